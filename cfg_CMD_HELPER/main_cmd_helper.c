@@ -39,6 +39,10 @@
 // --------------------------------------------------------------------------------
 
 #include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
 
 // --------------------------------------------------------------------------------
 
@@ -57,6 +61,32 @@
 
 // --------------------------------------------------------------------------------
 
+/**
+ * @brief Path of the command-socket of a running shcClient
+ * 
+ */
+#ifndef SHC_COMMAND_SOCKET_DEFAULT_PATH
+#define SHC_COMMAND_SOCKET_DEFAULT_PATH         "/tmp/shc_client_command.sock"
+#endif
+
+/**
+ * @brief Maximum length of a request / response of the command-socket
+ * 
+ */
+#define SHC_COMMAND_SOCKET_LINE_MAX_LENGTH      256
+
+// --------------------------------------------------------------------------------
+
+/*!
+ *
+ */
+static u8 main_shc_client_send(const char* p_request, char* p_response, u16 max_length);
+
+/*!
+ *
+ */
+static void main_shc_client_print_response(const char* p_response);
+
 /*!
  *
  */
@@ -123,10 +153,30 @@ SIGNAL_SLOT_INTERFACE_CREATE_SLOT(CLI_NO_ARGUMENT_GIVEN_SIGNAL, MAIN_CLI_NO_ARGU
  */
 static u8 exit_program = 0;
 
+/**
+ * @brief Is set to 1 if the command was processed by a running shcClient
+ * 
+ */
+static u8 forwarded_to_shc_client = 0;
+
 // --------------------------------------------------------------------------------
 
 int main(int argc, char* argv[]) {
 
+    if (argc == 3 && strcmp(argv[1], "-command") == 0) {
+
+        // named command of the command-file of the shcClient
+        char response[SHC_COMMAND_SOCKET_LINE_MAX_LENGTH];
+
+        if (main_shc_client_send(argv[2], response, sizeof(response)) == 0) {
+            printf("shcClient is not running !\n");
+            return 1;
+        }
+
+        main_shc_client_print_response(response);
+        return 0;
+    }
+
     ATOMIC_OPERATION
     (
         initialization();
@@ -161,6 +211,11 @@ int main(int argc, char* argv[]) {
 
     command_line_interface(argc, argv);
 
+    if (forwarded_to_shc_client) {
+        DEBUG_PASS("main() - command processed by shcClient");
+        return 0;
+    }
+
     if (exit_program) {
         DEBUG_PASS("main() - PROGRAM EXIT REQUESTED !!! ---");
         return 1;
@@ -185,6 +240,84 @@ int main(int argc, char* argv[]) {
 
 // --------------------------------------------------------------------------------
 
+/**
+ * @brief Sends a single request to the command-socket of a running shcClient
+ * and waits for its response.
+ * 
+ * @param p_request zero-terminated request without line-feed
+ * @param p_response buffer for the zero-terminated response without line-feed
+ * @param max_length size of p_response
+ * @return 1 if the shcClient has answered, otherwise 0
+ */
+static u8 main_shc_client_send(const char* p_request, char* p_response, u16 max_length) {
+
+    struct sockaddr_un address;
+    memset(&address, 0x00, sizeof(address));
+
+    address.sun_family = AF_UNIX;
+    snprintf(address.sun_path, sizeof(address.sun_path), "%s", SHC_COMMAND_SOCKET_DEFAULT_PATH);
+
+    int handle = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (handle < 0) {
+        return 0;
+    }
+
+    if (connect(handle, (struct sockaddr*)&address, sizeof(address)) != 0) {
+        // shcClient is not running
+        close(handle);
+        return 0;
+    }
+
+    char line[SHC_COMMAND_SOCKET_LINE_MAX_LENGTH];
+    int length = snprintf(line, sizeof(line), "%s\n", p_request);
+
+    if (length >= (int)sizeof(line) || send(handle, line, (size_t)length, MSG_NOSIGNAL) != (ssize_t)length) {
+        close(handle);
+        return 0;
+    }
+
+    length = 0;
+
+    while (length < (int)max_length - 1) {
+
+        ssize_t count = recv(handle, p_response + length, max_length - 1 - (size_t)length, 0);
+        if (count <= 0) {
+            break;
+        }
+
+        length += (int)count;
+
+        if (memchr(p_response, '\n', (size_t)length) != NULL) {
+            break;
+        }
+    }
+
+    close(handle);
+
+    p_response[length] = '\0';
+    p_response[strcspn(p_response, "\r\n")] = '\0';
+
+    return length != 0 ? 1 : 0;
+}
+
+/**
+ * @brief Prints the response of the shcClient
+ * 
+ * @param p_response zero-terminated response, e.g. OK 020100
+ */
+static void main_shc_client_print_response(const char* p_response) {
+
+    if (strncmp(p_response, "OK", 2) == 0) {
+        printf("Response:\n%s\n", p_response[2] == ' ' ? p_response + 3 : "");
+    } else if (strcmp(p_response, "TIMEOUT") == 0) {
+        printf("TIMEOUT !\n");
+    } else {
+        printf("shcClient: %s\n", p_response);
+    }
+}
+
+// --------------------------------------------------------------------------------
+
 static void main_RPI_HOST_RESPONSE_RECEIVED_SLOT_CALLBACK(const void* p_argument) {
 
     if (p_argument == NULL) {
@@ -225,6 +358,30 @@ static void main_RPI_HOST_COMMAND_RECEIVED_SLOT_CALLBACK(const void* p_argument)
 
     lcd_write_line("CMD-Helper");
     lcd_write_line("- command OK");
+
+    char request[SHC_COMMAND_SOCKET_LINE_MAX_LENGTH];
+    char response[SHC_COMMAND_SOCKET_LINE_MAX_LENGTH];
+
+    if (p_buffer->length * 2 + 5 > sizeof(request)) {
+        return;
+    }
+
+    u16 length = (u16)snprintf(request, sizeof(request), "com:");
+    u16 i = 0;
+
+    for ( ; i < p_buffer->length ; i++) {
+        length += (u16)snprintf(request + length, sizeof(request) - length, "%02X", p_buffer->data[i]);
+    }
+
+    if (main_shc_client_send(request, response, sizeof(response)) == 0) {
+        // no shcClient running, the command is sent by this program
+        return;
+    }
+
+    main_shc_client_print_response(response);
+
+    forwarded_to_shc_client = 1;
+    exit_program = 1;
 }
 
 static void main_RPI_HOST_TIMEOUT_SLOT_CALLBACK(const void* p_argument) {
@@ -278,6 +435,9 @@ static void main_CLI_HELP_REQUESTED_SLOT_CALLBACK(const void* p_argument) {
     console_new_line();
 
     console_write_line("Usage: cmdHelper -remote <REMOTE-COMMAND>");
+    console_write_line("       cmdHelper -command <NAME>   (command-file of the shcClient)");
+    console_new_line();
+    console_write_line("If the shcClient is running, the command is sent via its command-socket.");
     console_new_line();
     console_write_line("Available <REMOTE-COMMAND>'s:");
     console_new_line();
@@ -37,6 +37,8 @@
 // --------------------------------------------------------------------------------
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 // --------------------------------------------------------------------------------
 
@@ -51,24 +53,256 @@
 
 #include "ui/command_line/command_line_interface.h"
 #include "ui/console/ui_console.h"
-#include "ui/lcd/ui_lcd_interface.h"
 #include "ui/cfg_file_parser/cfg_file_parser.h"
-#include "ui/log_interface/log_interface.h"
+
+// --------------------------------------------------------------------------------
+
+#include "shc_event_loop.h"
+#include "shc_log_interface.h"
+#include "shc_command_table.h"
+#include "shc_host_board.h"
+#include "shc_msg_executer.h"
+#include "shc_event_line.h"
+#include "shc_cli_executer.h"
+#include "shc_mqtt_interface.h"
+#include "shc_metrics.h"
+#include "shc_command_socket.h"
+#include "shc_cfg_reload.h"
+#include "shc_task_profiler.h"
+#include "shc_lcd_interface.h"
 
 // --------------------------------------------------------------------------------
 
 #define MAIN_STATUS_EXIT_PROGRAM        (1 << 0)
 #define MAIN_STATUS_CONSOLE_ACTIVE      (1 << 1)
 #define MAIN_STATUS_CFG_FILE_SET        (1 << 2)
+#define MAIN_STATUS_TASK_STATISTIC      (1 << 3)
 
 BUILD_MODULE_STATUS_U8(MAIN_STATUS)
 
 // --------------------------------------------------------------------------------
 
+/**
+ * @brief Maximum length of a single statistic log-line
+ *
+ */
+#define MAIN_STATISTIC_MESSAGE_MAX_LENGTH   256
+
+// --------------------------------------------------------------------------------
+
 TIME_MGMN_BUILD_STATIC_TIMER_U32(MAIN_TIMER)
 
 // --------------------------------------------------------------------------------
 
+/**
+ * @brief Interval of the event-loop statistic in the log-file.
+ * Set by SCHEDULE_STATISTIC_INTERVAL_MS, 0 disables the statistic.
+ *
+ */
+static u32 statistic_interval_ms = 0;
+
+/**
+ * @brief Point in time of the last statistic log-entry
+ *
+ */
+static u64 statistic_timestamp_us = 0;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Writes the actual statistic of the event-loop into the log-file
+ * and onto the console if the console is active. Latency is the time
+ * between a wakeup request and the next dispatch of the main-loop.
+ * Comparing the output of SCHEDULE_MODE=EVENT and SCHEDULE_MODE=POLLING
+ * gives the idle cpu-load of both modes.
+ *
+ */
+static void main_write_statistic(void) {
+
+    SHC_EVENT_LOOP_STATISTIC loop_statistic;
+    shc_event_loop_get_statistic(&loop_statistic);
+
+    u32 cpu_load_permille = 0;
+    if (loop_statistic.runtime_ms != 0) {
+        cpu_load_permille = (u32)(((u64)loop_statistic.cpu_time_ms * 1000ULL) / loop_statistic.runtime_ms);
+    }
+
+    u32 timer_latency_avg_us = 0;
+    if (loop_statistic.timer.count != 0) {
+        timer_latency_avg_us = (u32)(loop_statistic.timer.latency_sum_us / loop_statistic.timer.count);
+    }
+
+    u32 wakeup_latency_avg_us = 0;
+    if (loop_statistic.wakeup.count != 0) {
+        wakeup_latency_avg_us = (u32)(loop_statistic.wakeup.latency_sum_us / loop_statistic.wakeup.count);
+    }
+
+    char message[MAIN_STATISTIC_MESSAGE_MAX_LENGTH];
+    snprintf(message, sizeof(message),
+        "mode:%s cpu:%u.%u%% loops:%llu timer:%u (avg:%uus max:%uus) wakeup:%u (avg:%uus max:%uus) fd:%u",
+        shc_event_loop_get_mode() == SHC_EVENT_LOOP_MODE_EVENT ? "EVENT" : "POLLING",
+        cpu_load_permille / 10, cpu_load_permille % 10,
+        (unsigned long long)loop_statistic.loop_count,
+        loop_statistic.timer.count, timer_latency_avg_us, loop_statistic.timer.latency_max_us,
+        loop_statistic.wakeup.count, wakeup_latency_avg_us, loop_statistic.wakeup.latency_max_us,
+        loop_statistic.fd_count
+    );
+
+    SHC_LOG_INTERFACE_STATISTIC log_statistic;
+    shc_log_interface_get_statistic(&log_statistic);
+
+    char log_message_text[MAIN_STATISTIC_MESSAGE_MAX_LENGTH];
+    snprintf(log_message_text, sizeof(log_message_text),
+        "written:%u dropped:%u (no file:%u) errors:%u writev:%u depth:%u high-water:%u",
+        log_statistic.written, log_statistic.dropped, log_statistic.dropped_without_file, log_statistic.write_errors,
+        log_statistic.write_calls, log_statistic.queue_depth, log_statistic.queue_high_water
+    );
+
+    if (MAIN_STATUS_is_set(MAIN_STATUS_CONSOLE_ACTIVE)) {
+        console_write_number(MAIN_TIMER_elapsed());
+        console_write(" - ");
+        console_write_string("Statistic: ", message);
+        console_write_number(MAIN_TIMER_elapsed());
+        console_write(" - ");
+        console_write_string("Log: ", log_message_text);
+    }
+
+    SHC_LCD_INTERFACE_STATISTIC lcd_statistic;
+    shc_lcd_interface_get_statistic(&lcd_statistic);
+
+    char lcd_message_text[MAIN_STATISTIC_MESSAGE_MAX_LENGTH];
+    snprintf(lcd_message_text, sizeof(lcd_message_text),
+        "written:%u refreshed:%u (max:%uus) write max:%uus",
+        lcd_statistic.written, lcd_statistic.refreshed,
+        lcd_statistic.refresh_max_us, lcd_statistic.write_max_us
+    );
+
+    if (MAIN_STATUS_is_set(MAIN_STATUS_CONSOLE_ACTIVE)) {
+        console_write_number(MAIN_TIMER_elapsed());
+        console_write(" - ");
+        console_write_string("LCD: ", lcd_message_text);
+    }
+
+    SHC_EVENT_LINE_STATISTIC line_statistic;
+    shc_event_line_get_statistic(&line_statistic);
+
+    u32 line_latency_avg_us = 0;
+    if (line_statistic.publish_count != 0) {
+        line_latency_avg_us = (u32)(line_statistic.latency_sum_us / line_statistic.publish_count);
+    }
+
+    char line_message_text[MAIN_STATISTIC_MESSAGE_MAX_LENGTH];
+    snprintf(line_message_text, sizeof(line_message_text),
+        "active:%u edges:%u published:%u (avg:%uus max:%uus)",
+        line_statistic.active, line_statistic.edge_count, line_statistic.publish_count,
+        line_latency_avg_us, line_statistic.latency_max_us
+    );
+
+    if (MAIN_STATUS_is_set(MAIN_STATUS_CONSOLE_ACTIVE)) {
+        console_write_number(MAIN_TIMER_elapsed());
+        console_write(" - ");
+        console_write_string("Event-Line: ", line_message_text);
+    }
+
+    SHC_MQTT_INTERFACE_STATISTIC mqtt_statistic;
+    shc_mqtt_interface_get_statistic(&mqtt_statistic);
+
+    u32 mqtt_latency_avg_us = 0;
+    if (mqtt_statistic.published != 0) {
+        mqtt_latency_avg_us = (u32)(mqtt_statistic.latency_sum_us / mqtt_statistic.published);
+    }
+
+    char mqtt_message_text[MAIN_STATISTIC_MESSAGE_MAX_LENGTH];
+    snprintf(mqtt_message_text, sizeof(mqtt_message_text),
+        "published:%u (avg:%uus max:%uus) coalesced:%u dropped:%u failed:%u depth:%u high-water:%u in-flight:%u",
+        mqtt_statistic.published, mqtt_latency_avg_us, mqtt_statistic.latency_max_us,
+        mqtt_statistic.coalesced, mqtt_statistic.dropped, mqtt_statistic.failed,
+        mqtt_statistic.queue_depth, mqtt_statistic.queue_high_water, mqtt_statistic.inflight_high_water
+    );
+
+    if (MAIN_STATUS_is_set(MAIN_STATUS_CONSOLE_ACTIVE)) {
+        console_write_number(MAIN_TIMER_elapsed());
+        console_write(" - ");
+        console_write_string("MQTT: ", mqtt_message_text);
+    }
+
+    char latency_message_text[MAIN_STATISTIC_MESSAGE_MAX_LENGTH];
+    snprintf(latency_message_text, sizeof(latency_message_text),
+        "total p50:%uus p99:%uus host p50:%uus p99:%uus publish p50:%uus p99:%uus queue-wait p99 interactive:%uus event:%uus report:%uus",
+        shc_metrics_get_quantile_us(SHC_METRICS_STAGE_TOTAL, 500), shc_metrics_get_quantile_us(SHC_METRICS_STAGE_TOTAL, 990),
+        shc_metrics_get_quantile_us(SHC_METRICS_STAGE_HOST, 500), shc_metrics_get_quantile_us(SHC_METRICS_STAGE_HOST, 990),
+        shc_metrics_get_quantile_us(SHC_METRICS_STAGE_PUBLISH, 500), shc_metrics_get_quantile_us(SHC_METRICS_STAGE_PUBLISH, 990),
+        shc_metrics_get_queue_wait_quantile_us(SHC_MSG_EXECUTER_PRIORITY_INTERACTIVE, 990),
+        shc_metrics_get_queue_wait_quantile_us(SHC_MSG_EXECUTER_PRIORITY_EVENT, 990),
+        shc_metrics_get_queue_wait_quantile_us(SHC_MSG_EXECUTER_PRIORITY_REPORT, 990)
+    );
+
+    if (MAIN_STATUS_is_set(MAIN_STATUS_CONSOLE_ACTIVE)) {
+        console_write_number(MAIN_TIMER_elapsed());
+        console_write(" - ");
+        console_write_string("Latency: ", latency_message_text);
+    }
+
+    log_message_string("Statistic: ", message);
+    log_message_string("Log: ", log_message_text);
+    log_message_string("LCD: ", lcd_message_text);
+    log_message_string("Event-Line: ", line_message_text);
+    log_message_string("MQTT: ", mqtt_message_text);
+    log_message_string("Latency: ", latency_message_text);
+}
+
+/**
+ * @brief Writes the run-time statistic of every task of the main-loop
+ * into the log-file and on stdout if -stats was given.
+ *
+ */
+static void main_write_task_statistic(void) {
+
+    #if SHC_TASK_PROFILER_ENABLED
+    {
+        u8 i = 0;
+        for ( ; i < SHC_TASK_PROFILER_NUM_TASKS ; i++) {
+
+            char task_message_text[MAIN_STATISTIC_MESSAGE_MAX_LENGTH];
+            shc_task_profiler_format(i, task_message_text, sizeof(task_message_text));
+
+            if (MAIN_STATUS_is_set(MAIN_STATUS_TASK_STATISTIC)) {
+                printf("Task: %s\n", task_message_text);
+            }
+
+            log_message_string("Task: ", task_message_text);
+        }
+
+        if (MAIN_STATUS_is_set(MAIN_STATUS_TASK_STATISTIC)) {
+            fflush(stdout);
+        }
+    }
+    #endif
+}
+
+/**
+ * @brief Writes the statistic of the event-loop if the
+ * statistic-interval has expired.
+ *
+ */
+static void main_statistic_task(void) {
+
+    if (statistic_interval_ms == 0) {
+        return;
+    }
+
+    u64 now_us = shc_event_loop_time_us();
+
+    if (now_us - statistic_timestamp_us >= (u64)statistic_interval_ms * 1000ULL) {
+        statistic_timestamp_us = now_us;
+        main_write_statistic();
+    }
+
+    shc_event_loop_set_deadline(statistic_interval_ms - (u32)((now_us - statistic_timestamp_us) / 1000ULL));
+}
+
+// --------------------------------------------------------------------------------
+
 /**
  * @brief 
  * 
@@ -82,6 +316,7 @@ static void main_CLI_HELP_REQUESTED_SLOT_CALLBACK(const void* p_argument) {
     console_write_line("-file <cfg_file_path>   : using <cfg_file_path> for program configuration");
     console_write_line("-lcd                    : Enables 16x2 LCD dispaly-driver");
     console_write_line("-console                : Enables program output on console");
+    console_write_line("-stats                  : Prints the run-time of every task on SIGUSR1 and on exit");
     console_write_line("-help / -h              : showing this help");
 
     MAIN_STATUS_set(MAIN_STATUS_EXIT_PROGRAM);
@@ -131,8 +366,8 @@ static void main_CLI_INVALID_PARAMETER_SLOT_CALLBACK(const void* p_argument) {
 
     }
     
-    lcd_write_line("SHC");
-    lcd_write_line("- inv parameter");
+    shc_lcd_write_line("SHC");
+    shc_lcd_write_line("- inv parameter");
 
     main_CLI_HELP_REQUESTED_SLOT_CALLBACK(NULL);
 }
@@ -154,8 +389,7 @@ static void main_CLI_LCD_ACTIVATED_SLOT_CALLBACK(const void* p_argument) {
     
     log_message("LCD activated");
 
-    lcd_init();
-    lcd_set_enabled(1);
+    shc_lcd_interface_enable();
 }
 
 /**
@@ -247,6 +481,8 @@ static void main_CLI_EXECUTER_COMMAND_NOT_FOUND_CALLBACK(const void* p_argument)
 static void main_CLI_EXECUTER_COMMAND_RECEIVED_SLOT_CALLBACK(const void* p_argument) {
     DEBUG_PASS("main_CLI_EXECUTER_COMMAND_RECEIVED_SLOT_CALLBACK()");
 
+    shc_event_loop_activity();
+
     if (MAIN_STATUS_is_set(MAIN_STATUS_CONSOLE_ACTIVE)) {
         console_write_number(MAIN_TIMER_elapsed());
         console_write(" - ");
@@ -332,6 +568,8 @@ static void main_MQTT_MESSAGE_RECEIVED_CALLBACK(const void* p_argument) {
 
     DEBUG_TRACE_STR((const char*) p_argument, "main_MQTT_MESSAGE_RECEIVED_CALLBACK()");
 
+    shc_event_loop_activity();
+
     if (MAIN_STATUS_is_set(MAIN_STATUS_CONSOLE_ACTIVE)) {
         console_write_number(MAIN_TIMER_elapsed());
         console_write(" - ");
@@ -490,6 +728,58 @@ static void main_MSG_EXECUTER_RESPONSE_RECEIVED_SLOT_CALLBACK(const void* p_argu
     log_message_string("Command successful - response:", (const char*)p_argument);
 }
 
+/**
+ * @brief Is called after the command-table has been (re-)loaded
+ * 
+ * @param p_argument the new table of type SHC_COMMAND_TABLE
+ */
+static void main_COMMAND_TABLE_LOADED_SLOT_CALLBACK(const void* p_argument) {
+
+    if (p_argument == NULL) {
+        DEBUG_PASS("main_COMMAND_TABLE_LOADED_SLOT_CALLBACK() - NULL_POINTER_EXCEPTION");
+        return;
+    }
+
+    const SHC_COMMAND_TABLE* p_table = (const SHC_COMMAND_TABLE*)p_argument;
+
+    char message[MAIN_STATISTIC_MESSAGE_MAX_LENGTH];
+    snprintf(message, sizeof(message), "generation:%u commands:%u reports:%u events:%u",
+        p_table->generation, p_table->num_entries, p_table->num_reports, p_table->num_events
+    );
+
+    if (MAIN_STATUS_is_set(MAIN_STATUS_CONSOLE_ACTIVE)) {
+        console_write_number(MAIN_TIMER_elapsed());
+        console_write(" - ");
+        console_write_string("Command-table loaded: ", message);
+    }
+
+    log_message_string("Command-table loaded - ", message);
+}
+
+/**
+ * @brief The configuration-file was reloaded after SIGHUP
+ *
+ * @param p_argument number of changed configuration-objects as const u16*
+ */
+static void main_CFG_RELOAD_COMPLETE_SLOT_CALLBACK(const void* p_argument) {
+
+    if (p_argument == NULL) {
+        DEBUG_PASS("main_CFG_RELOAD_COMPLETE_SLOT_CALLBACK() - NULL_POINTER_EXCEPTION");
+        return;
+    }
+
+    char message[MAIN_STATISTIC_MESSAGE_MAX_LENGTH];
+    snprintf(message, sizeof(message), "changed:%u", *(const u16*)p_argument);
+
+    if (MAIN_STATUS_is_set(MAIN_STATUS_CONSOLE_ACTIVE)) {
+        console_write_number(MAIN_TIMER_elapsed());
+        console_write(" - ");
+        console_write_string("Configuration reloaded: ", message);
+    }
+
+    log_message_string("Configuration reloaded - ", message);
+}
+
 /**
  * @brief 
  * 
@@ -499,6 +789,8 @@ static void main_RPI_HOST_COMMAND_RECEIVED_SLOT_CALLBACK(const void* p_argument)
 
     DEBUG_PASS("main_RPI_HOST_COMMAND_RECEIVED_SLOT_CALLBACK()");
 
+    shc_event_loop_activity();
+
     if (MAIN_STATUS_is_set(MAIN_STATUS_CONSOLE_ACTIVE)) {
         console_write_number(MAIN_TIMER_elapsed());
         console_write(" - ");
@@ -526,8 +818,51 @@ static void main_RPI_HOST_RESPONSE_TIMEOUT_SLOT_CALLBACK(const void* p_argument)
     log_message("Timeout on receiving response from control-board");
 }
 
+/**
+ * @brief Takes the scheduling parameters of the main-loop
+ * from the configuration-file.
+ *
+ *  SCHEDULE_MODE=EVENT|POLLING
+ *  SCHEDULE_MAX_IDLE_MS=<time_ms>
+ *  SCHEDULE_STATISTIC_INTERVAL_MS=<time_ms>
+ * 
+ * @param p_argument the configuration object of type CFG_FILE_PARSER_CFG_OBJECT_TYPE
+ */
+static void main_CFG_OBJECT_RECEIVED_SLOT_CALLBACK(const void* p_argument) {
+
+    if (p_argument == NULL) {
+        DEBUG_PASS("main_CFG_OBJECT_RECEIVED_SLOT_CALLBACK() - NULL_POINTER_EXCEPTION");
+        return;
+    }
+
+    const CFG_FILE_PARSER_CFG_OBJECT_TYPE* p_cfg_obj = (const CFG_FILE_PARSER_CFG_OBJECT_TYPE*)p_argument;
+
+    if (strcmp(p_cfg_obj->key, "SCHEDULE_MODE") == 0) {
+
+        DEBUG_TRACE_STR(p_cfg_obj->value, "main_CFG_OBJECT_RECEIVED_SLOT_CALLBACK() - SCHEDULE_MODE");
+
+        if (strcmp(p_cfg_obj->value, "POLLING") == 0) {
+            shc_event_loop_set_mode(SHC_EVENT_LOOP_MODE_POLLING);
+        } else {
+            shc_event_loop_set_mode(SHC_EVENT_LOOP_MODE_EVENT);
+        }
+
+    } else if (strcmp(p_cfg_obj->key, "SCHEDULE_MAX_IDLE_MS") == 0) {
+
+        DEBUG_TRACE_STR(p_cfg_obj->value, "main_CFG_OBJECT_RECEIVED_SLOT_CALLBACK() - SCHEDULE_MAX_IDLE_MS");
+        shc_event_loop_set_max_idle_time((u32)strtoul(p_cfg_obj->value, NULL, 10));
+
+    } else if (strcmp(p_cfg_obj->key, "SCHEDULE_STATISTIC_INTERVAL_MS") == 0) {
+
+        DEBUG_TRACE_STR(p_cfg_obj->value, "main_CFG_OBJECT_RECEIVED_SLOT_CALLBACK() - SCHEDULE_STATISTIC_INTERVAL_MS");
+        statistic_interval_ms = (u32)strtoul(p_cfg_obj->value, NULL, 10);
+    }
+}
+
 // --------------------------------------------------------------------------------
 
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(CFG_PARSER_NEW_CFG_OBJECT_SIGNAL, MAIN_CFG_OBJECT_RECEIVED_SLOT, main_CFG_OBJECT_RECEIVED_SLOT_CALLBACK)
+
 SIGNAL_SLOT_INTERFACE_CREATE_SLOT(CLI_CONFIGURATION_SIGNAL, MAIN_CLI_CONFIGURATION_SIGNAL_SLOT, main_CLI_CONFIGURATION_SLOT_CALLBACK)
 SIGNAL_SLOT_INTERFACE_CREATE_SLOT(CLI_HELP_REQUESTED_SIGNAL, MAIN_CLI_HELP_REQUESTED_SLOT, main_CLI_HELP_REQUESTED_SLOT_CALLBACK)
 SIGNAL_SLOT_INTERFACE_CREATE_SLOT(CLI_INVALID_PARAMETER_SIGNAL, MAIN_CLI_INVALID_PARAMETER_SLOT, main_CLI_INVALID_PARAMETER_SLOT_CALLBACK)
@@ -553,12 +888,44 @@ SIGNAL_SLOT_INTERFACE_CREATE_SLOT(MSG_EXECUTER_RESPONSE_TIMEOUT_SIGNAL, MAIN_MSG
 SIGNAL_SLOT_INTERFACE_CREATE_SLOT(MSG_EXECUTER_INVALID_COMMAND_SIGNAL, MAIN_MSG_EXECUTER_INVALID_COMMAND_SLOT, main_MSG_EXECUTER_INVALID_COMMAND_SLOT_CALLBACK)
 SIGNAL_SLOT_INTERFACE_CREATE_SLOT(MSG_EXECUTER_INVALID_COMMAND_SYNTAX_SIGNAL, MAIN_MSG_EXECUTER_INVALID_COMMAND_SYNTAX_SLOT, main_MSG_EXECUTER_INVALID_COMMAND_SYNTAX_SLOT_CALLBACK)
 SIGNAL_SLOT_INTERFACE_CREATE_SLOT(MSG_EXECUTER_RESPONSE_RECEIVED_SIGNAL, MAIN_MSG_EXECUTER_RESPONSE_RECEIVED_SLOT, main_MSG_EXECUTER_RESPONSE_RECEIVED_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(SHC_COMMAND_TABLE_LOADED_SIGNAL, MAIN_COMMAND_TABLE_LOADED_SLOT, main_COMMAND_TABLE_LOADED_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(SHC_CFG_RELOAD_COMPLETE_SIGNAL, MAIN_CFG_RELOAD_COMPLETE_SLOT, main_CFG_RELOAD_COMPLETE_SLOT_CALLBACK)
 
 SIGNAL_SLOT_INTERFACE_CREATE_SLOT(RPI_HOST_COMMAND_RECEIVED_SIGNAL, MAIN_RPI_HOST_COMMAND_RECEIVED_SLOT, main_RPI_HOST_COMMAND_RECEIVED_SLOT_CALLBACK)
 SIGNAL_SLOT_INTERFACE_CREATE_SLOT(RPI_HOST_RESPONSE_TIMEOUT_SIGNAL, MAIN_RPI_HOST_RESPONSE_TIMEOUT_SLOT, main_RPI_HOST_RESPONSE_TIMEOUT_SLOT_CALLBACK)
 
 // --------------------------------------------------------------------------------
 
+/**
+ * @brief Removes the arguments that are handled by the shcClient itself,
+ * all other arguments are given to the command-line-interface of the framework.
+ *
+ * @param argc number of arguments
+ * @param argv the arguments, modified in place
+ * @return number of remaining arguments
+ */
+static int main_filter_arguments(int argc, char* argv[]) {
+
+    int count = 0;
+
+    int i = 0;
+    for ( ; i < argc ; i++) {
+
+        if (i != 0 && strcmp(argv[i], "-stats") == 0) {
+            MAIN_STATUS_set(MAIN_STATUS_TASK_STATISTIC);
+            continue;
+        }
+
+        argv[count++] = argv[i];
+    }
+
+    if (count < argc) {
+        argv[count] = NULL;
+    }
+
+    return count;
+}
+
 /**
  * @brief 
  * 
@@ -576,6 +943,26 @@ int main(int argc, char* argv[]) {
     MAIN_STATUS_clear_all();
     MAIN_TIMER_start();
 
+    // blocks SIGHUP and SIGUSR1 before any thread is created
+    shc_cfg_reload_init();
+    shc_task_profiler_init();
+    shc_cli_executer_init();
+    shc_log_interface_init();
+    shc_lcd_interface_init();
+
+    if (shc_event_loop_init() == 0) {
+        DEBUG_PASS("main() - Initialize event-loop has FAILED - using polling mode");
+    }
+
+    shc_event_line_init();
+    shc_host_board_init();
+    shc_msg_executer_init();
+    shc_mqtt_interface_init();
+    shc_metrics_init();
+    shc_command_socket_init();
+
+    MAIN_CFG_OBJECT_RECEIVED_SLOT_connect();
+
     MAIN_CLI_HELP_REQUESTED_SLOT_connect();
     MAIN_CLI_INVALID_PARAMETER_SLOT_connect();
     MAIN_CLI_LCD_ACTIVATED_SLOT_connect();
@@ -599,10 +986,13 @@ int main(int argc, char* argv[]) {
     MAIN_MSG_EXECUTER_INVALID_COMMAND_SLOT_connect();
     MAIN_MSG_EXECUTER_INVALID_COMMAND_SYNTAX_SLOT_connect();
     MAIN_MSG_EXECUTER_RESPONSE_RECEIVED_SLOT_connect();
+    MAIN_COMMAND_TABLE_LOADED_SLOT_connect();
+    MAIN_CFG_RELOAD_COMPLETE_SLOT_connect();
 
     MAIN_RPI_HOST_COMMAND_RECEIVED_SLOT_connect();
     MAIN_RPI_HOST_RESPONSE_TIMEOUT_SLOT_connect();
 
+    argc = main_filter_arguments(argc, argv);
     command_line_interface(argc, argv);
 
     if (MAIN_STATUS_is_set(MAIN_STATUS_CONSOLE_ACTIVE)) {
@@ -622,11 +1012,12 @@ int main(int argc, char* argv[]) {
 
     if (MAIN_STATUS_is_set(MAIN_STATUS_EXIT_PROGRAM)) {
         DEBUG_PASS("main() - initialization FAILED !!! --- ");
+        shc_lcd_interface_deinit();
         return 1;
     }
 
-    lcd_write_line("SHC");
-    lcd_write_line("... started");
+    shc_lcd_write_line("SHC");
+    shc_lcd_write_line("... started");
 
     for (;;) {
 
@@ -634,10 +1025,47 @@ int main(int argc, char* argv[]) {
             break;
         }
         
-        mcu_task_controller_schedule();
-        mcu_task_controller_background_run();
-        watchdog();
+        SHC_TASK_PROFILER_RUN(SHC_TASK_PROFILER_TASK_FRAMEWORK, {
+            mcu_task_controller_schedule();
+            mcu_task_controller_background_run();
+            watchdog();
+        });
+
+        SHC_TASK_PROFILER_RUN(SHC_TASK_PROFILER_TASK_CFG_RELOAD, shc_cfg_reload_task());
+        SHC_TASK_PROFILER_RUN(SHC_TASK_PROFILER_TASK_EVENT_LINE, shc_event_line_task());
+        SHC_TASK_PROFILER_RUN(SHC_TASK_PROFILER_TASK_HOST_BOARD, shc_host_board_task());
+        SHC_TASK_PROFILER_RUN(SHC_TASK_PROFILER_TASK_MSG_EXECUTER, shc_msg_executer_task());
+        SHC_TASK_PROFILER_RUN(SHC_TASK_PROFILER_TASK_CLI_EXECUTER, shc_cli_executer_task());
+        SHC_TASK_PROFILER_RUN(SHC_TASK_PROFILER_TASK_MQTT_INTERFACE, shc_mqtt_interface_task());
+        SHC_TASK_PROFILER_RUN(SHC_TASK_PROFILER_TASK_METRICS, shc_metrics_task());
+        SHC_TASK_PROFILER_RUN(SHC_TASK_PROFILER_TASK_COMMAND_SOCKET, shc_command_socket_task());
+        SHC_TASK_PROFILER_RUN(SHC_TASK_PROFILER_TASK_STATISTIC, main_statistic_task());
+
+        if (shc_task_profiler_task()) {
+            main_write_task_statistic();
+        }
+
+        shc_event_loop_wait();
     }
 
+    main_write_statistic();
+
+    if (MAIN_STATUS_is_set(MAIN_STATUS_TASK_STATISTIC)) {
+        main_write_task_statistic();
+    }
+
+    shc_command_socket_deinit();
+    shc_metrics_deinit();
+    shc_mqtt_interface_deinit();
+    shc_msg_executer_deinit();
+    shc_host_board_deinit();
+    shc_event_line_deinit();
+    shc_cli_executer_deinit();
+    shc_cfg_reload_deinit();
+    shc_task_profiler_deinit();
+    shc_event_loop_deinit();
+    shc_lcd_interface_deinit();
+    shc_log_interface_deinit();
+
     return 0;
 }
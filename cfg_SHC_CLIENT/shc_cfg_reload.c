@@ -0,0 +1,371 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_cfg_reload.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Implementation of the configuration-reload on SIGHUP
+ *
+ * @see     shc_cfg_reload.h
+ */
+
+#define TRACER_OFF
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "tracer.h"
+
+// --------------------------------------------------------------------------------
+
+#include "cpu.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/signalfd.h>
+
+// --------------------------------------------------------------------------------
+
+#include "common/signal_slot_interface.h"
+
+#include "ui/command_line/command_line_interface.h"
+#include "ui/cfg_file_parser/cfg_file_parser.h"
+
+// --------------------------------------------------------------------------------
+
+#include "shc_event_loop.h"
+#include "shc_cfg_reload.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Maximum number of remembered configuration-objects
+ *
+ */
+#ifndef SHC_CFG_RELOAD_MAX_OBJECTS
+#define SHC_CFG_RELOAD_MAX_OBJECTS                  64
+#endif
+
+/**
+ * @brief Maximum length of the key of a configuration-object
+ *
+ */
+#ifndef SHC_CFG_RELOAD_KEY_MAX_LENGTH
+#define SHC_CFG_RELOAD_KEY_MAX_LENGTH               48
+#endif
+
+/**
+ * @brief Maximum length of the value of a configuration-object
+ *
+ */
+#ifndef SHC_CFG_RELOAD_VALUE_MAX_LENGTH
+#define SHC_CFG_RELOAD_VALUE_MAX_LENGTH             128
+#endif
+
+/**
+ * @brief Maximum length of the path of the configuration-file
+ *
+ */
+#ifndef SHC_CFG_RELOAD_PATH_MAX_LENGTH
+#define SHC_CFG_RELOAD_PATH_MAX_LENGTH              256
+#endif
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief A configuration-object as it was applied by the modules
+ *
+ */
+typedef struct SHC_CFG_RELOAD_OBJECT_STRUCT {
+    char key[SHC_CFG_RELOAD_KEY_MAX_LENGTH];
+    char value[SHC_CFG_RELOAD_VALUE_MAX_LENGTH];
+} SHC_CFG_RELOAD_OBJECT;
+
+// --------------------------------------------------------------------------------
+
+static SHC_CFG_RELOAD_OBJECT object_list[SHC_CFG_RELOAD_MAX_OBJECTS];
+static u8 object_count = 0;
+
+/**
+ * @brief Path of the configuration-file, given by the command-line
+ *
+ */
+static char cfg_file_path[SHC_CFG_RELOAD_PATH_MAX_LENGTH];
+
+/**
+ * @brief Receives SIGHUP, watched by the event-loop
+ *
+ */
+static int signal_handle = -1;
+static u8 signal_registered = 0;
+
+/**
+ * @brief SIGHUP was received, the file is read by shc_cfg_reload_task()
+ *
+ */
+static u8 reload_pending = 0;
+
+/**
+ * @brief Argument of SHC_CFG_RELOAD_COMPLETE_SIGNAL
+ *
+ */
+static u16 change_count = 0;
+
+// --------------------------------------------------------------------------------
+
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(SHC_CFG_RELOAD_COMPLETE_SIGNAL)
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Get the remembered object of the given key
+ *
+ * @param p_key zero-terminated key
+ * @return the object or NULL if the key is unknown
+ */
+static SHC_CFG_RELOAD_OBJECT* shc_cfg_reload_find(const char* p_key) {
+
+    u8 i = 0;
+    for ( ; i < object_count ; i++) {
+        if (strcmp(object_list[i].key, p_key) == 0) {
+            return &object_list[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Remembers the value of the given key
+ *
+ * @param p_key zero-terminated key
+ * @param p_value zero-terminated value
+ */
+static void shc_cfg_reload_remember(const char* p_key, const char* p_value) {
+
+    SHC_CFG_RELOAD_OBJECT* p_object = shc_cfg_reload_find(p_key);
+
+    if (p_object == NULL) {
+
+        if (object_count == SHC_CFG_RELOAD_MAX_OBJECTS) {
+            DEBUG_TRACE_STR(p_key, "shc_cfg_reload_remember() - Too many configuration-objects");
+            return;
+        }
+
+        p_object = &object_list[object_count];
+        object_count += 1;
+
+        snprintf(p_object->key, sizeof(p_object->key), "%s", p_key);
+    }
+
+    snprintf(p_object->value, sizeof(p_object->value), "%s", p_value);
+}
+
+/**
+ * @brief Reads the configuration-file and sends every object
+ * whose value differs from the remembered one.
+ *
+ * @return number of sent objects
+ */
+static u16 shc_cfg_reload_read_file(void) {
+
+    FILE* p_file = fopen(cfg_file_path, "r");
+    if (p_file == NULL) {
+        DEBUG_TRACE_STR(cfg_file_path, "shc_cfg_reload_read_file() - Open file has FAILED !!! ---");
+        return 0;
+    }
+
+    char line[SHC_CFG_RELOAD_KEY_MAX_LENGTH + SHC_CFG_RELOAD_VALUE_MAX_LENGTH];
+    u16 count = 0;
+
+    while (fgets(line, sizeof(line), p_file) != NULL) {
+
+        line[strcspn(line, "\r\n")] = '\0';
+
+        if (line[0] == '\0' || line[0] == '#') {
+            continue;
+        }
+
+        char* p_value = strchr(line, '=');
+        if (p_value == NULL) {
+            continue;
+        }
+
+        *p_value = '\0';
+        p_value += 1;
+
+        const SHC_CFG_RELOAD_OBJECT* p_object = shc_cfg_reload_find(line);
+
+        if (p_object != NULL && strcmp(p_object->value, p_value) == 0) {
+            continue;
+        }
+
+        DEBUG_TRACE_STR(line, "shc_cfg_reload_read_file() - Changed:");
+
+        CFG_FILE_PARSER_CFG_OBJECT_TYPE cfg_object;
+        memset(&cfg_object, 0x00, sizeof(cfg_object));
+
+        snprintf(cfg_object.key, sizeof(cfg_object.key), "%s", line);
+        snprintf(cfg_object.value, sizeof(cfg_object.value), "%s", p_value);
+
+        // the object is remembered by our own slot
+        CFG_PARSER_NEW_CFG_OBJECT_SIGNAL_send(&cfg_object);
+        count += 1;
+    }
+
+    fclose(p_file);
+
+    return count;
+}
+
+/**
+ * @brief Is called by the event-loop if SIGHUP was received.
+ * Several signals in a row are handled by a single reload.
+ *
+ * @param fd the signalfd
+ * @param p_context not used
+ */
+static void shc_cfg_reload_signal_callback(int fd, void* p_context) {
+
+    (void) p_context;
+
+    struct signalfd_siginfo signal_info;
+
+    while (read(fd, &signal_info, sizeof(signal_info)) == sizeof(signal_info)) {
+        DEBUG_TRACE_long(signal_info.ssi_pid, "shc_cfg_reload_signal_callback() - SIGHUP from pid:");
+        reload_pending = 1;
+    }
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Remembers the path of the configuration-file
+ *
+ * @param p_argument zero-terminated path of the configuration-file
+ */
+static void shc_cfg_reload_CLI_CONFIGURATION_SLOT_CALLBACK(const void* p_argument) {
+
+    if (p_argument == NULL) {
+        DEBUG_PASS("shc_cfg_reload_CLI_CONFIGURATION_SLOT_CALLBACK() - NULL_POINTER_EXCEPTION");
+        return;
+    }
+
+    snprintf(cfg_file_path, sizeof(cfg_file_path), "%s", (const char*)p_argument);
+}
+
+/**
+ * @brief Remembers every configuration-object that was applied by the modules
+ *
+ * @param p_argument the configuration object of type CFG_FILE_PARSER_CFG_OBJECT_TYPE
+ */
+static void shc_cfg_reload_CFG_OBJECT_RECEIVED_SLOT_CALLBACK(const void* p_argument) {
+
+    if (p_argument == NULL) {
+        DEBUG_PASS("shc_cfg_reload_CFG_OBJECT_RECEIVED_SLOT_CALLBACK() - NULL_POINTER_EXCEPTION");
+        return;
+    }
+
+    const CFG_FILE_PARSER_CFG_OBJECT_TYPE* p_cfg_obj = (const CFG_FILE_PARSER_CFG_OBJECT_TYPE*)p_argument;
+    shc_cfg_reload_remember(p_cfg_obj->key, p_cfg_obj->value);
+}
+
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(CLI_CONFIGURATION_SIGNAL, SHC_CFG_RELOAD_CLI_CONFIGURATION_SLOT, shc_cfg_reload_CLI_CONFIGURATION_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(CFG_PARSER_NEW_CFG_OBJECT_SIGNAL, SHC_CFG_RELOAD_CFG_OBJECT_RECEIVED_SLOT, shc_cfg_reload_CFG_OBJECT_RECEIVED_SLOT_CALLBACK)
+
+// --------------------------------------------------------------------------------
+
+void shc_cfg_reload_init(void) {
+
+    DEBUG_PASS("shc_cfg_reload_init()");
+
+    SHC_CFG_RELOAD_COMPLETE_SIGNAL_init();
+
+    memset(object_list, 0x00, sizeof(object_list));
+    object_count = 0;
+    reload_pending = 0;
+
+    sigset_t signal_mask;
+    sigemptyset(&signal_mask);
+    sigaddset(&signal_mask, SIGHUP);
+
+    // inherited by every thread that is created afterwards
+    pthread_sigmask(SIG_BLOCK, &signal_mask, NULL);
+
+    signal_handle = signalfd(-1, &signal_mask, SFD_NONBLOCK | SFD_CLOEXEC);
+    if (signal_handle < 0) {
+        DEBUG_PASS("shc_cfg_reload_init() - Create signalfd has FAILED !!! ---");
+    }
+
+    SHC_CFG_RELOAD_CLI_CONFIGURATION_SLOT_connect();
+    SHC_CFG_RELOAD_CFG_OBJECT_RECEIVED_SLOT_connect();
+}
+
+void shc_cfg_reload_deinit(void) {
+
+    DEBUG_PASS("shc_cfg_reload_deinit()");
+
+    if (signal_handle < 0) {
+        return;
+    }
+
+    if (signal_registered) {
+        shc_event_loop_remove_fd(signal_handle);
+        signal_registered = 0;
+    }
+
+    close(signal_handle);
+    signal_handle = -1;
+}
+
+void shc_cfg_reload_task(void) {
+
+    if (signal_handle >= 0 && signal_registered == 0) {
+
+        // the event-loop is initialized after the signalfd was created
+        if (shc_event_loop_add_fd(signal_handle, shc_cfg_reload_signal_callback, NULL)) {
+            signal_registered = 1;
+        } else {
+            shc_cfg_reload_signal_callback(signal_handle, NULL);
+        }
+    }
+
+    if (reload_pending == 0) {
+        return;
+    }
+
+    reload_pending = 0;
+
+    if (cfg_file_path[0] == '\0') {
+        DEBUG_PASS("shc_cfg_reload_task() - No configuration-file given");
+        return;
+    }
+
+    DEBUG_TRACE_STR(cfg_file_path, "shc_cfg_reload_task() - Reloading:");
+
+    change_count = shc_cfg_reload_read_file();
+    SHC_CFG_RELOAD_COMPLETE_SIGNAL_send(&change_count);
+}
+
+// --------------------------------------------------------------------------------
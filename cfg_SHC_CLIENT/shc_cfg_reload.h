@@ -0,0 +1,87 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_cfg_reload.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Reloads the configuration-file on SIGHUP.
+ *
+ *          All configuration-objects of the configuration-parser are
+ *          remembered. On SIGHUP the configuration-file is read again
+ *          and only the objects whose value has changed are sent via
+ *          CFG_PARSER_NEW_CFG_OBJECT_SIGNAL. Every module applies them
+ *          the same way as on startup, e.g. the MQTT-client only
+ *          reconnects if MQTT_HOST_ADDRESS or MQTT_CLIENT_ID has changed.
+ *          Afterwards SHC_CFG_RELOAD_COMPLETE_SIGNAL is sent and the
+ *          command-, report-, event- and execute-file are reloaded.
+ *
+ *          Queued requests and messages are not touched by a reload.
+ *          Removed keys keep their actual value until the next restart.
+ *
+ *          SIGHUP is received via signalfd and handled by the main-loop.
+ *          shc_cfg_reload_init() blocks SIGHUP and must be called before
+ *          any thread is created.
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_shc_cfg_reload_
+#define _H_shc_cfg_reload_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "common/signal_slot_interface.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Is sent after a reload of the configuration-file.
+ * Argument is the number of changed configuration-objects as const u16*
+ *
+ */
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(SHC_CFG_RELOAD_COMPLETE_SIGNAL)
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Blocks SIGHUP, creates the signalfd and connects to the
+ * command-line-interface and the configuration-parser.
+ * Must be called before any other thread is created.
+ *
+ */
+void shc_cfg_reload_init(void);
+
+/**
+ * @brief Closes the signalfd
+ *
+ */
+void shc_cfg_reload_deinit(void);
+
+/**
+ * @brief Reloads the configuration-file if SIGHUP was received.
+ * Must be called from the main-loop.
+ *
+ */
+void shc_cfg_reload_task(void);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_shc_cfg_reload_
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,1000 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_cli_executer.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Implementation of the executer of shell-commands
+ *
+ * @see     shc_cli_executer.h
+ */
+
+#define TRACER_OFF
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "tracer.h"
+
+// --------------------------------------------------------------------------------
+
+#include "cpu.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <spawn.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/signalfd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+// --------------------------------------------------------------------------------
+
+#include "common/signal_slot_interface.h"
+
+#include "ui/cfg_file_parser/cfg_file_parser.h"
+
+// --------------------------------------------------------------------------------
+
+#include "shc_event_loop.h"
+#include "shc_cli_executer.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Maximum number of commands that can run at the same time
+ *
+ */
+#ifndef SHC_CLI_EXECUTER_JOB_LIST_SIZE
+#define SHC_CLI_EXECUTER_JOB_LIST_SIZE              8
+#endif
+
+/**
+ * @brief Default values, overwritten by the configuration-file
+ *
+ */
+#ifndef SHC_CLI_EXECUTER_MAX_JOBS
+#define SHC_CLI_EXECUTER_MAX_JOBS                   4
+#endif
+
+#ifndef SHC_CLI_EXECUTER_TIMEOUT_MS
+#define SHC_CLI_EXECUTER_TIMEOUT_MS                 5000
+#endif
+
+/**
+ * @brief Maximum number of commands waiting for a free job
+ *
+ */
+#ifndef SHC_CLI_EXECUTER_FIFO_SIZE
+#define SHC_CLI_EXECUTER_FIFO_SIZE                  16
+#endif
+
+/**
+ * @brief Maximum length of a command, same as the length
+ * of a shell-command of the message-executer
+ *
+ */
+#ifndef SHC_CLI_EXECUTER_COMMAND_MAX_LENGTH
+#define SHC_CLI_EXECUTER_COMMAND_MAX_LENGTH         256
+#endif
+
+/**
+ * @brief Maximum number of bytes of the output of a command,
+ * the rest of the output is dropped
+ *
+ */
+#ifndef SHC_CLI_EXECUTER_OUTPUT_MAX_LENGTH
+#define SHC_CLI_EXECUTER_OUTPUT_MAX_LENGTH          512
+#endif
+
+/**
+ * @brief Shell that is used to run the commands
+ *
+ */
+#ifndef SHC_CLI_EXECUTER_SHELL
+#define SHC_CLI_EXECUTER_SHELL                      "/bin/sh"
+#endif
+
+/**
+ * @brief Interval to reap exited commands if there is no helper-process
+ *
+ */
+#ifndef SHC_CLI_EXECUTER_REAP_INTERVAL_MS
+#define SHC_CLI_EXECUTER_REAP_INTERVAL_MS           20
+#endif
+
+/**
+ * @brief Exit-code of the shell if the command was not found
+ *
+ */
+#define SHC_CLI_EXECUTER_EXIT_CODE_NOT_FOUND        127
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief shcClient -> helper: start the given command
+ *
+ */
+#define SHC_CLI_EXECUTER_MESSAGE_SPAWN              0
+
+/**
+ * @brief helper -> shcClient: the command was started,
+ * the read-end of its output-pipe is attached
+ *
+ */
+#define SHC_CLI_EXECUTER_MESSAGE_STARTED            1
+
+/**
+ * @brief helper -> shcClient: a command has exited
+ *
+ */
+#define SHC_CLI_EXECUTER_MESSAGE_EXITED             2
+
+// --------------------------------------------------------------------------------
+
+#define SHC_CLI_EXECUTER_JOB_FREE                   0
+#define SHC_CLI_EXECUTER_JOB_STARTING               1
+#define SHC_CLI_EXECUTER_JOB_RUNNING                2
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Message between the shcClient and the helper-process
+ *
+ */
+typedef struct SHC_CLI_EXECUTER_MESSAGE_STRUCT {
+    u8 type;
+    u32 id;
+    pid_t pid;
+
+    /**
+     * @brief errno if the command could not be started,
+     * wait-status if the command has exited
+     *
+     */
+    int status;
+
+    char command[SHC_CLI_EXECUTER_COMMAND_MAX_LENGTH];
+
+} SHC_CLI_EXECUTER_MESSAGE;
+
+/**
+ * @brief A running command
+ *
+ */
+typedef struct SHC_CLI_EXECUTER_JOB_STRUCT {
+    u8 state;
+    u8 output_closed;
+    u8 output_polled;
+    u8 exited;
+    u32 id;
+    pid_t pid;
+    int output_handle;
+    int exit_status;
+    u64 start_time_us;
+    u16 output_length;
+    char command[SHC_CLI_EXECUTER_COMMAND_MAX_LENGTH];
+    char output[SHC_CLI_EXECUTER_OUTPUT_MAX_LENGTH + 1];
+} SHC_CLI_EXECUTER_JOB;
+
+// --------------------------------------------------------------------------------
+
+static SHC_CLI_EXECUTER_JOB job_list[SHC_CLI_EXECUTER_JOB_LIST_SIZE];
+static u8 job_count = 0;
+static u32 job_id = 0;
+
+static char command_fifo[SHC_CLI_EXECUTER_FIFO_SIZE][SHC_CLI_EXECUTER_COMMAND_MAX_LENGTH];
+static u8 fifo_read_index = 0;
+static u8 fifo_count = 0;
+
+static u8 max_jobs = SHC_CLI_EXECUTER_MAX_JOBS;
+static u32 timeout_ms = SHC_CLI_EXECUTER_TIMEOUT_MS;
+
+/**
+ * @brief Socket to the helper-process, -1 if the commands
+ * are started by the shcClient itself
+ *
+ */
+static int helper_handle = -1;
+static pid_t helper_pid = -1;
+static u8 helper_registered = 0;
+
+extern char** environ;
+
+// --------------------------------------------------------------------------------
+
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(CLI_EXECUTER_COMMAND_RECEIVED_SIGNAL)
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(CLI_EXECUTER_COMMAND_RESPONSE_SIGNAL)
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(CLI_EXECUTER_COMMAND_TIMEOUT_SIGNAL)
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(CLI_EXECUTER_COMMAND_NOT_FOUND_SIGNAL)
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Starts /bin/sh -c <command> inside of a new process-group.
+ * stdout and stderr of the command are connected to a new pipe,
+ * stdin is connected to /dev/null.
+ * Used by the helper-process and by the shcClient if there is no helper.
+ *
+ * @param p_command the command to start
+ * @param p_pid pid of the new process
+ * @param p_output_handle read-end of the output-pipe
+ * @return 0 on success, otherwise errno
+ */
+static int shc_cli_executer_spawn(const char* p_command, pid_t* p_pid, int* p_output_handle) {
+
+    int pipe_handle[2];
+
+    if (pipe(pipe_handle) != 0) {
+        return errno;
+    }
+
+    fcntl(pipe_handle[0], F_SETFD, FD_CLOEXEC);
+    fcntl(pipe_handle[1], F_SETFD, FD_CLOEXEC);
+
+    posix_spawn_file_actions_t file_actions;
+    posix_spawnattr_t attributes;
+    sigset_t signal_mask;
+
+    posix_spawn_file_actions_init(&file_actions);
+    posix_spawn_file_actions_addopen(&file_actions, STDIN_FILENO, "/dev/null", O_RDONLY, 0);
+    posix_spawn_file_actions_adddup2(&file_actions, pipe_handle[1], STDOUT_FILENO);
+    posix_spawn_file_actions_adddup2(&file_actions, pipe_handle[1], STDERR_FILENO);
+
+    posix_spawnattr_init(&attributes);
+    posix_spawnattr_setpgroup(&attributes, 0);
+
+    sigemptyset(&signal_mask);
+    posix_spawnattr_setsigmask(&attributes, &signal_mask);
+
+    sigfillset(&signal_mask);
+    posix_spawnattr_setsigdefault(&attributes, &signal_mask);
+
+    posix_spawnattr_setflags(&attributes, POSIX_SPAWN_SETPGROUP | POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_SETSIGDEF);
+
+    char* argument_list[] = { SHC_CLI_EXECUTER_SHELL, "-c", (char*)p_command, NULL };
+    int result = posix_spawn(p_pid, SHC_CLI_EXECUTER_SHELL, &file_actions, &attributes, argument_list, environ);
+
+    posix_spawnattr_destroy(&attributes);
+    posix_spawn_file_actions_destroy(&file_actions);
+
+    close(pipe_handle[1]);
+
+    if (result != 0) {
+        close(pipe_handle[0]);
+        return result;
+    }
+
+    *p_output_handle = pipe_handle[0];
+    return 0;
+}
+
+/**
+ * @brief Sends a message to the other end of the helper-socket.
+ * The given file-descriptor is attached via SCM_RIGHTS.
+ *
+ * @param socket_handle the helper-socket
+ * @param p_message the message to send
+ * @param attached_handle file-descriptor to attach, -1 if there is none
+ * @return 1 if the message was sent, otherwise 0
+ */
+static u8 shc_cli_executer_send_message(int socket_handle, const SHC_CLI_EXECUTER_MESSAGE* p_message, int attached_handle) {
+
+    struct iovec io_vector = {
+        .iov_base = (void*)p_message,
+        .iov_len = sizeof(SHC_CLI_EXECUTER_MESSAGE)
+    };
+
+    union {
+        char buffer[CMSG_SPACE(sizeof(int))];
+        struct cmsghdr align;
+    } control;
+
+    struct msghdr message_header;
+    memset(&message_header, 0x00, sizeof(message_header));
+
+    message_header.msg_iov = &io_vector;
+    message_header.msg_iovlen = 1;
+
+    if (attached_handle >= 0) {
+
+        memset(&control, 0x00, sizeof(control));
+
+        message_header.msg_control = control.buffer;
+        message_header.msg_controllen = sizeof(control.buffer);
+
+        struct cmsghdr* p_control_header = CMSG_FIRSTHDR(&message_header);
+        p_control_header->cmsg_level = SOL_SOCKET;
+        p_control_header->cmsg_type = SCM_RIGHTS;
+        p_control_header->cmsg_len = CMSG_LEN(sizeof(int));
+
+        memcpy(CMSG_DATA(p_control_header), &attached_handle, sizeof(int));
+    }
+
+    return sendmsg(socket_handle, &message_header, MSG_NOSIGNAL) == (ssize_t)sizeof(SHC_CLI_EXECUTER_MESSAGE);
+}
+
+/**
+ * @brief Receives a message from the other end of the helper-socket.
+ *
+ * @param socket_handle the helper-socket
+ * @param p_message the received message
+ * @param p_attached_handle attached file-descriptor or -1
+ * @return 1 if a message was received, otherwise 0
+ */
+static u8 shc_cli_executer_receive_message(int socket_handle, SHC_CLI_EXECUTER_MESSAGE* p_message, int* p_attached_handle) {
+
+    struct iovec io_vector = {
+        .iov_base = (void*)p_message,
+        .iov_len = sizeof(SHC_CLI_EXECUTER_MESSAGE)
+    };
+
+    union {
+        char buffer[CMSG_SPACE(sizeof(int))];
+        struct cmsghdr align;
+    } control;
+
+    struct msghdr message_header;
+    memset(&message_header, 0x00, sizeof(message_header));
+
+    message_header.msg_iov = &io_vector;
+    message_header.msg_iovlen = 1;
+    message_header.msg_control = control.buffer;
+    message_header.msg_controllen = sizeof(control.buffer);
+
+    *p_attached_handle = -1;
+
+    if (recvmsg(socket_handle, &message_header, MSG_CMSG_CLOEXEC) != (ssize_t)sizeof(SHC_CLI_EXECUTER_MESSAGE)) {
+        return 0;
+    }
+
+    struct cmsghdr* p_control_header = CMSG_FIRSTHDR(&message_header);
+
+    if (p_control_header != NULL && p_control_header->cmsg_level == SOL_SOCKET && p_control_header->cmsg_type == SCM_RIGHTS) {
+        memcpy(p_attached_handle, CMSG_DATA(p_control_header), sizeof(int));
+    }
+
+    p_message->command[sizeof(p_message->command) - 1] = '\0';
+    return 1;
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Main-loop of the helper-process. Starts every received
+ * command and reports its pid and output-pipe. Reaps all exited
+ * commands and reports their exit-status.
+ * The helper exits as soon as the shcClient closes the socket.
+ *
+ * @param socket_handle the helper-socket
+ */
+static void shc_cli_executer_helper_run(int socket_handle) {
+
+    int handle = 3;
+    for ( ; handle < 1024 ; handle++) {
+        if (handle != socket_handle) {
+            close(handle);
+        }
+    }
+
+    signal(SIGINT, SIG_IGN);
+    signal(SIGTERM, SIG_IGN);
+
+    sigset_t signal_mask;
+    sigemptyset(&signal_mask);
+    sigaddset(&signal_mask, SIGCHLD);
+    sigprocmask(SIG_BLOCK, &signal_mask, NULL);
+
+    struct pollfd poll_list[2] = {
+        { .fd = socket_handle, .events = POLLIN },
+        { .fd = signalfd(-1, &signal_mask, SFD_CLOEXEC | SFD_NONBLOCK), .events = POLLIN }
+    };
+
+    SHC_CLI_EXECUTER_MESSAGE message;
+    int attached_handle = -1;
+
+    for (;;) {
+
+        if (poll(poll_list, 2, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+
+        if (poll_list[0].revents & (POLLHUP | POLLERR)) {
+            break;
+        }
+
+        if (poll_list[0].revents & POLLIN) {
+
+            if (shc_cli_executer_receive_message(socket_handle, &message, &attached_handle) == 0) {
+                break;
+            }
+
+            int output_handle = -1;
+
+            message.type = SHC_CLI_EXECUTER_MESSAGE_STARTED;
+            message.status = shc_cli_executer_spawn(message.command, &message.pid, &output_handle);
+
+            if (message.status != 0) {
+                message.pid = -1;
+            }
+
+            shc_cli_executer_send_message(socket_handle, &message, output_handle);
+
+            if (output_handle >= 0) {
+                close(output_handle);
+            }
+        }
+
+        if (poll_list[1].revents & POLLIN) {
+
+            struct signalfd_siginfo signal_info;
+            while (read(poll_list[1].fd, &signal_info, sizeof(signal_info)) > 0) { }
+
+            int status = 0;
+            pid_t pid = 0;
+
+            while ((pid = waitpid(-1, &status, WNOHANG)) > 0) {
+
+                memset(&message, 0x00, sizeof(message));
+
+                message.type = SHC_CLI_EXECUTER_MESSAGE_EXITED;
+                message.pid = pid;
+                message.status = status;
+
+                shc_cli_executer_send_message(socket_handle, &message, -1);
+            }
+        }
+    }
+
+    _exit(0);
+}
+
+/**
+ * @brief Forks the helper-process
+ *
+ */
+static void shc_cli_executer_helper_start(void) {
+
+    int socket_list[2];
+
+    if (socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, socket_list) != 0) {
+        DEBUG_PASS("shc_cli_executer_helper_start() - socketpair() has FAILED !!! ---");
+        return;
+    }
+
+    helper_pid = fork();
+
+    if (helper_pid < 0) {
+        DEBUG_PASS("shc_cli_executer_helper_start() - fork() has FAILED !!! ---");
+        close(socket_list[0]);
+        close(socket_list[1]);
+        return;
+    }
+
+    if (helper_pid == 0) {
+        close(socket_list[0]);
+        shc_cli_executer_helper_run(socket_list[1]);
+    }
+
+    close(socket_list[1]);
+
+    helper_handle = socket_list[0];
+    fcntl(helper_handle, F_SETFL, fcntl(helper_handle, F_GETFL) | O_NONBLOCK);
+
+    DEBUG_TRACE_long(helper_pid, "shc_cli_executer_helper_start() - Helper:");
+}
+
+/**
+ * @brief Stops the helper and starts all commands
+ * by the shcClient itself.
+ *
+ */
+static void shc_cli_executer_helper_stop(void) {
+
+    if (helper_handle < 0) {
+        return;
+    }
+
+    if (helper_registered) {
+        shc_event_loop_remove_fd(helper_handle);
+        helper_registered = 0;
+    }
+
+    close(helper_handle);
+    helper_handle = -1;
+
+    waitpid(helper_pid, NULL, 0);
+    helper_pid = -1;
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Sends the response of a finished command and releases its job.
+ *
+ * @param p_job the finished command
+ */
+static void shc_cli_executer_finish(SHC_CLI_EXECUTER_JOB* p_job) {
+
+    if (p_job->output_handle >= 0) {
+        shc_event_loop_remove_fd(p_job->output_handle);
+        close(p_job->output_handle);
+        p_job->output_handle = -1;
+    }
+
+    while (p_job->output_length != 0 && (p_job->output[p_job->output_length - 1] == '\n' || p_job->output[p_job->output_length - 1] == '\r')) {
+        p_job->output_length -= 1;
+    }
+
+    p_job->output[p_job->output_length] = '\0';
+
+    DEBUG_TRACE_STR(p_job->command, "shc_cli_executer_finish()");
+
+    if (WIFEXITED(p_job->exit_status) && WEXITSTATUS(p_job->exit_status) == SHC_CLI_EXECUTER_EXIT_CODE_NOT_FOUND) {
+        CLI_EXECUTER_COMMAND_NOT_FOUND_SIGNAL_send(p_job->command);
+    } else {
+        CLI_EXECUTER_COMMAND_RESPONSE_SIGNAL_send(p_job->output);
+    }
+
+    p_job->state = SHC_CLI_EXECUTER_JOB_FREE;
+    job_count -= 1;
+
+    shc_event_loop_wakeup();
+}
+
+/**
+ * @brief Kills a command that has exceeded its timeout
+ * together with its process-group and releases its job.
+ *
+ * @param p_job the command to kill
+ */
+static void shc_cli_executer_kill(SHC_CLI_EXECUTER_JOB* p_job) {
+
+    DEBUG_TRACE_STR(p_job->command, "shc_cli_executer_kill()");
+
+    if (p_job->pid > 0 && p_job->exited == 0) {
+        kill(-p_job->pid, SIGKILL);
+    }
+
+    if (p_job->output_handle >= 0) {
+        shc_event_loop_remove_fd(p_job->output_handle);
+        close(p_job->output_handle);
+        p_job->output_handle = -1;
+    }
+
+    CLI_EXECUTER_COMMAND_TIMEOUT_SIGNAL_send(p_job->command);
+
+    p_job->state = SHC_CLI_EXECUTER_JOB_FREE;
+    job_count -= 1;
+
+    shc_event_loop_wakeup();
+}
+
+/**
+ * @brief Is called by the event-loop if there is output of a command.
+ *
+ * @param fd read-end of the output-pipe
+ * @param p_context the job of the command
+ */
+static void shc_cli_executer_output_callback(int fd, void* p_context) {
+
+    SHC_CLI_EXECUTER_JOB* p_job = (SHC_CLI_EXECUTER_JOB*)p_context;
+    char buffer[256];
+    ssize_t length = 0;
+
+    while ((length = read(fd, buffer, sizeof(buffer))) > 0) {
+
+        u16 free_space = SHC_CLI_EXECUTER_OUTPUT_MAX_LENGTH - p_job->output_length;
+        u16 copy_length = (length < free_space) ? (u16)length : free_space;
+
+        memcpy(p_job->output + p_job->output_length, buffer, copy_length);
+        p_job->output_length += copy_length;
+    }
+
+    if (length == 0) {
+
+        p_job->output_closed = 1;
+
+        shc_event_loop_remove_fd(fd);
+        close(fd);
+        p_job->output_handle = -1;
+
+        if (helper_handle < 0 && p_job->exited == 0 && waitpid(p_job->pid, &p_job->exit_status, WNOHANG) == p_job->pid) {
+            p_job->exited = 1;
+        }
+
+        if (p_job->exited) {
+            shc_cli_executer_finish(p_job);
+        }
+    }
+}
+
+/**
+ * @brief Get the job of the given process
+ *
+ * @param pid pid of the command
+ * @return the job of the command or NULL if there is none
+ */
+static SHC_CLI_EXECUTER_JOB* shc_cli_executer_find_job(pid_t pid) {
+
+    u8 i = 0;
+    for ( ; i < SHC_CLI_EXECUTER_JOB_LIST_SIZE ; i++) {
+        if (job_list[i].state == SHC_CLI_EXECUTER_JOB_RUNNING && job_list[i].pid == pid) {
+            return &job_list[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief The command of the given job is running,
+ * its output is watched by the event-loop.
+ *
+ * @param p_job the started command
+ * @param pid pid of the command
+ * @param output_handle read-end of the output-pipe
+ */
+static void shc_cli_executer_started(SHC_CLI_EXECUTER_JOB* p_job, pid_t pid, int output_handle) {
+
+    fcntl(output_handle, F_SETFL, fcntl(output_handle, F_GETFL) | O_NONBLOCK);
+
+    p_job->state = SHC_CLI_EXECUTER_JOB_RUNNING;
+    p_job->pid = pid;
+    p_job->output_handle = output_handle;
+
+    if (shc_event_loop_add_fd(output_handle, shc_cli_executer_output_callback, p_job) == 0) {
+        // the output is read by shc_cli_executer_task()
+        DEBUG_PASS("shc_cli_executer_started() - Event-loop not available");
+        p_job->output_polled = 1;
+    }
+}
+
+/**
+ * @brief The command of the given process has exited
+ *
+ * @param pid pid of the command
+ * @param status wait-status of the command
+ */
+static void shc_cli_executer_exited(pid_t pid, int status) {
+
+    SHC_CLI_EXECUTER_JOB* p_job = shc_cli_executer_find_job(pid);
+
+    if (p_job == NULL) {
+        // killed because of its timeout
+        return;
+    }
+
+    p_job->exited = 1;
+    p_job->exit_status = status;
+
+    if (p_job->output_closed) {
+        shc_cli_executer_finish(p_job);
+    }
+}
+
+/**
+ * @brief Is called by the event-loop if the helper has sent a message.
+ *
+ * @param fd the helper-socket
+ * @param p_context not used
+ */
+static void shc_cli_executer_helper_callback(int fd, void* p_context) {
+
+    (void) p_context;
+
+    SHC_CLI_EXECUTER_MESSAGE message;
+    int attached_handle = -1;
+
+    while (shc_cli_executer_receive_message(fd, &message, &attached_handle)) {
+
+        if (message.type == SHC_CLI_EXECUTER_MESSAGE_EXITED) {
+            shc_cli_executer_exited(message.pid, message.status);
+            continue;
+        }
+
+        SHC_CLI_EXECUTER_JOB* p_job = NULL;
+
+        u8 i = 0;
+        for ( ; i < SHC_CLI_EXECUTER_JOB_LIST_SIZE ; i++) {
+            if (job_list[i].state == SHC_CLI_EXECUTER_JOB_STARTING && job_list[i].id == message.id) {
+                p_job = &job_list[i];
+            }
+        }
+
+        if (p_job == NULL) {
+            // killed because of its timeout before it was started
+            if (attached_handle >= 0) {
+                close(attached_handle);
+            }
+
+            if (message.pid > 0) {
+                kill(-message.pid, SIGKILL);
+            }
+
+            continue;
+        }
+
+        if (message.pid <= 0 || attached_handle < 0) {
+            DEBUG_TRACE_STR(p_job->command, "shc_cli_executer_helper_callback() - Start has FAILED !!! ---");
+            p_job->state = SHC_CLI_EXECUTER_JOB_FREE;
+            job_count -= 1;
+            CLI_EXECUTER_COMMAND_NOT_FOUND_SIGNAL_send(p_job->command);
+            continue;
+        }
+
+        shc_cli_executer_started(p_job, message.pid, attached_handle);
+    }
+}
+
+/**
+ * @brief Starts the given command inside of a free job
+ *
+ * @param p_command the command to start
+ */
+static void shc_cli_executer_start(const char* p_command) {
+
+    SHC_CLI_EXECUTER_JOB* p_job = &job_list[0];
+    while (p_job->state != SHC_CLI_EXECUTER_JOB_FREE) {
+        p_job++;
+    }
+
+    memset(p_job, 0x00, sizeof(SHC_CLI_EXECUTER_JOB));
+
+    snprintf(p_job->command, sizeof(p_job->command), "%s", p_command);
+
+    p_job->id = ++job_id;
+    p_job->pid = -1;
+    p_job->output_handle = -1;
+    p_job->start_time_us = shc_event_loop_time_us();
+    p_job->state = SHC_CLI_EXECUTER_JOB_STARTING;
+
+    job_count += 1;
+
+    DEBUG_TRACE_STR(p_job->command, "shc_cli_executer_start()");
+
+    if (helper_handle >= 0) {
+
+        SHC_CLI_EXECUTER_MESSAGE message;
+        memset(&message, 0x00, sizeof(message));
+
+        message.type = SHC_CLI_EXECUTER_MESSAGE_SPAWN;
+        message.id = p_job->id;
+        snprintf(message.command, sizeof(message.command), "%s", p_job->command);
+
+        if (shc_cli_executer_send_message(helper_handle, &message, -1)) {
+            return;
+        }
+
+        DEBUG_PASS("shc_cli_executer_start() - Helper not available - starting commands directly");
+        shc_cli_executer_helper_stop();
+    }
+
+    pid_t pid = -1;
+    int output_handle = -1;
+
+    if (shc_cli_executer_spawn(p_job->command, &pid, &output_handle) != 0) {
+        DEBUG_TRACE_STR(p_job->command, "shc_cli_executer_start() - posix_spawn() has FAILED !!! ---");
+        p_job->state = SHC_CLI_EXECUTER_JOB_FREE;
+        job_count -= 1;
+        CLI_EXECUTER_COMMAND_NOT_FOUND_SIGNAL_send(p_job->command);
+        return;
+    }
+
+    shc_cli_executer_started(p_job, pid, output_handle);
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Adds a new command to the fifo
+ *
+ * @param p_argument the command as zero-terminated string
+ */
+static void shc_cli_executer_COMMAND_RECEIVED_SLOT_CALLBACK(const void* p_argument) {
+
+    if (p_argument == NULL) {
+        DEBUG_PASS("shc_cli_executer_COMMAND_RECEIVED_SLOT_CALLBACK() - NULL_POINTER_EXCEPTION");
+        return;
+    }
+
+    if (fifo_count == SHC_CLI_EXECUTER_FIFO_SIZE) {
+        DEBUG_PASS("shc_cli_executer_COMMAND_RECEIVED_SLOT_CALLBACK() - FIFO is full");
+        return;
+    }
+
+    snprintf(
+        command_fifo[(fifo_read_index + fifo_count) % SHC_CLI_EXECUTER_FIFO_SIZE],
+        SHC_CLI_EXECUTER_COMMAND_MAX_LENGTH,
+        "%s",
+        (const char*)p_argument
+    );
+
+    fifo_count += 1;
+    shc_event_loop_wakeup();
+}
+
+/**
+ * @brief Takes the number of jobs and the timeout from the configuration-file.
+ *
+ * @param p_argument the configuration object of type CFG_FILE_PARSER_CFG_OBJECT_TYPE
+ */
+static void shc_cli_executer_CFG_OBJECT_RECEIVED_SLOT_CALLBACK(const void* p_argument) {
+
+    if (p_argument == NULL) {
+        DEBUG_PASS("shc_cli_executer_CFG_OBJECT_RECEIVED_SLOT_CALLBACK() - NULL_POINTER_EXCEPTION");
+        return;
+    }
+
+    const CFG_FILE_PARSER_CFG_OBJECT_TYPE* p_cfg_obj = (const CFG_FILE_PARSER_CFG_OBJECT_TYPE*)p_argument;
+
+    if (strcmp(p_cfg_obj->key, "CLI_EXECUTER_MAX_JOBS") == 0) {
+
+        u32 jobs = (u32)strtoul(p_cfg_obj->value, NULL, 10);
+
+        if (jobs == 0 || jobs > SHC_CLI_EXECUTER_JOB_LIST_SIZE) {
+            DEBUG_TRACE_long(jobs, "shc_cli_executer_CFG_OBJECT_RECEIVED_SLOT_CALLBACK() - Invalid number of jobs");
+            jobs = SHC_CLI_EXECUTER_JOB_LIST_SIZE;
+        }
+
+        max_jobs = (u8)jobs;
+
+    } else if (strcmp(p_cfg_obj->key, "CLI_EXECUTER_TIMEOUT_MS") == 0) {
+        timeout_ms = (u32)strtoul(p_cfg_obj->value, NULL, 10);
+    }
+}
+
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(CLI_EXECUTER_COMMAND_RECEIVED_SIGNAL, SHC_CLI_EXECUTER_COMMAND_RECEIVED_SLOT, shc_cli_executer_COMMAND_RECEIVED_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(CFG_PARSER_NEW_CFG_OBJECT_SIGNAL, SHC_CLI_EXECUTER_CFG_OBJECT_RECEIVED_SLOT, shc_cli_executer_CFG_OBJECT_RECEIVED_SLOT_CALLBACK)
+
+// --------------------------------------------------------------------------------
+
+void shc_cli_executer_init(void) {
+
+    DEBUG_PASS("shc_cli_executer_init()");
+
+    CLI_EXECUTER_COMMAND_RECEIVED_SIGNAL_init();
+    CLI_EXECUTER_COMMAND_RESPONSE_SIGNAL_init();
+    CLI_EXECUTER_COMMAND_TIMEOUT_SIGNAL_init();
+    CLI_EXECUTER_COMMAND_NOT_FOUND_SIGNAL_init();
+
+    memset(job_list, 0x00, sizeof(job_list));
+
+    job_count = 0;
+    fifo_read_index = 0;
+    fifo_count = 0;
+
+    shc_cli_executer_helper_start();
+
+    SHC_CLI_EXECUTER_COMMAND_RECEIVED_SLOT_connect();
+    SHC_CLI_EXECUTER_CFG_OBJECT_RECEIVED_SLOT_connect();
+}
+
+void shc_cli_executer_deinit(void) {
+
+    DEBUG_PASS("shc_cli_executer_deinit()");
+
+    u8 i = 0;
+    for ( ; i < SHC_CLI_EXECUTER_JOB_LIST_SIZE ; i++) {
+
+        SHC_CLI_EXECUTER_JOB* p_job = &job_list[i];
+
+        if (p_job->state == SHC_CLI_EXECUTER_JOB_FREE) {
+            continue;
+        }
+
+        if (p_job->pid > 0 && p_job->exited == 0) {
+            kill(-p_job->pid, SIGKILL);
+        }
+
+        if (p_job->output_handle >= 0) {
+            shc_event_loop_remove_fd(p_job->output_handle);
+            close(p_job->output_handle);
+        }
+
+        p_job->state = SHC_CLI_EXECUTER_JOB_FREE;
+    }
+
+    job_count = 0;
+    shc_cli_executer_helper_stop();
+}
+
+void shc_cli_executer_task(void) {
+
+    if (helper_handle >= 0 && helper_registered == 0) {
+
+        // the event-loop is initialized after the helper was forked
+        if (shc_event_loop_add_fd(helper_handle, shc_cli_executer_helper_callback, NULL)) {
+            helper_registered = 1;
+        } else {
+            shc_cli_executer_helper_callback(helper_handle, NULL);
+        }
+    }
+
+    if (helper_handle < 0) {
+
+        int status = 0;
+        pid_t pid = 0;
+
+        while ((pid = waitpid(-1, &status, WNOHANG)) > 0) {
+            shc_cli_executer_exited(pid, status);
+        }
+    }
+
+    while (fifo_count != 0 && job_count < max_jobs) {
+
+        shc_cli_executer_start(command_fifo[fifo_read_index]);
+
+        fifo_read_index = (fifo_read_index + 1) % SHC_CLI_EXECUTER_FIFO_SIZE;
+        fifo_count -= 1;
+    }
+
+    if (job_count == 0) {
+        return;
+    }
+
+    u64 now_us = shc_event_loop_time_us();
+    u8 reap_pending = 0;
+
+    u8 i = 0;
+    for ( ; i < SHC_CLI_EXECUTER_JOB_LIST_SIZE ; i++) {
+
+        SHC_CLI_EXECUTER_JOB* p_job = &job_list[i];
+
+        if (p_job->state == SHC_CLI_EXECUTER_JOB_RUNNING && p_job->output_polled && p_job->output_handle >= 0) {
+            shc_cli_executer_output_callback(p_job->output_handle, p_job);
+        }
+
+        if (p_job->state == SHC_CLI_EXECUTER_JOB_FREE) {
+            continue;
+        }
+
+        if (p_job->output_closed && p_job->exited == 0) {
+            reap_pending = 1;
+        }
+
+        u32 elapsed_ms = (u32)((now_us - p_job->start_time_us) / 1000ULL);
+
+        if (timeout_ms != 0 && elapsed_ms >= timeout_ms) {
+            shc_cli_executer_kill(p_job);
+            continue;
+        }
+
+        if (timeout_ms != 0) {
+            shc_event_loop_set_deadline(timeout_ms - elapsed_ms);
+        }
+    }
+
+    if (helper_handle < 0 && reap_pending) {
+        // the output was closed before the command has exited
+        shc_event_loop_set_deadline(SHC_CLI_EXECUTER_REAP_INTERVAL_MS);
+    }
+}
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,112 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_cli_executer.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Executer of shell-commands (exe_ entries) of the shcClient.
+ *
+ *          Replaces the CLI_EXECUTER module of the framework.
+ *          Every command is started via posix_spawn() as /bin/sh -c <command>
+ *          inside of its own process-group. Output (stdout and stderr)
+ *          is read through a non-blocking pipe that is watched by the
+ *          event-loop. Several commands run at the same time, all other
+ *          commands wait inside of a fifo.
+ *
+ *          The processes are started by a helper-process that is forked
+ *          on shc_cli_executer_init(), while the shcClient is still small.
+ *          The helper passes the pipe of every command back via SCM_RIGHTS.
+ *          Without the helper the commands are started by the shcClient itself.
+ *
+ *          A command that is still running after CLI_EXECUTER_TIMEOUT_MS
+ *          is killed together with its process-group.
+ *
+ *          Configuration (configuration-file):
+ *
+ *          - CLI_EXECUTER_MAX_JOBS=<number> (default 4)
+ *          - CLI_EXECUTER_TIMEOUT_MS=<time_ms> (default 5000)
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_shc_cli_executer_
+#define _H_shc_cli_executer_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "common/signal_slot_interface.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Is send to start a shell-command.
+ * Argument is the command as zero-terminated string
+ *
+ */
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(CLI_EXECUTER_COMMAND_RECEIVED_SIGNAL)
+
+/**
+ * @brief Is send if a shell-command has finished.
+ * Argument is the output of the command as zero-terminated string
+ *
+ */
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(CLI_EXECUTER_COMMAND_RESPONSE_SIGNAL)
+
+/**
+ * @brief Is send if a shell-command was killed because of its timeout.
+ * Argument is the command as zero-terminated string
+ *
+ */
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(CLI_EXECUTER_COMMAND_TIMEOUT_SIGNAL)
+
+/**
+ * @brief Is send if the shell has not found the command (exit-code 127)
+ * or the command could not be started. Argument is the command
+ * as zero-terminated string
+ *
+ */
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(CLI_EXECUTER_COMMAND_NOT_FOUND_SIGNAL)
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Forks the helper-process and creates all signals.
+ * Must be called before any other thread is started.
+ *
+ */
+void shc_cli_executer_init(void);
+
+/**
+ * @brief Kills all running commands and stops the helper-process
+ *
+ */
+void shc_cli_executer_deinit(void);
+
+/**
+ * @brief Starts waiting commands and checks the timeouts.
+ * Must be called from the main-loop.
+ *
+ */
+void shc_cli_executer_task(void);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_shc_cli_executer_
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,572 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_command_socket.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Implementation of the local command-interface of the shcClient
+ *
+ * @see     shc_command_socket.h
+ */
+
+#define TRACER_OFF
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "tracer.h"
+
+// --------------------------------------------------------------------------------
+
+#include "cpu.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+// --------------------------------------------------------------------------------
+
+#include "common/signal_slot_interface.h"
+
+#include "ui/cfg_file_parser/cfg_file_parser.h"
+
+// --------------------------------------------------------------------------------
+
+#include "shc_event_loop.h"
+#include "shc_host_board.h"
+#include "shc_command_table.h"
+#include "shc_msg_executer.h"
+#include "shc_command_socket.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Path of the unix-socket if COMMAND_SOCKET_PATH is not given.
+ * Also used by cmdHelper and spiHelper.
+ *
+ */
+#ifndef SHC_COMMAND_SOCKET_DEFAULT_PATH
+#define SHC_COMMAND_SOCKET_DEFAULT_PATH             "/tmp/shc_client_command.sock"
+#endif
+
+/**
+ * @brief Maximum length of the path of the unix-socket
+ *
+ */
+#ifndef SHC_COMMAND_SOCKET_PATH_MAX_LENGTH
+#define SHC_COMMAND_SOCKET_PATH_MAX_LENGTH          108
+#endif
+
+/**
+ * @brief Maximum number of connected clients
+ *
+ */
+#ifndef SHC_COMMAND_SOCKET_MAX_CLIENTS
+#define SHC_COMMAND_SOCKET_MAX_CLIENTS              4
+#endif
+
+/**
+ * @brief Maximum length of a request including its line-feed
+ *
+ */
+#ifndef SHC_COMMAND_SOCKET_LINE_MAX_LENGTH
+#define SHC_COMMAND_SOCKET_LINE_MAX_LENGTH          256
+#endif
+
+/**
+ * @brief The client-id holds the index of the connection in its lower bits
+ *
+ */
+#define SHC_COMMAND_SOCKET_CLIENT_ID_SHIFT          4
+#define SHC_COMMAND_SOCKET_CLIENT_ID_MASK           0x0F
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief A connected client
+ *
+ */
+typedef struct SHC_COMMAND_SOCKET_CLIENT_STRUCT {
+
+    /**
+     * @brief file-descriptor of the connection, -1 if not used
+     *
+     */
+    int handle;
+
+    /**
+     * @brief client-id of the request in process, 0 if there is none.
+     * The connection is not read while a request is in process.
+     *
+     */
+    u32 pending_id;
+
+    /**
+     * @brief received bytes that are not processed yet
+     *
+     */
+    char rx_buffer[SHC_COMMAND_SOCKET_LINE_MAX_LENGTH];
+    u16 rx_length;
+
+} SHC_COMMAND_SOCKET_CLIENT;
+
+// --------------------------------------------------------------------------------
+
+static SHC_COMMAND_SOCKET_CLIENT client_list[SHC_COMMAND_SOCKET_MAX_CLIENTS];
+
+/**
+ * @brief Incremented for every request, part of the client-id
+ *
+ */
+static u32 request_sequence = 0;
+
+static char socket_path[SHC_COMMAND_SOCKET_PATH_MAX_LENGTH];
+static int socket_handle = -1;
+static u8 socket_pending = 0;
+
+// --------------------------------------------------------------------------------
+
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(SHC_COMMAND_SOCKET_REQUEST_SIGNAL)
+
+// --------------------------------------------------------------------------------
+
+static void shc_command_socket_client_callback(int fd, void* p_context);
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Closes the connection of the given client.
+ * The response of a request in process is dropped.
+ *
+ * @param p_client the client
+ */
+static void shc_command_socket_client_close(SHC_COMMAND_SOCKET_CLIENT* p_client) {
+
+    if (p_client->handle < 0) {
+        return;
+    }
+
+    shc_event_loop_remove_fd(p_client->handle);
+    close(p_client->handle);
+
+    p_client->handle = -1;
+    p_client->pending_id = 0;
+    p_client->rx_length = 0;
+}
+
+/**
+ * @brief Writes a single line to the client.
+ * The client is closed if the line cannot be written.
+ *
+ * @param p_client the client
+ * @param p_line the line including its line-feed
+ * @param length number of characters of p_line
+ */
+static void shc_command_socket_client_write(SHC_COMMAND_SOCKET_CLIENT* p_client, const char* p_line, u16 length) {
+
+    if (send(p_client->handle, p_line, length, MSG_NOSIGNAL) != (ssize_t)length) {
+        DEBUG_PASS("shc_command_socket_client_write() - send() has FAILED !!! ---");
+        shc_command_socket_client_close(p_client);
+    }
+}
+
+/**
+ * @brief Parses a single request and forwards it to the message-executer.
+ * Invalid requests are answered immediately.
+ *
+ * @param p_client the client
+ * @param p_line the zero-terminated request without line-feed
+ */
+static void shc_command_socket_client_request(SHC_COMMAND_SOCKET_CLIENT* p_client, char* p_line) {
+
+    u8 frame[SHC_COMMAND_TABLE_MAX_COMMAND_LENGTH];
+    SHC_COMMAND_SOCKET_REQUEST request;
+
+    memset(&request, 0x00, sizeof(request));
+    request.board = SHC_HOST_BOARD_DEFAULT;
+
+    if (strncmp(p_line, "com:", 4) == 0 || strncmp(p_line, "com@", 4) == 0) {
+
+        char* p_hex = p_line + 4;
+
+        if (p_line[3] == '@') {
+
+            p_hex = strchr(p_line, ':');
+            request.board = p_hex == NULL ? SHC_HOST_BOARD_INVALID : shc_host_board_find(p_line + 4, (u16)(p_hex - p_line - 4));
+
+            if (request.board == SHC_HOST_BOARD_INVALID) {
+                shc_command_socket_client_write(p_client, "ERROR unknown board\n", 20);
+                return;
+            }
+
+            p_hex += 1;
+        }
+
+        request.length = shc_command_table_hex_to_bytes(p_hex, frame, sizeof(frame));
+        request.p_frame = frame;
+
+        if (request.length == 0) {
+            shc_command_socket_client_write(p_client, "ERROR invalid frame\n", 20);
+            return;
+        }
+
+    } else {
+        request.p_key = p_line;
+    }
+
+    request_sequence += 1;
+
+    request.client_id = (request_sequence << SHC_COMMAND_SOCKET_CLIENT_ID_SHIFT) | (u32)(p_client - client_list + 1);
+    p_client->pending_id = request.client_id;
+
+    // nothing is read until the response has been written
+    shc_event_loop_remove_fd(p_client->handle);
+
+    DEBUG_TRACE_STR(p_line, "shc_command_socket_client_request()");
+    SHC_COMMAND_SOCKET_REQUEST_SIGNAL_send(&request);
+}
+
+/**
+ * @brief Processes all complete requests of the given client,
+ * as long as no request is in process.
+ *
+ * @param p_client the client
+ */
+static void shc_command_socket_client_process(SHC_COMMAND_SOCKET_CLIENT* p_client) {
+
+    while (p_client->handle >= 0 && p_client->pending_id == 0) {
+
+        char* p_end = memchr(p_client->rx_buffer, '\n', p_client->rx_length);
+
+        if (p_end == NULL) {
+
+            if (p_client->rx_length == sizeof(p_client->rx_buffer)) {
+                shc_command_socket_client_write(p_client, "ERROR line too long\n", 20);
+                shc_command_socket_client_close(p_client);
+            }
+
+            return;
+        }
+
+        char line[SHC_COMMAND_SOCKET_LINE_MAX_LENGTH];
+        u16 line_length = (u16)(p_end - p_client->rx_buffer);
+
+        memcpy(line, p_client->rx_buffer, line_length);
+        line[line_length] = '\0';
+
+        if (line_length != 0 && line[line_length - 1] == '\r') {
+            line[line_length - 1] = '\0';
+        }
+
+        p_client->rx_length -= line_length + 1;
+        memmove(p_client->rx_buffer, p_end + 1, p_client->rx_length);
+
+        if (line[0] != '\0') {
+            shc_command_socket_client_request(p_client, line);
+        }
+    }
+
+    if (p_client->handle >= 0 && p_client->pending_id == 0) {
+
+        if (shc_event_loop_add_fd(p_client->handle, shc_command_socket_client_callback, p_client) == 0) {
+            shc_command_socket_client_close(p_client);
+        }
+    }
+}
+
+/**
+ * @brief Is called by the event-loop if a client has sent data
+ * or has closed its connection.
+ *
+ * @param fd file-descriptor of the connection
+ * @param p_context the client of type SHC_COMMAND_SOCKET_CLIENT
+ */
+static void shc_command_socket_client_callback(int fd, void* p_context) {
+
+    SHC_COMMAND_SOCKET_CLIENT* p_client = (SHC_COMMAND_SOCKET_CLIENT*)p_context;
+
+    ssize_t length = recv(
+        fd,
+        p_client->rx_buffer + p_client->rx_length,
+        sizeof(p_client->rx_buffer) - p_client->rx_length,
+        MSG_DONTWAIT
+    );
+
+    if (length == 0 || (length < 0 && errno != EAGAIN && errno != EINTR)) {
+        DEBUG_PASS("shc_command_socket_client_callback() - Connection closed");
+        shc_command_socket_client_close(p_client);
+        return;
+    }
+
+    if (length > 0) {
+        p_client->rx_length += (u16)length;
+        shc_command_socket_client_process(p_client);
+    }
+}
+
+/**
+ * @brief Is called by the event-loop if there are new connections
+ * on the unix-socket. Connections above SHC_COMMAND_SOCKET_MAX_CLIENTS
+ * are refused.
+ *
+ * @param fd file-descriptor of the listening socket
+ * @param p_context not used
+ */
+static void shc_command_socket_accept_callback(int fd, void* p_context) {
+
+    (void) p_context;
+
+    int client_handle = -1;
+
+    while ((client_handle = accept(fd, NULL, NULL)) >= 0) {
+
+        fcntl(client_handle, F_SETFD, FD_CLOEXEC);
+        fcntl(client_handle, F_SETFL, fcntl(client_handle, F_GETFL) | O_NONBLOCK);
+
+        SHC_COMMAND_SOCKET_CLIENT* p_client = NULL;
+
+        u8 i = 0;
+        for ( ; i < SHC_COMMAND_SOCKET_MAX_CLIENTS ; i++) {
+            if (client_list[i].handle < 0) {
+                p_client = &client_list[i];
+                break;
+            }
+        }
+
+        if (p_client == NULL) {
+            DEBUG_PASS("shc_command_socket_accept_callback() - Too many clients");
+            send(client_handle, "ERROR too many clients\n", 23, MSG_NOSIGNAL);
+            close(client_handle);
+            continue;
+        }
+
+        p_client->handle = client_handle;
+        p_client->pending_id = 0;
+        p_client->rx_length = 0;
+
+        if (shc_event_loop_add_fd(client_handle, shc_command_socket_client_callback, p_client) == 0) {
+            DEBUG_PASS("shc_command_socket_accept_callback() - Event-loop is full");
+            close(client_handle);
+            p_client->handle = -1;
+        }
+    }
+}
+
+/**
+ * @brief Closes the unix-socket and all connections
+ * and removes the socket from the file-system
+ *
+ */
+static void shc_command_socket_close(void) {
+
+    u8 i = 0;
+    for ( ; i < SHC_COMMAND_SOCKET_MAX_CLIENTS ; i++) {
+        shc_command_socket_client_close(&client_list[i]);
+    }
+
+    if (socket_handle < 0) {
+        return;
+    }
+
+    shc_event_loop_remove_fd(socket_handle);
+    close(socket_handle);
+    unlink(socket_path);
+
+    socket_handle = -1;
+}
+
+/**
+ * @brief Opens the unix-socket at socket_path
+ *
+ */
+static void shc_command_socket_open(void) {
+
+    shc_command_socket_close();
+
+    if (socket_path[0] == '\0') {
+        return;
+    }
+
+    struct sockaddr_un address;
+    memset(&address, 0x00, sizeof(address));
+
+    address.sun_family = AF_UNIX;
+    snprintf(address.sun_path, sizeof(address.sun_path), "%s", socket_path);
+
+    socket_handle = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC | SOCK_NONBLOCK, 0);
+    if (socket_handle < 0) {
+        DEBUG_PASS("shc_command_socket_open() - Create socket has FAILED !!! ---");
+        return;
+    }
+
+    // a socket of a previous run
+    unlink(socket_path);
+
+    if (bind(socket_handle, (struct sockaddr*)&address, sizeof(address)) != 0 || listen(socket_handle, 4) != 0) {
+        DEBUG_TRACE_STR(socket_path, "shc_command_socket_open() - Bind socket has FAILED !!! ---");
+        close(socket_handle);
+        socket_handle = -1;
+        return;
+    }
+
+    if (shc_event_loop_add_fd(socket_handle, shc_command_socket_accept_callback, NULL) == 0) {
+        DEBUG_PASS("shc_command_socket_open() - Event-loop not available");
+        close(socket_handle);
+        unlink(socket_path);
+        socket_handle = -1;
+        return;
+    }
+
+    DEBUG_TRACE_STR(socket_path, "shc_command_socket_open() - Listening on:");
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Writes the response of the message-executer to its client
+ * and continues with the next request of this client.
+ *
+ * @param p_argument the response of type SHC_MSG_EXECUTER_CLIENT_RESPONSE
+ */
+static void shc_command_socket_CLIENT_RESPONSE_SLOT_CALLBACK(const void* p_argument) {
+
+    if (p_argument == NULL) {
+        DEBUG_PASS("shc_command_socket_CLIENT_RESPONSE_SLOT_CALLBACK() - NULL_POINTER_EXCEPTION");
+        return;
+    }
+
+    const SHC_MSG_EXECUTER_CLIENT_RESPONSE* p_response = (const SHC_MSG_EXECUTER_CLIENT_RESPONSE*)p_argument;
+    u32 index = (p_response->client_id & SHC_COMMAND_SOCKET_CLIENT_ID_MASK);
+
+    if (index == 0 || index > SHC_COMMAND_SOCKET_MAX_CLIENTS) {
+        return;
+    }
+
+    SHC_COMMAND_SOCKET_CLIENT* p_client = &client_list[index - 1];
+
+    if (p_client->handle < 0 || p_client->pending_id != p_response->client_id) {
+        // the client has closed its connection in the meantime
+        DEBUG_PASS("shc_command_socket_CLIENT_RESPONSE_SLOT_CALLBACK() - Client not available");
+        return;
+    }
+
+    char line[3 + 1 + (SHC_COMMAND_TABLE_MAX_COMMAND_LENGTH * 2) + 2];
+    u16 line_length = 0;
+
+    switch (p_response->status) {
+
+        case SHC_MSG_EXECUTER_CLIENT_STATUS_OK:
+
+            if (p_response->length == 0) {
+                line_length = (u16)snprintf(line, sizeof(line), "OK\n");
+                break;
+            }
+
+            memcpy(line, "OK ", 3);
+            shc_command_table_bytes_to_hex(p_response->p_data, p_response->length, line + 3, (u16)(sizeof(line) - 4));
+
+            line_length = (u16)strlen(line);
+            line[line_length++] = '\n';
+            break;
+
+        case SHC_MSG_EXECUTER_CLIENT_STATUS_TIMEOUT:
+            line_length = (u16)snprintf(line, sizeof(line), "TIMEOUT\n");
+            break;
+
+        case SHC_MSG_EXECUTER_CLIENT_STATUS_BUSY:
+            line_length = (u16)snprintf(line, sizeof(line), "ERROR queue is full\n");
+            break;
+
+        default:
+            line_length = (u16)snprintf(line, sizeof(line), "ERROR unknown command\n");
+            break;
+    }
+
+    p_client->pending_id = 0;
+
+    shc_command_socket_client_write(p_client, line, line_length);
+    shc_command_socket_client_process(p_client);
+}
+
+/**
+ * @brief Takes the path of the unix-socket from the configuration-file.
+ *
+ * @param p_argument the configuration object of type CFG_FILE_PARSER_CFG_OBJECT_TYPE
+ */
+static void shc_command_socket_CFG_OBJECT_RECEIVED_SLOT_CALLBACK(const void* p_argument) {
+
+    if (p_argument == NULL) {
+        DEBUG_PASS("shc_command_socket_CFG_OBJECT_RECEIVED_SLOT_CALLBACK() - NULL_POINTER_EXCEPTION");
+        return;
+    }
+
+    const CFG_FILE_PARSER_CFG_OBJECT_TYPE* p_cfg_obj = (const CFG_FILE_PARSER_CFG_OBJECT_TYPE*)p_argument;
+
+    if (strcmp(p_cfg_obj->key, "COMMAND_SOCKET_PATH") == 0) {
+        shc_command_socket_close();
+        snprintf(socket_path, sizeof(socket_path), "%s", p_cfg_obj->value);
+        socket_pending = 1;
+    }
+}
+
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(MSG_EXECUTER_CLIENT_RESPONSE_SIGNAL, SHC_COMMAND_SOCKET_CLIENT_RESPONSE_SLOT, shc_command_socket_CLIENT_RESPONSE_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(CFG_PARSER_NEW_CFG_OBJECT_SIGNAL, SHC_COMMAND_SOCKET_CFG_OBJECT_RECEIVED_SLOT, shc_command_socket_CFG_OBJECT_RECEIVED_SLOT_CALLBACK)
+
+// --------------------------------------------------------------------------------
+
+void shc_command_socket_init(void) {
+
+    DEBUG_PASS("shc_command_socket_init()");
+
+    SHC_COMMAND_SOCKET_REQUEST_SIGNAL_init();
+
+    u8 i = 0;
+    for ( ; i < SHC_COMMAND_SOCKET_MAX_CLIENTS ; i++) {
+        memset(&client_list[i], 0x00, sizeof(SHC_COMMAND_SOCKET_CLIENT));
+        client_list[i].handle = -1;
+    }
+
+    snprintf(socket_path, sizeof(socket_path), "%s", SHC_COMMAND_SOCKET_DEFAULT_PATH);
+    socket_pending = 1;
+
+    SHC_COMMAND_SOCKET_CLIENT_RESPONSE_SLOT_connect();
+    SHC_COMMAND_SOCKET_CFG_OBJECT_RECEIVED_SLOT_connect();
+}
+
+void shc_command_socket_deinit(void) {
+
+    DEBUG_PASS("shc_command_socket_deinit()");
+    shc_command_socket_close();
+}
+
+void shc_command_socket_task(void) {
+
+    if (socket_pending) {
+        socket_pending = 0;
+        shc_command_socket_open();
+    }
+}
+
+// --------------------------------------------------------------------------------
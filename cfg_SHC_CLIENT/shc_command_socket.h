@@ -0,0 +1,121 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_command_socket.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Local command-interface of the shcClient.
+ *
+ *          Local programs (e.g. cmdHelper and spiHelper) send their
+ *          commands via a unix-socket instead of accessing the
+ *          control-board themselves. The commands are put into the
+ *          same queue as the commands received via MQTT.
+ *
+ *          Every request and every response is a single line:
+ *
+ *          - com:<hex>             frame for board 0, incl. length-byte
+ *          - com@<board>:<hex>     frame for the given board
+ *          - <name>                command of the command-file, e.g. cmd_light_on
+ *
+ *          - OK [<hex>]            response without length-byte
+ *          - TIMEOUT               the control-board has not responded
+ *          - ERROR <reason>        invalid request or queue is full
+ *
+ *          A connection can send several requests, they are processed
+ *          one after another and answered in the same order.
+ *
+ *          Configuration (configuration-file):
+ *
+ *          - COMMAND_SOCKET_PATH=<path> (default /tmp/shc_client_command.sock)
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_shc_command_socket_
+#define _H_shc_command_socket_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "common/signal_slot_interface.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Argument of SHC_COMMAND_SOCKET_REQUEST_SIGNAL
+ *
+ */
+typedef struct SHC_COMMAND_SOCKET_REQUEST_STRUCT {
+
+    /**
+     * @brief given back by MSG_EXECUTER_CLIENT_RESPONSE_SIGNAL, never 0
+     *
+     */
+    u32 client_id;
+
+    /**
+     * @brief zero-terminated name of a command or NULL for a frame
+     *
+     */
+    const char* p_key;
+
+    /**
+     * @brief frame including its length-byte and the board to send it to,
+     * only valid if p_key is NULL
+     *
+     */
+    u8 board;
+    u16 length;
+    const u8* p_frame;
+
+} SHC_COMMAND_SOCKET_REQUEST;
+
+/**
+ * @brief Is sent for every request of a local client.
+ * Argument is of type SHC_COMMAND_SOCKET_REQUEST
+ *
+ */
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(SHC_COMMAND_SOCKET_REQUEST_SIGNAL)
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Creates the request-signal and connects to the
+ * message-executer and the configuration-parser.
+ *
+ */
+void shc_command_socket_init(void);
+
+/**
+ * @brief Closes all connections and removes the unix-socket
+ *
+ */
+void shc_command_socket_deinit(void);
+
+/**
+ * @brief Opens the unix-socket after COMMAND_SOCKET_PATH has changed.
+ * Must be called from the main-loop.
+ *
+ */
+void shc_command_socket_task(void);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_shc_command_socket_
+
+// --------------------------------------------------------------------------------
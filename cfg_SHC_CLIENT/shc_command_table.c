@@ -0,0 +1,986 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_command_table.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Implementation of the in-memory command-table
+ *
+ * @see     shc_command_table.h
+ */
+
+#define TRACER_OFF
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "tracer.h"
+
+// --------------------------------------------------------------------------------
+
+#include "cpu.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <libgen.h>
+#include <sys/stat.h>
+#include <sys/inotify.h>
+
+// --------------------------------------------------------------------------------
+
+#include "common/signal_slot_interface.h"
+
+// --------------------------------------------------------------------------------
+
+#include "shc_event_loop.h"
+#include "shc_host_board.h"
+#include "shc_command_table.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Maximum length of a path of one of the files
+ *
+ */
+#ifndef SHC_COMMAND_TABLE_PATH_MAX_LENGTH
+#define SHC_COMMAND_TABLE_PATH_MAX_LENGTH           256
+#endif
+
+/**
+ * @brief Time to wait after a change of a file before it is reloaded.
+ * Editors write a file in several steps.
+ *
+ */
+#ifndef SHC_COMMAND_TABLE_RELOAD_DELAY_MS
+#define SHC_COMMAND_TABLE_RELOAD_DELAY_MS           200
+#endif
+
+/**
+ * @brief Interval of checking the modification time of the files
+ * if inotify is not available
+ *
+ */
+#ifndef SHC_COMMAND_TABLE_POLL_INTERVAL_MS
+#define SHC_COMMAND_TABLE_POLL_INTERVAL_MS          60000
+#endif
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Entry of the table while it is build.
+ * Strings and payloads are stored as offsets into the data-buffer
+ * because the buffer can be moved by realloc().
+ *
+ */
+typedef struct SHC_COMMAND_TABLE_BUILDER_ENTRY_STRUCT {
+    u32 key_offset;
+    u32 payload_offset;
+    u32 expected_offset;
+    u16 length;
+    u16 expected_length;
+    u8 type;
+    u8 board;
+} SHC_COMMAND_TABLE_BUILDER_ENTRY;
+
+/**
+ * @brief Temporary data while a new table is build
+ *
+ */
+typedef struct SHC_COMMAND_TABLE_BUILDER_STRUCT {
+
+    u8* p_data;
+    u32 data_length;
+    u32 data_capacity;
+
+    SHC_COMMAND_TABLE_BUILDER_ENTRY* entry_list;
+    u32 num_entries;
+    u32 entry_capacity;
+
+    SHC_COMMAND_TABLE_BUILDER_ENTRY* event_list;
+    u32 num_events;
+    u32 event_capacity;
+
+} SHC_COMMAND_TABLE_BUILDER;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief The table that is used until the first file has been loaded
+ *
+ */
+static u32 empty_bucket = 0;
+static SHC_COMMAND_TABLE empty_table = {
+    .generation = 0,
+    .num_entries = 0,
+    .entry_list = NULL,
+    .bucket_mask = 0,
+    .bucket_list = &empty_bucket,
+    .num_reports = 0,
+    .report_list = NULL,
+    .num_events = 0,
+    .event_list = NULL,
+    .p_data = NULL
+};
+
+static SHC_COMMAND_TABLE* p_actual_table = &empty_table;
+static u32 table_generation = 0;
+
+static char file_path_list[SHC_COMMAND_TABLE_NUM_FILES][SHC_COMMAND_TABLE_PATH_MAX_LENGTH];
+static time_t file_mtime_list[SHC_COMMAND_TABLE_NUM_FILES];
+static int watch_list[SHC_COMMAND_TABLE_NUM_FILES];
+
+static int inotify_handle = -1;
+
+static u8 reload_pending = 0;
+static u64 reload_time_us = 0;
+static u64 poll_time_us = 0;
+static u32 poll_interval_ms = SHC_COMMAND_TABLE_POLL_INTERVAL_MS;
+
+// --------------------------------------------------------------------------------
+
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(SHC_COMMAND_TABLE_LOADED_SIGNAL)
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(MSG_EXECUTER_FILE_OPEN_FAILED_SIGNAL)
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief FNV-1a hash of a zero-terminated string
+ *
+ * @param p_key the string to hash
+ * @return hash of p_key
+ */
+static u32 shc_command_table_hash(const char* p_key) {
+
+    u32 hash = 2166136261UL;
+
+    while (*p_key != '\0') {
+        hash ^= (u8)*p_key++;
+        hash *= 16777619UL;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief Converts a single hex-character into its value
+ *
+ * @param character the character to convert
+ * @return value of the character or -1 if it is not a hex-character
+ */
+static i8 shc_command_table_hex_value(char character) {
+
+    if (character >= '0' && character <= '9') {
+        return (i8)(character - '0');
+    }
+
+    if (character >= 'a' && character <= 'f') {
+        return (i8)(character - 'a' + 10);
+    }
+
+    if (character >= 'A' && character <= 'F') {
+        return (i8)(character - 'A' + 10);
+    }
+
+    return -1;
+}
+
+/**
+ * @brief Appends data to the data-buffer of the builder
+ *
+ * @param p_builder the builder
+ * @param p_data data to append
+ * @param length number of bytes to append
+ * @param p_offset offset of the appended data
+ * @return 1 on success, 0 if there is not enough memory
+ */
+static u8 shc_command_table_builder_append(SHC_COMMAND_TABLE_BUILDER* p_builder, const void* p_data, u32 length, u32* p_offset) {
+
+    if (p_builder->data_length + length > p_builder->data_capacity) {
+
+        u32 new_capacity = p_builder->data_capacity ? p_builder->data_capacity * 2 : 4096;
+        while (new_capacity < p_builder->data_length + length) {
+            new_capacity *= 2;
+        }
+
+        u8* p_new_data = (u8*)realloc(p_builder->p_data, new_capacity);
+        if (p_new_data == NULL) {
+            return 0;
+        }
+
+        p_builder->p_data = p_new_data;
+        p_builder->data_capacity = new_capacity;
+    }
+
+    memcpy(p_builder->p_data + p_builder->data_length, p_data, length);
+
+    *p_offset = p_builder->data_length;
+    p_builder->data_length += length;
+
+    return 1;
+}
+
+/**
+ * @brief Adds a new entry to the given list of the builder
+ *
+ * @param p_list list to extend
+ * @param p_count actual number of entries
+ * @param p_capacity actual capacity of the list
+ * @return the new entry or NULL if there is not enough memory
+ */
+static SHC_COMMAND_TABLE_BUILDER_ENTRY* shc_command_table_builder_add(SHC_COMMAND_TABLE_BUILDER_ENTRY** p_list, u32* p_count, u32* p_capacity) {
+
+    if (*p_count == *p_capacity) {
+
+        u32 new_capacity = *p_capacity ? *p_capacity * 2 : 64;
+        SHC_COMMAND_TABLE_BUILDER_ENTRY* p_new_list = (SHC_COMMAND_TABLE_BUILDER_ENTRY*)realloc(*p_list, new_capacity * sizeof(SHC_COMMAND_TABLE_BUILDER_ENTRY));
+
+        if (p_new_list == NULL) {
+            return NULL;
+        }
+
+        *p_list = p_new_list;
+        *p_capacity = new_capacity;
+    }
+
+    SHC_COMMAND_TABLE_BUILDER_ENTRY* p_entry = &(*p_list)[*p_count];
+    memset(p_entry, 0x00, sizeof(SHC_COMMAND_TABLE_BUILDER_ENTRY));
+
+    *p_count += 1;
+    return p_entry;
+}
+
+/**
+ * @brief Parses the name of a control-board in front of a command,
+ * e.g. @kitchen:0704010100000000
+ *
+ * @param pp_value the value of the line, moved behind the name of the board
+ * @return index of the board, SHC_HOST_BOARD_DEFAULT if there is no name
+ * or SHC_HOST_BOARD_INVALID if the board is unknown
+ */
+static u8 shc_command_table_parse_board(const char** pp_value) {
+
+    const char* p_name = *pp_value;
+
+    if (*p_name != '@') {
+        return SHC_HOST_BOARD_DEFAULT;
+    }
+
+    p_name += 1;
+
+    const char* p_end = strchr(p_name, ':');
+    if (p_end == NULL) {
+        return SHC_HOST_BOARD_INVALID;
+    }
+
+    *pp_value = p_end + 1;
+
+    return shc_host_board_find(p_name, (u16)(p_end - p_name));
+}
+
+/**
+ * @brief Adds a command, report or shell-command to the builder
+ *
+ * @param p_builder the builder
+ * @param p_key name of the command
+ * @param p_value value of the line
+ * @param from_execute_file the line is from the execute-file
+ * @return 1 on success, 0 if the line is invalid or there is not enough memory
+ */
+static u8 shc_command_table_parse_command(SHC_COMMAND_TABLE_BUILDER* p_builder, const char* p_key, const char* p_value, u8 from_execute_file) {
+
+    u8 buffer[SHC_COMMAND_TABLE_MAX_COMMAND_LENGTH];
+    const void* p_payload = NULL;
+    u32 payload_length = 0;
+    u8 type = SHC_COMMAND_TYPE_COM;
+    u8 board = SHC_HOST_BOARD_DEFAULT;
+
+    if (from_execute_file) {
+
+        while (*p_value == ' ') {
+            p_value += 1;
+        }
+
+        type = SHC_COMMAND_TYPE_EXE;
+        p_payload = p_value;
+        payload_length = strlen(p_value) + 1;
+
+    } else if (strncmp(p_value, "EXE:", 4) == 0) {
+
+        type = SHC_COMMAND_TYPE_EXE;
+        p_payload = p_value + 4;
+        payload_length = strlen(p_value + 4) + 1;
+
+    } else if (strncmp(p_value, "com:", 4) == 0 || strncmp(p_value, "com@", 4) == 0) {
+
+        const char* p_hex = p_value + 3;
+
+        if (*p_hex == ':') {
+            p_hex += 1;
+        } else {
+            board = shc_command_table_parse_board(&p_hex);
+        }
+
+        if (board == SHC_HOST_BOARD_INVALID) {
+            return 0;
+        }
+
+        type = strncmp(p_key, "rpt_", 4) == 0 ? SHC_COMMAND_TYPE_REPORT : SHC_COMMAND_TYPE_COM;
+        payload_length = shc_command_table_hex_to_bytes(p_hex, buffer, sizeof(buffer));
+        p_payload = buffer;
+
+        if (payload_length == 0) {
+            return 0;
+        }
+
+    } else {
+        return 0;
+    }
+
+    SHC_COMMAND_TABLE_BUILDER_ENTRY* p_entry = shc_command_table_builder_add(&p_builder->entry_list, &p_builder->num_entries, &p_builder->entry_capacity);
+    if (p_entry == NULL) {
+        return 0;
+    }
+
+    p_entry->type = type;
+    p_entry->board = board;
+    p_entry->length = (u16)(type == SHC_COMMAND_TYPE_EXE ? payload_length - 1 : payload_length);
+
+    if (shc_command_table_builder_append(p_builder, p_key, strlen(p_key) + 1, &p_entry->key_offset) == 0) {
+        return 0;
+    }
+
+    return shc_command_table_builder_append(p_builder, p_payload, payload_length, &p_entry->payload_offset);
+}
+
+/**
+ * @brief Adds an event rule to the builder
+ *
+ * @param p_builder the builder
+ * @param p_key name of the event
+ * @param p_value value of the line, [@<board>:]<hex-command>=<hex-expected-response>
+ * @return 1 on success, 0 if the line is invalid or there is not enough memory
+ */
+static u8 shc_command_table_parse_event(SHC_COMMAND_TABLE_BUILDER* p_builder, const char* p_key, char* p_value) {
+
+    char* p_expected = strchr(p_value, '=');
+    if (p_expected == NULL) {
+        return 0;
+    }
+
+    *p_expected++ = '\0';
+
+    const char* p_command = p_value;
+
+    u8 board = shc_command_table_parse_board(&p_command);
+    if (board == SHC_HOST_BOARD_INVALID) {
+        return 0;
+    }
+
+    u8 command[SHC_COMMAND_TABLE_MAX_COMMAND_LENGTH];
+    u8 expected[SHC_COMMAND_TABLE_MAX_COMMAND_LENGTH];
+
+    u16 command_length = shc_command_table_hex_to_bytes(p_command, command, sizeof(command));
+    u16 expected_length = shc_command_table_hex_to_bytes(p_expected, expected, sizeof(expected));
+
+    if (command_length == 0 || expected_length == 0) {
+        return 0;
+    }
+
+    SHC_COMMAND_TABLE_BUILDER_ENTRY* p_entry = shc_command_table_builder_add(&p_builder->event_list, &p_builder->num_events, &p_builder->event_capacity);
+    if (p_entry == NULL) {
+        return 0;
+    }
+
+    p_entry->board = board;
+    p_entry->length = command_length;
+    p_entry->expected_length = expected_length;
+
+    if (shc_command_table_builder_append(p_builder, p_key, strlen(p_key) + 1, &p_entry->key_offset) == 0) {
+        return 0;
+    }
+
+    if (shc_command_table_builder_append(p_builder, command, command_length, &p_entry->payload_offset) == 0) {
+        return 0;
+    }
+
+    return shc_command_table_builder_append(p_builder, expected, expected_length, &p_entry->expected_offset);
+}
+
+/**
+ * @brief Parses a single file into the builder.
+ * Invalid lines are ignored.
+ *
+ * @param p_builder the builder
+ * @param file_id one of SHC_COMMAND_TABLE_FILE_xxx
+ * @return 1 on success, 0 if the file could not be opened
+ */
+static u8 shc_command_table_parse_file(SHC_COMMAND_TABLE_BUILDER* p_builder, u8 file_id) {
+
+    const char* p_path = file_path_list[file_id];
+
+    if (p_path[0] == '\0') {
+        return 1;
+    }
+
+    FILE* p_file = fopen(p_path, "r");
+    if (p_file == NULL) {
+        DEBUG_TRACE_STR(p_path, "shc_command_table_parse_file() - Open file has FAILED !!! ---");
+        MSG_EXECUTER_FILE_OPEN_FAILED_SIGNAL_send(p_path);
+        return 0;
+    }
+
+    struct stat file_stat;
+    if (fstat(fileno(p_file), &file_stat) == 0) {
+        file_mtime_list[file_id] = file_stat.st_mtime;
+    }
+
+    char* p_line = NULL;
+    size_t line_capacity = 0;
+    ssize_t line_length = 0;
+
+    while ((line_length = getline(&p_line, &line_capacity, p_file)) >= 0) {
+
+        while (line_length > 0 && (p_line[line_length - 1] == '\n' || p_line[line_length - 1] == '\r')) {
+            p_line[--line_length] = '\0';
+        }
+
+        if (line_length == 0 || p_line[0] == '#') {
+            continue;
+        }
+
+        char* p_value = strchr(p_line, '=');
+        if (p_value == NULL) {
+            continue;
+        }
+
+        *p_value++ = '\0';
+
+        if (strlen(p_line) >= SHC_COMMAND_TABLE_MAX_KEY_LENGTH) {
+            DEBUG_TRACE_STR(p_line, "shc_command_table_parse_file() - Key too long");
+            continue;
+        }
+
+        u8 is_valid = 0;
+
+        if (strncmp(p_line, "evt_", 4) == 0) {
+            is_valid = shc_command_table_parse_event(p_builder, p_line, p_value);
+
+        } else if (strncmp(p_line, "cmd_", 4) == 0 || strncmp(p_line, "exe_", 4) == 0 || strncmp(p_line, "rpt_", 4) == 0) {
+            is_valid = shc_command_table_parse_command(p_builder, p_line, p_value, file_id == SHC_COMMAND_TABLE_FILE_EXECUTE);
+
+        } else {
+            // e.g. version=0101
+            is_valid = 1;
+        }
+
+        if (is_valid == 0) {
+            DEBUG_TRACE_STR(p_line, "shc_command_table_parse_file() - Invalid line");
+        }
+    }
+
+    free(p_line);
+    fclose(p_file);
+
+    return 1;
+}
+
+/**
+ * @brief Releases all memory of the builder
+ *
+ * @param p_builder the builder
+ */
+static void shc_command_table_builder_free(SHC_COMMAND_TABLE_BUILDER* p_builder) {
+    free(p_builder->p_data);
+    free(p_builder->entry_list);
+    free(p_builder->event_list);
+}
+
+/**
+ * @brief Releases all memory of a table
+ *
+ * @param p_table the table to release
+ */
+static void shc_command_table_free(SHC_COMMAND_TABLE* p_table) {
+
+    if (p_table == NULL || p_table == &empty_table) {
+        return;
+    }
+
+    free(p_table->entry_list);
+    free(p_table->bucket_list);
+    free(p_table->report_list);
+    shc_event_matcher_free(&p_table->event_matcher);
+
+    free(p_table->event_list);
+    free(p_table->p_data);
+    free(p_table);
+}
+
+/**
+ * @brief Inserts an entry into the hash-table.
+ * An existing entry with the same key is replaced.
+ *
+ * @param p_table the table
+ * @param index index of the entry to insert
+ * @return 1 if a new key was inserted, 0 if an existing key was replaced
+ */
+static u8 shc_command_table_insert(SHC_COMMAND_TABLE* p_table, u32 index) {
+
+    const SHC_COMMAND_TABLE_ENTRY* p_entry = &p_table->entry_list[index];
+    u32 bucket = p_entry->hash & p_table->bucket_mask;
+
+    while (p_table->bucket_list[bucket] != 0) {
+
+        u32* p_bucket = &p_table->bucket_list[bucket];
+        const SHC_COMMAND_TABLE_ENTRY* p_other = &p_table->entry_list[*p_bucket - 1];
+
+        if (p_other->hash == p_entry->hash && strcmp(p_other->key, p_entry->key) == 0) {
+            *p_bucket = index + 1;
+            return 0;
+        }
+
+        bucket = (bucket + 1) & p_table->bucket_mask;
+    }
+
+    p_table->bucket_list[bucket] = index + 1;
+    return 1;
+}
+
+/**
+ * @brief Creates a new table out of the builder.
+ * The data-buffer is moved into the table.
+ *
+ * @param p_builder the builder
+ * @return the new table or NULL if there is not enough memory
+ */
+static SHC_COMMAND_TABLE* shc_command_table_create(SHC_COMMAND_TABLE_BUILDER* p_builder) {
+
+    SHC_COMMAND_TABLE* p_table = (SHC_COMMAND_TABLE*)calloc(1, sizeof(SHC_COMMAND_TABLE));
+    if (p_table == NULL) {
+        return NULL;
+    }
+
+    // load-factor of the hash-table is below 0.5
+    u32 num_buckets = 16;
+    while (num_buckets < p_builder->num_entries * 2) {
+        num_buckets *= 2;
+    }
+
+    p_table->bucket_mask = num_buckets - 1;
+    p_table->bucket_list = (u32*)calloc(num_buckets, sizeof(u32));
+    p_table->entry_list = (SHC_COMMAND_TABLE_ENTRY*)calloc(p_builder->num_entries + 1, sizeof(SHC_COMMAND_TABLE_ENTRY));
+    p_table->report_list = (u32*)calloc(p_builder->num_entries + 1, sizeof(u32));
+    p_table->event_list = (SHC_COMMAND_TABLE_EVENT*)calloc(p_builder->num_events + 1, sizeof(SHC_COMMAND_TABLE_EVENT));
+
+    if (p_table->bucket_list == NULL || p_table->entry_list == NULL || p_table->report_list == NULL || p_table->event_list == NULL) {
+        shc_command_table_free(p_table);
+        return NULL;
+    }
+
+    p_table->p_data = p_builder->p_data;
+    p_builder->p_data = NULL;
+
+    u32 i = 0;
+    for ( ; i < p_builder->num_entries ; i++) {
+
+        const SHC_COMMAND_TABLE_BUILDER_ENTRY* p_source = &p_builder->entry_list[i];
+        SHC_COMMAND_TABLE_ENTRY* p_entry = &p_table->entry_list[p_table->num_entries];
+
+        p_entry->key = (const char*)(p_table->p_data + p_source->key_offset);
+        p_entry->hash = shc_command_table_hash(p_entry->key);
+        p_entry->type = p_source->type;
+        p_entry->board = p_source->board;
+        p_entry->length = p_source->length;
+        p_entry->p_payload = p_table->p_data + p_source->payload_offset;
+
+        if (shc_command_table_insert(p_table, p_table->num_entries) == 0) {
+            // a duplicate key, the last line of the files wins
+            DEBUG_TRACE_STR(p_entry->key, "shc_command_table_create() - Duplicate key");
+        }
+
+        p_table->num_entries += 1;
+    }
+
+    // only reports that are still part of the hash-table,
+    // grouped by board so a batch-frame never spans two boards
+    u8 board = 0;
+    for ( ; board < SHC_HOST_BOARD_MAX_COUNT ; board++) {
+
+        for (i = 0 ; i < p_table->num_entries ; i++) {
+
+            const SHC_COMMAND_TABLE_ENTRY* p_entry = &p_table->entry_list[i];
+
+            if (p_entry->type != SHC_COMMAND_TYPE_REPORT || p_entry->board != board) {
+                continue;
+            }
+
+            if (shc_command_table_lookup(p_table, p_entry->key) == p_entry) {
+                p_table->report_list[p_table->num_reports++] = i;
+            }
+        }
+    }
+
+    for (i = 0 ; i < p_builder->num_events ; i++) {
+
+        const SHC_COMMAND_TABLE_BUILDER_ENTRY* p_source = &p_builder->event_list[i];
+        SHC_COMMAND_TABLE_EVENT* p_event = &p_table->event_list[p_table->num_events++];
+
+        p_event->key = (const char*)(p_table->p_data + p_source->key_offset);
+        p_event->board = p_source->board;
+        p_event->p_command = p_table->p_data + p_source->payload_offset;
+        p_event->command_length = p_source->length;
+        p_event->p_expected = p_table->p_data + p_source->expected_offset;
+        p_event->expected_length = p_source->expected_length;
+    }
+
+    if (shc_event_matcher_create(&p_table->event_matcher, p_table->event_list, p_table->num_events) == 0) {
+        shc_command_table_free(p_table);
+        return NULL;
+    }
+
+    return p_table;
+}
+
+/**
+ * @brief Adds an inotify watch for the directory of the given file.
+ * Directories are watched instead of files because editors
+ * replace a file instead of writing into it.
+ *
+ * @param file_id one of SHC_COMMAND_TABLE_FILE_xxx
+ */
+static void shc_command_table_add_watch(u8 file_id) {
+
+    if (inotify_handle < 0 || file_path_list[file_id][0] == '\0') {
+        return;
+    }
+
+    char directory[SHC_COMMAND_TABLE_PATH_MAX_LENGTH];
+    memcpy(directory, file_path_list[file_id], sizeof(directory));
+
+    watch_list[file_id] = inotify_add_watch(
+        inotify_handle,
+        dirname(directory),
+        IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE
+    );
+
+    if (watch_list[file_id] < 0) {
+        DEBUG_TRACE_STR(file_path_list[file_id], "shc_command_table_add_watch() - inotify_add_watch() has FAILED !!! ---");
+    }
+}
+
+/**
+ * @brief Is called by the event-loop if the inotify-handle is readable.
+ * Requests a reload if one of the files has changed.
+ *
+ * @param fd the inotify-handle
+ * @param p_context not used
+ */
+static void shc_command_table_inotify_callback(int fd, void* p_context) {
+
+    (void) p_context;
+
+    char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    ssize_t length = 0;
+
+    while ((length = read(fd, buffer, sizeof(buffer))) > 0) {
+
+        char* p_position = buffer;
+
+        while (p_position < buffer + length) {
+
+            const struct inotify_event* p_event = (const struct inotify_event*)p_position;
+            p_position += sizeof(struct inotify_event) + p_event->len;
+
+            if (p_event->len == 0) {
+                continue;
+            }
+
+            u8 file_id = 0;
+            for ( ; file_id < SHC_COMMAND_TABLE_NUM_FILES ; file_id++) {
+
+                if (p_event->wd != watch_list[file_id]) {
+                    continue;
+                }
+
+                char path[SHC_COMMAND_TABLE_PATH_MAX_LENGTH];
+                memcpy(path, file_path_list[file_id], sizeof(path));
+
+                if (strcmp(basename(path), p_event->name) == 0) {
+                    DEBUG_TRACE_STR(p_event->name, "shc_command_table_inotify_callback() - File has changed");
+                    shc_command_table_request_reload();
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Checks the modification time of all files.
+ * Used if inotify is not available.
+ *
+ */
+static void shc_command_table_poll_files(void) {
+
+    u8 file_id = 0;
+    for ( ; file_id < SHC_COMMAND_TABLE_NUM_FILES ; file_id++) {
+
+        if (file_path_list[file_id][0] == '\0') {
+            continue;
+        }
+
+        struct stat file_stat;
+        if (stat(file_path_list[file_id], &file_stat) != 0) {
+            continue;
+        }
+
+        if (file_stat.st_mtime != file_mtime_list[file_id]) {
+            shc_command_table_request_reload();
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------
+
+void shc_command_table_init(void) {
+
+    DEBUG_PASS("shc_command_table_init()");
+
+    SHC_COMMAND_TABLE_LOADED_SIGNAL_init();
+    MSG_EXECUTER_FILE_OPEN_FAILED_SIGNAL_init();
+
+    memset(file_path_list, 0x00, sizeof(file_path_list));
+    memset(file_mtime_list, 0x00, sizeof(file_mtime_list));
+
+    u8 file_id = 0;
+    for ( ; file_id < SHC_COMMAND_TABLE_NUM_FILES ; file_id++) {
+        watch_list[file_id] = -1;
+    }
+
+    p_actual_table = &empty_table;
+    reload_pending = 0;
+
+    inotify_handle = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+    if (inotify_handle < 0) {
+        DEBUG_PASS("shc_command_table_init() - inotify not available - using polling");
+        return;
+    }
+
+    if (shc_event_loop_add_fd(inotify_handle, shc_command_table_inotify_callback, NULL) == 0) {
+        DEBUG_PASS("shc_command_table_init() - Event-loop not available - using polling");
+        close(inotify_handle);
+        inotify_handle = -1;
+    }
+}
+
+void shc_command_table_deinit(void) {
+
+    DEBUG_PASS("shc_command_table_deinit()");
+
+    if (inotify_handle >= 0) {
+        shc_event_loop_remove_fd(inotify_handle);
+        close(inotify_handle);
+        inotify_handle = -1;
+    }
+
+    SHC_COMMAND_TABLE* p_old_table = __atomic_exchange_n(&p_actual_table, &empty_table, __ATOMIC_ACQ_REL);
+    shc_command_table_free(p_old_table);
+}
+
+void shc_command_table_set_file(u8 file_id, const char* p_path) {
+
+    if (file_id >= SHC_COMMAND_TABLE_NUM_FILES || p_path == NULL) {
+        return;
+    }
+
+    DEBUG_TRACE_STR(p_path, "shc_command_table_set_file()");
+
+    if (strcmp(file_path_list[file_id], p_path) == 0) {
+        return;
+    }
+
+    snprintf(file_path_list[file_id], SHC_COMMAND_TABLE_PATH_MAX_LENGTH, "%s", p_path);
+
+    if (watch_list[file_id] >= 0) {
+
+        // the watch is shared with other files of the same directory
+        u8 is_shared = 0;
+        u8 other_id = 0;
+
+        for ( ; other_id < SHC_COMMAND_TABLE_NUM_FILES ; other_id++) {
+            if (other_id != file_id && watch_list[other_id] == watch_list[file_id]) {
+                is_shared = 1;
+            }
+        }
+
+        if (is_shared == 0) {
+            inotify_rm_watch(inotify_handle, watch_list[file_id]);
+        }
+
+        watch_list[file_id] = -1;
+    }
+
+    shc_command_table_add_watch(file_id);
+
+    // load immediately after the configuration has been read
+    reload_pending = 1;
+    reload_time_us = 0;
+}
+
+void shc_command_table_set_poll_interval(u32 interval_ms) {
+    DEBUG_TRACE_long(interval_ms, "shc_command_table_set_poll_interval()");
+    poll_interval_ms = interval_ms;
+}
+
+u8 shc_command_table_load(void) {
+
+    DEBUG_PASS("shc_command_table_load()");
+
+    SHC_COMMAND_TABLE_BUILDER builder;
+    memset(&builder, 0x00, sizeof(builder));
+
+    u8 is_complete = 1;
+    u8 file_id = 0;
+
+    for ( ; file_id < SHC_COMMAND_TABLE_NUM_FILES ; file_id++) {
+
+        if (shc_command_table_parse_file(&builder, file_id) == 0) {
+            is_complete = 0;
+        }
+    }
+
+    if (is_complete == 0) {
+        // keep the actual table, e.g. the file is replaced right now
+        shc_command_table_builder_free(&builder);
+        return 0;
+    }
+
+    SHC_COMMAND_TABLE* p_new_table = shc_command_table_create(&builder);
+    shc_command_table_builder_free(&builder);
+
+    if (p_new_table == NULL) {
+        DEBUG_PASS("shc_command_table_load() - Out of memory");
+        return 0;
+    }
+
+    p_new_table->generation = ++table_generation;
+
+    SHC_COMMAND_TABLE* p_old_table = __atomic_exchange_n(&p_actual_table, p_new_table, __ATOMIC_ACQ_REL);
+
+    // all readers are part of the main-loop, nobody holds the old table anymore
+    shc_command_table_free(p_old_table);
+
+    SHC_COMMAND_TABLE_LOADED_SIGNAL_send(p_new_table);
+    return 1;
+}
+
+void shc_command_table_request_reload(void) {
+    reload_pending = 1;
+    reload_time_us = shc_event_loop_time_us() + (u64)SHC_COMMAND_TABLE_RELOAD_DELAY_MS * 1000ULL;
+}
+
+void shc_command_table_task(void) {
+
+    u64 now_us = shc_event_loop_time_us();
+
+    if (inotify_handle < 0 && now_us >= poll_time_us) {
+        poll_time_us = now_us + (u64)poll_interval_ms * 1000ULL;
+        shc_command_table_poll_files();
+    }
+
+    if (reload_pending == 0) {
+        return;
+    }
+
+    if (now_us < reload_time_us) {
+        shc_event_loop_set_deadline((u32)((reload_time_us - now_us) / 1000ULL) + 1);
+        return;
+    }
+
+    reload_pending = 0;
+    shc_command_table_load();
+}
+
+const SHC_COMMAND_TABLE* shc_command_table_get(void) {
+    return __atomic_load_n(&p_actual_table, __ATOMIC_ACQUIRE);
+}
+
+const SHC_COMMAND_TABLE_ENTRY* shc_command_table_lookup(const SHC_COMMAND_TABLE* p_table, const char* p_key) {
+
+    if (p_table == NULL || p_key == NULL || p_table->num_entries == 0) {
+        return NULL;
+    }
+
+    u32 hash = shc_command_table_hash(p_key);
+    u32 bucket = hash & p_table->bucket_mask;
+
+    while (p_table->bucket_list[bucket] != 0) {
+
+        const SHC_COMMAND_TABLE_ENTRY* p_entry = &p_table->entry_list[p_table->bucket_list[bucket] - 1];
+
+        if (p_entry->hash == hash && strcmp(p_entry->key, p_key) == 0) {
+            return p_entry;
+        }
+
+        bucket = (bucket + 1) & p_table->bucket_mask;
+    }
+
+    return NULL;
+}
+
+u16 shc_command_table_hex_to_bytes(const char* p_hex, u8* p_buffer, u16 max_length) {
+
+    u16 length = 0;
+
+    while (p_hex[0] != '\0' && p_hex[0] != ' ') {
+
+        i8 high = shc_command_table_hex_value(p_hex[0]);
+        i8 low = shc_command_table_hex_value(p_hex[1]);
+
+        if (high < 0 || low < 0 || length >= max_length) {
+            return 0;
+        }
+
+        p_buffer[length++] = (u8)((high << 4) | low);
+        p_hex += 2;
+    }
+
+    return length;
+}
+
+void shc_command_table_bytes_to_hex(const u8* p_data, u16 length, char* p_hex, u16 max_length) {
+
+    static const char hex_table[] = "0123456789ABCDEF";
+
+    u16 i = 0;
+    for ( ; i < length && (u32)(i * 2 + 2) < max_length ; i++) {
+        p_hex[i * 2] = hex_table[p_data[i] >> 4];
+        p_hex[i * 2 + 1] = hex_table[p_data[i] & 0x0F];
+    }
+
+    if (max_length != 0) {
+        p_hex[i * 2] = '\0';
+    }
+}
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,351 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_command_table.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   In-memory table of the command-, report-, event-
+ *          and execute-file of the shcClient.
+ *
+ *          All files are parsed once into a single table. Commands
+ *          are found by an open-addressing hash-table with a single
+ *          lookup, independent of the size of the files.
+ *          The files are watched via inotify. If one of them has
+ *          changed a new table is built and swapped with the actual one.
+ *
+ *          Supported lines:
+ *
+ *          - cmd_<name>=com:<hex>          command for the control-board
+ *          - cmd_<name>=com@<board>:<hex>  command for the given control-board
+ *          - cmd_<name>=EXE:<shell>        shell-command
+ *          - exe_<name>=<shell>            shell-command (execute-file)
+ *          - rpt_<name>=com:<hex>          periodic report
+ *          - rpt_<name>=com@<board>:<hex>  periodic report of the given control-board
+ *          - evt_<name>=<hex>=<hex>        event (command, expected response)
+ *          - evt_<name>=@<board>:<hex>=<hex> event of the given control-board
+ *
+ *          <board> is the name of a control-board, see shc_host_board.h.
+ *          Without a name board 0 is used. Lines with an unknown
+ *          board are ignored. Lines starting with '#' are ignored.
+ *
+ *          The table must only be accessed from the main-loop.
+ *          A table returned by shc_command_table_get() is valid until
+ *          the next call of shc_command_table_task().
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_shc_command_table_
+#define _H_shc_command_table_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "common/signal_slot_interface.h"
+
+// --------------------------------------------------------------------------------
+
+#include "shc_event_matcher.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Maximum number of bytes of a single command
+ * or expected response
+ *
+ */
+#ifndef SHC_COMMAND_TABLE_MAX_COMMAND_LENGTH
+#define SHC_COMMAND_TABLE_MAX_COMMAND_LENGTH        64
+#endif
+
+/**
+ * @brief Maximum length of the name of a command
+ *
+ */
+#ifndef SHC_COMMAND_TABLE_MAX_KEY_LENGTH
+#define SHC_COMMAND_TABLE_MAX_KEY_LENGTH            64
+#endif
+
+// --------------------------------------------------------------------------------
+
+#define SHC_COMMAND_TABLE_FILE_COMMAND              0
+#define SHC_COMMAND_TABLE_FILE_REPORT               1
+#define SHC_COMMAND_TABLE_FILE_EVENT                2
+#define SHC_COMMAND_TABLE_FILE_EXECUTE              3
+#define SHC_COMMAND_TABLE_NUM_FILES                 4
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief The entry is a command for the control-board.
+ * The payload holds the binary command.
+ *
+ */
+#define SHC_COMMAND_TYPE_COM                        0
+
+/**
+ * @brief The entry is a shell-command.
+ * The payload holds the zero-terminated command.
+ *
+ */
+#define SHC_COMMAND_TYPE_EXE                        1
+
+/**
+ * @brief The entry is a periodic report.
+ * The payload holds the binary command.
+ *
+ */
+#define SHC_COMMAND_TYPE_REPORT                     2
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief A single command of the table
+ *
+ */
+typedef struct SHC_COMMAND_TABLE_ENTRY_STRUCT {
+
+    /**
+     * @brief zero-terminated name of the command, e.g. cmd_light_01_on
+     *
+     */
+    const char* key;
+
+    /**
+     * @brief hash of the key
+     *
+     */
+    u32 hash;
+
+    /**
+     * @brief one of SHC_COMMAND_TYPE_xxx
+     *
+     */
+    u8 type;
+
+    /**
+     * @brief control-board of the command, see shc_host_board.h
+     *
+     */
+    u8 board;
+
+    /**
+     * @brief number of bytes of the payload
+     *
+     */
+    u16 length;
+
+    /**
+     * @brief binary command or zero-terminated shell-command
+     *
+     */
+    const u8* p_payload;
+
+} SHC_COMMAND_TABLE_ENTRY;
+
+/**
+ * @brief A single event rule of the event-file
+ *
+ */
+typedef struct SHC_COMMAND_TABLE_EVENT_STRUCT {
+
+    /**
+     * @brief zero-terminated name of the event, e.g. evt_light_01_on
+     *
+     */
+    const char* key;
+
+    /**
+     * @brief control-board that is polled, see shc_host_board.h
+     *
+     */
+    u8 board;
+
+    /**
+     * @brief command that is used to poll the event
+     *
+     */
+    const u8* p_command;
+    u16 command_length;
+
+    /**
+     * @brief the event is raised if the response starts with these bytes
+     *
+     */
+    const u8* p_expected;
+    u16 expected_length;
+
+} SHC_COMMAND_TABLE_EVENT;
+
+/**
+ * @brief A complete table build from all files
+ *
+ */
+typedef struct SHC_COMMAND_TABLE_STRUCT {
+
+    /**
+     * @brief incremented on every successful reload
+     *
+     */
+    u32 generation;
+
+    u32 num_entries;
+    SHC_COMMAND_TABLE_ENTRY* entry_list;
+
+    /**
+     * @brief open-addressing hash-table, holds index + 1 of an entry or 0
+     *
+     */
+    u32 bucket_mask;
+    u32* bucket_list;
+
+    /**
+     * @brief indices of all reports grouped by their control-board,
+     * in the order of the report-file inside of a group
+     *
+     */
+    u32 num_reports;
+    u32* report_list;
+
+    u32 num_events;
+    SHC_COMMAND_TABLE_EVENT* event_list;
+
+    /**
+     * @brief the compiled rules of event_list
+     *
+     */
+    SHC_EVENT_MATCHER event_matcher;
+
+    /**
+     * @brief memory of all keys and payloads
+     *
+     */
+    u8* p_data;
+
+} SHC_COMMAND_TABLE;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Is send after a new table has been loaded.
+ * Argument is the new table of type SHC_COMMAND_TABLE
+ *
+ */
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(SHC_COMMAND_TABLE_LOADED_SIGNAL)
+
+/**
+ * @brief Is send if one of the files could not be opened.
+ * Argument is the path of the file as zero-terminated string
+ *
+ */
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(MSG_EXECUTER_FILE_OPEN_FAILED_SIGNAL)
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Initializes the command-table.
+ * The table is empty until shc_command_table_load() is called.
+ *
+ */
+void shc_command_table_init(void);
+
+/**
+ * @brief Releases the actual table and stops watching the files
+ *
+ */
+void shc_command_table_deinit(void);
+
+/**
+ * @brief Sets the path of one of the files. The file is loaded
+ * on the next call of shc_command_table_task().
+ *
+ * @param file_id one of SHC_COMMAND_TABLE_FILE_xxx
+ * @param p_path zero-terminated path of the file
+ */
+void shc_command_table_set_file(u8 file_id, const char* p_path);
+
+/**
+ * @brief Sets the interval of checking the modification time of the files.
+ * Only used if inotify is not available.
+ *
+ * @param interval_ms interval in milliseconds
+ */
+void shc_command_table_set_poll_interval(u32 interval_ms);
+
+/**
+ * @brief Builds a new table from all files and replaces the actual one.
+ * The actual table stays active if the new table cannot be built.
+ *
+ * @return 1 if the new table is active, otherwise 0
+ */
+u8 shc_command_table_load(void);
+
+/**
+ * @brief Requests a reload of all files on the next call of shc_command_table_task()
+ *
+ */
+void shc_command_table_request_reload(void);
+
+/**
+ * @brief Reloads the table if a file has changed.
+ * Must be called from the main-loop.
+ *
+ */
+void shc_command_table_task(void);
+
+/**
+ * @brief Get the actual table
+ *
+ * @return the actual table, never NULL
+ */
+const SHC_COMMAND_TABLE* shc_command_table_get(void);
+
+/**
+ * @brief Searches for a command inside of the given table
+ *
+ * @param p_table table to search in
+ * @param p_key zero-terminated name of the command
+ * @return the command or NULL if there is no command with this name
+ */
+const SHC_COMMAND_TABLE_ENTRY* shc_command_table_lookup(const SHC_COMMAND_TABLE* p_table, const char* p_key);
+
+/**
+ * @brief Converts a hex-string into binary data
+ *
+ * @param p_hex zero-terminated hex-string, e.g. "0704010100000000"
+ * @param p_buffer binary data is written into this buffer
+ * @param max_length size of p_buffer
+ * @return number of bytes written into p_buffer, 0 if p_hex is invalid
+ */
+u16 shc_command_table_hex_to_bytes(const char* p_hex, u8* p_buffer, u16 max_length);
+
+/**
+ * @brief Converts binary data into a zero-terminated upper-case hex-string
+ *
+ * @param p_data binary data
+ * @param length number of bytes of p_data
+ * @param p_hex hex-string is written into this buffer
+ * @param max_length size of p_hex including the zero-terminator
+ */
+void shc_command_table_bytes_to_hex(const u8* p_data, u16 length, char* p_hex, u16 max_length);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_shc_command_table_
+
+// --------------------------------------------------------------------------------
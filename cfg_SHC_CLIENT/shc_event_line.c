@@ -0,0 +1,380 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_event_line.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Implementation of the event-pending line of the control-board
+ *
+ * @see     shc_event_line.h
+ */
+
+#define TRACER_OFF
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "tracer.h"
+
+// --------------------------------------------------------------------------------
+
+#include "cpu.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/gpio.h>
+
+// --------------------------------------------------------------------------------
+
+#include "common/signal_slot_interface.h"
+
+#include "ui/cfg_file_parser/cfg_file_parser.h"
+
+// --------------------------------------------------------------------------------
+
+#include "shc_event_loop.h"
+#include "shc_event_line.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Default gpio character device, overwritten by EVENT_LINE_GPIO_CHIP
+ *
+ */
+#ifndef SHC_EVENT_LINE_GPIO_CHIP
+#define SHC_EVENT_LINE_GPIO_CHIP                    "/dev/gpiochip0"
+#endif
+
+/**
+ * @brief Maximum length of the path of the gpio character device
+ *
+ */
+#ifndef SHC_EVENT_LINE_PATH_MAX_LENGTH
+#define SHC_EVENT_LINE_PATH_MAX_LENGTH              64
+#endif
+
+/**
+ * @brief Name of the consumer of the gpio-line, see gpioinfo
+ *
+ */
+#define SHC_EVENT_LINE_CONSUMER                     "shcClient"
+
+/**
+ * @brief No line-offset is configured
+ *
+ */
+#define SHC_EVENT_LINE_OFFSET_INVALID               0xFFFFFFFF
+
+// --------------------------------------------------------------------------------
+
+#define SHC_EVENT_LINE_EDGE_FALLING                 0
+#define SHC_EVENT_LINE_EDGE_RISING                  1
+#define SHC_EVENT_LINE_EDGE_BOTH                    2
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Edge-event of the gpio character device,
+ * uAPI v1 is used with kernel-headers older than 5.10
+ *
+ */
+#ifdef GPIO_V2_GET_LINE_IOCTL
+typedef struct gpio_v2_line_event SHC_EVENT_LINE_EVENT_TYPE;
+#define SHC_EVENT_LINE_TIMESTAMP_NS(event)          (event).timestamp_ns
+#else
+typedef struct gpioevent_data SHC_EVENT_LINE_EVENT_TYPE;
+#define SHC_EVENT_LINE_TIMESTAMP_NS(event)          (event).timestamp
+#endif
+
+// --------------------------------------------------------------------------------
+
+static char chip_path[SHC_EVENT_LINE_PATH_MAX_LENGTH] = SHC_EVENT_LINE_GPIO_CHIP;
+static u32 line_offset = SHC_EVENT_LINE_OFFSET_INVALID;
+static u8 line_edge = SHC_EVENT_LINE_EDGE_FALLING;
+
+/**
+ * @brief The configuration has changed, the line is requested again
+ *
+ */
+static u8 request_pending = 0;
+
+/**
+ * @brief File-descriptor of the requested line, watched by the event-loop
+ *
+ */
+static int line_handle = -1;
+
+/**
+ * @brief Point in time of the last edge in microseconds,
+ * argument of SHC_EVENT_LINE_TRIGGERED_SIGNAL
+ *
+ */
+static u64 edge_timestamp_us = 0;
+
+static SHC_EVENT_LINE_STATISTIC statistic;
+
+// --------------------------------------------------------------------------------
+
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(SHC_EVENT_LINE_TRIGGERED_SIGNAL)
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Releases the requested line
+ *
+ */
+static void shc_event_line_release(void) {
+
+    if (line_handle < 0) {
+        return;
+    }
+
+    shc_event_loop_remove_fd(line_handle);
+    close(line_handle);
+
+    line_handle = -1;
+    statistic.active = 0;
+}
+
+/**
+ * @brief Requests the configured line from the gpio character device
+ * with edge-detection. The timestamps of the edges are taken from
+ * CLOCK_MONOTONIC, the clock of the event-loop.
+ *
+ * @param chip_handle file-descriptor of the gpio character device
+ * @return file-descriptor of the line or -1 on failure
+ */
+static int shc_event_line_request(int chip_handle) {
+
+#ifdef GPIO_V2_GET_LINE_IOCTL
+
+    struct gpio_v2_line_request request;
+    memset(&request, 0x00, sizeof(request));
+
+    request.offsets[0] = line_offset;
+    request.num_lines = 1;
+    request.config.flags = GPIO_V2_LINE_FLAG_INPUT;
+
+    if (line_edge != SHC_EVENT_LINE_EDGE_RISING) {
+        request.config.flags |= GPIO_V2_LINE_FLAG_EDGE_FALLING;
+    }
+
+    if (line_edge != SHC_EVENT_LINE_EDGE_FALLING) {
+        request.config.flags |= GPIO_V2_LINE_FLAG_EDGE_RISING;
+    }
+
+    snprintf(request.consumer, sizeof(request.consumer), "%s", SHC_EVENT_LINE_CONSUMER);
+
+    if (ioctl(chip_handle, GPIO_V2_GET_LINE_IOCTL, &request) < 0) {
+        return -1;
+    }
+
+    return request.fd;
+
+#else
+
+    struct gpioevent_request request;
+    memset(&request, 0x00, sizeof(request));
+
+    request.lineoffset = line_offset;
+    request.handleflags = GPIOHANDLE_REQUEST_INPUT;
+    request.eventflags = (line_edge == SHC_EVENT_LINE_EDGE_FALLING) ? GPIOEVENT_REQUEST_FALLING_EDGE
+                       : (line_edge == SHC_EVENT_LINE_EDGE_RISING) ? GPIOEVENT_REQUEST_RISING_EDGE
+                       : GPIOEVENT_REQUEST_BOTH_EDGES;
+
+    snprintf(request.consumer_label, sizeof(request.consumer_label), "%s", SHC_EVENT_LINE_CONSUMER);
+
+    if (ioctl(chip_handle, GPIO_GET_LINEEVENT_IOCTL, &request) < 0) {
+        return -1;
+    }
+
+    return request.fd;
+
+#endif
+}
+
+/**
+ * @brief Is called by the event-loop if there are edges to read.
+ * All edges that are read at once are reported as a single trigger,
+ * the executer polls all events anyway.
+ *
+ * @param fd file-descriptor of the line
+ * @param p_context not used
+ */
+static void shc_event_line_callback(int fd, void* p_context) {
+
+    (void) p_context;
+
+    SHC_EVENT_LINE_EVENT_TYPE event_list[16];
+
+    u64 timestamp_us = 0;
+    ssize_t length = 0;
+
+    while ((length = read(fd, event_list, sizeof(event_list))) > 0) {
+
+        u32 count = (u32)length / sizeof(event_list[0]);
+        if (count == 0) {
+            break;
+        }
+
+        if (timestamp_us == 0) {
+            timestamp_us = SHC_EVENT_LINE_TIMESTAMP_NS(event_list[0]) / 1000ULL;
+        }
+
+        statistic.edge_count += count;
+    }
+
+    if (timestamp_us == 0) {
+        return;
+    }
+
+    DEBUG_TRACE_long(statistic.edge_count, "shc_event_line_callback() - Edges:");
+
+    edge_timestamp_us = timestamp_us;
+    SHC_EVENT_LINE_TRIGGERED_SIGNAL_send(&edge_timestamp_us);
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Takes the gpio-line from the configuration-file.
+ *
+ * @param p_argument the configuration object of type CFG_FILE_PARSER_CFG_OBJECT_TYPE
+ */
+static void shc_event_line_CFG_OBJECT_RECEIVED_SLOT_CALLBACK(const void* p_argument) {
+
+    if (p_argument == NULL) {
+        DEBUG_PASS("shc_event_line_CFG_OBJECT_RECEIVED_SLOT_CALLBACK() - NULL_POINTER_EXCEPTION");
+        return;
+    }
+
+    const CFG_FILE_PARSER_CFG_OBJECT_TYPE* p_cfg_obj = (const CFG_FILE_PARSER_CFG_OBJECT_TYPE*)p_argument;
+
+    if (strcmp(p_cfg_obj->key, "EVENT_LINE_GPIO") == 0) {
+        line_offset = (u32)strtoul(p_cfg_obj->value, NULL, 10);
+        request_pending = 1;
+
+    } else if (strcmp(p_cfg_obj->key, "EVENT_LINE_GPIO_CHIP") == 0) {
+        snprintf(chip_path, sizeof(chip_path), "%s", p_cfg_obj->value);
+        request_pending = 1;
+
+    } else if (strcmp(p_cfg_obj->key, "EVENT_LINE_EDGE") == 0) {
+
+        if (strcmp(p_cfg_obj->value, "RISING") == 0) {
+            line_edge = SHC_EVENT_LINE_EDGE_RISING;
+        } else if (strcmp(p_cfg_obj->value, "BOTH") == 0) {
+            line_edge = SHC_EVENT_LINE_EDGE_BOTH;
+        } else {
+            line_edge = SHC_EVENT_LINE_EDGE_FALLING;
+        }
+
+        request_pending = 1;
+    }
+}
+
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(CFG_PARSER_NEW_CFG_OBJECT_SIGNAL, SHC_EVENT_LINE_CFG_OBJECT_RECEIVED_SLOT, shc_event_line_CFG_OBJECT_RECEIVED_SLOT_CALLBACK)
+
+// --------------------------------------------------------------------------------
+
+void shc_event_line_init(void) {
+
+    DEBUG_PASS("shc_event_line_init()");
+
+    SHC_EVENT_LINE_TRIGGERED_SIGNAL_init();
+
+    memset(&statistic, 0x00, sizeof(statistic));
+
+    line_handle = -1;
+    request_pending = 0;
+
+    SHC_EVENT_LINE_CFG_OBJECT_RECEIVED_SLOT_connect();
+}
+
+void shc_event_line_deinit(void) {
+
+    DEBUG_PASS("shc_event_line_deinit()");
+
+    shc_event_line_release();
+}
+
+void shc_event_line_task(void) {
+
+    if (request_pending == 0) {
+        return;
+    }
+
+    request_pending = 0;
+    shc_event_line_release();
+
+    if (line_offset == SHC_EVENT_LINE_OFFSET_INVALID) {
+        return;
+    }
+
+    int chip_handle = open(chip_path, O_RDONLY | O_CLOEXEC);
+    if (chip_handle < 0) {
+        DEBUG_TRACE_STR(chip_path, "shc_event_line_task() - Open gpio-chip has FAILED !!! ---");
+        return;
+    }
+
+    line_handle = shc_event_line_request(chip_handle);
+    close(chip_handle);
+
+    if (line_handle < 0) {
+        DEBUG_TRACE_long(line_offset, "shc_event_line_task() - Request gpio-line has FAILED !!! --- line:");
+        return;
+    }
+
+    fcntl(line_handle, F_SETFL, fcntl(line_handle, F_GETFL) | O_NONBLOCK);
+
+    if (shc_event_loop_add_fd(line_handle, shc_event_line_callback, NULL) == 0) {
+        DEBUG_PASS("shc_event_line_task() - Event-loop not available - using event-poll only");
+        close(line_handle);
+        line_handle = -1;
+        return;
+    }
+
+    DEBUG_TRACE_long(line_offset, "shc_event_line_task() - Watching gpio-line:");
+    statistic.active = 1;
+}
+
+void shc_event_line_add_latency(u32 latency_us) {
+
+    statistic.publish_count += 1;
+    statistic.latency_sum_us += latency_us;
+
+    if (latency_us > statistic.latency_max_us) {
+        statistic.latency_max_us = latency_us;
+    }
+}
+
+void shc_event_line_get_statistic(SHC_EVENT_LINE_STATISTIC* p_statistic) {
+
+    if (p_statistic == NULL) {
+        return;
+    }
+
+    memcpy(p_statistic, &statistic, sizeof(SHC_EVENT_LINE_STATISTIC));
+}
+
+// --------------------------------------------------------------------------------
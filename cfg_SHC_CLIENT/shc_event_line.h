@@ -0,0 +1,141 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_event_line.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Event-pending line of the control-board.
+ *
+ *          The control-board signals pending events via a gpio of the
+ *          raspberry pi. The line is requested from the gpio character
+ *          device with edge-detection and its file-descriptor is watched
+ *          by the event-loop. Every edge sends SHC_EVENT_LINE_TRIGGERED_SIGNAL
+ *          and the message-executer polls all events immediately.
+ *          The periodic event-poll (SCHEDULE_INTERVAL_EVENT_MS) stays
+ *          active as safety net and can be set to a larger interval.
+ *
+ *          Configuration (configuration-file):
+ *
+ *          - EVENT_LINE_GPIO=<line-offset> (not set: line is not used)
+ *          - EVENT_LINE_GPIO_CHIP=<path> (default /dev/gpiochip0)
+ *          - EVENT_LINE_EDGE=FALLING|RISING|BOTH (default FALLING)
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_shc_event_line_
+#define _H_shc_event_line_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "common/signal_slot_interface.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Is send on every edge of the event-line.
+ * Argument is the point in time of the edge in microseconds
+ * as const u64*, same clock as shc_event_loop_time_us()
+ *
+ */
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(SHC_EVENT_LINE_TRIGGERED_SIGNAL)
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Statistic of the event-line since shc_event_line_init()
+ *
+ */
+typedef struct SHC_EVENT_LINE_STATISTIC_STRUCT {
+
+    /**
+     * @brief The line is requested and watched by the event-loop
+     *
+     */
+    u8 active;
+
+    /**
+     * @brief Number of edges
+     *
+     */
+    u32 edge_count;
+
+    /**
+     * @brief Number of events that were published
+     * because of an edge
+     *
+     */
+    u32 publish_count;
+
+    /**
+     * @brief Sum of all edge-to-publish latencies in microseconds
+     *
+     */
+    u64 latency_sum_us;
+
+    /**
+     * @brief Maximum edge-to-publish latency in microseconds
+     *
+     */
+    u32 latency_max_us;
+
+} SHC_EVENT_LINE_STATISTIC;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Initializes the event-line module and connects
+ * to the configuration-parser. The line is requested by
+ * shc_event_line_task() as soon as it is configured.
+ *
+ */
+void shc_event_line_init(void);
+
+/**
+ * @brief Releases the gpio-line
+ *
+ */
+void shc_event_line_deinit(void);
+
+/**
+ * @brief Requests the gpio-line after a new configuration.
+ * Must be called from the main-loop.
+ *
+ */
+void shc_event_line_task(void);
+
+/**
+ * @brief Adds the latency of a published event to the statistic
+ *
+ * @param latency_us time between the edge and the publish of the event
+ */
+void shc_event_line_add_latency(u32 latency_us);
+
+/**
+ * @brief Get the actual statistic of the event-line
+ *
+ * @param p_statistic the statistic is copied into this structure
+ */
+void shc_event_line_get_statistic(SHC_EVENT_LINE_STATISTIC* p_statistic);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_shc_event_line_
+
+// --------------------------------------------------------------------------------
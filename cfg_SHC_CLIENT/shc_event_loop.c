@@ -0,0 +1,527 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_event_loop.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Implementation of the event driven idle handling
+ *          of the shcClient main-loop using epoll, timerfd and eventfd.
+ *
+ * @see     shc_event_loop.h
+ */
+
+#define TRACER_OFF
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "tracer.h"
+
+// --------------------------------------------------------------------------------
+
+#include "cpu.h"
+
+// --------------------------------------------------------------------------------
+
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <sys/eventfd.h>
+#include <sys/resource.h>
+
+// --------------------------------------------------------------------------------
+
+#include "shc_event_loop.h"
+#include "shc_task_profiler.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Maximum number of file-descriptors that can be
+ * registered via shc_event_loop_add_fd()
+ *
+ */
+#ifndef SHC_EVENT_LOOP_MAX_NUM_FD
+#define SHC_EVENT_LOOP_MAX_NUM_FD               24
+#endif
+
+/**
+ * @brief Default maximum time the main-loop sleeps if nothing happens
+ *
+ */
+#ifndef SHC_EVENT_LOOP_MAX_IDLE_MS
+#define SHC_EVENT_LOOP_MAX_IDLE_MS              50
+#endif
+
+/**
+ * @brief Interval of the main-loop while there is work in progress
+ *
+ */
+#ifndef SHC_EVENT_LOOP_BUSY_INTERVAL_US
+#define SHC_EVENT_LOOP_BUSY_INTERVAL_US         1000
+#endif
+
+/**
+ * @brief Time the main-loop stays in busy-mode after the last activity
+ *
+ */
+#ifndef SHC_EVENT_LOOP_ACTIVITY_HOLD_MS
+#define SHC_EVENT_LOOP_ACTIVITY_HOLD_MS         1000
+#endif
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief epoll user-data of the internal timerfd
+ *
+ */
+#define SHC_EVENT_LOOP_ID_TIMER                 (SHC_EVENT_LOOP_MAX_NUM_FD + 0)
+
+/**
+ * @brief epoll user-data of the internal eventfd
+ *
+ */
+#define SHC_EVENT_LOOP_ID_WAKEUP                (SHC_EVENT_LOOP_MAX_NUM_FD + 1)
+
+/**
+ * @brief Value of a deadline that was not set
+ *
+ */
+#define SHC_EVENT_LOOP_NO_DEADLINE              0xFFFFFFFFFFFFFFFFULL
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Entry of a registered file-descriptor
+ *
+ */
+typedef struct SHC_EVENT_LOOP_FD_ENTRY_STRUCT {
+    int fd;
+    SHC_EVENT_LOOP_FD_CALLBACK p_callback;
+    void* p_context;
+} SHC_EVENT_LOOP_FD_ENTRY;
+
+// --------------------------------------------------------------------------------
+
+static int epoll_handle = -1;
+static int timer_handle = -1;
+static int wakeup_handle = -1;
+
+static u8 loop_mode = SHC_EVENT_LOOP_MODE_POLLING;
+static u32 max_idle_time_ms = SHC_EVENT_LOOP_MAX_IDLE_MS;
+
+/**
+ * @brief earliest deadline that was requested since the last wait
+ *
+ */
+static u64 next_deadline_us = SHC_EVENT_LOOP_NO_DEADLINE;
+
+/**
+ * @brief busy-mode is active until this point in time
+ *
+ */
+static u64 activity_until_us = 0;
+
+/**
+ * @brief point in time the timerfd was armed for,
+ * used to measure the latency of timer wakeups
+ *
+ */
+static u64 armed_deadline_us = 0;
+
+/**
+ * @brief point in time of the first shc_event_loop_wakeup()
+ * since the last dispatch, written by foreign threads
+ *
+ */
+static u64 wakeup_requested_us = 0;
+
+static u64 start_time_us = 0;
+static u64 start_cpu_time_us = 0;
+
+static SHC_EVENT_LOOP_FD_ENTRY fd_table[SHC_EVENT_LOOP_MAX_NUM_FD];
+static SHC_EVENT_LOOP_STATISTIC statistic;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Get the consumed cpu-time of this process in microseconds
+ *
+ * @return user + system time in microseconds
+ */
+static u64 shc_event_loop_cpu_time_us(void) {
+
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+
+    return    (u64)usage.ru_utime.tv_sec * 1000000ULL + (u64)usage.ru_utime.tv_usec
+            + (u64)usage.ru_stime.tv_sec * 1000000ULL + (u64)usage.ru_stime.tv_usec;
+}
+
+/**
+ * @brief Adds a single latency measurement to the given statistic
+ *
+ * @param p_statistic statistic to update
+ * @param latency_us measured latency in microseconds
+ */
+static void shc_event_loop_add_latency(SHC_EVENT_LOOP_WAKEUP_STATISTIC* p_statistic, u64 latency_us) {
+
+    if (latency_us > 0xFFFFFFFFULL) {
+        latency_us = 0xFFFFFFFFULL;
+    }
+
+    p_statistic->count += 1;
+    p_statistic->latency_sum_us += latency_us;
+
+    if ((u32)latency_us > p_statistic->latency_max_us) {
+        p_statistic->latency_max_us = (u32)latency_us;
+    }
+}
+
+/**
+ * @brief Arms the timerfd to expire at the given absolute monotonic time
+ *
+ * @param deadline_us absolute monotonic time in microseconds
+ */
+static void shc_event_loop_arm_timer(u64 deadline_us) {
+
+    struct itimerspec timer_value;
+    memset(&timer_value, 0x00, sizeof(timer_value));
+
+    timer_value.it_value.tv_sec = (time_t)(deadline_us / 1000000ULL);
+    timer_value.it_value.tv_nsec = (long)((deadline_us % 1000000ULL) * 1000ULL);
+
+    if (timer_value.it_value.tv_sec == 0 && timer_value.it_value.tv_nsec == 0) {
+        // a zero value would disarm the timer
+        timer_value.it_value.tv_nsec = 1;
+    }
+
+    armed_deadline_us = deadline_us;
+    timerfd_settime(timer_handle, TFD_TIMER_ABSTIME, &timer_value, NULL);
+}
+
+/**
+ * @brief Dispatches a single epoll event
+ *
+ * @param id user-data of the epoll event
+ * @param now_us actual monotonic time
+ */
+static void shc_event_loop_dispatch(u32 id, u64 now_us) {
+
+    if (id == SHC_EVENT_LOOP_ID_TIMER) {
+
+        u64 expirations = 0;
+        if (read(timer_handle, &expirations, sizeof(expirations)) > 0) {
+            shc_event_loop_add_latency(&statistic.timer, now_us > armed_deadline_us ? now_us - armed_deadline_us : 0);
+        }
+
+        return;
+    }
+
+    if (id == SHC_EVENT_LOOP_ID_WAKEUP) {
+
+        u64 counter = 0;
+        if (read(wakeup_handle, &counter, sizeof(counter)) > 0) {
+
+            u64 requested_us = __atomic_exchange_n(&wakeup_requested_us, 0, __ATOMIC_ACQ_REL);
+            if (requested_us != 0) {
+                shc_event_loop_add_latency(&statistic.wakeup, now_us > requested_us ? now_us - requested_us : 0);
+            }
+        }
+
+        return;
+    }
+
+    if (id >= SHC_EVENT_LOOP_MAX_NUM_FD) {
+        return;
+    }
+
+    SHC_EVENT_LOOP_FD_ENTRY* p_entry = &fd_table[id];
+    if (p_entry->fd < 0 || p_entry->p_callback == NULL) {
+        return;
+    }
+
+    statistic.fd_count += 1;
+    SHC_TASK_PROFILER_RUN(SHC_TASK_PROFILER_TASK_FD_CALLBACK, p_entry->p_callback(p_entry->fd, p_entry->p_context));
+}
+
+// --------------------------------------------------------------------------------
+
+u8 shc_event_loop_init(void) {
+
+    DEBUG_PASS("shc_event_loop_init()");
+
+    u8 i = 0;
+    for ( ; i < SHC_EVENT_LOOP_MAX_NUM_FD ; i++) {
+        fd_table[i].fd = -1;
+        fd_table[i].p_callback = NULL;
+        fd_table[i].p_context = NULL;
+    }
+
+    memset(&statistic, 0x00, sizeof(statistic));
+
+    start_time_us = shc_event_loop_time_us();
+    start_cpu_time_us = shc_event_loop_cpu_time_us();
+    next_deadline_us = SHC_EVENT_LOOP_NO_DEADLINE;
+    activity_until_us = 0;
+
+    epoll_handle = epoll_create1(EPOLL_CLOEXEC);
+    timer_handle = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    wakeup_handle = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    if (epoll_handle < 0 || timer_handle < 0 || wakeup_handle < 0) {
+        DEBUG_PASS("shc_event_loop_init() - Creating file-descriptors has FAILED !!! ---");
+        shc_event_loop_deinit();
+        return 0;
+    }
+
+    struct epoll_event event;
+    memset(&event, 0x00, sizeof(event));
+
+    event.events = EPOLLIN;
+    event.data.u32 = SHC_EVENT_LOOP_ID_TIMER;
+
+    if (epoll_ctl(epoll_handle, EPOLL_CTL_ADD, timer_handle, &event) != 0) {
+        DEBUG_PASS("shc_event_loop_init() - Adding timerfd has FAILED !!! ---");
+        shc_event_loop_deinit();
+        return 0;
+    }
+
+    event.events = EPOLLIN;
+    event.data.u32 = SHC_EVENT_LOOP_ID_WAKEUP;
+
+    if (epoll_ctl(epoll_handle, EPOLL_CTL_ADD, wakeup_handle, &event) != 0) {
+        DEBUG_PASS("shc_event_loop_init() - Adding eventfd has FAILED !!! ---");
+        shc_event_loop_deinit();
+        return 0;
+    }
+
+    loop_mode = SHC_EVENT_LOOP_MODE_EVENT;
+    return 1;
+}
+
+void shc_event_loop_deinit(void) {
+
+    DEBUG_PASS("shc_event_loop_deinit()");
+
+    if (wakeup_handle >= 0) {
+        close(wakeup_handle);
+        wakeup_handle = -1;
+    }
+
+    if (timer_handle >= 0) {
+        close(timer_handle);
+        timer_handle = -1;
+    }
+
+    if (epoll_handle >= 0) {
+        close(epoll_handle);
+        epoll_handle = -1;
+    }
+
+    loop_mode = SHC_EVENT_LOOP_MODE_POLLING;
+}
+
+void shc_event_loop_set_mode(u8 mode) {
+
+    DEBUG_TRACE_byte(mode, "shc_event_loop_set_mode()");
+
+    if (mode == SHC_EVENT_LOOP_MODE_EVENT && epoll_handle < 0) {
+        DEBUG_PASS("shc_event_loop_set_mode() - Event-loop not initialized - stay in polling mode");
+        return;
+    }
+
+    loop_mode = mode;
+}
+
+u8 shc_event_loop_get_mode(void) {
+    return loop_mode;
+}
+
+void shc_event_loop_set_max_idle_time(u32 max_idle_ms) {
+
+    DEBUG_TRACE_long(max_idle_ms, "shc_event_loop_set_max_idle_time()");
+
+    if (max_idle_ms == 0) {
+        return;
+    }
+
+    max_idle_time_ms = max_idle_ms;
+}
+
+u8 shc_event_loop_add_fd(int fd, SHC_EVENT_LOOP_FD_CALLBACK p_callback, void* p_context) {
+
+    if (fd < 0 || p_callback == NULL) {
+        DEBUG_PASS("shc_event_loop_add_fd() - Invalid argument");
+        return 0;
+    }
+
+    if (epoll_handle < 0) {
+        DEBUG_PASS("shc_event_loop_add_fd() - Event-loop not initialized");
+        return 0;
+    }
+
+    u32 i = 0;
+    for ( ; i < SHC_EVENT_LOOP_MAX_NUM_FD ; i++) {
+
+        if (fd_table[i].fd >= 0) {
+            continue;
+        }
+
+        struct epoll_event event;
+        memset(&event, 0x00, sizeof(event));
+
+        event.events = EPOLLIN;
+        event.data.u32 = i;
+
+        if (epoll_ctl(epoll_handle, EPOLL_CTL_ADD, fd, &event) != 0) {
+            DEBUG_PASS("shc_event_loop_add_fd() - epoll_ctl() has FAILED !!! ---");
+            return 0;
+        }
+
+        fd_table[i].fd = fd;
+        fd_table[i].p_callback = p_callback;
+        fd_table[i].p_context = p_context;
+
+        return 1;
+    }
+
+    DEBUG_PASS("shc_event_loop_add_fd() - No free entry available");
+    return 0;
+}
+
+void shc_event_loop_remove_fd(int fd) {
+
+    u32 i = 0;
+    for ( ; i < SHC_EVENT_LOOP_MAX_NUM_FD ; i++) {
+
+        if (fd_table[i].fd != fd) {
+            continue;
+        }
+
+        epoll_ctl(epoll_handle, EPOLL_CTL_DEL, fd, NULL);
+
+        fd_table[i].fd = -1;
+        fd_table[i].p_callback = NULL;
+        fd_table[i].p_context = NULL;
+    }
+}
+
+void shc_event_loop_set_deadline(u32 timeout_ms) {
+
+    u64 deadline_us = shc_event_loop_time_us() + (u64)timeout_ms * 1000ULL;
+
+    if (deadline_us < next_deadline_us) {
+        next_deadline_us = deadline_us;
+    }
+
+    shc_task_profiler_deadline(deadline_us);
+}
+
+void shc_event_loop_activity(void) {
+    activity_until_us = shc_event_loop_time_us() + (u64)SHC_EVENT_LOOP_ACTIVITY_HOLD_MS * 1000ULL;
+}
+
+void shc_event_loop_wakeup(void) {
+
+    if (wakeup_handle < 0) {
+        return;
+    }
+
+    u64 expected = 0;
+    u64 now_us = shc_event_loop_time_us();
+
+    // only the first request since the last dispatch is measured
+    __atomic_compare_exchange_n(&wakeup_requested_us, &expected, now_us, 0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+
+    u64 counter = 1;
+    if (write(wakeup_handle, &counter, sizeof(counter)) < 0) {
+        DEBUG_PASS("shc_event_loop_wakeup() - write() has FAILED !!! ---");
+    }
+}
+
+void shc_event_loop_wait(void) {
+
+    statistic.loop_count += 1;
+
+    if (epoll_handle < 0) {
+        return;
+    }
+
+    u64 now_us = shc_event_loop_time_us();
+    int timeout_ms = 0;
+
+    if (loop_mode == SHC_EVENT_LOOP_MODE_EVENT) {
+
+        u64 wakeup_us = now_us + (u64)max_idle_time_ms * 1000ULL;
+
+        if (activity_until_us > now_us) {
+            wakeup_us = now_us + SHC_EVENT_LOOP_BUSY_INTERVAL_US;
+        }
+
+        if (next_deadline_us < wakeup_us) {
+            wakeup_us = next_deadline_us;
+        }
+
+        shc_event_loop_arm_timer(wakeup_us);
+        timeout_ms = -1;
+    }
+
+    next_deadline_us = SHC_EVENT_LOOP_NO_DEADLINE;
+
+    struct epoll_event events[SHC_EVENT_LOOP_MAX_NUM_FD + 2];
+    int num_events = epoll_wait(epoll_handle, events, SHC_EVENT_LOOP_MAX_NUM_FD + 2, timeout_ms);
+
+    if (num_events <= 0) {
+        // nothing happened or interrupted by a signal
+        return;
+    }
+
+    now_us = shc_event_loop_time_us();
+
+    int i = 0;
+    for ( ; i < num_events ; i++) {
+        shc_event_loop_dispatch(events[i].data.u32, now_us);
+    }
+}
+
+void shc_event_loop_get_statistic(SHC_EVENT_LOOP_STATISTIC* p_statistic) {
+
+    if (p_statistic == NULL) {
+        return;
+    }
+
+    memcpy(p_statistic, &statistic, sizeof(SHC_EVENT_LOOP_STATISTIC));
+
+    p_statistic->runtime_ms = (u32)((shc_event_loop_time_us() - start_time_us) / 1000ULL);
+    p_statistic->cpu_time_ms = (u32)((shc_event_loop_cpu_time_us() - start_cpu_time_us) / 1000ULL);
+}
+
+u64 shc_event_loop_time_us(void) {
+
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (u64)now.tv_sec * 1000000ULL + (u64)now.tv_nsec / 1000ULL;
+}
+
+// --------------------------------------------------------------------------------
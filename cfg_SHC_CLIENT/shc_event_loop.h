@@ -0,0 +1,277 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_event_loop.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Event driven idle handling for the main-loop of the shcClient.
+ *
+ *          Instead of spinning on mcu_task_controller_schedule() the main-loop
+ *          calls shc_event_loop_wait() after every schedule cycle. Depending on
+ *          the actual scheduling mode the call returns immediately (POLLING)
+ *          or blocks (EVENT) until one of the following happens:
+ *
+ *          - the next requested deadline is reached (timerfd)
+ *          - a registered file-descriptor gets readable (epoll)
+ *          - another thread has called shc_event_loop_wakeup() (eventfd)
+ *
+ *          While there is activity (e.g. a command is in progress) the loop
+ *          wakes up every SHC_EVENT_LOOP_BUSY_INTERVAL_US so the tasks of the
+ *          framework are polled as fast as they need to be.
+ *
+ *          The main-loop is not fully event driven:
+ *
+ *          - the tasks of the framework (e.g. the SPI-communication with the
+ *            host-board) and the MQTT-interface do not own a file-descriptor.
+ *            The paho-thread signals received and delivered messages by
+ *            shc_event_loop_wakeup(), everything else is polled.
+ *          - after shc_event_loop_activity() the loop polls every
+ *            SHC_EVENT_LOOP_BUSY_INTERVAL_US (1 ms) for
+ *            SHC_EVENT_LOOP_ACTIVITY_HOLD_MS
+ *          - without any event the loop still wakes up every
+ *            SCHEDULE_MAX_IDLE_MS, for the tasks that can not signal work
+ *
+ *          see unittest/benchmark_shc_event_loop.c for idle-cpu and
+ *          wake-to-dispatch latency compared to the spinning main-loop.
+ *
+ *          Usage:
+ *
+ *              shc_event_loop_init();
+ *
+ *              for (;;) {
+ *                  mcu_task_controller_schedule();
+ *                  mcu_task_controller_background_run();
+ *                  shc_event_loop_wait();
+ *              }
+ *
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_shc_event_loop_
+#define _H_shc_event_loop_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief The main-loop runs without any sleep.
+ * This is the behavior of the shcClient up to version 5.12
+ *
+ */
+#define SHC_EVENT_LOOP_MODE_POLLING             0
+
+/**
+ * @brief The main-loop blocks until there is something to do.
+ *
+ */
+#define SHC_EVENT_LOOP_MODE_EVENT               1
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Callback that is invoked by the event-loop if a
+ * registered file-descriptor has become readable.
+ *
+ * @param fd the file-descriptor that is readable
+ * @param p_context the context that was given on registration
+ */
+typedef void (*SHC_EVENT_LOOP_FD_CALLBACK)(int fd, void* p_context);
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Statistic of a single wakeup source of the event-loop.
+ * Latency is the time between the moment the wakeup was requested
+ * and the moment the main-loop is dispatching again.
+ *
+ */
+typedef struct SHC_EVENT_LOOP_WAKEUP_STATISTIC_STRUCT {
+
+    /**
+     * @brief Number of wakeups caused by this source
+     *
+     */
+    u32 count;
+
+    /**
+     * @brief Sum of all measured latencies in microseconds
+     *
+     */
+    u64 latency_sum_us;
+
+    /**
+     * @brief Maximum measured latency in microseconds
+     *
+     */
+    u32 latency_max_us;
+
+} SHC_EVENT_LOOP_WAKEUP_STATISTIC;
+
+/**
+ * @brief Statistic of the event-loop since shc_event_loop_init()
+ *
+ */
+typedef struct SHC_EVENT_LOOP_STATISTIC_STRUCT {
+
+    /**
+     * @brief Number of calls of shc_event_loop_wait()
+     *
+     */
+    u64 loop_count;
+
+    /**
+     * @brief Wakeups because a deadline or the busy-interval has expired
+     *
+     */
+    SHC_EVENT_LOOP_WAKEUP_STATISTIC timer;
+
+    /**
+     * @brief Wakeups requested by shc_event_loop_wakeup()
+     *
+     */
+    SHC_EVENT_LOOP_WAKEUP_STATISTIC wakeup;
+
+    /**
+     * @brief Number of dispatched file-descriptor callbacks
+     *
+     */
+    u32 fd_count;
+
+    /**
+     * @brief Wall-clock time in milliseconds since shc_event_loop_init()
+     *
+     */
+    u32 runtime_ms;
+
+    /**
+     * @brief CPU-time (user + system) in milliseconds since shc_event_loop_init()
+     *
+     */
+    u32 cpu_time_ms;
+
+} SHC_EVENT_LOOP_STATISTIC;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Creates the epoll, timerfd and eventfd instances of the event-loop.
+ * If the initialization fails the event-loop falls back to SHC_EVENT_LOOP_MODE_POLLING.
+ *
+ * @return 1 if the event-loop was initialized successful, otherwise 0
+ */
+u8 shc_event_loop_init(void);
+
+/**
+ * @brief Closes all file-descriptors of the event-loop.
+ * Registered file-descriptors are not closed.
+ *
+ */
+void shc_event_loop_deinit(void);
+
+/**
+ * @brief Sets the scheduling mode of the main-loop.
+ *
+ * @param mode SHC_EVENT_LOOP_MODE_POLLING or SHC_EVENT_LOOP_MODE_EVENT
+ */
+void shc_event_loop_set_mode(u8 mode);
+
+/**
+ * @brief Get the actual scheduling mode of the main-loop
+ *
+ * @return SHC_EVENT_LOOP_MODE_POLLING or SHC_EVENT_LOOP_MODE_EVENT
+ */
+u8 shc_event_loop_get_mode(void);
+
+/**
+ * @brief Sets the maximum time the main-loop will sleep
+ * if there is nothing to do. This is a safety-net for
+ * tasks that are not able to signal pending work.
+ *
+ * @param max_idle_ms maximum idle time in milliseconds, 0 is ignored
+ */
+void shc_event_loop_set_max_idle_time(u32 max_idle_ms);
+
+/**
+ * @brief Registers a file-descriptor. The given callback is invoked
+ * from inside of shc_event_loop_wait() if the file-descriptor is readable.
+ *
+ * @param fd file-descriptor to watch
+ * @param p_callback callback to invoke if fd is readable
+ * @param p_context user-context that is given to the callback
+ * @return 1 on success, otherwise 0
+ */
+u8 shc_event_loop_add_fd(int fd, SHC_EVENT_LOOP_FD_CALLBACK p_callback, void* p_context);
+
+/**
+ * @brief Removes a file-descriptor that was registered via shc_event_loop_add_fd()
+ *
+ * @param fd file-descriptor to remove
+ */
+void shc_event_loop_remove_fd(int fd);
+
+/**
+ * @brief Requests the main-loop to run again not later than
+ * the given time from now. Deadlines are collected until the
+ * next call of shc_event_loop_wait(), the earliest one wins.
+ *
+ * @param timeout_ms time from now in milliseconds
+ */
+void shc_event_loop_set_deadline(u32 timeout_ms);
+
+/**
+ * @brief Signals that there is work in progress. The main-loop
+ * polls the tasks with SHC_EVENT_LOOP_BUSY_INTERVAL_US until
+ * SHC_EVENT_LOOP_ACTIVITY_HOLD_MS have passed without further activity.
+ *
+ */
+void shc_event_loop_activity(void);
+
+/**
+ * @brief Wakes up the main-loop. Can be called from any thread.
+ *
+ */
+void shc_event_loop_wakeup(void);
+
+/**
+ * @brief Blocks until there is something to do (SHC_EVENT_LOOP_MODE_EVENT)
+ * and dispatches all readable file-descriptors. In SHC_EVENT_LOOP_MODE_POLLING
+ * this function does not block.
+ *
+ */
+void shc_event_loop_wait(void);
+
+/**
+ * @brief Get the actual statistic of the event-loop.
+ *
+ * @param p_statistic the statistic is copied into this structure
+ */
+void shc_event_loop_get_statistic(SHC_EVENT_LOOP_STATISTIC* p_statistic);
+
+/**
+ * @brief Get the actual value of the monotonic clock in microseconds.
+ *
+ * @return monotonic time in microseconds
+ */
+u64 shc_event_loop_time_us(void);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_shc_event_loop_
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,341 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_event_matcher.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Implementation of the precompiled event-matcher
+ *
+ * @see     shc_event_matcher.h
+ */
+
+#define TRACER_OFF
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "tracer.h"
+
+// --------------------------------------------------------------------------------
+
+#include "cpu.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdlib.h>
+#include <string.h>
+
+// --------------------------------------------------------------------------------
+
+#include "shc_event_matcher.h"
+#include "shc_command_table.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief FNV-1a hash over binary data
+ *
+ * @param hash start value of the hash
+ * @param p_data data to hash
+ * @param length number of bytes of p_data
+ * @return hash of p_data
+ */
+static u32 shc_event_matcher_hash(u32 hash, const u8* p_data, u16 length) {
+
+    u16 i = 0;
+    for ( ; i < length ; i++) {
+        hash ^= p_data[i];
+        hash *= 16777619UL;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief Hash of a poll-command of a control-board
+ *
+ */
+static u32 shc_event_matcher_group_hash(u8 board, const u8* p_command, u16 length) {
+    return shc_event_matcher_hash(shc_event_matcher_hash(2166136261UL, &board, 1), p_command, length);
+}
+
+/**
+ * @brief Hash of an expected prefix of a group
+ *
+ */
+static u32 shc_event_matcher_rule_hash(u32 group, const u8* p_prefix, u16 length) {
+    u8 group_bytes[4] = { (u8)(group >> 24), (u8)(group >> 16), (u8)(group >> 8), (u8)group };
+    return shc_event_matcher_hash(shc_event_matcher_hash(2166136261UL, group_bytes, sizeof(group_bytes)), p_prefix, length);
+}
+
+/**
+ * @brief Calculates the number of buckets of a hash-table
+ * with a load-factor below 0.5
+ *
+ * @param count number of elements
+ * @return number of buckets, always a power of 2
+ */
+static u32 shc_event_matcher_num_buckets(u32 count) {
+
+    u32 num_buckets = 16;
+    while (num_buckets < count * 2) {
+        num_buckets *= 2;
+    }
+
+    return num_buckets;
+}
+
+/**
+ * @brief Returns the group of the given poll-command, a new group is
+ * created if there is no group for this command.
+ *
+ * @param p_matcher the matcher
+ * @param p_event event that holds the poll-command
+ * @return index of the group
+ */
+static u32 shc_event_matcher_get_group(SHC_EVENT_MATCHER* p_matcher, const SHC_COMMAND_TABLE_EVENT* p_event) {
+
+    u32 hash = shc_event_matcher_group_hash(p_event->board, p_event->p_command, p_event->command_length);
+    u32 bucket = hash & p_matcher->group_bucket_mask;
+
+    while (p_matcher->group_bucket_list[bucket] != 0) {
+
+        u32 group = p_matcher->group_bucket_list[bucket] - 1;
+        const SHC_EVENT_MATCHER_GROUP* p_group = &p_matcher->group_list[group];
+
+        if (p_group->hash == hash &&
+            p_group->board == p_event->board &&
+            p_group->command_length == p_event->command_length &&
+            memcmp(p_group->p_command, p_event->p_command, p_event->command_length) == 0) {
+
+            return group;
+        }
+
+        bucket = (bucket + 1) & p_matcher->group_bucket_mask;
+    }
+
+    u32 group = p_matcher->num_groups++;
+    SHC_EVENT_MATCHER_GROUP* p_group = &p_matcher->group_list[group];
+
+    p_group->board = p_event->board;
+    p_group->p_command = p_event->p_command;
+    p_group->command_length = p_event->command_length;
+    p_group->hash = hash;
+    p_group->num_prefix_lengths = 0;
+
+    p_matcher->group_bucket_list[bucket] = group + 1;
+
+    return group;
+}
+
+/**
+ * @brief Adds the prefix-length of a rule to its group.
+ * The list is sorted, longest prefix first.
+ *
+ * @param p_group the group of the rule
+ * @param length the length of the expected prefix
+ * @return 1 on success, 0 if the group has too many different lengths
+ */
+static u8 shc_event_matcher_add_length(SHC_EVENT_MATCHER_GROUP* p_group, u16 length) {
+
+    u8 position = 0;
+
+    for ( ; position < p_group->num_prefix_lengths ; position++) {
+
+        if (p_group->prefix_length_list[position] == length) {
+            return 1;
+        }
+
+        if (p_group->prefix_length_list[position] < length) {
+            break;
+        }
+    }
+
+    if (p_group->num_prefix_lengths == SHC_EVENT_MATCHER_MAX_PREFIX_LENGTHS) {
+        return 0;
+    }
+
+    memmove(
+        &p_group->prefix_length_list[position + 1],
+        &p_group->prefix_length_list[position],
+        (p_group->num_prefix_lengths - position) * sizeof(u16)
+    );
+
+    p_group->prefix_length_list[position] = length;
+    p_group->num_prefix_lengths += 1;
+
+    return 1;
+}
+
+/**
+ * @brief Searches for a rule inside of the rule hash-table.
+ *
+ * @param p_matcher the matcher
+ * @param group index of the group
+ * @param p_prefix the prefix to search for
+ * @param length number of bytes of p_prefix
+ * @param p_bucket the bucket of the rule or the first free bucket
+ * @return index of the event or SHC_EVENT_MATCHER_NOT_FOUND
+ */
+static u32 shc_event_matcher_find_rule(const SHC_EVENT_MATCHER* p_matcher, u32 group, const u8* p_prefix, u16 length, u32* p_bucket) {
+
+    u32 bucket = shc_event_matcher_rule_hash(group, p_prefix, length) & p_matcher->rule_bucket_mask;
+
+    while (p_matcher->rule_bucket_list[bucket] != 0) {
+
+        u32 index = p_matcher->rule_bucket_list[bucket] - 1;
+        const SHC_COMMAND_TABLE_EVENT* p_event = &p_matcher->p_event_list[index];
+
+        if (p_matcher->rule_group_list[index] == group &&
+            p_event->expected_length == length &&
+            memcmp(p_event->p_expected, p_prefix, length) == 0) {
+
+            *p_bucket = bucket;
+            return index;
+        }
+
+        bucket = (bucket + 1) & p_matcher->rule_bucket_mask;
+    }
+
+    *p_bucket = bucket;
+    return SHC_EVENT_MATCHER_NOT_FOUND;
+}
+
+// --------------------------------------------------------------------------------
+
+u8 shc_event_matcher_create(SHC_EVENT_MATCHER* p_matcher, const SHC_COMMAND_TABLE_EVENT* p_event_list, u32 num_events) {
+
+    DEBUG_TRACE_long(num_events, "shc_event_matcher_create()");
+
+    memset(p_matcher, 0x00, sizeof(SHC_EVENT_MATCHER));
+
+    u32 num_buckets = shc_event_matcher_num_buckets(num_events);
+
+    p_matcher->p_event_list = p_event_list;
+    p_matcher->num_events = num_events;
+
+    p_matcher->group_list = (SHC_EVENT_MATCHER_GROUP*)calloc(num_events + 1, sizeof(SHC_EVENT_MATCHER_GROUP));
+    p_matcher->group_bucket_list = (u32*)calloc(num_buckets, sizeof(u32));
+    p_matcher->rule_bucket_list = (u32*)calloc(num_buckets, sizeof(u32));
+    p_matcher->rule_group_list = (u32*)calloc(num_events + 1, sizeof(u32));
+
+    if (p_matcher->group_list == NULL || p_matcher->group_bucket_list == NULL ||
+        p_matcher->rule_bucket_list == NULL || p_matcher->rule_group_list == NULL) {
+
+        shc_event_matcher_free(p_matcher);
+        return 0;
+    }
+
+    p_matcher->group_bucket_mask = num_buckets - 1;
+    p_matcher->rule_bucket_mask = num_buckets - 1;
+
+    u32 i = 0;
+    for ( ; i < num_events ; i++) {
+
+        const SHC_COMMAND_TABLE_EVENT* p_event = &p_event_list[i];
+
+        u32 group = shc_event_matcher_get_group(p_matcher, p_event);
+        p_matcher->rule_group_list[i] = SHC_EVENT_MATCHER_NOT_FOUND;
+
+        u32 bucket = 0;
+        if (shc_event_matcher_find_rule(p_matcher, group, p_event->p_expected, p_event->expected_length, &bucket) != SHC_EVENT_MATCHER_NOT_FOUND) {
+            DEBUG_TRACE_STR(p_event->key, "shc_event_matcher_create() - Duplicate rule");
+            continue;
+        }
+
+        if (shc_event_matcher_add_length(&p_matcher->group_list[group], p_event->expected_length) == 0) {
+            DEBUG_TRACE_STR(p_event->key, "shc_event_matcher_create() - Too many prefix-lengths");
+            continue;
+        }
+
+        p_matcher->rule_group_list[i] = group;
+        p_matcher->rule_bucket_list[bucket] = i + 1;
+    }
+
+    DEBUG_TRACE_long(p_matcher->num_groups, "shc_event_matcher_create() - Groups");
+
+    return 1;
+}
+
+void shc_event_matcher_free(SHC_EVENT_MATCHER* p_matcher) {
+
+    free(p_matcher->group_list);
+    free(p_matcher->group_bucket_list);
+    free(p_matcher->rule_bucket_list);
+    free(p_matcher->rule_group_list);
+
+    memset(p_matcher, 0x00, sizeof(SHC_EVENT_MATCHER));
+}
+
+u32 shc_event_matcher_find_group(const SHC_EVENT_MATCHER* p_matcher, u8 board, const u8* p_command, u16 length) {
+
+    if (p_matcher->num_groups == 0) {
+        return SHC_EVENT_MATCHER_NOT_FOUND;
+    }
+
+    u32 hash = shc_event_matcher_group_hash(board, p_command, length);
+    u32 bucket = hash & p_matcher->group_bucket_mask;
+
+    while (p_matcher->group_bucket_list[bucket] != 0) {
+
+        u32 group = p_matcher->group_bucket_list[bucket] - 1;
+        const SHC_EVENT_MATCHER_GROUP* p_group = &p_matcher->group_list[group];
+
+        if (p_group->hash == hash &&
+            p_group->board == board &&
+            p_group->command_length == length &&
+            memcmp(p_group->p_command, p_command, length) == 0) {
+
+            return group;
+        }
+
+        bucket = (bucket + 1) & p_matcher->group_bucket_mask;
+    }
+
+    return SHC_EVENT_MATCHER_NOT_FOUND;
+}
+
+u32 shc_event_matcher_match(const SHC_EVENT_MATCHER* p_matcher, u32 group, const u8* p_response, u16 length) {
+
+    if (group >= p_matcher->num_groups) {
+        return SHC_EVENT_MATCHER_NOT_FOUND;
+    }
+
+    const SHC_EVENT_MATCHER_GROUP* p_group = &p_matcher->group_list[group];
+
+    u8 i = 0;
+    for ( ; i < p_group->num_prefix_lengths ; i++) {
+
+        u16 prefix_length = p_group->prefix_length_list[i];
+
+        if (prefix_length > length) {
+            continue;
+        }
+
+        u32 bucket = 0;
+        u32 index = shc_event_matcher_find_rule(p_matcher, group, p_response, prefix_length, &bucket);
+
+        if (index != SHC_EVENT_MATCHER_NOT_FOUND) {
+            return index;
+        }
+    }
+
+    return SHC_EVENT_MATCHER_NOT_FOUND;
+}
+
+// --------------------------------------------------------------------------------
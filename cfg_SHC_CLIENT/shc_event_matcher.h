@@ -0,0 +1,177 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_event_matcher.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Precompiled matcher of the evt_ rules of the event-file.
+ *
+ *          The rules are compiled when the command-table is loaded.
+ *          All rules with the same poll-command form a group. Groups
+ *          are found by a hash over the binary command. Inside of a
+ *          group the rules are found by a second hash over the group
+ *          and the expected response-prefix. Matching a response takes
+ *          one lookup per distinct prefix-length of the group, which
+ *          is a single lookup for a typical event-file.
+ *
+ *          If more than one rule of a group matches, the rule with the
+ *          longest expected prefix wins. For rules with the same
+ *          prefix the first line of the event-file wins.
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_shc_event_matcher_
+#define _H_shc_event_matcher_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Maximum number of different lengths of expected
+ * response-prefixes inside of a single group
+ *
+ */
+#ifndef SHC_EVENT_MATCHER_MAX_PREFIX_LENGTHS
+#define SHC_EVENT_MATCHER_MAX_PREFIX_LENGTHS        4
+#endif
+
+/**
+ * @brief Returned by shc_event_matcher_find_group() and
+ * shc_event_matcher_match() if nothing was found
+ *
+ */
+#define SHC_EVENT_MATCHER_NOT_FOUND                 0xFFFFFFFFUL
+
+// --------------------------------------------------------------------------------
+
+struct SHC_COMMAND_TABLE_EVENT_STRUCT;
+
+/**
+ * @brief All rules that are polled with the same command
+ * on the same control-board
+ *
+ */
+typedef struct SHC_EVENT_MATCHER_GROUP_STRUCT {
+
+    /**
+     * @brief control-board that is polled, see shc_host_board.h
+     *
+     */
+    u8 board;
+
+    /**
+     * @brief command that is used to poll all rules of this group
+     *
+     */
+    const u8* p_command;
+    u16 command_length;
+    u32 hash;
+
+    /**
+     * @brief different lengths of the expected prefixes, longest first
+     *
+     */
+    u8 num_prefix_lengths;
+    u16 prefix_length_list[SHC_EVENT_MATCHER_MAX_PREFIX_LENGTHS];
+
+} SHC_EVENT_MATCHER_GROUP;
+
+/**
+ * @brief The compiled rules of a command-table
+ *
+ */
+typedef struct SHC_EVENT_MATCHER_STRUCT {
+
+    u32 num_groups;
+    SHC_EVENT_MATCHER_GROUP* group_list;
+
+    /**
+     * @brief hash-table of the groups, holds index + 1 of a group or 0
+     *
+     */
+    u32 group_bucket_mask;
+    u32* group_bucket_list;
+
+    /**
+     * @brief hash-table of the rules, holds index + 1 of an event or 0
+     *
+     */
+    u32 rule_bucket_mask;
+    u32* rule_bucket_list;
+
+    /**
+     * @brief group of every event, SHC_EVENT_MATCHER_NOT_FOUND if
+     * the event has been ignored
+     *
+     */
+    u32* rule_group_list;
+
+    const struct SHC_COMMAND_TABLE_EVENT_STRUCT* p_event_list;
+    u32 num_events;
+
+} SHC_EVENT_MATCHER;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Compiles the given events. The event-list must be
+ * valid as long as the matcher is used.
+ *
+ * @param p_matcher the matcher to build
+ * @param p_event_list events of the command-table
+ * @param num_events number of events of p_event_list
+ * @return 1 on success, 0 if there is not enough memory
+ */
+u8 shc_event_matcher_create(SHC_EVENT_MATCHER* p_matcher, const struct SHC_COMMAND_TABLE_EVENT_STRUCT* p_event_list, u32 num_events);
+
+/**
+ * @brief Releases all memory of the matcher
+ *
+ * @param p_matcher the matcher to release
+ */
+void shc_event_matcher_free(SHC_EVENT_MATCHER* p_matcher);
+
+/**
+ * @brief Searches for the group of the given poll-command
+ *
+ * @param p_matcher the matcher
+ * @param board index of the polled control-board
+ * @param p_command binary command
+ * @param length number of bytes of p_command
+ * @return index of the group or SHC_EVENT_MATCHER_NOT_FOUND
+ */
+u32 shc_event_matcher_find_group(const SHC_EVENT_MATCHER* p_matcher, u8 board, const u8* p_command, u16 length);
+
+/**
+ * @brief Searches for the rule of the given group that
+ * matches the given response.
+ *
+ * @param p_matcher the matcher
+ * @param group index of the group
+ * @param p_response the response of the poll-command
+ * @param length number of bytes of p_response
+ * @return index of the event inside of the event-list or SHC_EVENT_MATCHER_NOT_FOUND
+ */
+u32 shc_event_matcher_match(const SHC_EVENT_MATCHER* p_matcher, u32 group, const u8* p_response, u16 length);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_shc_event_matcher_
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,864 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_host_board.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Implementation of the control-boards of the shcClient
+ *
+ * @see     shc_host_board.h
+ */
+
+#define TRACER_OFF
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "tracer.h"
+
+// --------------------------------------------------------------------------------
+
+#include "cpu.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <linux/spi/spidev.h>
+
+// --------------------------------------------------------------------------------
+
+#include "common/signal_slot_interface.h"
+#include "common/common_types.h"
+
+#include "ui/cfg_file_parser/cfg_file_parser.h"
+
+// --------------------------------------------------------------------------------
+
+#include "shc_event_loop.h"
+#include "shc_host_board.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Name of board 0, overwritten by HOST_BOARD_0
+ *
+ */
+#ifndef SHC_HOST_BOARD_DEFAULT_NAME
+#define SHC_HOST_BOARD_DEFAULT_NAME                 "main"
+#endif
+
+/**
+ * @brief Speed of the spidev-devices if neither HOST_BOARD_<n>
+ * nor COM_SPI_BAUDRATE is given
+ *
+ */
+#ifndef SHC_HOST_BOARD_SPEED_HZ
+#define SHC_HOST_BOARD_SPEED_HZ                     50000
+#endif
+
+/**
+ * @brief Time a worker waits for the response of its board.
+ * Below the response-timeout of the message-executer.
+ *
+ */
+#ifndef SHC_HOST_BOARD_RESPONSE_TIMEOUT_MS
+#define SHC_HOST_BOARD_RESPONSE_TIMEOUT_MS          1000
+#endif
+
+/**
+ * @brief Interval of polling a board for its response
+ *
+ */
+#ifndef SHC_HOST_BOARD_POLL_INTERVAL_US
+#define SHC_HOST_BOARD_POLL_INTERVAL_US             1000
+#endif
+
+/**
+ * @brief Maximum length of the path of a spidev-device
+ *
+ */
+#ifndef SHC_HOST_BOARD_PATH_MAX_LENGTH
+#define SHC_HOST_BOARD_PATH_MAX_LENGTH              64
+#endif
+
+/**
+ * @brief A device-path with this prefix is a unix-socket
+ *
+ */
+#define SHC_HOST_BOARD_SOCKET_PREFIX                "unix="
+#define SHC_HOST_BOARD_SOCKET_PREFIX_LENGTH         5
+
+/**
+ * @brief A frame and a response are at most a length-byte
+ * and 255 bytes of data
+ *
+ */
+#define SHC_HOST_BOARD_FRAME_MAX_LENGTH             256
+
+/**
+ * @brief The board answers a poll with one of these values
+ * as long as the response is not ready
+ *
+ */
+#define SHC_HOST_BOARD_NOT_READY_EMPTY              0x00
+#define SHC_HOST_BOARD_NOT_READY_FLOATING           0xFF
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief A control-board and its worker-thread
+ *
+ */
+typedef struct SHC_HOST_BOARD_STRUCT {
+
+    /**
+     * @brief Configuration, only used by the main-loop
+     *
+     */
+    char name[SHC_HOST_BOARD_NAME_MAX_LENGTH];
+    char device_path[SHC_HOST_BOARD_PATH_MAX_LENGTH];
+    u32 speed_hz;
+    u8 configured;
+
+    /**
+     * @brief The configuration has changed, the worker is restarted
+     * as soon as the actual transaction is complete
+     *
+     */
+    u8 restart_pending;
+
+    /**
+     * @brief A transaction is running, only used by the main-loop
+     *
+     */
+    u8 busy;
+    u64 start_time_us;
+
+    SHC_HOST_BOARD_STATISTIC statistic;
+
+    /**
+     * @brief File-descriptor of the spidev-device or the unix-socket,
+     * -1 if not available
+     *
+     */
+    int handle;
+    u32 active_speed_hz;
+    u8 is_socket;
+
+    pthread_t thread;
+    u8 thread_running;
+
+    /**
+     * @brief Everything below is protected by mutex. The frame and the
+     * response are owned by the worker while request_pending is set
+     * or the transaction is running.
+     *
+     */
+    pthread_mutex_t mutex;
+    pthread_cond_t condition;
+
+    u8 stop;
+    u8 request_pending;
+    u8 response_pending;
+    u8 status;
+
+    u8 frame[SHC_HOST_BOARD_FRAME_MAX_LENGTH];
+    u16 frame_length;
+
+    u8 response[SHC_HOST_BOARD_FRAME_MAX_LENGTH];
+    u16 response_length;
+
+} SHC_HOST_BOARD;
+
+// --------------------------------------------------------------------------------
+
+static SHC_HOST_BOARD board_list[SHC_HOST_BOARD_MAX_COUNT];
+
+/**
+ * @brief Speed of boards without own speed, set by COM_SPI_BAUDRATE
+ *
+ */
+static u32 default_speed_hz = SHC_HOST_BOARD_SPEED_HZ;
+
+/**
+ * @brief A board has to be (re-)started by shc_host_board_task()
+ *
+ */
+static u8 restart_pending = 0;
+
+/**
+ * @brief Frame of board 0, given to the host-protocol of the framework
+ *
+ */
+static COMMON_GENERIC_BUFFER_TYPE command_buffer;
+
+// --------------------------------------------------------------------------------
+
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(SHC_HOST_BOARD_RESPONSE_SIGNAL)
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Full-duplex transfer of the given number of bytes
+ *
+ * @param p_board the board
+ * @param p_tx bytes to write
+ * @param p_rx buffer of the received bytes
+ * @param length number of bytes to transfer
+ * @return 1 on success, otherwise 0
+ */
+static u8 shc_host_board_spi_transfer(SHC_HOST_BOARD* p_board, const u8* p_tx, u8* p_rx, u16 length) {
+
+    struct spi_ioc_transfer transfer;
+    memset(&transfer, 0x00, sizeof(transfer));
+
+    transfer.tx_buf = (unsigned long)p_tx;
+    transfer.rx_buf = (unsigned long)p_rx;
+    transfer.len = length;
+    transfer.speed_hz = p_board->active_speed_hz;
+    transfer.bits_per_word = 8;
+
+    return ioctl(p_board->handle, SPI_IOC_MESSAGE(1), &transfer) >= 0;
+}
+
+/**
+ * @brief Writes the frame of the board and polls for the response.
+ * Runs inside of the worker-thread.
+ *
+ * @param p_board the board
+ * @return one of SHC_HOST_BOARD_STATUS_xxx
+ */
+static u8 shc_host_board_transaction(SHC_HOST_BOARD* p_board) {
+
+    u8 dummy[SHC_HOST_BOARD_FRAME_MAX_LENGTH];
+    memset(dummy, 0x00, sizeof(dummy));
+
+    if (shc_host_board_spi_transfer(p_board, p_board->frame, p_board->response, p_board->frame_length) == 0) {
+        return SHC_HOST_BOARD_STATUS_TIMEOUT;
+    }
+
+    u64 deadline_us = shc_event_loop_time_us() + (u64)SHC_HOST_BOARD_RESPONSE_TIMEOUT_MS * 1000ULL;
+    struct timespec poll_interval = { 0, SHC_HOST_BOARD_POLL_INTERVAL_US * 1000L };
+
+    while (shc_event_loop_time_us() < deadline_us) {
+
+        nanosleep(&poll_interval, NULL);
+
+        u8 length = 0;
+
+        if (shc_host_board_spi_transfer(p_board, dummy, &length, 1) == 0) {
+            return SHC_HOST_BOARD_STATUS_TIMEOUT;
+        }
+
+        if (length == SHC_HOST_BOARD_NOT_READY_EMPTY || length == SHC_HOST_BOARD_NOT_READY_FLOATING) {
+            continue;
+        }
+
+        if (shc_host_board_spi_transfer(p_board, dummy, p_board->response, length) == 0) {
+            return SHC_HOST_BOARD_STATUS_TIMEOUT;
+        }
+
+        p_board->response_length = length;
+        return SHC_HOST_BOARD_STATUS_OK;
+    }
+
+    return SHC_HOST_BOARD_STATUS_TIMEOUT;
+}
+
+/**
+ * @brief Reads exactly the given number of bytes from the unix-socket
+ * of the board until the deadline is reached.
+ *
+ * @param p_board the board
+ * @param p_buffer buffer of the received bytes
+ * @param length number of bytes to read
+ * @param deadline_us point in time of shc_event_loop_time_us()
+ * @return 1 on success, otherwise 0
+ */
+static u8 shc_host_board_socket_read(SHC_HOST_BOARD* p_board, u8* p_buffer, u16 length, u64 deadline_us) {
+
+    u16 received = 0;
+
+    while (received < length) {
+
+        u64 now_us = shc_event_loop_time_us();
+        if (now_us >= deadline_us) {
+            return 0;
+        }
+
+        struct pollfd poll_fd = { .fd = p_board->handle, .events = POLLIN, .revents = 0 };
+
+        if (poll(&poll_fd, 1, (int)((deadline_us - now_us + 999) / 1000)) <= 0) {
+            continue;
+        }
+
+        ssize_t count = recv(p_board->handle, p_buffer + received, length - received, MSG_DONTWAIT);
+        if (count == 0) {
+            return 0;
+        }
+
+        if (count > 0) {
+            received += (u16)count;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Writes the frame of the board to its unix-socket and waits
+ * for the response. The response of a previous frame that has timed out
+ * is dropped before.
+ * Runs inside of the worker-thread.
+ *
+ * @param p_board the board
+ * @return one of SHC_HOST_BOARD_STATUS_xxx
+ */
+static u8 shc_host_board_socket_transaction(SHC_HOST_BOARD* p_board) {
+
+    u8 dummy[SHC_HOST_BOARD_FRAME_MAX_LENGTH];
+
+    while (recv(p_board->handle, dummy, sizeof(dummy), MSG_DONTWAIT) > 0) {
+        // late response
+    }
+
+    if (send(p_board->handle, p_board->frame, p_board->frame_length, MSG_NOSIGNAL) != (ssize_t)p_board->frame_length) {
+        return SHC_HOST_BOARD_STATUS_TIMEOUT;
+    }
+
+    u64 deadline_us = shc_event_loop_time_us() + (u64)SHC_HOST_BOARD_RESPONSE_TIMEOUT_MS * 1000ULL;
+    u8 length = 0;
+
+    if (shc_host_board_socket_read(p_board, &length, 1, deadline_us) == 0) {
+        return SHC_HOST_BOARD_STATUS_TIMEOUT;
+    }
+
+    if (shc_host_board_socket_read(p_board, p_board->response, length, deadline_us) == 0) {
+        return SHC_HOST_BOARD_STATUS_TIMEOUT;
+    }
+
+    p_board->response_length = length;
+    return SHC_HOST_BOARD_STATUS_OK;
+}
+
+/**
+ * @brief Worker of a single board. Waits for a frame, runs the
+ * transaction and wakes up the main-loop to report the result.
+ *
+ * @param p_argument the board of type SHC_HOST_BOARD
+ * @return always NULL
+ */
+static void* shc_host_board_worker_thread(void* p_argument) {
+
+    SHC_HOST_BOARD* p_board = (SHC_HOST_BOARD*)p_argument;
+
+    pthread_mutex_lock(&p_board->mutex);
+
+    while (1) {
+
+        while (p_board->stop == 0 && p_board->request_pending == 0) {
+            pthread_cond_wait(&p_board->condition, &p_board->mutex);
+        }
+
+        if (p_board->stop) {
+            break;
+        }
+
+        p_board->request_pending = 0;
+        pthread_mutex_unlock(&p_board->mutex);
+
+        u8 status = p_board->is_socket ? shc_host_board_socket_transaction(p_board) : shc_host_board_transaction(p_board);
+
+        pthread_mutex_lock(&p_board->mutex);
+
+        p_board->status = status;
+        p_board->response_pending = 1;
+
+        shc_event_loop_wakeup();
+    }
+
+    pthread_mutex_unlock(&p_board->mutex);
+
+    return NULL;
+}
+
+/**
+ * @brief Stops the worker of the board and closes its device.
+ * A transaction that is still running is finished first.
+ *
+ * @param p_board the board
+ */
+static void shc_host_board_stop(SHC_HOST_BOARD* p_board) {
+
+    if (p_board->thread_running) {
+
+        pthread_mutex_lock(&p_board->mutex);
+        p_board->stop = 1;
+        pthread_cond_signal(&p_board->condition);
+        pthread_mutex_unlock(&p_board->mutex);
+
+        pthread_join(p_board->thread, NULL);
+        p_board->thread_running = 0;
+    }
+
+    if (p_board->handle >= 0) {
+        close(p_board->handle);
+        p_board->handle = -1;
+    }
+}
+
+/**
+ * @brief Connects to the unix-socket given by the device-path of the board
+ *
+ * @param p_board the board
+ * @return 1 on success, otherwise 0
+ */
+static u8 shc_host_board_open_socket(SHC_HOST_BOARD* p_board) {
+
+    struct sockaddr_un address;
+    memset(&address, 0x00, sizeof(address));
+
+    address.sun_family = AF_UNIX;
+    snprintf(address.sun_path, sizeof(address.sun_path), "%s", p_board->device_path + SHC_HOST_BOARD_SOCKET_PREFIX_LENGTH);
+
+    p_board->handle = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (p_board->handle < 0) {
+        return 0;
+    }
+
+    if (connect(p_board->handle, (struct sockaddr*)&address, sizeof(address)) != 0) {
+        close(p_board->handle);
+        p_board->handle = -1;
+        return 0;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Opens the spidev-device given by the device-path of the board
+ *
+ * @param p_board the board
+ * @return 1 on success, otherwise 0
+ */
+static u8 shc_host_board_open_spidev(SHC_HOST_BOARD* p_board) {
+
+    p_board->handle = open(p_board->device_path, O_RDWR | O_CLOEXEC);
+    if (p_board->handle < 0) {
+        return 0;
+    }
+
+    u8 mode = SPI_MODE_0;
+    u8 bits_per_word = 8;
+
+    ioctl(p_board->handle, SPI_IOC_WR_MODE, &mode);
+    ioctl(p_board->handle, SPI_IOC_WR_BITS_PER_WORD, &bits_per_word);
+    ioctl(p_board->handle, SPI_IOC_WR_MAX_SPEED_HZ, &p_board->active_speed_hz);
+
+    return 1;
+}
+
+/**
+ * @brief Opens the device of the board and starts its worker.
+ * A board without device answers every frame with a timeout.
+ *
+ * @param p_board the board
+ */
+static void shc_host_board_start(SHC_HOST_BOARD* p_board) {
+
+    p_board->stop = 0;
+    p_board->active_speed_hz = p_board->speed_hz != 0 ? p_board->speed_hz : default_speed_hz;
+    p_board->is_socket = strncmp(p_board->device_path, SHC_HOST_BOARD_SOCKET_PREFIX, SHC_HOST_BOARD_SOCKET_PREFIX_LENGTH) == 0;
+
+    u8 is_open = p_board->is_socket ? shc_host_board_open_socket(p_board) : shc_host_board_open_spidev(p_board);
+
+    if (is_open == 0) {
+        DEBUG_TRACE_STR(p_board->device_path, "shc_host_board_start() - Open device has FAILED !!! ---");
+        return;
+    }
+
+    if (pthread_create(&p_board->thread, NULL, shc_host_board_worker_thread, p_board) != 0) {
+        DEBUG_PASS("shc_host_board_start() - pthread_create() has FAILED !!! ---");
+        close(p_board->handle);
+        p_board->handle = -1;
+        return;
+    }
+
+    DEBUG_TRACE_STR(p_board->device_path, "shc_host_board_start() - Worker started:");
+    p_board->thread_running = 1;
+}
+
+/**
+ * @brief Sends the result of a transaction
+ *
+ * @param board index of the board
+ * @param status one of SHC_HOST_BOARD_STATUS_xxx
+ * @param p_data the response without the length-byte
+ * @param length number of bytes of p_data
+ */
+static void shc_host_board_complete(u8 board, u8 status, const u8* p_data, u16 length) {
+
+    SHC_HOST_BOARD* p_board = &board_list[board];
+
+    if (p_board->busy) {
+        p_board->busy = 0;
+        p_board->statistic.busy_time_us += shc_event_loop_time_us() - p_board->start_time_us;
+    }
+
+    if (status == SHC_HOST_BOARD_STATUS_OK) {
+        p_board->statistic.transactions += 1;
+    } else {
+        p_board->statistic.timeouts += 1;
+    }
+
+    SHC_HOST_BOARD_RESPONSE response;
+
+    response.board = board;
+    response.status = status;
+    response.length = length;
+    response.p_data = p_data;
+
+    SHC_HOST_BOARD_RESPONSE_SIGNAL_send(&response);
+}
+
+/**
+ * @brief Sends the results of all workers
+ *
+ */
+static void shc_host_board_process_responses(void) {
+
+    u8 board = 1;
+    for ( ; board < SHC_HOST_BOARD_MAX_COUNT ; board++) {
+
+        SHC_HOST_BOARD* p_board = &board_list[board];
+
+        if (p_board->busy == 0) {
+            continue;
+        }
+
+        pthread_mutex_lock(&p_board->mutex);
+
+        u8 has_response = p_board->response_pending;
+        p_board->response_pending = 0;
+
+        pthread_mutex_unlock(&p_board->mutex);
+
+        if (has_response) {
+            // the worker does not touch the response until the next frame
+            shc_host_board_complete(board, p_board->status, p_board->response, p_board->response_length);
+        }
+    }
+}
+
+/**
+ * @brief Parses <name>:<spidev-path>[:<speed_hz>] or <name>:unix=<socket-path>
+ *
+ * @param p_board the board to configure
+ * @param p_value value of HOST_BOARD_<n>
+ */
+static void shc_host_board_parse(SHC_HOST_BOARD* p_board, const char* p_value) {
+
+    char name[SHC_HOST_BOARD_NAME_MAX_LENGTH];
+    char device_path[SHC_HOST_BOARD_PATH_MAX_LENGTH];
+    u32 speed_hz = 0;
+
+    const char* p_path = strchr(p_value, ':');
+    if (p_path == NULL || p_path == p_value || (u32)(p_path - p_value) >= sizeof(name)) {
+        DEBUG_TRACE_STR(p_value, "shc_host_board_parse() - Invalid board");
+        return;
+    }
+
+    snprintf(name, sizeof(name), "%.*s", (int)(p_path - p_value), p_value);
+    p_path += 1;
+
+    const char* p_speed = strchr(p_path, ':');
+    if (p_speed != NULL) {
+        speed_hz = (u32)strtoul(p_speed + 1, NULL, 10);
+    } else {
+        p_speed = p_path + strlen(p_path);
+    }
+
+    snprintf(device_path, sizeof(device_path), "%.*s", (int)(p_speed - p_path), p_path);
+
+    if (p_board->configured &&
+        strcmp(p_board->name, name) == 0 &&
+        strcmp(p_board->device_path, device_path) == 0 &&
+        p_board->speed_hz == speed_hz) {
+
+        return;
+    }
+
+    memcpy(p_board->name, name, sizeof(name));
+    memcpy(p_board->device_path, device_path, sizeof(device_path));
+
+    p_board->speed_hz = speed_hz;
+    p_board->configured = 1;
+    p_board->restart_pending = 1;
+
+    restart_pending = 1;
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief The host-protocol of the framework has received the response of board 0
+ *
+ * @param p_argument the response of type COMMON_GENERIC_BUFFER_TYPE
+ */
+static void shc_host_board_RPI_HOST_RESPONSE_RECEIVED_SLOT_CALLBACK(const void* p_argument) {
+
+    if (p_argument == NULL) {
+        DEBUG_PASS("shc_host_board_RPI_HOST_RESPONSE_RECEIVED_SLOT_CALLBACK() - NULL_POINTER_EXCEPTION");
+        return;
+    }
+
+    const COMMON_GENERIC_BUFFER_TYPE* p_buffer = (const COMMON_GENERIC_BUFFER_TYPE*)p_argument;
+    shc_host_board_complete(SHC_HOST_BOARD_DEFAULT, SHC_HOST_BOARD_STATUS_OK, p_buffer->data, p_buffer->length);
+}
+
+/**
+ * @brief The host-protocol of the framework has not received a response of board 0
+ *
+ * @param p_argument not used
+ */
+static void shc_host_board_RPI_HOST_RESPONSE_TIMEOUT_SLOT_CALLBACK(const void* p_argument) {
+
+    (void) p_argument;
+    shc_host_board_complete(SHC_HOST_BOARD_DEFAULT, SHC_HOST_BOARD_STATUS_TIMEOUT, NULL, 0);
+}
+
+/**
+ * @brief Takes the boards from the configuration-file.
+ *
+ * @param p_argument the configuration object of type CFG_FILE_PARSER_CFG_OBJECT_TYPE
+ */
+static void shc_host_board_CFG_OBJECT_RECEIVED_SLOT_CALLBACK(const void* p_argument) {
+
+    if (p_argument == NULL) {
+        DEBUG_PASS("shc_host_board_CFG_OBJECT_RECEIVED_SLOT_CALLBACK() - NULL_POINTER_EXCEPTION");
+        return;
+    }
+
+    const CFG_FILE_PARSER_CFG_OBJECT_TYPE* p_cfg_obj = (const CFG_FILE_PARSER_CFG_OBJECT_TYPE*)p_argument;
+
+    if (strcmp(p_cfg_obj->key, "COM_SPI_BAUDRATE") == 0) {
+        default_speed_hz = (u32)strtoul(p_cfg_obj->value, NULL, 10);
+        return;
+    }
+
+    if (strcmp(p_cfg_obj->key, "HOST_BOARD_0") == 0) {
+        snprintf(board_list[SHC_HOST_BOARD_DEFAULT].name, SHC_HOST_BOARD_NAME_MAX_LENGTH, "%s", p_cfg_obj->value);
+        return;
+    }
+
+    if (strncmp(p_cfg_obj->key, "HOST_BOARD_", 11) != 0) {
+        return;
+    }
+
+    u32 board = (u32)strtoul(p_cfg_obj->key + 11, NULL, 10);
+
+    if (board == SHC_HOST_BOARD_DEFAULT || board >= SHC_HOST_BOARD_MAX_COUNT) {
+        DEBUG_TRACE_STR(p_cfg_obj->key, "shc_host_board_CFG_OBJECT_RECEIVED_SLOT_CALLBACK() - Invalid board");
+        return;
+    }
+
+    shc_host_board_parse(&board_list[board], p_cfg_obj->value);
+}
+
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(RPI_HOST_RESPONSE_RECEIVED_SIGNAL, SHC_HOST_BOARD_RPI_HOST_RESPONSE_RECEIVED_SLOT, shc_host_board_RPI_HOST_RESPONSE_RECEIVED_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(RPI_HOST_RESPONSE_TIMEOUT_SIGNAL, SHC_HOST_BOARD_RPI_HOST_RESPONSE_TIMEOUT_SLOT, shc_host_board_RPI_HOST_RESPONSE_TIMEOUT_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(CFG_PARSER_NEW_CFG_OBJECT_SIGNAL, SHC_HOST_BOARD_CFG_OBJECT_RECEIVED_SLOT, shc_host_board_CFG_OBJECT_RECEIVED_SLOT_CALLBACK)
+
+// --------------------------------------------------------------------------------
+
+void shc_host_board_init(void) {
+
+    DEBUG_PASS("shc_host_board_init()");
+
+    SHC_HOST_BOARD_RESPONSE_SIGNAL_init();
+
+    memset(board_list, 0x00, sizeof(board_list));
+
+    u8 board = 0;
+    for ( ; board < SHC_HOST_BOARD_MAX_COUNT ; board++) {
+        board_list[board].handle = -1;
+        pthread_mutex_init(&board_list[board].mutex, NULL);
+        pthread_cond_init(&board_list[board].condition, NULL);
+    }
+
+    snprintf(board_list[SHC_HOST_BOARD_DEFAULT].name, SHC_HOST_BOARD_NAME_MAX_LENGTH, "%s", SHC_HOST_BOARD_DEFAULT_NAME);
+    board_list[SHC_HOST_BOARD_DEFAULT].configured = 1;
+
+    restart_pending = 0;
+
+    SHC_HOST_BOARD_RPI_HOST_RESPONSE_RECEIVED_SLOT_connect();
+    SHC_HOST_BOARD_RPI_HOST_RESPONSE_TIMEOUT_SLOT_connect();
+    SHC_HOST_BOARD_CFG_OBJECT_RECEIVED_SLOT_connect();
+}
+
+void shc_host_board_deinit(void) {
+
+    DEBUG_PASS("shc_host_board_deinit()");
+
+    u8 board = 1;
+    for ( ; board < SHC_HOST_BOARD_MAX_COUNT ; board++) {
+        shc_host_board_stop(&board_list[board]);
+    }
+}
+
+void shc_host_board_task(void) {
+
+    shc_host_board_process_responses();
+
+    if (restart_pending == 0) {
+        return;
+    }
+
+    restart_pending = 0;
+
+    u8 board = 1;
+    for ( ; board < SHC_HOST_BOARD_MAX_COUNT ; board++) {
+
+        SHC_HOST_BOARD* p_board = &board_list[board];
+
+        if (p_board->restart_pending == 0) {
+            continue;
+        }
+
+        if (p_board->busy) {
+            // restarted after the actual transaction
+            restart_pending = 1;
+            continue;
+        }
+
+        p_board->restart_pending = 0;
+
+        shc_host_board_stop(p_board);
+        shc_host_board_start(p_board);
+    }
+
+    if (restart_pending) {
+        shc_event_loop_set_deadline(SHC_HOST_BOARD_RESPONSE_TIMEOUT_MS);
+    }
+}
+
+u8 shc_host_board_find(const char* p_name, u16 name_length) {
+
+    if (p_name == NULL || name_length == 0 || name_length >= SHC_HOST_BOARD_NAME_MAX_LENGTH) {
+        return SHC_HOST_BOARD_INVALID;
+    }
+
+    u8 board = 0;
+    for ( ; board < SHC_HOST_BOARD_MAX_COUNT ; board++) {
+
+        const SHC_HOST_BOARD* p_board = &board_list[board];
+
+        if (p_board->configured && strncmp(p_board->name, p_name, name_length) == 0 && p_board->name[name_length] == '\0') {
+            return board;
+        }
+    }
+
+    return SHC_HOST_BOARD_INVALID;
+}
+
+const char* shc_host_board_get_name(u8 board) {
+
+    if (board >= SHC_HOST_BOARD_MAX_COUNT) {
+        return "";
+    }
+
+    return board_list[board].name;
+}
+
+u8 shc_host_board_is_ready(u8 board) {
+
+    if (board == SHC_HOST_BOARD_DEFAULT) {
+        // the host-protocol of the framework queues the frames itself
+        return 1;
+    }
+
+    if (board >= SHC_HOST_BOARD_MAX_COUNT) {
+        return 0;
+    }
+
+    const SHC_HOST_BOARD* p_board = &board_list[board];
+
+    return p_board->configured && p_board->busy == 0 && p_board->restart_pending == 0;
+}
+
+u8 shc_host_board_send(u8 board, const u8* p_frame, u16 length) {
+
+    if (shc_host_board_is_ready(board) == 0 || length == 0 || length > SHC_HOST_BOARD_FRAME_MAX_LENGTH) {
+        return 0;
+    }
+
+    SHC_HOST_BOARD* p_board = &board_list[board];
+
+    p_board->busy = 1;
+    p_board->start_time_us = shc_event_loop_time_us();
+
+    memcpy(p_board->frame, p_frame, length);
+    p_board->frame_length = length;
+
+    if (board == SHC_HOST_BOARD_DEFAULT) {
+
+        command_buffer.length = length;
+        command_buffer.data = p_board->frame;
+
+        RPI_HOST_COMMAND_RECEIVED_SIGNAL_send(&command_buffer);
+        return 1;
+    }
+
+    pthread_mutex_lock(&p_board->mutex);
+
+    if (p_board->thread_running) {
+        p_board->request_pending = 1;
+        pthread_cond_signal(&p_board->condition);
+    } else {
+        // device not available, reported by the next shc_host_board_task()
+        p_board->status = SHC_HOST_BOARD_STATUS_TIMEOUT;
+        p_board->response_length = 0;
+        p_board->response_pending = 1;
+        shc_event_loop_wakeup();
+    }
+
+    pthread_mutex_unlock(&p_board->mutex);
+
+    return 1;
+}
+
+void shc_host_board_get_statistic(u8 board, SHC_HOST_BOARD_STATISTIC* p_statistic) {
+
+    if (board >= SHC_HOST_BOARD_MAX_COUNT || p_statistic == NULL) {
+        return;
+    }
+
+    memcpy(p_statistic, &board_list[board].statistic, sizeof(SHC_HOST_BOARD_STATISTIC));
+}
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,228 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_host_board.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Control-boards of the shcClient.
+ *
+ *          Board 0 is the control-board of the host-protocol of the
+ *          framework (COM_SPI_DEVICE). Further boards are connected to
+ *          their own spidev-device and are driven by a worker-thread
+ *          per board, so the transfers of different boards run
+ *          concurrently. The worker uses the same framing as the
+ *          host-protocol of the framework: the frame is written
+ *          including its length-byte and the board is polled until it
+ *          answers with a length-byte followed by the response.
+ *
+ *          Every board has at most one transaction at a time. The result
+ *          of a transaction is reported via SHC_HOST_BOARD_RESPONSE_SIGNAL
+ *          from shc_host_board_task(), independent of the board.
+ *
+ *          Commands are routed by the name of the board, e.g.
+ *          cmd_light_on=com@kitchen:0704010100000000 (command-file)
+ *
+ *          Instead of a spidev-device a board can be connected via a
+ *          unix-socket, e.g. to the simulated control-board of shcLoadTest.
+ *          The frame is written including its length-byte and the
+ *          response is read as length-byte followed by the response.
+ *
+ *          Configuration (configuration-file):
+ *
+ *          - HOST_BOARD_0=<name> (name of board 0, default "main")
+ *          - HOST_BOARD_<1 ... 7>=<name>:<spidev-path>[:<speed_hz>]
+ *            (speed default COM_SPI_BAUDRATE)
+ *          - HOST_BOARD_<1 ... 7>=<name>:unix=<socket-path>
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_shc_host_board_
+#define _H_shc_host_board_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "common/signal_slot_interface.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Maximum number of control-boards, including board 0
+ *
+ */
+#define SHC_HOST_BOARD_MAX_COUNT                    8
+
+/**
+ * @brief The board of the host-protocol of the framework
+ *
+ */
+#define SHC_HOST_BOARD_DEFAULT                      0
+
+/**
+ * @brief Returned by shc_host_board_find() for an unknown name
+ *
+ */
+#define SHC_HOST_BOARD_INVALID                      0xFF
+
+/**
+ * @brief Maximum length of the name of a board
+ *
+ */
+#define SHC_HOST_BOARD_NAME_MAX_LENGTH              16
+
+// --------------------------------------------------------------------------------
+
+#define SHC_HOST_BOARD_STATUS_OK                    0
+#define SHC_HOST_BOARD_STATUS_TIMEOUT               1
+
+/**
+ * @brief Argument of SHC_HOST_BOARD_RESPONSE_SIGNAL
+ *
+ */
+typedef struct SHC_HOST_BOARD_RESPONSE_STRUCT {
+
+    /**
+     * @brief index of the board
+     *
+     */
+    u8 board;
+
+    /**
+     * @brief one of SHC_HOST_BOARD_STATUS_xxx
+     *
+     */
+    u8 status;
+
+    /**
+     * @brief the response without the length-byte,
+     * only valid while the signal is processed
+     *
+     */
+    u16 length;
+    const u8* p_data;
+
+} SHC_HOST_BOARD_RESPONSE;
+
+/**
+ * @brief Is sent if a transaction of a board is complete.
+ * Argument is of type SHC_HOST_BOARD_RESPONSE
+ *
+ */
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(SHC_HOST_BOARD_RESPONSE_SIGNAL)
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Statistic of a single board since shc_host_board_init()
+ *
+ */
+typedef struct SHC_HOST_BOARD_STATISTIC_STRUCT {
+
+    /**
+     * @brief Number of transactions with response
+     *
+     */
+    u32 transactions;
+
+    /**
+     * @brief Number of transactions without response
+     *
+     */
+    u32 timeouts;
+
+    /**
+     * @brief Time the board was busy with transactions in microseconds
+     *
+     */
+    u64 busy_time_us;
+
+} SHC_HOST_BOARD_STATISTIC;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Creates the response-signal and connects to the
+ * host-protocol of the framework and the configuration-parser.
+ *
+ */
+void shc_host_board_init(void);
+
+/**
+ * @brief Stops all worker-threads and closes the spidev-devices
+ *
+ */
+void shc_host_board_deinit(void);
+
+/**
+ * @brief Starts the worker-threads of new or changed boards
+ * and sends the responses of the worker-threads.
+ * Must be called from the main-loop.
+ *
+ */
+void shc_host_board_task(void);
+
+/**
+ * @brief Get the index of a board by its name
+ *
+ * @param p_name name of the board, must not be zero-terminated
+ * @param name_length number of characters of p_name
+ * @return index of the board or SHC_HOST_BOARD_INVALID
+ */
+u8 shc_host_board_find(const char* p_name, u16 name_length);
+
+/**
+ * @brief Get the name of a board
+ *
+ * @param board index of the board
+ * @return zero-terminated name, empty if the board is not configured
+ */
+const char* shc_host_board_get_name(u8 board);
+
+/**
+ * @brief Checks if a new transaction can be started on the given board
+ *
+ * @param board index of the board
+ * @return 1 if the board is configured and idle, otherwise 0
+ */
+u8 shc_host_board_is_ready(u8 board);
+
+/**
+ * @brief Sends a frame to the given board. The result is reported
+ * via SHC_HOST_BOARD_RESPONSE_SIGNAL.
+ *
+ * @param board index of the board
+ * @param p_frame the frame including its length-byte, copied
+ * @param length number of bytes of p_frame
+ * @return 1 if the transaction was started, otherwise 0
+ */
+u8 shc_host_board_send(u8 board, const u8* p_frame, u16 length);
+
+/**
+ * @brief Get the actual statistic of a board
+ *
+ * @param board index of the board
+ * @param p_statistic the statistic is copied into this structure
+ */
+void shc_host_board_get_statistic(u8 board, SHC_HOST_BOARD_STATISTIC* p_statistic);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_shc_host_board_
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,687 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_json_tokenizer.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Implementation of the zero-copy JSON-tokenizer
+ *
+ * @see     shc_json_tokenizer.h
+ */
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include <string.h>
+
+// --------------------------------------------------------------------------------
+
+#include "shc_json_tokenizer.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief States of the tokenizer, what is expected as next character
+ *
+ */
+#define SHC_JSON_STATE_VALUE                        0
+#define SHC_JSON_STATE_KEY                          1
+#define SHC_JSON_STATE_COLON                        2
+#define SHC_JSON_STATE_SEPARATOR                    3
+#define SHC_JSON_STATE_DONE                         4
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Checks for a whitespace as defined by RFC 8259
+ *
+ * @param c the character to check
+ * @return 1 if c is a whitespace, otherwise 0
+ */
+static u8 shc_json_is_whitespace(char c) {
+    return ((u8)c <= ' ' && (c == ' ' || c == '\t' || c == '\n' || c == '\r')) ? 1 : 0;
+}
+
+/**
+ * @brief Checks for a hexadecimal digit
+ *
+ * @param c the character to check
+ * @return the value of the digit or 0xFF if c is not a hexadecimal digit
+ */
+static u8 shc_json_hex_value(char c) {
+
+    if (c >= '0' && c <= '9') {
+        return (u8)(c - '0');
+    }
+
+    if (c >= 'a' && c <= 'f') {
+        return (u8)(c - 'a' + 10);
+    }
+
+    if (c >= 'A' && c <= 'F') {
+        return (u8)(c - 'A' + 10);
+    }
+
+    return 0xFF;
+}
+
+/**
+ * @brief Adds a new token to the document
+ *
+ * @param p_document the document to add the token to
+ * @param type type of the new token
+ * @param start position of the first character of the new token
+ * @return index of the new token or SHC_JSON_NOT_FOUND if the list is full
+ */
+static u16 shc_json_add_token(SHC_JSON_DOCUMENT* p_document, u8 type, u16 start) {
+
+    if (p_document->num_tokens >= p_document->max_tokens) {
+        return SHC_JSON_NOT_FOUND;
+    }
+
+    u16 index = p_document->num_tokens;
+    SHC_JSON_TOKEN* p_token = &p_document->p_token_list[index];
+
+    p_token->type = type;
+    p_token->terminated = 0;
+    p_token->escaped = 0;
+    p_token->start = start;
+    p_token->end = start;
+    p_token->size = 0;
+    p_token->next = index + 1;
+
+    p_document->num_tokens += 1;
+    return index;
+}
+
+/**
+ * @brief Searches the closing '"' of a string and validates its escape-sequences.
+ * Most strings do not contain any escape-sequence, so the next '"' is searched
+ * with memchr() first and the string is only scanned character by character
+ * if it contains a '\\'. Control-characters are not rejected.
+ *
+ * @param p_json the payload
+ * @param length number of characters of p_json
+ * @param pos position of the first character behind the opening '"'
+ * @param p_escaped set to 1 if the string contains an escape-sequence
+ * @return position of the closing '"' or length if the string is invalid
+ */
+static u16 shc_json_scan_string(const char* p_json, u16 length, u16 pos, u8* p_escaped) {
+
+    const char* p_quote = memchr(&p_json[pos], '"', length - pos);
+
+    if (p_quote == NULL) {
+        return length;
+    }
+
+    u16 end = (u16)(p_quote - p_json);
+
+    if (memchr(&p_json[pos], '\\', end - pos) == NULL) {
+        *p_escaped = 0;
+        return end;
+    }
+
+    *p_escaped = 1;
+
+    while (pos < length) {
+
+        char c = p_json[pos];
+
+        if (c == '"') {
+            return pos;
+        }
+
+        if (c == '\\') {
+
+            pos += 1;
+            if (pos >= length) {
+                return length;
+            }
+
+            c = p_json[pos];
+
+            if (c == 'u') {
+
+                if (pos + 4 >= length) {
+                    return length;
+                }
+
+                u8 i = 1;
+                for ( ; i <= 4; i++) {
+                    if (shc_json_hex_value(p_json[pos + i]) == 0xFF) {
+                        return length;
+                    }
+                }
+
+                pos += 4;
+
+            } else if (strchr("\"\\/bfnrt", c) == NULL || c == '\0') {
+                return length;
+            }
+        }
+
+        pos += 1;
+    }
+
+    return length;
+}
+
+/**
+ * @brief Scans the string that starts at pos and adds it to the document.
+ * A string without escape-sequence is zero-terminated at its closing '"',
+ * it is used as it is by shc_json_get_string() and shc_json_find().
+ *
+ * @param p_document the document to add the string to
+ * @param length number of characters of the payload
+ * @param pos position of the opening '"'
+ * @return position of the closing '"' or length if the string is invalid
+ * or the list of tokens is full
+ */
+static u16 shc_json_add_string(SHC_JSON_DOCUMENT* p_document, u16 length, u16 pos) {
+
+    u8 escaped = 0;
+    u16 end = shc_json_scan_string(p_document->p_json, length, pos + 1, &escaped);
+
+    if (end == length) {
+        return length;
+    }
+
+    u16 index = shc_json_add_token(p_document, SHC_JSON_TYPE_STRING, pos + 1);
+    if (index == SHC_JSON_NOT_FOUND) {
+        return length;
+    }
+
+    SHC_JSON_TOKEN* p_token = &p_document->p_token_list[index];
+
+    p_token->end = end;
+    p_token->escaped = escaped;
+
+    if (escaped == 0) {
+        p_document->p_json[end] = '\0';
+        p_token->terminated = 1;
+    }
+
+    return end;
+}
+
+/**
+ * @brief Searches the end of a number, true, false or null and validates it
+ *
+ * @param p_json the payload
+ * @param length number of characters of p_json
+ * @param pos position of the first character of the primitive
+ * @return position behind the last character or pos if the primitive is invalid
+ */
+static u16 shc_json_scan_primitive(const char* p_json, u16 length, u16 pos) {
+
+    u16 end = pos;
+
+    while (end < length) {
+
+        char c = p_json[end];
+
+        if (c == '\0' || c == ',' || c == ']' || c == '}' || shc_json_is_whitespace(c)) {
+            break;
+        }
+
+        end += 1;
+    }
+
+    u16 primitive_length = end - pos;
+    const char* p_primitive = &p_json[pos];
+
+    if ((primitive_length == 4 && memcmp(p_primitive, "true", 4) == 0)
+     || (primitive_length == 5 && memcmp(p_primitive, "false", 5) == 0)
+     || (primitive_length == 4 && memcmp(p_primitive, "null", 4) == 0)) {
+        return end;
+    }
+
+    if (p_primitive[0] != '-' && (p_primitive[0] < '0' || p_primitive[0] > '9')) {
+        return pos;
+    }
+
+    u16 i = 1;
+    for ( ; i < primitive_length; i++) {
+        char c = p_primitive[i];
+        if ((c < '0' || c > '9') && c != '.' && c != 'e' && c != 'E' && c != '+' && c != '-') {
+            return pos;
+        }
+    }
+
+    return end;
+}
+
+/**
+ * @brief Writes a unicode code-point as UTF-8
+ *
+ * @param p_buffer the code-point is written at this position
+ * @param code_point the code-point to write
+ * @return number of written bytes
+ */
+static u8 shc_json_put_utf8(char* p_buffer, u32 code_point) {
+
+    if (code_point < 0x80) {
+        p_buffer[0] = (char)code_point;
+        return 1;
+    }
+
+    if (code_point < 0x800) {
+        p_buffer[0] = (char)(0xC0 | (code_point >> 6));
+        p_buffer[1] = (char)(0x80 | (code_point & 0x3F));
+        return 2;
+    }
+
+    if (code_point < 0x10000) {
+        p_buffer[0] = (char)(0xE0 | (code_point >> 12));
+        p_buffer[1] = (char)(0x80 | ((code_point >> 6) & 0x3F));
+        p_buffer[2] = (char)(0x80 | (code_point & 0x3F));
+        return 3;
+    }
+
+    p_buffer[0] = (char)(0xF0 | (code_point >> 18));
+    p_buffer[1] = (char)(0x80 | ((code_point >> 12) & 0x3F));
+    p_buffer[2] = (char)(0x80 | ((code_point >> 6) & 0x3F));
+    p_buffer[3] = (char)(0x80 | (code_point & 0x3F));
+    return 4;
+}
+
+/**
+ * @brief Reads the four hexadecimal digits of a \\u escape-sequence,
+ * the digits have already been validated by the tokenizer.
+ *
+ * @param p_digits the first digit
+ * @return value of the escape-sequence
+ */
+static u32 shc_json_read_u_escape(const char* p_digits) {
+
+    u32 value = 0;
+
+    u8 i = 0;
+    for ( ; i < 4; i++) {
+        value = (value << 4) | shc_json_hex_value(p_digits[i]);
+    }
+
+    return value;
+}
+
+// --------------------------------------------------------------------------------
+
+u8 shc_json_is_structured(const char* p_json, u16 length) {
+
+    u16 pos = 0;
+    while (pos < length && shc_json_is_whitespace(p_json[pos])) {
+        pos += 1;
+    }
+
+    if (pos == length) {
+        return 0;
+    }
+
+    return (p_json[pos] == '{' || p_json[pos] == '[') ? 1 : 0;
+}
+
+u16 shc_json_tokenize(SHC_JSON_DOCUMENT* p_document, char* p_json, u16 length) {
+
+    u16 parent_stack[SHC_JSON_TOKENIZER_MAX_DEPTH];
+    u8 depth = 0;
+
+    u8 state = SHC_JSON_STATE_VALUE;
+
+    /**
+     * @brief an object or array has just been opened,
+     * so it may be closed without any member
+     *
+     */
+    u8 is_empty = 0;
+
+    p_document->p_json = p_json;
+    p_document->num_tokens = 0;
+
+    u16 pos = 0;
+
+    while (pos < length) {
+
+        char c = p_json[pos];
+
+        if (c == '\0') {
+            break;
+        }
+
+        if (shc_json_is_whitespace(c)) {
+            pos += 1;
+            continue;
+        }
+
+        SHC_JSON_TOKEN* p_parent = (depth != 0) ? &p_document->p_token_list[parent_stack[depth - 1]] : NULL;
+        u8 is_closing = 0;
+
+        if (state == SHC_JSON_STATE_DONE) {
+            return 0;
+
+        } else if (state == SHC_JSON_STATE_COLON) {
+
+            if (c != ':') {
+                return 0;
+            }
+
+            state = SHC_JSON_STATE_VALUE;
+            pos += 1;
+
+        } else if (state == SHC_JSON_STATE_SEPARATOR) {
+
+            if (c == ',') {
+                state = (p_parent->type == SHC_JSON_TYPE_OBJECT) ? SHC_JSON_STATE_KEY : SHC_JSON_STATE_VALUE;
+                pos += 1;
+
+            } else {
+                is_closing = 1;
+            }
+
+        } else if (state == SHC_JSON_STATE_KEY) {
+
+            if (c == '"') {
+
+                u16 end = shc_json_add_string(p_document, length, pos);
+                if (end == length) {
+                    return 0;
+                }
+
+                p_parent->size += 1;
+
+                state = SHC_JSON_STATE_COLON;
+                pos = end + 1;
+
+            } else if (c == '}' && is_empty) {
+                is_closing = 1;
+
+            } else {
+                return 0;
+            }
+
+        } else if (c == ']' && is_empty) {
+            is_closing = 1;
+
+        } else {
+
+            // SHC_JSON_STATE_VALUE
+
+            if (p_parent != NULL && p_parent->type == SHC_JSON_TYPE_ARRAY) {
+                p_parent->size += 1;
+            }
+
+            if (c == '{' || c == '[') {
+
+                if (depth == SHC_JSON_TOKENIZER_MAX_DEPTH) {
+                    return 0;
+                }
+
+                u16 index = shc_json_add_token(p_document, (c == '{') ? SHC_JSON_TYPE_OBJECT : SHC_JSON_TYPE_ARRAY, pos);
+                if (index == SHC_JSON_NOT_FOUND) {
+                    return 0;
+                }
+
+                parent_stack[depth++] = index;
+                state = (c == '{') ? SHC_JSON_STATE_KEY : SHC_JSON_STATE_VALUE;
+                pos += 1;
+
+                is_empty = 1;
+                continue;
+
+            } else if (c == '"') {
+
+                u16 end = shc_json_add_string(p_document, length, pos);
+                if (end == length) {
+                    return 0;
+                }
+
+                pos = end + 1;
+
+            } else {
+
+                u16 end = shc_json_scan_primitive(p_json, length, pos);
+                if (end == pos) {
+                    return 0;
+                }
+
+                u16 index = shc_json_add_token(p_document, SHC_JSON_TYPE_PRIMITIVE, pos);
+                if (index == SHC_JSON_NOT_FOUND) {
+                    return 0;
+                }
+
+                p_document->p_token_list[index].end = end;
+                pos = end;
+            }
+
+            state = (depth != 0) ? SHC_JSON_STATE_SEPARATOR : SHC_JSON_STATE_DONE;
+        }
+
+        if (is_closing) {
+
+            if ((c == '}' && p_parent->type != SHC_JSON_TYPE_OBJECT)
+             || (c == ']' && p_parent->type != SHC_JSON_TYPE_ARRAY)
+             || (c != '}' && c != ']')) {
+                return 0;
+            }
+
+            p_parent->end = pos + 1;
+            p_parent->next = p_document->num_tokens;
+
+            depth -= 1;
+            state = (depth != 0) ? SHC_JSON_STATE_SEPARATOR : SHC_JSON_STATE_DONE;
+            pos += 1;
+        }
+
+        is_empty = 0;
+    }
+
+    if (state != SHC_JSON_STATE_DONE) {
+        return 0;
+    }
+
+    return p_document->num_tokens;
+}
+
+u16 shc_json_first_child(const SHC_JSON_DOCUMENT* p_document, u16 index) {
+
+    if (index >= p_document->num_tokens) {
+        return SHC_JSON_NOT_FOUND;
+    }
+
+    const SHC_JSON_TOKEN* p_token = &p_document->p_token_list[index];
+
+    if (p_token->type != SHC_JSON_TYPE_OBJECT && p_token->type != SHC_JSON_TYPE_ARRAY) {
+        return SHC_JSON_NOT_FOUND;
+    }
+
+    if (p_token->size == 0) {
+        return SHC_JSON_NOT_FOUND;
+    }
+
+    return index + 1;
+}
+
+u16 shc_json_find(const SHC_JSON_DOCUMENT* p_document, u16 index, const char* p_key) {
+
+    if (index >= p_document->num_tokens || p_document->p_token_list[index].type != SHC_JSON_TYPE_OBJECT) {
+        return SHC_JSON_NOT_FOUND;
+    }
+
+    size_t key_length = strlen(p_key);
+    u16 end = p_document->p_token_list[index].next;
+    u16 key_index = shc_json_first_child(p_document, index);
+
+    while (key_index != SHC_JSON_NOT_FOUND && key_index < end) {
+
+        const SHC_JSON_TOKEN* p_name = &p_document->p_token_list[key_index];
+        const char* p_name_string = &p_document->p_json[p_name->start];
+        u16 value_index = p_name->next;
+
+        if (p_name->escaped && p_name->terminated) {
+
+            if (strcmp(p_name_string, p_key) == 0) {
+                return value_index;
+            }
+
+        } else if ((size_t)(p_name->end - p_name->start) == key_length && memcmp(p_name_string, p_key, key_length) == 0) {
+            return value_index;
+        }
+
+        key_index = p_document->p_token_list[value_index].next;
+    }
+
+    return SHC_JSON_NOT_FOUND;
+}
+
+const char* shc_json_get_string(SHC_JSON_DOCUMENT* p_document, u16 index) {
+
+    if (index >= p_document->num_tokens) {
+        return NULL;
+    }
+
+    SHC_JSON_TOKEN* p_token = &p_document->p_token_list[index];
+
+    if (p_token->type != SHC_JSON_TYPE_STRING) {
+        return NULL;
+    }
+
+    char* p_string = &p_document->p_json[p_token->start];
+
+    if (p_token->terminated) {
+        return p_string;
+    }
+
+    u16 read_pos = p_token->start;
+    u16 write_pos = p_token->start;
+
+    // the unescaped string is never longer than the escaped one,
+    // so it can be written over itself
+
+    while (read_pos < p_token->end) {
+
+        char c = p_document->p_json[read_pos++];
+
+        if (c != '\\') {
+            p_document->p_json[write_pos++] = c;
+            continue;
+        }
+
+        c = p_document->p_json[read_pos++];
+
+        switch (c) {
+            default :   p_document->p_json[write_pos++] = c; break;
+            case 'b' :  p_document->p_json[write_pos++] = '\b'; break;
+            case 'f' :  p_document->p_json[write_pos++] = '\f'; break;
+            case 'n' :  p_document->p_json[write_pos++] = '\n'; break;
+            case 'r' :  p_document->p_json[write_pos++] = '\r'; break;
+            case 't' :  p_document->p_json[write_pos++] = '\t'; break;
+
+            case 'u' : {
+
+                u32 code_point = shc_json_read_u_escape(&p_document->p_json[read_pos]);
+                read_pos += 4;
+
+                if (code_point >= 0xD800 && code_point <= 0xDBFF
+                 && read_pos + 6 <= p_token->end
+                 && p_document->p_json[read_pos] == '\\'
+                 && p_document->p_json[read_pos + 1] == 'u') {
+
+                    u32 low_surrogate = shc_json_read_u_escape(&p_document->p_json[read_pos + 2]);
+
+                    if (low_surrogate >= 0xDC00 && low_surrogate <= 0xDFFF) {
+                        code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low_surrogate - 0xDC00);
+                        read_pos += 6;
+                    }
+                }
+
+                write_pos += shc_json_put_utf8(&p_document->p_json[write_pos], code_point);
+                break;
+            }
+        }
+    }
+
+    p_document->p_json[write_pos] = '\0';
+    p_token->terminated = 1;
+
+    return p_string;
+}
+
+u8 shc_json_get_u32(const SHC_JSON_DOCUMENT* p_document, u16 index, u32* p_value) {
+
+    if (index >= p_document->num_tokens) {
+        return 0;
+    }
+
+    const SHC_JSON_TOKEN* p_token = &p_document->p_token_list[index];
+
+    if (p_token->type != SHC_JSON_TYPE_PRIMITIVE) {
+        return 0;
+    }
+
+    u32 value = 0;
+    u16 pos = p_token->start;
+
+    for ( ; pos < p_token->end; pos++) {
+
+        char c = p_document->p_json[pos];
+
+        if (c < '0' || c > '9') {
+            return 0;
+        }
+
+        u32 digit = (u32)(c - '0');
+
+        if (value > (0xFFFFFFFFUL - digit) / 10) {
+            return 0;
+        }
+
+        value = value * 10 + digit;
+    }
+
+    *p_value = value;
+    return 1;
+}
+
+u8 shc_json_get_bool(const SHC_JSON_DOCUMENT* p_document, u16 index, u8* p_value) {
+
+    if (index >= p_document->num_tokens) {
+        return 0;
+    }
+
+    const SHC_JSON_TOKEN* p_token = &p_document->p_token_list[index];
+
+    if (p_token->type != SHC_JSON_TYPE_PRIMITIVE) {
+        return 0;
+    }
+
+    const char* p_primitive = &p_document->p_json[p_token->start];
+    u16 primitive_length = p_token->end - p_token->start;
+
+    if (primitive_length == 4 && memcmp(p_primitive, "true", 4) == 0) {
+        *p_value = 1;
+        return 1;
+    }
+
+    if (primitive_length == 5 && memcmp(p_primitive, "false", 5) == 0) {
+        *p_value = 0;
+        return 1;
+    }
+
+    return 0;
+}
+
+// --------------------------------------------------------------------------------
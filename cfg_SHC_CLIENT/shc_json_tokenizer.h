@@ -0,0 +1,224 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_json_tokenizer.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Zero-copy JSON-tokenizer for received MQTT-payloads.
+ *
+ *          The payload is validated and split into tokens within a
+ *          single pass. A token only holds the position of its value
+ *          inside of the payload, nothing is copied. Objects and arrays
+ *          know the index of the token behind all of their children,
+ *          so a value is skipped without looking at its content.
+ *
+ *          Members of an object are stored as key-token followed by
+ *          the value-token. A string without escape-sequence is
+ *          zero-terminated in place by the tokenizer, at its closing '"'.
+ *          Strings with escape-sequences are unescaped and zero-terminated
+ *          in place on first access. The payload must be writable.
+ *
+ *          Example:
+ *
+ *              {"commands":["cmd_light_01_on","cmd_light_02_off"]}
+ *
+ *              0 OBJECT size 1
+ *              1   STRING commands
+ *              2   ARRAY size 2
+ *              3     STRING cmd_light_01_on
+ *              4     STRING cmd_light_02_off
+ *
+ *          The tokenizer does not depend on the framework.
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_shc_json_tokenizer_
+#define _H_shc_json_tokenizer_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Maximum nesting of objects and arrays
+ *
+ */
+#ifndef SHC_JSON_TOKENIZER_MAX_DEPTH
+#define SHC_JSON_TOKENIZER_MAX_DEPTH                16
+#endif
+
+// --------------------------------------------------------------------------------
+
+#define SHC_JSON_TYPE_OBJECT                        1
+#define SHC_JSON_TYPE_ARRAY                         2
+#define SHC_JSON_TYPE_STRING                        3
+
+/**
+ * @brief number, true, false or null
+ *
+ */
+#define SHC_JSON_TYPE_PRIMITIVE                     4
+
+/**
+ * @brief Index of a token that does not exist
+ *
+ */
+#define SHC_JSON_NOT_FOUND                          0xFFFF
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief A single value of the payload
+ *
+ */
+typedef struct SHC_JSON_TOKEN_STRUCT {
+
+    /**
+     * @brief one of SHC_JSON_TYPE_xxx
+     *
+     */
+    u8 type;
+
+    /**
+     * @brief the string is already unescaped and zero-terminated
+     *
+     */
+    u8 terminated;
+
+    /**
+     * @brief the string contains at least one escape-sequence
+     *
+     */
+    u8 escaped;
+
+    /**
+     * @brief position of the first character, without '"' of strings
+     *
+     */
+    u16 start;
+
+    /**
+     * @brief position behind the last character, at '"' of strings
+     *
+     */
+    u16 end;
+
+    /**
+     * @brief number of members of an object or elements of an array
+     *
+     */
+    u16 size;
+
+    /**
+     * @brief index of the token behind this token and all of its children
+     *
+     */
+    u16 next;
+
+} SHC_JSON_TOKEN;
+
+/**
+ * @brief A tokenized payload
+ *
+ */
+typedef struct SHC_JSON_DOCUMENT_STRUCT {
+    char* p_json;
+    SHC_JSON_TOKEN* p_token_list;
+    u16 max_tokens;
+    u16 num_tokens;
+} SHC_JSON_DOCUMENT;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Checks if the given payload is a JSON object or array
+ * by its first character that is not a whitespace.
+ *
+ * @param p_json the payload
+ * @param length number of characters of p_json
+ * @return 1 if the payload starts with '{' or '[', otherwise 0
+ */
+u8 shc_json_is_structured(const char* p_json, u16 length);
+
+/**
+ * @brief Validates the payload and splits it into tokens.
+ * Token 0 is the root-value.
+ *
+ * @param p_document the document, p_token_list and max_tokens must be set
+ * @param p_json the payload, modified in place
+ * @param length number of characters of p_json
+ * @return number of tokens, 0 if the payload is invalid or has too many tokens
+ */
+u16 shc_json_tokenize(SHC_JSON_DOCUMENT* p_document, char* p_json, u16 length);
+
+/**
+ * @brief Get the first child of an object or array.
+ * The next child is given by the member next of the actual child.
+ * The child of a member of an object is its key.
+ *
+ * @param p_document the tokenized payload
+ * @param index index of the object or array
+ * @return index of the first child or SHC_JSON_NOT_FOUND
+ */
+u16 shc_json_first_child(const SHC_JSON_DOCUMENT* p_document, u16 index);
+
+/**
+ * @brief Searches for a member of an object
+ *
+ * @param p_document the tokenized payload
+ * @param index index of the object
+ * @param p_key zero-terminated name of the member, not escaped
+ * @return index of the value of the member or SHC_JSON_NOT_FOUND
+ */
+u16 shc_json_find(const SHC_JSON_DOCUMENT* p_document, u16 index, const char* p_key);
+
+/**
+ * @brief Get the value of a string. The string is unescaped and
+ * zero-terminated inside of the payload on first access.
+ *
+ * @param p_document the tokenized payload
+ * @param index index of the string
+ * @return the zero-terminated string or NULL if the token is not a string
+ */
+const char* shc_json_get_string(SHC_JSON_DOCUMENT* p_document, u16 index);
+
+/**
+ * @brief Get the value of an unsigned integer
+ *
+ * @param p_document the tokenized payload
+ * @param index index of the number
+ * @param p_value the value is written into this variable
+ * @return 1 if the token is an unsigned integer that fits into 32 bit, otherwise 0
+ */
+u8 shc_json_get_u32(const SHC_JSON_DOCUMENT* p_document, u16 index, u32* p_value);
+
+/**
+ * @brief Get the value of true or false
+ *
+ * @param p_document the tokenized payload
+ * @param index index of the boolean
+ * @param p_value 1 for true, 0 for false
+ * @return 1 if the token is true or false, otherwise 0
+ */
+u8 shc_json_get_bool(const SHC_JSON_DOCUMENT* p_document, u16 index, u8* p_value);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_shc_json_tokenizer_
+
+// --------------------------------------------------------------------------------
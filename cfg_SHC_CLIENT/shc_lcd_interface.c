@@ -0,0 +1,283 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_lcd_interface.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Implementation of the asynchronous LCD output.
+ *
+ *          The framebuffer is protected by a mutex that is only held
+ *          while a line is copied. The display-thread takes a snapshot
+ *          of the framebuffer and compares it with a shadow-copy of the
+ *          content of the display. The framework driver is only called
+ *          if both differ.
+ *
+ * @see     shc_lcd_interface.h
+ */
+
+#define TRACER_OFF
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "tracer.h"
+
+// --------------------------------------------------------------------------------
+
+#include "cpu.h"
+
+// --------------------------------------------------------------------------------
+
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <semaphore.h>
+
+// --------------------------------------------------------------------------------
+
+#include "ui/lcd/ui_lcd_interface.h"
+
+// --------------------------------------------------------------------------------
+
+#include "shc_lcd_interface.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Content of the display, written by shc_lcd_write_line().
+ * Every line is padded with spaces, so a shorter line
+ * overwrites all characters of the previous one.
+ *
+ */
+static char frame_buffer[SHC_LCD_INTERFACE_NUM_LINES][SHC_LCD_INTERFACE_NUM_CHARACTERS + 1];
+static pthread_mutex_t frame_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * @brief Content that was written to the display by the display-thread.
+ * Only used by the display-thread.
+ *
+ */
+static char display_buffer[SHC_LCD_INTERFACE_NUM_LINES][SHC_LCD_INTERFACE_NUM_CHARACTERS + 1];
+
+static SHC_LCD_INTERFACE_STATISTIC statistic;
+
+static pthread_t display_thread;
+static sem_t display_semaphore;
+static u8 display_running = 0;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Get the actual value of the monotonic clock in microseconds
+ *
+ * @return monotonic time in microseconds
+ */
+static u64 shc_lcd_interface_time_us(void) {
+
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (u64)now.tv_sec * 1000000ULL + (u64)now.tv_nsec / 1000ULL;
+}
+
+/**
+ * @brief Fills all lines of a buffer with spaces
+ *
+ * @param p_buffer framebuffer or shadow-copy of the display
+ */
+static void shc_lcd_interface_clear(char p_buffer[][SHC_LCD_INTERFACE_NUM_CHARACTERS + 1]) {
+
+    u8 i = 0;
+    for ( ; i < SHC_LCD_INTERFACE_NUM_LINES ; i++) {
+        memset(p_buffer[i], ' ', SHC_LCD_INTERFACE_NUM_CHARACTERS);
+        p_buffer[i][SHC_LCD_INTERFACE_NUM_CHARACTERS] = '\0';
+    }
+}
+
+/**
+ * @brief Stores a new maximum into a field of the statistic
+ *
+ * @param p_maximum field of the statistic
+ * @param value the new value
+ */
+static void shc_lcd_interface_update_max(u32* p_maximum, u32 value) {
+
+    u32 maximum = __atomic_load_n(p_maximum, __ATOMIC_RELAXED);
+
+    while (value > maximum) {
+        if (__atomic_compare_exchange_n(p_maximum, &maximum, value, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Writes the framebuffer to the display if its content
+ * differs from the content that was written before.
+ *
+ */
+static void shc_lcd_interface_refresh(void) {
+
+    char snapshot[SHC_LCD_INTERFACE_NUM_LINES][SHC_LCD_INTERFACE_NUM_CHARACTERS + 1];
+
+    pthread_mutex_lock(&frame_mutex);
+    memcpy(snapshot, frame_buffer, sizeof(snapshot));
+    pthread_mutex_unlock(&frame_mutex);
+
+    if (memcmp(snapshot, display_buffer, sizeof(snapshot)) == 0) {
+        return;
+    }
+
+    u64 start_us = shc_lcd_interface_time_us();
+
+    // the driver has no cursor-positioning, all lines are written from top to bottom
+    u8 i = 0;
+    for ( ; i < SHC_LCD_INTERFACE_NUM_LINES ; i++) {
+        lcd_write_line(snapshot[i]);
+    }
+
+    memcpy(display_buffer, snapshot, sizeof(display_buffer));
+
+    __atomic_add_fetch(&statistic.refreshed, 1, __ATOMIC_RELAXED);
+    shc_lcd_interface_update_max(&statistic.refresh_max_us, (u32)(shc_lcd_interface_time_us() - start_us));
+}
+
+/**
+ * @brief Initializes the display and refreshes it every time
+ * the semaphore is posted, until display_running is cleared.
+ *
+ * @param p_argument not used
+ * @return always NULL
+ */
+static void* shc_lcd_interface_display_thread(void* p_argument) {
+
+    (void) p_argument;
+
+    lcd_init();
+    lcd_set_enabled(1);
+
+    // the display is empty after lcd_init(), lines written before are shown now
+    shc_lcd_interface_clear(display_buffer);
+    shc_lcd_interface_refresh();
+
+    while (__atomic_load_n(&display_running, __ATOMIC_ACQUIRE)) {
+
+        sem_wait(&display_semaphore);
+
+        // all lines written during the last refresh are handled at once
+        while (sem_trywait(&display_semaphore) == 0) { }
+
+        shc_lcd_interface_refresh();
+    }
+
+    shc_lcd_interface_refresh();
+
+    return NULL;
+}
+
+// --------------------------------------------------------------------------------
+
+void shc_lcd_interface_init(void) {
+
+    DEBUG_PASS("shc_lcd_interface_init()");
+
+    pthread_mutex_lock(&frame_mutex);
+    shc_lcd_interface_clear(frame_buffer);
+    pthread_mutex_unlock(&frame_mutex);
+
+    memset(&statistic, 0x00, sizeof(statistic));
+}
+
+void shc_lcd_interface_enable(void) {
+
+    DEBUG_PASS("shc_lcd_interface_enable()");
+
+    if (display_running) {
+        return;
+    }
+
+    if (sem_init(&display_semaphore, 0, 0) != 0) {
+        DEBUG_PASS("shc_lcd_interface_enable() - sem_init() has FAILED !!! ---");
+        return;
+    }
+
+    display_running = 1;
+
+    if (pthread_create(&display_thread, NULL, shc_lcd_interface_display_thread, NULL) != 0) {
+        DEBUG_PASS("shc_lcd_interface_enable() - pthread_create() has FAILED !!! ---");
+        display_running = 0;
+        sem_destroy(&display_semaphore);
+    }
+}
+
+void shc_lcd_interface_deinit(void) {
+
+    DEBUG_PASS("shc_lcd_interface_deinit()");
+
+    if (display_running == 0) {
+        return;
+    }
+
+    __atomic_store_n(&display_running, 0, __ATOMIC_RELEASE);
+    sem_post(&display_semaphore);
+
+    pthread_join(display_thread, NULL);
+    sem_destroy(&display_semaphore);
+}
+
+void shc_lcd_write_line(const char* p_line) {
+
+    if (p_line == NULL) {
+        return;
+    }
+
+    u64 start_us = shc_lcd_interface_time_us();
+
+    size_t length = strnlen(p_line, SHC_LCD_INTERFACE_NUM_CHARACTERS);
+
+    pthread_mutex_lock(&frame_mutex);
+
+    memmove(frame_buffer[0], frame_buffer[1], sizeof(frame_buffer) - sizeof(frame_buffer[0]));
+
+    char* p_last_line = frame_buffer[SHC_LCD_INTERFACE_NUM_LINES - 1];
+    memcpy(p_last_line, p_line, length);
+    memset(p_last_line + length, ' ', SHC_LCD_INTERFACE_NUM_CHARACTERS - length);
+
+    pthread_mutex_unlock(&frame_mutex);
+
+    if (__atomic_load_n(&display_running, __ATOMIC_ACQUIRE)) {
+        sem_post(&display_semaphore);
+    }
+
+    __atomic_add_fetch(&statistic.written, 1, __ATOMIC_RELAXED);
+    shc_lcd_interface_update_max(&statistic.write_max_us, (u32)(shc_lcd_interface_time_us() - start_us));
+}
+
+void shc_lcd_interface_get_statistic(SHC_LCD_INTERFACE_STATISTIC* p_statistic) {
+
+    if (p_statistic == NULL) {
+        return;
+    }
+
+    p_statistic->written = __atomic_load_n(&statistic.written, __ATOMIC_RELAXED);
+    p_statistic->refreshed = __atomic_load_n(&statistic.refreshed, __ATOMIC_RELAXED);
+    p_statistic->refresh_max_us = __atomic_load_n(&statistic.refresh_max_us, __ATOMIC_RELAXED);
+    p_statistic->write_max_us = __atomic_load_n(&statistic.write_max_us, __ATOMIC_RELAXED);
+}
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,152 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_lcd_interface.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Asynchronous LCD output of the shcClient.
+ *
+ *          The LCD_16X2 driver of the framework bit-bangs the GPIOs with
+ *          fixed delays, so a single lcd_write_line() blocks the caller
+ *          for milliseconds. shc_lcd_write_line() only scrolls the line
+ *          into an in-memory framebuffer and returns. A background thread
+ *          is the only user of the framework driver: it initializes the
+ *          display and writes the framebuffer to it whenever its content
+ *          differs from the content of the display.
+ *
+ *          Lines that are written while the display is refreshed are
+ *          coalesced into the next refresh, a line that does not change
+ *          the framebuffer does not cause a refresh at all.
+ *
+ *          The framework driver has no cursor positioning. A refresh
+ *          therefore writes all lines of the display in order, from the
+ *          first line to the last one.
+ *
+ *          Usage:
+ *
+ *              shc_lcd_interface_init();
+ *              shc_lcd_interface_enable();     // -lcd was given
+ *
+ *              shc_lcd_write_line("SHC");
+ *              shc_lcd_write_line("... started");
+ *
+ *              shc_lcd_interface_deinit();     // the last content is shown
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_shc_lcd_interface_
+#define _H_shc_lcd_interface_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Number of lines of the display
+ *
+ */
+#ifndef SHC_LCD_INTERFACE_NUM_LINES
+#define SHC_LCD_INTERFACE_NUM_LINES                 2
+#endif
+
+/**
+ * @brief Number of characters of a single line of the display
+ *
+ */
+#ifndef SHC_LCD_INTERFACE_NUM_CHARACTERS
+#define SHC_LCD_INTERFACE_NUM_CHARACTERS            16
+#endif
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Statistic of the LCD output since shc_lcd_interface_init()
+ *
+ */
+typedef struct SHC_LCD_INTERFACE_STATISTIC_STRUCT {
+
+    /**
+     * @brief Number of calls of shc_lcd_write_line()
+     *
+     */
+    u32 written;
+
+    /**
+     * @brief Number of refreshes of the display
+     *
+     */
+    u32 refreshed;
+
+    /**
+     * @brief Maximum duration of a single refresh in microseconds
+     *
+     */
+    u32 refresh_max_us;
+
+    /**
+     * @brief Maximum time shc_lcd_write_line() has blocked its caller in microseconds
+     *
+     */
+    u32 write_max_us;
+
+} SHC_LCD_INTERFACE_STATISTIC;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Clears the framebuffer. The display is not touched
+ * until shc_lcd_interface_enable() is called.
+ *
+ */
+void shc_lcd_interface_init(void);
+
+/**
+ * @brief Starts the background thread that initializes
+ * the display and keeps it up to date.
+ *
+ */
+void shc_lcd_interface_enable(void);
+
+/**
+ * @brief Writes the actual framebuffer to the display
+ * and stops the background thread.
+ *
+ */
+void shc_lcd_interface_deinit(void);
+
+/**
+ * @brief Scrolls the framebuffer by one line and writes the given
+ * text into the last line. Does not wait for the display.
+ * Must only be called from the main-loop.
+ *
+ * @param p_line zero-terminated text, longer texts are cut
+ */
+void shc_lcd_write_line(const char* p_line);
+
+/**
+ * @brief Get the actual statistic of the LCD output
+ *
+ * @param p_statistic the statistic is copied into this structure
+ */
+void shc_lcd_interface_get_statistic(SHC_LCD_INTERFACE_STATISTIC* p_statistic);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_shc_lcd_interface_
+
+// --------------------------------------------------------------------------------
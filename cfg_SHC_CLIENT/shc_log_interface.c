@@ -0,0 +1,816 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_log_interface.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Asynchronous log backend using a bounded lock-free
+ *          multi-producer ring-buffer and a writer thread.
+ *
+ *          Every slot of the ring-buffer holds a sequence number.
+ *          A producer owns a slot after it has moved the enqueue
+ *          position by compare-and-swap. The writer claims all
+ *          filled slots, writes them with one writev() and gives
+ *          the slots back afterwards. There is no copy of a record
+ *          between formatting and writing.
+ *
+ * @see     shc_log_interface.h
+ */
+
+#define TRACER_OFF
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "tracer.h"
+
+// --------------------------------------------------------------------------------
+
+#include "cpu.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#include <errno.h>
+#include <sched.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sys/uio.h>
+
+// --------------------------------------------------------------------------------
+
+#include "common/signal_slot_interface.h"
+#include "ui/cfg_file_parser/cfg_file_parser.h"
+
+// --------------------------------------------------------------------------------
+
+#include "shc_log_interface.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Number of records of the ring-buffer, must be a power of two
+ *
+ */
+#ifndef SHC_LOG_INTERFACE_QUEUE_SIZE
+#define SHC_LOG_INTERFACE_QUEUE_SIZE                512
+#endif
+
+/**
+ * @brief Maximum length of a single record including time-stamp and line-break
+ *
+ */
+#ifndef SHC_LOG_INTERFACE_RECORD_MAX_LENGTH
+#define SHC_LOG_INTERFACE_RECORD_MAX_LENGTH         256
+#endif
+
+/**
+ * @brief Maximum number of records that are written by a single writev()
+ *
+ */
+#ifndef SHC_LOG_INTERFACE_WRITEV_MAX_RECORDS
+#define SHC_LOG_INTERFACE_WRITEV_MAX_RECORDS        64
+#endif
+
+/**
+ * @brief Default of LOG_FLUSH_INTERVAL_MS
+ *
+ */
+#ifndef SHC_LOG_INTERFACE_FLUSH_INTERVAL_MS
+#define SHC_LOG_INTERFACE_FLUSH_INTERVAL_MS         1000
+#endif
+
+/**
+ * @brief Default of LOG_FSYNC_INTERVAL_MS
+ *
+ */
+#ifndef SHC_LOG_INTERFACE_FSYNC_INTERVAL_MS
+#define SHC_LOG_INTERFACE_FSYNC_INTERVAL_MS         60000
+#endif
+
+/**
+ * @brief Name of the log-file inside of LOG_FILE_PATH
+ *
+ */
+#ifndef SHC_LOG_INTERFACE_FILE_NAME
+#define SHC_LOG_INTERFACE_FILE_NAME                 "shc_log.txt"
+#endif
+
+/**
+ * @brief Maximum length of the complete path of the log-file
+ *
+ */
+#ifndef SHC_LOG_INTERFACE_PATH_MAX_LENGTH
+#define SHC_LOG_INTERFACE_PATH_MAX_LENGTH           256
+#endif
+
+// --------------------------------------------------------------------------------
+
+#if (SHC_LOG_INTERFACE_QUEUE_SIZE & (SHC_LOG_INTERFACE_QUEUE_SIZE - 1)) != 0
+#error SHC_LOG_INTERFACE_QUEUE_SIZE must be a power of two
+#endif
+
+#define SHC_LOG_INTERFACE_QUEUE_MASK                (SHC_LOG_INTERFACE_QUEUE_SIZE - 1)
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief A single slot of the ring-buffer
+ *
+ */
+typedef struct SHC_LOG_INTERFACE_RECORD_STRUCT {
+
+    /**
+     * @brief Sequence number of this slot.
+     * == position      : slot is free for the producer at position
+     * == position + 1  : slot holds the record of position
+     *
+     */
+    u32 sequence;
+
+    /**
+     * @brief Number of valid characters in data
+     *
+     */
+    u16 length;
+
+    /**
+     * @brief The formatted record
+     *
+     */
+    char data[SHC_LOG_INTERFACE_RECORD_MAX_LENGTH];
+
+} SHC_LOG_INTERFACE_RECORD;
+
+// --------------------------------------------------------------------------------
+
+static SHC_LOG_INTERFACE_RECORD record_table[SHC_LOG_INTERFACE_QUEUE_SIZE];
+
+static u32 enqueue_position = 0;
+static u32 dequeue_position = 0;
+
+static SHC_LOG_INTERFACE_STATISTIC statistic;
+
+static u8 overflow_policy = SHC_LOG_INTERFACE_OVERFLOW_DROP_NEWEST;
+static u32 flush_interval_ms = SHC_LOG_INTERFACE_FLUSH_INTERVAL_MS;
+static u32 fsync_interval_ms = SHC_LOG_INTERFACE_FSYNC_INTERVAL_MS;
+
+/**
+ * @brief Path of the log-file, only used by the writer thread
+ * after file_path_changed has been set.
+ *
+ */
+static char file_path[SHC_LOG_INTERFACE_PATH_MAX_LENGTH];
+static u8 file_path_changed = 0;
+static pthread_mutex_t file_path_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static int file_handle = -1;
+
+/**
+ * @brief Set by the writer thread while the log-file is open.
+ * Until then BLOCK behaves like DROP_NEWEST, there is nobody
+ * who could make space.
+ *
+ */
+static u8 file_available = 0;
+
+/**
+ * @brief Records dropped while no log-file was available that have
+ * not been reported inside of the log-file yet
+ *
+ */
+static u32 unreported_drops = 0;
+
+/**
+ * @brief Set by the producer that has woken up the writer,
+ * cleared by the writer before it drains the ring-buffer
+ *
+ */
+static u8 wakeup_pending = 0;
+
+static pthread_t writer_thread;
+static sem_t writer_semaphore;
+static u8 writer_running = 0;
+
+// --------------------------------------------------------------------------------
+
+static void shc_log_interface_CFG_OBJECT_RECEIVED_SLOT_CALLBACK(const void* p_argument);
+
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(CFG_PARSER_NEW_CFG_OBJECT_SIGNAL, SHC_LOG_INTERFACE_CFG_OBJECT_RECEIVED_SLOT, shc_log_interface_CFG_OBJECT_RECEIVED_SLOT_CALLBACK)
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Get the actual value of the monotonic clock in milliseconds
+ *
+ * @return monotonic time in milliseconds
+ */
+static u64 shc_log_interface_time_ms(void) {
+
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (u64)now.tv_sec * 1000ULL + (u64)now.tv_nsec / 1000000ULL;
+}
+
+/**
+ * @brief Get the actual number of records inside of the ring-buffer
+ *
+ * @return number of records
+ */
+static u32 shc_log_interface_queue_depth(void) {
+
+    // dequeue-position first, it never overtakes the enqueue-position
+    u32 dequeued = __atomic_load_n(&dequeue_position, __ATOMIC_ACQUIRE);
+    u32 enqueued = __atomic_load_n(&enqueue_position, __ATOMIC_ACQUIRE);
+    u32 depth = enqueued - dequeued;
+
+    return depth > SHC_LOG_INTERFACE_QUEUE_SIZE ? SHC_LOG_INTERFACE_QUEUE_SIZE : depth;
+}
+
+/**
+ * @brief Claims the oldest filled slot of the ring-buffer.
+ * The slot must be given back via shc_log_interface_release().
+ *
+ * @param p_position position of the claimed slot
+ * @return the claimed slot or NULL if the ring-buffer is empty
+ */
+static SHC_LOG_INTERFACE_RECORD* shc_log_interface_claim(u32* p_position) {
+
+    u32 position = __atomic_load_n(&dequeue_position, __ATOMIC_RELAXED);
+
+    for (;;) {
+
+        SHC_LOG_INTERFACE_RECORD* p_record = &record_table[position & SHC_LOG_INTERFACE_QUEUE_MASK];
+        u32 sequence = __atomic_load_n(&p_record->sequence, __ATOMIC_ACQUIRE);
+        i32 difference = (i32)(sequence - (position + 1));
+
+        if (difference == 0) {
+
+            if (__atomic_compare_exchange_n(&dequeue_position, &position, position + 1, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                *p_position = position;
+                return p_record;
+            }
+
+        } else if (difference < 0) {
+            return NULL;
+
+        } else {
+            position = __atomic_load_n(&dequeue_position, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+/**
+ * @brief Gives a claimed slot back to the producers
+ *
+ * @param p_record the claimed slot
+ * @param position position of the claimed slot
+ */
+static void shc_log_interface_release(SHC_LOG_INTERFACE_RECORD* p_record, u32 position) {
+    __atomic_store_n(&p_record->sequence, position + SHC_LOG_INTERFACE_QUEUE_SIZE, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Reserves a free slot at the end of the ring-buffer.
+ * The slot must be published via shc_log_interface_publish().
+ *
+ * @param p_position position of the reserved slot
+ * @return the reserved slot or NULL if the ring-buffer is full
+ */
+static SHC_LOG_INTERFACE_RECORD* shc_log_interface_reserve(u32* p_position) {
+
+    u32 position = __atomic_load_n(&enqueue_position, __ATOMIC_RELAXED);
+
+    for (;;) {
+
+        SHC_LOG_INTERFACE_RECORD* p_record = &record_table[position & SHC_LOG_INTERFACE_QUEUE_MASK];
+        u32 sequence = __atomic_load_n(&p_record->sequence, __ATOMIC_ACQUIRE);
+        i32 difference = (i32)(sequence - position);
+
+        if (difference == 0) {
+
+            if (__atomic_compare_exchange_n(&enqueue_position, &position, position + 1, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                *p_position = position;
+                return p_record;
+            }
+
+        } else if (difference < 0) {
+            return NULL;
+
+        } else {
+            position = __atomic_load_n(&enqueue_position, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+/**
+ * @brief Makes a reserved slot visible to the writer
+ *
+ * @param p_record the reserved slot
+ * @param position position of the reserved slot
+ */
+static void shc_log_interface_publish(SHC_LOG_INTERFACE_RECORD* p_record, u32 position) {
+    __atomic_store_n(&p_record->sequence, position + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Reserves a slot with respect to the actual overflow-policy
+ *
+ * @param p_position position of the reserved slot
+ * @return the reserved slot or NULL if the record has to be dropped
+ */
+static SHC_LOG_INTERFACE_RECORD* shc_log_interface_reserve_with_policy(u32* p_position) {
+
+    for (;;) {
+
+        SHC_LOG_INTERFACE_RECORD* p_record = shc_log_interface_reserve(p_position);
+        if (p_record != NULL) {
+            return p_record;
+        }
+
+        u8 policy = __atomic_load_n(&overflow_policy, __ATOMIC_RELAXED);
+
+        if (policy == SHC_LOG_INTERFACE_OVERFLOW_DROP_OLDEST) {
+
+            u32 oldest_position = 0;
+            SHC_LOG_INTERFACE_RECORD* p_oldest = shc_log_interface_claim(&oldest_position);
+
+            if (p_oldest != NULL) {
+                shc_log_interface_release(p_oldest, oldest_position);
+                __atomic_add_fetch(&statistic.dropped, 1, __ATOMIC_RELAXED);
+            }
+
+            continue;
+        }
+
+        u8 available = __atomic_load_n(&file_available, __ATOMIC_ACQUIRE);
+
+        if (policy == SHC_LOG_INTERFACE_OVERFLOW_BLOCK && writer_running && available) {
+            sem_post(&writer_semaphore);
+            sched_yield();
+            continue;
+        }
+
+        __atomic_add_fetch(&statistic.dropped, 1, __ATOMIC_RELAXED);
+
+        if (available == 0) {
+            // reported inside of the log-file as soon as it is available
+            __atomic_add_fetch(&statistic.dropped_without_file, 1, __ATOMIC_RELAXED);
+            __atomic_add_fetch(&unreported_drops, 1, __ATOMIC_RELAXED);
+        }
+
+        return NULL;
+    }
+}
+
+/**
+ * @brief Formats a record into a slot of the ring-buffer
+ * and wakes up the writer if necessary.
+ *
+ * @param p_msg message of the record
+ * @param p_string optional string that is appended to the message, can be NULL
+ */
+static void shc_log_interface_add_record(const char* p_msg, const char* p_string) {
+
+    u32 position = 0;
+    SHC_LOG_INTERFACE_RECORD* p_record = shc_log_interface_reserve_with_policy(&position);
+
+    if (p_record == NULL) {
+        return;
+    }
+
+    time_t now = time(NULL);
+    struct tm local_time;
+    localtime_r(&now, &local_time);
+
+    int length = (int)strftime(p_record->data, SHC_LOG_INTERFACE_RECORD_MAX_LENGTH, "%Y-%m-%d %H:%M:%S - ", &local_time);
+
+    int appended = snprintf(
+        p_record->data + length,
+        SHC_LOG_INTERFACE_RECORD_MAX_LENGTH - length,
+        "%s%s",
+        p_msg != NULL ? p_msg : "",
+        p_string != NULL ? p_string : ""
+    );
+
+    if (appended > 0) {
+        length += appended;
+    }
+
+    if (length > SHC_LOG_INTERFACE_RECORD_MAX_LENGTH - 1) {
+        length = SHC_LOG_INTERFACE_RECORD_MAX_LENGTH - 1;
+    }
+
+    p_record->data[length] = '\n';
+    p_record->length = (u16)(length + 1);
+
+    shc_log_interface_publish(p_record, position);
+
+    u32 depth = shc_log_interface_queue_depth();
+    u32 high_water = __atomic_load_n(&statistic.queue_high_water, __ATOMIC_RELAXED);
+
+    while (depth > high_water) {
+        if (__atomic_compare_exchange_n(&statistic.queue_high_water, &high_water, depth, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            break;
+        }
+    }
+
+    if (writer_running == 0) {
+        return;
+    }
+
+    // only one producer wakes up the writer until it has drained the
+    // ring-buffer, this keeps the hot-path free of syscalls
+    if (flush_interval_ms == 0 || depth >= SHC_LOG_INTERFACE_QUEUE_SIZE / 2) {
+
+        if (__atomic_exchange_n(&wakeup_pending, 1, __ATOMIC_ACQ_REL) == 0) {
+            sem_post(&writer_semaphore);
+        }
+    }
+}
+
+/**
+ * @brief Opens the log-file if the path has changed
+ *
+ */
+static void shc_log_interface_update_file(void) {
+
+    if (__atomic_load_n(&file_path_changed, __ATOMIC_ACQUIRE) == 0) {
+        return;
+    }
+
+    char path[SHC_LOG_INTERFACE_PATH_MAX_LENGTH];
+
+    pthread_mutex_lock(&file_path_mutex);
+    memcpy(path, file_path, sizeof(path));
+    file_path_changed = 0;
+    pthread_mutex_unlock(&file_path_mutex);
+
+    if (file_handle >= 0) {
+        fsync(file_handle);
+        close(file_handle);
+    }
+
+    file_handle = open(path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+
+    if (file_handle < 0) {
+        DEBUG_TRACE_STR(path, "shc_log_interface_update_file() - Opening log-file has FAILED !!! ---");
+        __atomic_add_fetch(&statistic.write_errors, 1, __ATOMIC_RELAXED);
+    }
+
+    __atomic_store_n(&file_available, file_handle >= 0 ? 1 : 0, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Writes the given records into the log-file.
+ * Handles partial writes of writev().
+ *
+ * @param p_iovec list of records
+ * @param count number of records
+ * @return 1 if all records have been written, otherwise 0
+ */
+static u8 shc_log_interface_write(struct iovec* p_iovec, int count) {
+
+    while (count > 0) {
+
+        ssize_t written = writev(file_handle, p_iovec, count);
+
+        if (written < 0) {
+
+            if (errno == EINTR) {
+                continue;
+            }
+
+            return 0;
+        }
+
+        __atomic_add_fetch(&statistic.write_calls, 1, __ATOMIC_RELAXED);
+
+        while (count > 0 && (size_t)written >= p_iovec->iov_len) {
+            written -= (ssize_t)p_iovec->iov_len;
+            p_iovec += 1;
+            count -= 1;
+        }
+
+        if (count > 0) {
+            p_iovec->iov_base = (char*)p_iovec->iov_base + written;
+            p_iovec->iov_len -= (size_t)written;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Writes a record into the log-file that tells how many records
+ * were dropped while no log-file was available. The record follows
+ * the records that were kept, the dropped ones were logged after them.
+ *
+ */
+static void shc_log_interface_report_drops(void) {
+
+    u32 drops = __atomic_exchange_n(&unreported_drops, 0, __ATOMIC_RELAXED);
+    if (drops == 0) {
+        return;
+    }
+
+    char notice[SHC_LOG_INTERFACE_RECORD_MAX_LENGTH];
+
+    int length = snprintf(notice, sizeof(notice),
+        "--- %u records dropped while no log-file was available (LOG_FILE_PATH) ---\n", drops
+    );
+
+    struct iovec notice_iovec;
+    notice_iovec.iov_base = notice;
+    notice_iovec.iov_len = (size_t)length;
+
+    if (shc_log_interface_write(&notice_iovec, 1) == 0) {
+        __atomic_add_fetch(&statistic.write_errors, 1, __ATOMIC_RELAXED);
+    }
+}
+
+/**
+ * @brief Writes all records of the ring-buffer into the log-file.
+ * Records are kept inside of the ring-buffer as long as there
+ * is no log-file available.
+ *
+ * @return number of written records
+ */
+static u32 shc_log_interface_drain(void) {
+
+    shc_log_interface_update_file();
+
+    if (file_handle < 0) {
+        return 0;
+    }
+
+    u32 written_records = 0;
+
+    for (;;) {
+
+        struct iovec iovec_list[SHC_LOG_INTERFACE_WRITEV_MAX_RECORDS];
+        SHC_LOG_INTERFACE_RECORD* record_list[SHC_LOG_INTERFACE_WRITEV_MAX_RECORDS];
+        u32 position_list[SHC_LOG_INTERFACE_WRITEV_MAX_RECORDS];
+        int count = 0;
+
+        while (count < SHC_LOG_INTERFACE_WRITEV_MAX_RECORDS) {
+
+            SHC_LOG_INTERFACE_RECORD* p_record = shc_log_interface_claim(&position_list[count]);
+            if (p_record == NULL) {
+                break;
+            }
+
+            record_list[count] = p_record;
+            iovec_list[count].iov_base = p_record->data;
+            iovec_list[count].iov_len = p_record->length;
+            count += 1;
+        }
+
+        if (count == 0) {
+            break;
+        }
+
+        if (shc_log_interface_write(iovec_list, count)) {
+            __atomic_add_fetch(&statistic.written, (u32)count, __ATOMIC_RELAXED);
+        } else {
+            __atomic_add_fetch(&statistic.write_errors, 1, __ATOMIC_RELAXED);
+            __atomic_add_fetch(&statistic.dropped, (u32)count, __ATOMIC_RELAXED);
+        }
+
+        int i = 0;
+        for ( ; i < count ; i++) {
+            shc_log_interface_release(record_list[i], position_list[i]);
+        }
+
+        written_records += (u32)count;
+
+        if (count < SHC_LOG_INTERFACE_WRITEV_MAX_RECORDS) {
+            break;
+        }
+    }
+
+    shc_log_interface_report_drops();
+
+    return written_records;
+}
+
+/**
+ * @brief Writer thread. Drains the ring-buffer every flush-interval
+ * or if woken up by a producer and calls fsync() every fsync-interval.
+ *
+ * @param p_argument not used
+ * @return always NULL
+ */
+static void* shc_log_interface_writer_thread(void* p_argument) {
+
+    (void) p_argument;
+
+    u64 last_fsync_ms = shc_log_interface_time_ms();
+    u8 fsync_pending = 0;
+
+    while (__atomic_load_n(&writer_running, __ATOMIC_ACQUIRE)) {
+
+        u32 interval_ms = __atomic_load_n(&flush_interval_ms, __ATOMIC_RELAXED);
+        if (interval_ms == 0) {
+            interval_ms = SHC_LOG_INTERFACE_FLUSH_INTERVAL_MS;
+        }
+
+        struct timespec timeout;
+        clock_gettime(CLOCK_REALTIME, &timeout);
+
+        timeout.tv_sec += (time_t)(interval_ms / 1000);
+        timeout.tv_nsec += (long)(interval_ms % 1000) * 1000000L;
+
+        if (timeout.tv_nsec >= 1000000000L) {
+            timeout.tv_sec += 1;
+            timeout.tv_nsec -= 1000000000L;
+        }
+
+        sem_timedwait(&writer_semaphore, &timeout);
+
+        // cleared before draining, a record published meanwhile wakes up the writer again
+        __atomic_store_n(&wakeup_pending, 0, __ATOMIC_RELEASE);
+
+        if (shc_log_interface_drain() != 0) {
+            fsync_pending = 1;
+        }
+
+        u32 sync_interval_ms = __atomic_load_n(&fsync_interval_ms, __ATOMIC_RELAXED);
+        u64 now_ms = shc_log_interface_time_ms();
+
+        if (fsync_pending && sync_interval_ms != 0 && now_ms - last_fsync_ms >= sync_interval_ms) {
+            fsync(file_handle);
+            fsync_pending = 0;
+            last_fsync_ms = now_ms;
+        }
+    }
+
+    shc_log_interface_drain();
+
+    return NULL;
+}
+
+// --------------------------------------------------------------------------------
+
+void shc_log_interface_init(void) {
+
+    DEBUG_PASS("shc_log_interface_init()");
+
+    u32 i = 0;
+    for ( ; i < SHC_LOG_INTERFACE_QUEUE_SIZE ; i++) {
+        record_table[i].sequence = i;
+        record_table[i].length = 0;
+    }
+
+    enqueue_position = 0;
+    dequeue_position = 0;
+
+    file_available = 0;
+    unreported_drops = 0;
+    wakeup_pending = 0;
+
+    memset(&statistic, 0x00, sizeof(statistic));
+    memset(file_path, 0x00, sizeof(file_path));
+
+    SHC_LOG_INTERFACE_CFG_OBJECT_RECEIVED_SLOT_connect();
+
+    if (sem_init(&writer_semaphore, 0, 0) != 0) {
+        DEBUG_PASS("shc_log_interface_init() - sem_init() has FAILED !!! ---");
+        return;
+    }
+
+    writer_running = 1;
+
+    if (pthread_create(&writer_thread, NULL, shc_log_interface_writer_thread, NULL) != 0) {
+        DEBUG_PASS("shc_log_interface_init() - pthread_create() has FAILED !!! ---");
+        writer_running = 0;
+        sem_destroy(&writer_semaphore);
+    }
+}
+
+void shc_log_interface_deinit(void) {
+
+    DEBUG_PASS("shc_log_interface_deinit()");
+
+    if (writer_running) {
+
+        __atomic_store_n(&writer_running, 0, __ATOMIC_RELEASE);
+        sem_post(&writer_semaphore);
+
+        pthread_join(writer_thread, NULL);
+        sem_destroy(&writer_semaphore);
+    }
+
+    if (file_handle >= 0) {
+        fsync(file_handle);
+        close(file_handle);
+        file_handle = -1;
+    }
+}
+
+void shc_log_interface_set_overflow_policy(u8 policy) {
+
+    DEBUG_TRACE_byte(policy, "shc_log_interface_set_overflow_policy()");
+    __atomic_store_n(&overflow_policy, policy, __ATOMIC_RELAXED);
+}
+
+void shc_log_interface_get_statistic(SHC_LOG_INTERFACE_STATISTIC* p_statistic) {
+
+    if (p_statistic == NULL) {
+        return;
+    }
+
+    p_statistic->written = __atomic_load_n(&statistic.written, __ATOMIC_RELAXED);
+    p_statistic->dropped = __atomic_load_n(&statistic.dropped, __ATOMIC_RELAXED);
+    p_statistic->dropped_without_file = __atomic_load_n(&statistic.dropped_without_file, __ATOMIC_RELAXED);
+    p_statistic->write_errors = __atomic_load_n(&statistic.write_errors, __ATOMIC_RELAXED);
+    p_statistic->write_calls = __atomic_load_n(&statistic.write_calls, __ATOMIC_RELAXED);
+    p_statistic->queue_high_water = __atomic_load_n(&statistic.queue_high_water, __ATOMIC_RELAXED);
+    p_statistic->queue_depth = shc_log_interface_queue_depth();
+}
+
+// --------------------------------------------------------------------------------
+
+void log_message(const char* p_msg) {
+    shc_log_interface_add_record(p_msg, NULL);
+}
+
+void log_message_string(const char* p_msg, const char* p_string) {
+    shc_log_interface_add_record(p_msg, p_string);
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Takes the parameters of the log-backend from the configuration-file
+ *
+ * @param p_argument the configuration object of type CFG_FILE_PARSER_CFG_OBJECT_TYPE
+ */
+static void shc_log_interface_CFG_OBJECT_RECEIVED_SLOT_CALLBACK(const void* p_argument) {
+
+    if (p_argument == NULL) {
+        DEBUG_PASS("shc_log_interface_CFG_OBJECT_RECEIVED_SLOT_CALLBACK() - NULL_POINTER_EXCEPTION");
+        return;
+    }
+
+    const CFG_FILE_PARSER_CFG_OBJECT_TYPE* p_cfg_obj = (const CFG_FILE_PARSER_CFG_OBJECT_TYPE*)p_argument;
+
+    if (strcmp(p_cfg_obj->key, "LOG_FILE_PATH") == 0) {
+
+        DEBUG_TRACE_STR(p_cfg_obj->value, "shc_log_interface_CFG_OBJECT_RECEIVED_SLOT_CALLBACK() - LOG_FILE_PATH");
+
+        pthread_mutex_lock(&file_path_mutex);
+        snprintf(file_path, sizeof(file_path), "%s%s", p_cfg_obj->value, SHC_LOG_INTERFACE_FILE_NAME);
+        __atomic_store_n(&file_path_changed, 1, __ATOMIC_RELEASE);
+        pthread_mutex_unlock(&file_path_mutex);
+
+        if (writer_running) {
+            sem_post(&writer_semaphore);
+        }
+
+    } else if (strcmp(p_cfg_obj->key, "LOG_FLUSH_INTERVAL_MS") == 0) {
+
+        DEBUG_TRACE_STR(p_cfg_obj->value, "shc_log_interface_CFG_OBJECT_RECEIVED_SLOT_CALLBACK() - LOG_FLUSH_INTERVAL_MS");
+        __atomic_store_n(&flush_interval_ms, (u32)strtoul(p_cfg_obj->value, NULL, 10), __ATOMIC_RELAXED);
+
+    } else if (strcmp(p_cfg_obj->key, "LOG_FSYNC_INTERVAL_MS") == 0) {
+
+        DEBUG_TRACE_STR(p_cfg_obj->value, "shc_log_interface_CFG_OBJECT_RECEIVED_SLOT_CALLBACK() - LOG_FSYNC_INTERVAL_MS");
+        __atomic_store_n(&fsync_interval_ms, (u32)strtoul(p_cfg_obj->value, NULL, 10), __ATOMIC_RELAXED);
+
+    } else if (strcmp(p_cfg_obj->key, "LOG_OVERFLOW_POLICY") == 0) {
+
+        DEBUG_TRACE_STR(p_cfg_obj->value, "shc_log_interface_CFG_OBJECT_RECEIVED_SLOT_CALLBACK() - LOG_OVERFLOW_POLICY");
+
+        if (strcmp(p_cfg_obj->value, "DROP_OLDEST") == 0) {
+            shc_log_interface_set_overflow_policy(SHC_LOG_INTERFACE_OVERFLOW_DROP_OLDEST);
+        } else if (strcmp(p_cfg_obj->value, "BLOCK") == 0) {
+            shc_log_interface_set_overflow_policy(SHC_LOG_INTERFACE_OVERFLOW_BLOCK);
+        } else {
+            shc_log_interface_set_overflow_policy(SHC_LOG_INTERFACE_OVERFLOW_DROP_NEWEST);
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------
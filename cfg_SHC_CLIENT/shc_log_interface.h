@@ -0,0 +1,184 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_log_interface.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Asynchronous log backend of the shcClient.
+ *
+ *          Replaces the LOG_INTERFACE module of the framework.
+ *          log_message() and log_message_string() only format the
+ *          message into a slot of a lock-free ring-buffer and return.
+ *          A background writer thread drains the ring-buffer and
+ *          writes all pending records with a single writev() call.
+ *
+ *          Configuration (configuration-file):
+ *
+ *          - LOG_FILE_PATH=<directory>         directory of the log-file
+ *          - LOG_FLUSH_INTERVAL_MS=<time_ms>   maximum time a record stays in the queue
+ *          - LOG_FSYNC_INTERVAL_MS=<time_ms>   interval of fsync(), 0 disables fsync()
+ *          - LOG_OVERFLOW_POLICY=<policy>      DROP_NEWEST, DROP_OLDEST or BLOCK
+ *
+ *          The writer is woken up before the flush-interval has expired
+ *          if the ring-buffer is at least half full.
+ *
+ *          Records logged before LOG_FILE_PATH is known stay inside of
+ *          the ring-buffer and are written as soon as the log-file is
+ *          opened. If more than SHC_LOG_INTERFACE_QUEUE_SIZE records are
+ *          logged meanwhile, the newest ones are dropped - also with the
+ *          policy BLOCK, because nobody could make space. These drops are
+ *          counted in dropped_without_file and reported by a record in
+ *          the log-file as soon as it is available.
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_shc_log_interface_
+#define _H_shc_log_interface_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief A new record is dropped if the ring-buffer is full
+ *
+ */
+#define SHC_LOG_INTERFACE_OVERFLOW_DROP_NEWEST          0
+
+/**
+ * @brief The oldest record is dropped if the ring-buffer is full
+ *
+ */
+#define SHC_LOG_INTERFACE_OVERFLOW_DROP_OLDEST          1
+
+/**
+ * @brief The caller waits until the writer has made space.
+ * Do not use this policy if the log-file is on a slow medium.
+ *
+ */
+#define SHC_LOG_INTERFACE_OVERFLOW_BLOCK                2
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Counters of the log-backend since shc_log_interface_init()
+ *
+ */
+typedef struct SHC_LOG_INTERFACE_STATISTIC_STRUCT {
+
+    /**
+     * @brief Number of records written into the log-file
+     *
+     */
+    u32 written;
+
+    /**
+     * @brief Number of records dropped because the ring-buffer was full
+     *
+     */
+    u32 dropped;
+
+    /**
+     * @brief Number of records of dropped that were dropped
+     * because no log-file was available yet
+     *
+     */
+    u32 dropped_without_file;
+
+    /**
+     * @brief Number of failed write operations
+     *
+     */
+    u32 write_errors;
+
+    /**
+     * @brief Number of writev() calls
+     *
+     */
+    u32 write_calls;
+
+    /**
+     * @brief Actual number of records inside of the ring-buffer
+     *
+     */
+    u32 queue_depth;
+
+    /**
+     * @brief Maximum number of records that have been inside of the ring-buffer
+     *
+     */
+    u32 queue_high_water;
+
+} SHC_LOG_INTERFACE_STATISTIC;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Initializes the ring-buffer, connects to the configuration-parser
+ * and starts the writer thread. Records that are logged before the
+ * LOG_FILE_PATH is known are kept inside of the ring-buffer.
+ *
+ */
+void shc_log_interface_init(void);
+
+/**
+ * @brief Writes all pending records, stops the writer thread
+ * and closes the log-file.
+ *
+ */
+void shc_log_interface_deinit(void);
+
+/**
+ * @brief Sets the behavior if the ring-buffer is full.
+ *
+ * @param policy one of SHC_LOG_INTERFACE_OVERFLOW_xxx
+ */
+void shc_log_interface_set_overflow_policy(u8 policy);
+
+/**
+ * @brief Get the actual counters of the log-backend.
+ *
+ * @param p_statistic counters are copied into this structure
+ */
+void shc_log_interface_get_statistic(SHC_LOG_INTERFACE_STATISTIC* p_statistic);
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Adds a new record to the log-file. Does not block.
+ * Can be called from any thread.
+ *
+ * @param p_msg message to log
+ */
+void log_message(const char* p_msg);
+
+/**
+ * @brief Adds a new record to the log-file that consists of
+ * the given message followed by the given string.
+ * Does not block. Can be called from any thread.
+ *
+ * @param p_msg message to log
+ * @param p_string string that is appended to the message
+ */
+void log_message_string(const char* p_msg, const char* p_string);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_shc_log_interface_
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,883 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_metrics.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Implementation of the latency-histograms and counters
+ *
+ * @see     shc_metrics.h
+ */
+
+#define TRACER_OFF
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "tracer.h"
+
+// --------------------------------------------------------------------------------
+
+#include "cpu.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+
+// --------------------------------------------------------------------------------
+
+#include "common/signal_slot_interface.h"
+
+#include "ui/cfg_file_parser/cfg_file_parser.h"
+
+// --------------------------------------------------------------------------------
+
+#include "shc_event_loop.h"
+#include "shc_msg_executer.h"
+#include "shc_cli_executer.h"
+#include "shc_mqtt_interface.h"
+#include "shc_response_cache.h"
+#include "shc_metrics.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Maximum number of command-names with their own histograms.
+ * All further command-names are counted as SHC_METRICS_KEY_OTHER.
+ *
+ */
+#ifndef SHC_METRICS_MAX_KEYS
+#define SHC_METRICS_MAX_KEYS                        64
+#endif
+
+/**
+ * @brief Maximum length of a command-name including the zero-terminator
+ *
+ */
+#ifndef SHC_METRICS_KEY_MAX_LENGTH
+#define SHC_METRICS_KEY_MAX_LENGTH                  64
+#endif
+
+/**
+ * @brief Maximum length of the path of the unix-socket and the metrics-file
+ *
+ */
+#ifndef SHC_METRICS_PATH_MAX_LENGTH
+#define SHC_METRICS_PATH_MAX_LENGTH                 108
+#endif
+
+/**
+ * @brief Default of METRICS_FILE_INTERVAL_MS
+ *
+ */
+#ifndef SHC_METRICS_FILE_INTERVAL_MS
+#define SHC_METRICS_FILE_INTERVAL_MS                10000
+#endif
+
+/**
+ * @brief Maximum time to write the metrics into a connection
+ * of the unix-socket, the main-loop is blocked meanwhile
+ *
+ */
+#ifndef SHC_METRICS_SOCKET_TIMEOUT_MS
+#define SHC_METRICS_SOCKET_TIMEOUT_MS               100
+#endif
+
+/**
+ * @brief Name of the command-names that do not fit into the key-list
+ *
+ */
+#define SHC_METRICS_KEY_OTHER                       "other"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Upper bounds of the buckets in microseconds,
+ * the last bucket (+Inf) is not part of the list
+ *
+ */
+static const u32 bucket_bound_list[] = {
+    250, 500, 1000, 2000, 3000, 5000, 7500, 10000, 15000, 25000,
+    50000, 75000, 100000, 250000, 500000, 1000000, 2500000, 5000000
+};
+
+#define SHC_METRICS_NUM_BUCKETS                     (sizeof(bucket_bound_list) / sizeof(bucket_bound_list[0]) + 1)
+
+static const char* const stage_name_list[SHC_METRICS_NUM_STAGES] = {
+    "queue", "host", "total", "publish"
+};
+
+static const char* const priority_name_list[SHC_MSG_EXECUTER_NUM_PRIORITIES] = {
+    "interactive", "event", "report"
+};
+
+// --------------------------------------------------------------------------------
+
+#define SHC_METRICS_COUNTER_MQTT_RECEIVED           0
+#define SHC_METRICS_COUNTER_HOST_TIMEOUT            1
+#define SHC_METRICS_COUNTER_INVALID_COMMAND         2
+#define SHC_METRICS_COUNTER_INVALID_SYNTAX          3
+#define SHC_METRICS_COUNTER_MQTT_RECONNECT          4
+#define SHC_METRICS_COUNTER_MQTT_CONNECTION_LOST    5
+#define SHC_METRICS_COUNTER_MQTT_SEND_FAILED        6
+#define SHC_METRICS_COUNTER_EXE_TIMEOUT             7
+#define SHC_METRICS_COUNTER_CACHE_HIT               8
+#define SHC_METRICS_COUNTER_CACHE_MISS              9
+#define SHC_METRICS_COUNTER_SUPERSEDED              10
+
+#define SHC_METRICS_NUM_COUNTERS                    11
+
+/**
+ * @brief Name and description of every counter in the Prometheus-output
+ *
+ */
+static const char* const counter_name_list[SHC_METRICS_NUM_COUNTERS][2] = {
+    { "mqtt_received",          "Number of received MQTT-messages" },
+    { "host_timeouts",          "Number of commands without response of the control-board" },
+    { "invalid_commands",       "Number of received commands that are unknown" },
+    { "invalid_syntax",         "Number of received commands with invalid syntax" },
+    { "mqtt_reconnects",        "Number of connections to the broker after the first one" },
+    { "mqtt_connection_lost",   "Number of lost connections to the broker" },
+    { "mqtt_send_failed",       "Number of messages that were dropped or not acknowledged" },
+    { "exe_timeouts",           "Number of shell-commands that were killed by their timeout" },
+    { "response_cache_hits",    "Number of status-queries answered from the response-cache" },
+    { "response_cache_misses",  "Number of status-queries sent to the control-board" },
+    { "commands_superseded",    "Number of commands replaced by a newer command of the same target" }
+};
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief A single histogram. The buckets are not cumulative,
+ * they are summed up on export.
+ *
+ */
+typedef struct SHC_METRICS_HISTOGRAM_STRUCT {
+    u32 bucket_list[SHC_METRICS_NUM_BUCKETS];
+    u32 count;
+    u64 sum_us;
+} SHC_METRICS_HISTOGRAM;
+
+/**
+ * @brief The histograms of all stages of a single command-name
+ *
+ */
+typedef struct SHC_METRICS_KEY_ENTRY_STRUCT {
+    char key[SHC_METRICS_KEY_MAX_LENGTH];
+    SHC_METRICS_HISTOGRAM histogram_list[SHC_METRICS_NUM_STAGES];
+} SHC_METRICS_KEY_ENTRY;
+
+/**
+ * @brief Output buffer of the Prometheus text-format
+ *
+ */
+typedef struct SHC_METRICS_BUFFER_STRUCT {
+    char* p_data;
+    size_t length;
+    size_t size;
+} SHC_METRICS_BUFFER;
+
+// --------------------------------------------------------------------------------
+
+static SHC_METRICS_KEY_ENTRY key_list[SHC_METRICS_MAX_KEYS];
+static u16 key_count = 0;
+
+/**
+ * @brief Histograms of every stage over all command-names
+ *
+ */
+static SHC_METRICS_HISTOGRAM stage_list[SHC_METRICS_NUM_STAGES];
+
+/**
+ * @brief Histograms of the queue-wait of every priority-class
+ *
+ */
+static SHC_METRICS_HISTOGRAM priority_list[SHC_MSG_EXECUTER_NUM_PRIORITIES];
+
+static u32 counter_list[SHC_METRICS_NUM_COUNTERS];
+static u32 connection_count = 0;
+
+static SHC_METRICS_BUFFER output;
+
+static char socket_path[SHC_METRICS_PATH_MAX_LENGTH];
+static int socket_handle = -1;
+static u8 socket_pending = 0;
+
+static char file_path[SHC_METRICS_PATH_MAX_LENGTH];
+static u32 file_interval_ms = SHC_METRICS_FILE_INTERVAL_MS;
+static u64 file_timestamp_us = 0;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Appends formatted text to the output buffer.
+ * The buffer grows as needed.
+ *
+ * @param p_format printf-like format
+ */
+static void shc_metrics_append(const char* p_format, ...) {
+
+    while (1) {
+
+        size_t free_space = output.size - output.length;
+
+        va_list args;
+        va_start(args, p_format);
+        int length = vsnprintf(output.p_data + output.length, free_space, p_format, args);
+        va_end(args);
+
+        if (length < 0) {
+            return;
+        }
+
+        if ((size_t)length < free_space) {
+            output.length += (size_t)length;
+            return;
+        }
+
+        size_t new_size = (output.size == 0) ? 4096 : output.size * 2;
+        while (new_size - output.length <= (size_t)length) {
+            new_size *= 2;
+        }
+
+        char* p_data = (char*)realloc(output.p_data, new_size);
+        if (p_data == NULL) {
+            DEBUG_PASS("shc_metrics_append() - Out of memory");
+            return;
+        }
+
+        output.p_data = p_data;
+        output.size = new_size;
+    }
+}
+
+/**
+ * @brief Adds a latency to the given histogram
+ *
+ * @param p_histogram the histogram
+ * @param latency_us the latency in microseconds
+ */
+static void shc_metrics_histogram_add(SHC_METRICS_HISTOGRAM* p_histogram, u32 latency_us) {
+
+    u8 bucket = 0;
+    while (bucket < SHC_METRICS_NUM_BUCKETS - 1 && latency_us > bucket_bound_list[bucket]) {
+        bucket += 1;
+    }
+
+    p_histogram->bucket_list[bucket] += 1;
+    p_histogram->count += 1;
+    p_histogram->sum_us += latency_us;
+}
+
+/**
+ * @brief Get a quantile of the given histogram.
+ * The value is interpolated inside of the bucket that contains the quantile.
+ *
+ * @param p_histogram the histogram
+ * @param permille the quantile, e.g. 500 for p50 or 990 for p99
+ * @return the quantile in microseconds, 0 if nothing was measured
+ */
+static u32 shc_metrics_histogram_quantile(const SHC_METRICS_HISTOGRAM* p_histogram, u16 permille) {
+
+    if (p_histogram->count == 0) {
+        return 0;
+    }
+
+    u64 rank = ((u64)p_histogram->count * permille + 999) / 1000;
+    u32 cumulative = 0;
+
+    u8 bucket = 0;
+    for ( ; bucket < SHC_METRICS_NUM_BUCKETS ; bucket++) {
+
+        u32 bucket_count = p_histogram->bucket_list[bucket];
+
+        if (cumulative + bucket_count < rank) {
+            cumulative += bucket_count;
+            continue;
+        }
+
+        if (bucket == SHC_METRICS_NUM_BUCKETS - 1) {
+            // no upper bound, same as histogram_quantile() of Prometheus
+            return bucket_bound_list[bucket - 1];
+        }
+
+        u32 lower_us = (bucket == 0) ? 0 : bucket_bound_list[bucket - 1];
+        u32 upper_us = bucket_bound_list[bucket];
+
+        return lower_us + (u32)(((u64)(upper_us - lower_us) * (rank - cumulative)) / bucket_count);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Get the histograms of a command-name,
+ * a new entry is created on first use.
+ *
+ * @param p_key name of the command, not zero-terminated
+ * @param key_length number of characters of p_key
+ * @return the entry of the command-name
+ */
+static SHC_METRICS_KEY_ENTRY* shc_metrics_find_key(const char* p_key, u16 key_length) {
+
+    if (key_length >= SHC_METRICS_KEY_MAX_LENGTH) {
+        key_length = SHC_METRICS_KEY_MAX_LENGTH - 1;
+    }
+
+    u16 i = 0;
+    for ( ; i < key_count ; i++) {
+
+        if (strncmp(key_list[i].key, p_key, key_length) == 0 && key_list[i].key[key_length] == '\0') {
+            return &key_list[i];
+        }
+    }
+
+    if (key_count == SHC_METRICS_MAX_KEYS - 1) {
+        // the last entry collects all other command-names
+        SHC_METRICS_KEY_ENTRY* p_entry = &key_list[SHC_METRICS_MAX_KEYS - 1];
+
+        if (p_entry->key[0] == '\0') {
+            snprintf(p_entry->key, sizeof(p_entry->key), "%s", SHC_METRICS_KEY_OTHER);
+        }
+
+        return p_entry;
+    }
+
+    SHC_METRICS_KEY_ENTRY* p_entry = &key_list[key_count++];
+
+    memcpy(p_entry->key, p_key, key_length);
+    p_entry->key[key_length] = '\0';
+
+    return p_entry;
+}
+
+/**
+ * @brief Appends a label-value, '"' and '\' are escaped
+ *
+ * @param p_value zero-terminated value
+ */
+static void shc_metrics_append_label(const char* p_value) {
+
+    for ( ; *p_value != '\0' ; p_value++) {
+
+        if (*p_value == '"' || *p_value == '\\') {
+            shc_metrics_append("\\%c", *p_value);
+        } else if ((u8)*p_value >= 0x20) {
+            shc_metrics_append("%c", *p_value);
+        }
+    }
+}
+
+/**
+ * @brief Appends all lines of a single histogram
+ *
+ * @param p_histogram the histogram
+ * @param stage index of the stage
+ * @param p_key name of the command
+ */
+static void shc_metrics_append_histogram(const SHC_METRICS_HISTOGRAM* p_histogram, u8 stage, const char* p_key) {
+
+    u32 cumulative = 0;
+
+    u8 bucket = 0;
+    for ( ; bucket < SHC_METRICS_NUM_BUCKETS ; bucket++) {
+
+        cumulative += p_histogram->bucket_list[bucket];
+
+        shc_metrics_append("shc_client_latency_seconds_bucket{stage=\"%s\",key=\"", stage_name_list[stage]);
+        shc_metrics_append_label(p_key);
+
+        if (bucket < SHC_METRICS_NUM_BUCKETS - 1) {
+            shc_metrics_append("\",le=\"%g\"} %u\n", (double)bucket_bound_list[bucket] / 1000000.0, cumulative);
+        } else {
+            shc_metrics_append("\",le=\"+Inf\"} %u\n", cumulative);
+        }
+    }
+
+    shc_metrics_append("shc_client_latency_seconds_sum{stage=\"%s\",key=\"", stage_name_list[stage]);
+    shc_metrics_append_label(p_key);
+    shc_metrics_append("\"} %.6f\n", (double)p_histogram->sum_us / 1000000.0);
+
+    shc_metrics_append("shc_client_latency_seconds_count{stage=\"%s\",key=\"", stage_name_list[stage]);
+    shc_metrics_append_label(p_key);
+    shc_metrics_append("\"} %u\n", p_histogram->count);
+}
+
+/**
+ * @brief Appends the queue-wait histogram of a single priority-class
+ *
+ * @param priority one of SHC_MSG_EXECUTER_PRIORITY_xxx
+ */
+static void shc_metrics_append_queue_wait(u8 priority) {
+
+    const SHC_METRICS_HISTOGRAM* p_histogram = &priority_list[priority];
+    u32 cumulative = 0;
+
+    u8 bucket = 0;
+    for ( ; bucket < SHC_METRICS_NUM_BUCKETS ; bucket++) {
+
+        cumulative += p_histogram->bucket_list[bucket];
+
+        if (bucket < SHC_METRICS_NUM_BUCKETS - 1) {
+            shc_metrics_append("shc_client_queue_wait_seconds_bucket{class=\"%s\",le=\"%g\"} %u\n",
+                priority_name_list[priority], (double)bucket_bound_list[bucket] / 1000000.0, cumulative);
+        } else {
+            shc_metrics_append("shc_client_queue_wait_seconds_bucket{class=\"%s\",le=\"+Inf\"} %u\n",
+                priority_name_list[priority], cumulative);
+        }
+    }
+
+    shc_metrics_append("shc_client_queue_wait_seconds_sum{class=\"%s\"} %.6f\n", priority_name_list[priority], (double)p_histogram->sum_us / 1000000.0);
+    shc_metrics_append("shc_client_queue_wait_seconds_count{class=\"%s\"} %u\n", priority_name_list[priority], p_histogram->count);
+}
+
+/**
+ * @brief Writes all metrics in the Prometheus text-format into the output buffer
+ *
+ */
+static void shc_metrics_render(void) {
+
+    output.length = 0;
+
+    shc_metrics_append("# HELP shc_client_latency_seconds Latency of commands, reports and events per stage\n");
+    shc_metrics_append("# TYPE shc_client_latency_seconds histogram\n");
+
+    u16 i = 0;
+    for ( ; i < SHC_METRICS_MAX_KEYS ; i++) {
+
+        if (key_list[i].key[0] == '\0') {
+            continue;
+        }
+
+        u8 stage = 0;
+        for ( ; stage < SHC_METRICS_NUM_STAGES ; stage++) {
+
+            if (key_list[i].histogram_list[stage].count != 0) {
+                shc_metrics_append_histogram(&key_list[i].histogram_list[stage], stage, key_list[i].key);
+            }
+        }
+    }
+
+    shc_metrics_append("# HELP shc_client_latency_quantile_seconds Latency-quantiles per stage over all commands\n");
+    shc_metrics_append("# TYPE shc_client_latency_quantile_seconds gauge\n");
+
+    u8 stage = 0;
+    for ( ; stage < SHC_METRICS_NUM_STAGES ; stage++) {
+
+        shc_metrics_append("shc_client_latency_quantile_seconds{stage=\"%s\",quantile=\"0.5\"} %.6f\n",
+            stage_name_list[stage], (double)shc_metrics_get_quantile_us(stage, 500) / 1000000.0);
+        shc_metrics_append("shc_client_latency_quantile_seconds{stage=\"%s\",quantile=\"0.99\"} %.6f\n",
+            stage_name_list[stage], (double)shc_metrics_get_quantile_us(stage, 990) / 1000000.0);
+    }
+
+    shc_metrics_append("# HELP shc_client_queue_wait_seconds Time requests wait inside of the fifo of their priority-class\n");
+    shc_metrics_append("# TYPE shc_client_queue_wait_seconds histogram\n");
+
+    u8 priority = 0;
+    for ( ; priority < SHC_MSG_EXECUTER_NUM_PRIORITIES ; priority++) {
+        shc_metrics_append_queue_wait(priority);
+    }
+
+    shc_metrics_append("# HELP shc_client_queue_wait_quantile_seconds Queue-wait-quantiles per priority-class\n");
+    shc_metrics_append("# TYPE shc_client_queue_wait_quantile_seconds gauge\n");
+
+    for (priority = 0 ; priority < SHC_MSG_EXECUTER_NUM_PRIORITIES ; priority++) {
+
+        shc_metrics_append("shc_client_queue_wait_quantile_seconds{class=\"%s\",quantile=\"0.5\"} %.6f\n",
+            priority_name_list[priority], (double)shc_metrics_get_queue_wait_quantile_us(priority, 500) / 1000000.0);
+        shc_metrics_append("shc_client_queue_wait_quantile_seconds{class=\"%s\",quantile=\"0.99\"} %.6f\n",
+            priority_name_list[priority], (double)shc_metrics_get_queue_wait_quantile_us(priority, 990) / 1000000.0);
+    }
+
+    for (i = 0 ; i < SHC_METRICS_NUM_COUNTERS ; i++) {
+        shc_metrics_append("# HELP shc_client_%s_total %s\n", counter_name_list[i][0], counter_name_list[i][1]);
+        shc_metrics_append("# TYPE shc_client_%s_total counter\n", counter_name_list[i][0]);
+        shc_metrics_append("shc_client_%s_total %u\n", counter_name_list[i][0], counter_list[i]);
+    }
+}
+
+/**
+ * @brief Writes the complete output buffer to the given file-descriptor
+ *
+ * @param handle file-descriptor of the file or socket
+ * @return 1 on success, otherwise 0
+ */
+static u8 shc_metrics_write_output(int handle) {
+
+    size_t offset = 0;
+
+    while (offset < output.length) {
+
+        ssize_t length = send(handle, output.p_data + offset, output.length - offset, MSG_NOSIGNAL);
+
+        if (length < 0 && errno == ENOTSOCK) {
+            length = write(handle, output.p_data + offset, output.length - offset);
+        }
+
+        if (length <= 0) {
+            return 0;
+        }
+
+        offset += (size_t)length;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Rewrites the metrics-file. A temporary file is renamed,
+ * a reader never sees a half-written file.
+ *
+ */
+static void shc_metrics_write_file(void) {
+
+    char temp_path[SHC_METRICS_PATH_MAX_LENGTH + 4];
+    snprintf(temp_path, sizeof(temp_path), "%s.tmp", file_path);
+
+    int handle = open(temp_path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (handle < 0) {
+        DEBUG_TRACE_STR(temp_path, "shc_metrics_write_file() - Open file has FAILED !!! ---");
+        return;
+    }
+
+    shc_metrics_render();
+
+    u8 is_written = shc_metrics_write_output(handle);
+    close(handle);
+
+    if (is_written == 0 || rename(temp_path, file_path) != 0) {
+        DEBUG_TRACE_STR(file_path, "shc_metrics_write_file() - Write file has FAILED !!! ---");
+        unlink(temp_path);
+    }
+}
+
+/**
+ * @brief Is called by the event-loop if there are new connections
+ * on the unix-socket. Every connection receives the actual metrics
+ * and is closed afterwards.
+ *
+ * @param fd file-descriptor of the listening socket
+ * @param p_context not used
+ */
+static void shc_metrics_socket_callback(int fd, void* p_context) {
+
+    (void) p_context;
+
+    u8 is_rendered = 0;
+    int client_handle = -1;
+
+    while ((client_handle = accept(fd, NULL, NULL)) >= 0) {
+
+        if (is_rendered == 0) {
+            shc_metrics_render();
+            is_rendered = 1;
+        }
+
+        struct timeval timeout;
+        timeout.tv_sec = 0;
+        timeout.tv_usec = SHC_METRICS_SOCKET_TIMEOUT_MS * 1000;
+
+        setsockopt(client_handle, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+        if (shc_metrics_write_output(client_handle) == 0) {
+            DEBUG_PASS("shc_metrics_socket_callback() - Write metrics has FAILED !!! ---");
+        }
+
+        close(client_handle);
+    }
+}
+
+/**
+ * @brief Closes the unix-socket and removes it from the file-system
+ *
+ */
+static void shc_metrics_socket_close(void) {
+
+    if (socket_handle < 0) {
+        return;
+    }
+
+    shc_event_loop_remove_fd(socket_handle);
+    close(socket_handle);
+    unlink(socket_path);
+
+    socket_handle = -1;
+}
+
+/**
+ * @brief Opens the unix-socket at socket_path
+ *
+ */
+static void shc_metrics_socket_open(void) {
+
+    shc_metrics_socket_close();
+
+    if (socket_path[0] == '\0') {
+        return;
+    }
+
+    struct sockaddr_un address;
+    memset(&address, 0x00, sizeof(address));
+
+    address.sun_family = AF_UNIX;
+    snprintf(address.sun_path, sizeof(address.sun_path), "%s", socket_path);
+
+    socket_handle = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC | SOCK_NONBLOCK, 0);
+    if (socket_handle < 0) {
+        DEBUG_PASS("shc_metrics_socket_open() - Create socket has FAILED !!! ---");
+        return;
+    }
+
+    // a socket of a previous run
+    unlink(socket_path);
+
+    if (bind(socket_handle, (struct sockaddr*)&address, sizeof(address)) != 0 || listen(socket_handle, 4) != 0) {
+        DEBUG_TRACE_STR(socket_path, "shc_metrics_socket_open() - Bind socket has FAILED !!! ---");
+        close(socket_handle);
+        socket_handle = -1;
+        return;
+    }
+
+    if (shc_event_loop_add_fd(socket_handle, shc_metrics_socket_callback, NULL) == 0) {
+        DEBUG_PASS("shc_metrics_socket_open() - Event-loop not available");
+        close(socket_handle);
+        unlink(socket_path);
+        socket_handle = -1;
+        return;
+    }
+
+    DEBUG_TRACE_STR(socket_path, "shc_metrics_socket_open() - Listening on:");
+}
+
+// --------------------------------------------------------------------------------
+
+static void shc_metrics_MQTT_MESSAGE_RECEIVED_SLOT_CALLBACK(const void* p_argument) {
+    (void) p_argument;
+    counter_list[SHC_METRICS_COUNTER_MQTT_RECEIVED] += 1;
+}
+
+static void shc_metrics_RESPONSE_TIMEOUT_SLOT_CALLBACK(const void* p_argument) {
+    (void) p_argument;
+    counter_list[SHC_METRICS_COUNTER_HOST_TIMEOUT] += 1;
+}
+
+static void shc_metrics_INVALID_COMMAND_SLOT_CALLBACK(const void* p_argument) {
+    (void) p_argument;
+    counter_list[SHC_METRICS_COUNTER_INVALID_COMMAND] += 1;
+}
+
+static void shc_metrics_INVALID_COMMAND_SYNTAX_SLOT_CALLBACK(const void* p_argument) {
+    (void) p_argument;
+    counter_list[SHC_METRICS_COUNTER_INVALID_SYNTAX] += 1;
+}
+
+static void shc_metrics_MQTT_CONNECTION_ESTABLISHED_SLOT_CALLBACK(const void* p_argument) {
+
+    (void) p_argument;
+
+    if (connection_count != 0) {
+        counter_list[SHC_METRICS_COUNTER_MQTT_RECONNECT] += 1;
+    }
+
+    connection_count += 1;
+}
+
+static void shc_metrics_MQTT_CONNECTION_LOST_SLOT_CALLBACK(const void* p_argument) {
+    (void) p_argument;
+    counter_list[SHC_METRICS_COUNTER_MQTT_CONNECTION_LOST] += 1;
+}
+
+static void shc_metrics_MQTT_MESSAGE_SEND_FAILED_SLOT_CALLBACK(const void* p_argument) {
+    (void) p_argument;
+    counter_list[SHC_METRICS_COUNTER_MQTT_SEND_FAILED] += 1;
+}
+
+static void shc_metrics_EXE_TIMEOUT_SLOT_CALLBACK(const void* p_argument) {
+    (void) p_argument;
+    counter_list[SHC_METRICS_COUNTER_EXE_TIMEOUT] += 1;
+}
+
+static void shc_metrics_RESPONSE_CACHE_HIT_SLOT_CALLBACK(const void* p_argument) {
+    (void) p_argument;
+    counter_list[SHC_METRICS_COUNTER_CACHE_HIT] += 1;
+}
+
+static void shc_metrics_RESPONSE_CACHE_MISS_SLOT_CALLBACK(const void* p_argument) {
+    (void) p_argument;
+    counter_list[SHC_METRICS_COUNTER_CACHE_MISS] += 1;
+}
+
+static void shc_metrics_COMMAND_SUPERSEDED_SLOT_CALLBACK(const void* p_argument) {
+    (void) p_argument;
+    counter_list[SHC_METRICS_COUNTER_SUPERSEDED] += 1;
+}
+
+/**
+ * @brief Takes the paths and the interval of the export from the configuration-file.
+ *
+ * @param p_argument the configuration object of type CFG_FILE_PARSER_CFG_OBJECT_TYPE
+ */
+static void shc_metrics_CFG_OBJECT_RECEIVED_SLOT_CALLBACK(const void* p_argument) {
+
+    if (p_argument == NULL) {
+        DEBUG_PASS("shc_metrics_CFG_OBJECT_RECEIVED_SLOT_CALLBACK() - NULL_POINTER_EXCEPTION");
+        return;
+    }
+
+    const CFG_FILE_PARSER_CFG_OBJECT_TYPE* p_cfg_obj = (const CFG_FILE_PARSER_CFG_OBJECT_TYPE*)p_argument;
+
+    if (strcmp(p_cfg_obj->key, "METRICS_SOCKET_PATH") == 0) {
+        snprintf(socket_path, sizeof(socket_path), "%s", p_cfg_obj->value);
+        socket_pending = 1;
+
+    } else if (strcmp(p_cfg_obj->key, "METRICS_FILE_PATH") == 0) {
+        snprintf(file_path, sizeof(file_path), "%s", p_cfg_obj->value);
+
+    } else if (strcmp(p_cfg_obj->key, "METRICS_FILE_INTERVAL_MS") == 0) {
+        file_interval_ms = (u32)strtoul(p_cfg_obj->value, NULL, 10);
+    }
+}
+
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(MQTT_MESSAGE_RECEIVED_SIGNAL, SHC_METRICS_MQTT_MESSAGE_RECEIVED_SLOT, shc_metrics_MQTT_MESSAGE_RECEIVED_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(MSG_EXECUTER_RESPONSE_TIMEOUT_SIGNAL, SHC_METRICS_RESPONSE_TIMEOUT_SLOT, shc_metrics_RESPONSE_TIMEOUT_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(MSG_EXECUTER_INVALID_COMMAND_SIGNAL, SHC_METRICS_INVALID_COMMAND_SLOT, shc_metrics_INVALID_COMMAND_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(MSG_EXECUTER_INVALID_COMMAND_SYNTAX_SIGNAL, SHC_METRICS_INVALID_COMMAND_SYNTAX_SLOT, shc_metrics_INVALID_COMMAND_SYNTAX_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(MQTT_CONNECTION_ESTABLISHED_SIGNAL, SHC_METRICS_MQTT_CONNECTION_ESTABLISHED_SLOT, shc_metrics_MQTT_CONNECTION_ESTABLISHED_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(MQTT_CONNECTION_LOST_SIGNAL, SHC_METRICS_MQTT_CONNECTION_LOST_SLOT, shc_metrics_MQTT_CONNECTION_LOST_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(MQTT_MESSAGE_SEND_FAILED_SIGNAL, SHC_METRICS_MQTT_MESSAGE_SEND_FAILED_SLOT, shc_metrics_MQTT_MESSAGE_SEND_FAILED_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(CLI_EXECUTER_COMMAND_TIMEOUT_SIGNAL, SHC_METRICS_EXE_TIMEOUT_SLOT, shc_metrics_EXE_TIMEOUT_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(SHC_RESPONSE_CACHE_HIT_SIGNAL, SHC_METRICS_RESPONSE_CACHE_HIT_SLOT, shc_metrics_RESPONSE_CACHE_HIT_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(SHC_RESPONSE_CACHE_MISS_SIGNAL, SHC_METRICS_RESPONSE_CACHE_MISS_SLOT, shc_metrics_RESPONSE_CACHE_MISS_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(MSG_EXECUTER_COMMAND_SUPERSEDED_SIGNAL, SHC_METRICS_COMMAND_SUPERSEDED_SLOT, shc_metrics_COMMAND_SUPERSEDED_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(CFG_PARSER_NEW_CFG_OBJECT_SIGNAL, SHC_METRICS_CFG_OBJECT_RECEIVED_SLOT, shc_metrics_CFG_OBJECT_RECEIVED_SLOT_CALLBACK)
+
+// --------------------------------------------------------------------------------
+
+void shc_metrics_init(void) {
+
+    DEBUG_PASS("shc_metrics_init()");
+
+    memset(key_list, 0x00, sizeof(key_list));
+    memset(stage_list, 0x00, sizeof(stage_list));
+    memset(priority_list, 0x00, sizeof(priority_list));
+    memset(counter_list, 0x00, sizeof(counter_list));
+
+    key_count = 0;
+    connection_count = 0;
+    file_timestamp_us = shc_event_loop_time_us();
+
+    SHC_METRICS_MQTT_MESSAGE_RECEIVED_SLOT_connect();
+    SHC_METRICS_RESPONSE_TIMEOUT_SLOT_connect();
+    SHC_METRICS_INVALID_COMMAND_SLOT_connect();
+    SHC_METRICS_INVALID_COMMAND_SYNTAX_SLOT_connect();
+    SHC_METRICS_MQTT_CONNECTION_ESTABLISHED_SLOT_connect();
+    SHC_METRICS_MQTT_CONNECTION_LOST_SLOT_connect();
+    SHC_METRICS_MQTT_MESSAGE_SEND_FAILED_SLOT_connect();
+    SHC_METRICS_EXE_TIMEOUT_SLOT_connect();
+    SHC_METRICS_RESPONSE_CACHE_HIT_SLOT_connect();
+    SHC_METRICS_RESPONSE_CACHE_MISS_SLOT_connect();
+    SHC_METRICS_COMMAND_SUPERSEDED_SLOT_connect();
+    SHC_METRICS_CFG_OBJECT_RECEIVED_SLOT_connect();
+}
+
+void shc_metrics_deinit(void) {
+
+    DEBUG_PASS("shc_metrics_deinit()");
+
+    if (file_path[0] != '\0') {
+        shc_metrics_write_file();
+    }
+
+    shc_metrics_socket_close();
+
+    free(output.p_data);
+    memset(&output, 0x00, sizeof(output));
+}
+
+void shc_metrics_task(void) {
+
+    if (socket_pending) {
+        socket_pending = 0;
+        shc_metrics_socket_open();
+    }
+
+    if (file_path[0] == '\0' || file_interval_ms == 0) {
+        return;
+    }
+
+    u64 now_us = shc_event_loop_time_us();
+    u32 elapsed_ms = (u32)((now_us - file_timestamp_us) / 1000ULL);
+
+    if (elapsed_ms >= file_interval_ms) {
+        file_timestamp_us = now_us;
+        elapsed_ms = 0;
+        shc_metrics_write_file();
+    }
+
+    shc_event_loop_set_deadline(file_interval_ms - elapsed_ms);
+}
+
+void shc_metrics_add_latency(u8 stage, const char* p_key, u16 key_length, u32 latency_us) {
+
+    if (stage >= SHC_METRICS_NUM_STAGES) {
+        return;
+    }
+
+    SHC_METRICS_KEY_ENTRY* p_entry = shc_metrics_find_key(p_key, key_length);
+
+    shc_metrics_histogram_add(&p_entry->histogram_list[stage], latency_us);
+    shc_metrics_histogram_add(&stage_list[stage], latency_us);
+}
+
+void shc_metrics_add_queue_wait(u8 priority, u32 wait_us) {
+
+    if (priority >= SHC_MSG_EXECUTER_NUM_PRIORITIES) {
+        return;
+    }
+
+    shc_metrics_histogram_add(&priority_list[priority], wait_us);
+}
+
+u32 shc_metrics_get_quantile_us(u8 stage, u16 permille) {
+
+    if (stage >= SHC_METRICS_NUM_STAGES) {
+        return 0;
+    }
+
+    return shc_metrics_histogram_quantile(&stage_list[stage], permille);
+}
+
+u32 shc_metrics_get_queue_wait_quantile_us(u8 priority, u16 permille) {
+
+    if (priority >= SHC_MSG_EXECUTER_NUM_PRIORITIES) {
+        return 0;
+    }
+
+    return shc_metrics_histogram_quantile(&priority_list[priority], permille);
+}
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,128 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_metrics.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Latency-histograms and counters of the shcClient.
+ *
+ *          Every command, report and event-poll is measured in stages:
+ *
+ *          - queue:   enqueue (e.g. MQTT_MESSAGE_RECEIVED_SIGNAL) until
+ *                     the request is sent to the control-board
+ *          - host:    round-trip to the control-board
+ *          - total:   enqueue until MSG_EXECUTER_RESPONSE_RECEIVED_SIGNAL
+ *          - publish: MQTT_MESSAGE_TO_SEND_SIGNAL until the acknowledge
+ *                     of the broker
+ *
+ *          Every stage has a histogram per command-name and one over
+ *          all command-names. The queue-wait is measured per
+ *          priority-class too (interactive, event, report). Timeouts, invalid commands and reconnects
+ *          are counted via the signals of the other modules.
+ *
+ *          The metrics are exported in the Prometheus text-format:
+ *
+ *          - METRICS_SOCKET_PATH=<path>: unix-socket, every connection
+ *            receives the actual metrics, e.g. socat - UNIX-CONNECT:<path>
+ *          - METRICS_FILE_PATH=<path>: file that is rewritten every
+ *            METRICS_FILE_INTERVAL_MS (default 10000), e.g. for the
+ *            textfile-collector of the node-exporter
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_shc_metrics_
+#define _H_shc_metrics_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#define SHC_METRICS_STAGE_QUEUE                     0
+#define SHC_METRICS_STAGE_HOST                      1
+#define SHC_METRICS_STAGE_TOTAL                     2
+#define SHC_METRICS_STAGE_PUBLISH                   3
+
+#define SHC_METRICS_NUM_STAGES                      4
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Connects to the configuration-parser and to the signals
+ * that are counted. The export is started by shc_metrics_task()
+ * as soon as it is configured.
+ *
+ */
+void shc_metrics_init(void);
+
+/**
+ * @brief Writes the metrics-file a last time
+ * and closes the unix-socket.
+ *
+ */
+void shc_metrics_deinit(void);
+
+/**
+ * @brief Opens the unix-socket after a new configuration
+ * and rewrites the metrics-file. Must be called from the main-loop.
+ *
+ */
+void shc_metrics_task(void);
+
+/**
+ * @brief Adds a measured latency to the histograms of the given stage
+ *
+ * @param stage one of SHC_METRICS_STAGE_xxx
+ * @param p_key name of the command, must not be zero-terminated
+ * @param key_length number of characters of p_key
+ * @param latency_us the measured latency in microseconds
+ */
+void shc_metrics_add_latency(u8 stage, const char* p_key, u16 key_length, u32 latency_us);
+
+/**
+ * @brief Adds the time a request has waited inside of the fifo
+ * of its priority-class to the histogram of this class
+ *
+ * @param priority one of SHC_MSG_EXECUTER_PRIORITY_xxx
+ * @param wait_us the measured time in microseconds
+ */
+void shc_metrics_add_queue_wait(u8 priority, u32 wait_us);
+
+/**
+ * @brief Get a quantile of the given stage over all command-names.
+ * The value is interpolated inside of the bucket that contains the quantile.
+ *
+ * @param stage one of SHC_METRICS_STAGE_xxx
+ * @param permille the quantile, e.g. 500 for p50 or 990 for p99
+ * @return the quantile in microseconds, 0 if nothing was measured
+ */
+u32 shc_metrics_get_quantile_us(u8 stage, u16 permille);
+
+/**
+ * @brief Get a quantile of the queue-wait of the given priority-class.
+ *
+ * @param priority one of SHC_MSG_EXECUTER_PRIORITY_xxx
+ * @param permille the quantile, e.g. 500 for p50 or 990 for p99
+ * @return the quantile in microseconds, 0 if nothing was measured
+ */
+u32 shc_metrics_get_queue_wait_quantile_us(u8 priority, u16 permille);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_shc_metrics_
+
+// --------------------------------------------------------------------------------
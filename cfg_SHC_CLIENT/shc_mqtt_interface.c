@@ -0,0 +1,1204 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_mqtt_interface.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Implementation of the MQTT-client with publish-queue
+ *
+ * @see     shc_mqtt_interface.h
+ */
+
+#define TRACER_OFF
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "tracer.h"
+
+// --------------------------------------------------------------------------------
+
+#include "cpu.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include <MQTTClient.h>
+
+// --------------------------------------------------------------------------------
+
+#include "common/signal_slot_interface.h"
+
+#include "ui/cfg_file_parser/cfg_file_parser.h"
+
+// --------------------------------------------------------------------------------
+
+#include "shc_event_loop.h"
+#include "shc_mqtt_interface.h"
+#include "shc_metrics.h"
+#include "shc_cfg_reload.h"
+#include "shc_json_tokenizer.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Maximum number of messages inside of the publish-queue,
+ * including the messages that are in flight
+ *
+ */
+#ifndef SHC_MQTT_INTERFACE_QUEUE_SIZE
+#define SHC_MQTT_INTERFACE_QUEUE_SIZE               32
+#endif
+
+/**
+ * @brief Maximum length of a single message including the zero-terminator
+ *
+ */
+#ifndef SHC_MQTT_INTERFACE_MESSAGE_MAX_LENGTH
+#define SHC_MQTT_INTERFACE_MESSAGE_MAX_LENGTH       256
+#endif
+
+/**
+ * @brief Maximum number of received messages that are buffered
+ * between the paho-thread and the main-loop
+ *
+ */
+#ifndef SHC_MQTT_INTERFACE_RECEIVE_FIFO_SIZE
+#define SHC_MQTT_INTERFACE_RECEIVE_FIFO_SIZE        8
+#endif
+
+/**
+ * @brief Maximum length of host-address, client-id and topic-name
+ *
+ */
+/**
+ * @brief Maximum number of JSON-tokens of a single received message
+ *
+ */
+#ifndef SHC_MQTT_INTERFACE_JSON_MAX_TOKENS
+#define SHC_MQTT_INTERFACE_JSON_MAX_TOKENS          64
+#endif
+
+/**
+ * @brief Members of a received JSON-object that hold the commands
+ *
+ */
+#define SHC_MQTT_INTERFACE_JSON_KEY_COMMAND         "command"
+#define SHC_MQTT_INTERFACE_JSON_KEY_COMMANDS        "commands"
+
+#ifndef SHC_MQTT_INTERFACE_STRING_MAX_LENGTH
+#define SHC_MQTT_INTERFACE_STRING_MAX_LENGTH        128
+#endif
+
+/**
+ * @brief Default values, overwritten by the configuration-file
+ *
+ */
+#ifndef SHC_MQTT_INTERFACE_MAX_INFLIGHT
+#define SHC_MQTT_INTERFACE_MAX_INFLIGHT             8
+#endif
+
+#ifndef SHC_MQTT_INTERFACE_QOS_STATE
+#define SHC_MQTT_INTERFACE_QOS_STATE                0
+#endif
+
+#ifndef SHC_MQTT_INTERFACE_QOS_EVENT
+#define SHC_MQTT_INTERFACE_QOS_EVENT                1
+#endif
+
+#ifndef SHC_MQTT_INTERFACE_TIMEOUT_MS
+#define SHC_MQTT_INTERFACE_TIMEOUT_MS               1000
+#endif
+
+#ifndef SHC_MQTT_INTERFACE_RECONNECT_INTERVAL_MS
+#define SHC_MQTT_INTERFACE_RECONNECT_INTERVAL_MS    5000
+#endif
+
+/**
+ * @brief Keep-alive interval of the connection in seconds
+ *
+ */
+#ifndef SHC_MQTT_INTERFACE_KEEP_ALIVE_S
+#define SHC_MQTT_INTERFACE_KEEP_ALIVE_S             20
+#endif
+
+/**
+ * @brief QoS of the subscription of MQTT_TOPIC_NAME
+ *
+ */
+#ifndef SHC_MQTT_INTERFACE_SUBSCRIBE_QOS
+#define SHC_MQTT_INTERFACE_SUBSCRIBE_QOS            1
+#endif
+
+// --------------------------------------------------------------------------------
+
+#define SHC_MQTT_INTERFACE_ENTRY_FREE               0
+#define SHC_MQTT_INTERFACE_ENTRY_WAITING            1
+#define SHC_MQTT_INTERFACE_ENTRY_INFLIGHT           2
+
+#define SHC_MQTT_INTERFACE_CLASS_STATE              0
+#define SHC_MQTT_INTERFACE_CLASS_EVENT              1
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief A single message of the publish-queue
+ *
+ */
+typedef struct SHC_MQTT_INTERFACE_ENTRY_STRUCT {
+
+    /**
+     * @brief SHC_MQTT_INTERFACE_ENTRY_FREE / _WAITING / _INFLIGHT
+     *
+     */
+    u8 state;
+
+    /**
+     * @brief SHC_MQTT_INTERFACE_CLASS_STATE / _EVENT
+     *
+     */
+    u8 message_class;
+
+    /**
+     * @brief Length of the message without the zero-terminator
+     *
+     */
+    u16 length;
+
+    /**
+     * @brief Length of <name> of a state, 0 for events
+     *
+     */
+    u16 key_length;
+
+    /**
+     * @brief Position inside of the queue, lower values are published first
+     *
+     */
+    u32 sequence;
+
+    /**
+     * @brief Delivery-token of paho while the message is in flight
+     *
+     */
+    MQTTClient_deliveryToken token;
+
+    /**
+     * @brief Point in time the message was added to the queue
+     *
+     */
+    u64 enqueue_time_us;
+
+    /**
+     * @brief Point in time the message was published
+     *
+     */
+    u64 publish_time_us;
+
+    char message[SHC_MQTT_INTERFACE_MESSAGE_MAX_LENGTH];
+
+} SHC_MQTT_INTERFACE_ENTRY;
+
+// --------------------------------------------------------------------------------
+
+static SHC_MQTT_INTERFACE_ENTRY queue[SHC_MQTT_INTERFACE_QUEUE_SIZE];
+static u32 queue_sequence = 0;
+static u16 inflight_count = 0;
+
+static SHC_MQTT_INTERFACE_STATISTIC statistic;
+
+static char host_address[SHC_MQTT_INTERFACE_STRING_MAX_LENGTH];
+static char client_id[SHC_MQTT_INTERFACE_STRING_MAX_LENGTH];
+static char topic_name[SHC_MQTT_INTERFACE_STRING_MAX_LENGTH];
+static char welcome_message[SHC_MQTT_INTERFACE_MESSAGE_MAX_LENGTH];
+
+static u16 max_inflight = SHC_MQTT_INTERFACE_MAX_INFLIGHT;
+static u8 qos_state = SHC_MQTT_INTERFACE_QOS_STATE;
+static u8 qos_event = SHC_MQTT_INTERFACE_QOS_EVENT;
+static u32 timeout_ms = SHC_MQTT_INTERFACE_TIMEOUT_MS;
+static u32 reconnect_interval_ms = SHC_MQTT_INTERFACE_RECONNECT_INTERVAL_MS;
+
+/**
+ * @brief The configuration is complete, the client connects to the broker
+ *
+ */
+static u8 connect_pending = 0;
+static u8 connected = 0;
+static u64 reconnect_time_us = 0;
+
+static MQTTClient client;
+static u8 client_created = 0;
+
+/**
+ * @brief MQTT_HOST_ADDRESS or MQTT_CLIENT_ID has changed after the
+ * client was created, the client is created again and reconnects
+ *
+ */
+static u8 client_outdated = 0;
+
+/**
+ * @brief MQTT_TOPIC_NAME has changed while connected,
+ * previous_topic_name is unsubscribed and topic_name is subscribed
+ *
+ */
+static u8 resubscribe_pending = 0;
+static char previous_topic_name[SHC_MQTT_INTERFACE_STRING_MAX_LENGTH];
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Everything below is written by the paho-thread
+ * and protected by callback_mutex
+ *
+ */
+static pthread_mutex_t callback_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static MQTTClient_deliveryToken complete_fifo[SHC_MQTT_INTERFACE_QUEUE_SIZE];
+static u16 complete_count = 0;
+
+/**
+ * @brief The main-loop processes the message at receive_read_index in place.
+ * The paho-thread only writes behind the last message, so the slot is not
+ * touched until the main-loop has released it by incrementing receive_read_index.
+ *
+ */
+static char receive_fifo[SHC_MQTT_INTERFACE_RECEIVE_FIFO_SIZE][SHC_MQTT_INTERFACE_MESSAGE_MAX_LENGTH];
+static u16 receive_length_list[SHC_MQTT_INTERFACE_RECEIVE_FIFO_SIZE];
+static u8 receive_read_index = 0;
+static u8 receive_count = 0;
+
+static u8 connection_lost = 0;
+static char connection_lost_cause[SHC_MQTT_INTERFACE_STRING_MAX_LENGTH];
+
+// --------------------------------------------------------------------------------
+
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(MQTT_MESSAGE_TO_SEND_SIGNAL)
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(MQTT_MESSAGE_RECEIVED_SIGNAL)
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(MQTT_MESSAGE_SEND_SUCCEED_SIGNAL)
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(MQTT_MESSAGE_SEND_FAILED_SIGNAL)
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(MQTT_CONNECTION_ESTABLISHED_SIGNAL)
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(MQTT_CONNECTION_LOST_SIGNAL)
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(MQTT_CONNECTION_FAILED_SIGNAL)
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Is called by the paho-thread if the connection is broken.
+ *
+ * @param p_context not used
+ * @param p_cause cause of the connection-loss, can be NULL
+ */
+static void shc_mqtt_interface_connection_lost_callback(void* p_context, char* p_cause) {
+
+    (void) p_context;
+
+    pthread_mutex_lock(&callback_mutex);
+
+    connection_lost = 1;
+    snprintf(connection_lost_cause, sizeof(connection_lost_cause), "%s", p_cause != NULL ? p_cause : "");
+
+    pthread_mutex_unlock(&callback_mutex);
+
+    shc_event_loop_wakeup();
+}
+
+/**
+ * @brief Is called by the paho-thread for every received message.
+ * Messages are dropped if the main-loop does not catch up.
+ *
+ * @return always 1, the message was processed
+ */
+static int shc_mqtt_interface_message_arrived_callback(void* p_context, char* p_topic_name, int topic_length, MQTTClient_message* p_message) {
+
+    (void) p_context;
+    (void) topic_length;
+
+    pthread_mutex_lock(&callback_mutex);
+
+    if (receive_count < SHC_MQTT_INTERFACE_RECEIVE_FIFO_SIZE) {
+
+        u8 write_index = (receive_read_index + receive_count) % SHC_MQTT_INTERFACE_RECEIVE_FIFO_SIZE;
+        char* p_buffer = receive_fifo[write_index];
+        int length = p_message->payloadlen;
+
+        if (length > SHC_MQTT_INTERFACE_MESSAGE_MAX_LENGTH - 1) {
+            length = SHC_MQTT_INTERFACE_MESSAGE_MAX_LENGTH - 1;
+        }
+
+        memcpy(p_buffer, p_message->payload, (size_t)length);
+        p_buffer[length] = '\0';
+
+        receive_length_list[write_index] = (u16)length;
+        receive_count += 1;
+    }
+
+    pthread_mutex_unlock(&callback_mutex);
+
+    MQTTClient_freeMessage(&p_message);
+    MQTTClient_free(p_topic_name);
+
+    shc_event_loop_wakeup();
+    return 1;
+}
+
+/**
+ * @brief Is called by the paho-thread if the broker has acknowledged a message
+ *
+ * @param p_context not used
+ * @param token delivery-token of the message
+ */
+static void shc_mqtt_interface_delivery_complete_callback(void* p_context, MQTTClient_deliveryToken token) {
+
+    (void) p_context;
+
+    pthread_mutex_lock(&callback_mutex);
+
+    if (complete_count < SHC_MQTT_INTERFACE_QUEUE_SIZE) {
+        complete_fifo[complete_count] = token;
+        complete_count += 1;
+    }
+
+    pthread_mutex_unlock(&callback_mutex);
+
+    shc_event_loop_wakeup();
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Removes a message from the publish-queue
+ *
+ * @param p_entry the message to remove
+ */
+static void shc_mqtt_interface_release(SHC_MQTT_INTERFACE_ENTRY* p_entry) {
+
+    if (p_entry->state == SHC_MQTT_INTERFACE_ENTRY_INFLIGHT) {
+        inflight_count -= 1;
+    }
+
+    p_entry->state = SHC_MQTT_INTERFACE_ENTRY_FREE;
+    statistic.queue_depth -= 1;
+}
+
+/**
+ * @brief Removes a message from the publish-queue
+ * and sends MQTT_MESSAGE_SEND_FAILED_SIGNAL
+ *
+ * @param p_entry the message that has failed
+ */
+static void shc_mqtt_interface_fail(SHC_MQTT_INTERFACE_ENTRY* p_entry) {
+
+    DEBUG_TRACE_STR(p_entry->message, "shc_mqtt_interface_fail()");
+
+    MQTT_MESSAGE_SEND_FAILED_SIGNAL_send(p_entry->message);
+    shc_mqtt_interface_release(p_entry);
+}
+
+/**
+ * @brief Get the message with the lowest sequence-number
+ * of the given state and class.
+ *
+ * @param state SHC_MQTT_INTERFACE_ENTRY_WAITING or SHC_MQTT_INTERFACE_ENTRY_INFLIGHT
+ * @param message_class class of the message, 0xFF for all classes
+ * @return the oldest message or NULL
+ */
+static SHC_MQTT_INTERFACE_ENTRY* shc_mqtt_interface_find_oldest(u8 state, u8 message_class) {
+
+    SHC_MQTT_INTERFACE_ENTRY* p_oldest = NULL;
+
+    u8 i = 0;
+    for ( ; i < SHC_MQTT_INTERFACE_QUEUE_SIZE ; i++) {
+
+        SHC_MQTT_INTERFACE_ENTRY* p_entry = &queue[i];
+
+        if (p_entry->state != state) {
+            continue;
+        }
+
+        if (message_class != 0xFF && p_entry->message_class != message_class) {
+            continue;
+        }
+
+        if (p_oldest == NULL || (i32)(p_entry->sequence - p_oldest->sequence) < 0) {
+            p_oldest = p_entry;
+        }
+    }
+
+    return p_oldest;
+}
+
+/**
+ * @brief Get a waiting state of the given name
+ *
+ * @param p_message message of the new state, <name>=<value>
+ * @param key_length length of <name>
+ * @return the waiting state or NULL
+ */
+static SHC_MQTT_INTERFACE_ENTRY* shc_mqtt_interface_find_state(const char* p_message, u16 key_length) {
+
+    u8 i = 0;
+    for ( ; i < SHC_MQTT_INTERFACE_QUEUE_SIZE ; i++) {
+
+        SHC_MQTT_INTERFACE_ENTRY* p_entry = &queue[i];
+
+        if (p_entry->state != SHC_MQTT_INTERFACE_ENTRY_WAITING) {
+            continue;
+        }
+
+        if (p_entry->key_length != key_length) {
+            continue;
+        }
+
+        if (memcmp(p_entry->message, p_message, key_length) == 0) {
+            return p_entry;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Get a free entry of the publish-queue. If the queue is full
+ * and the new message is an event the oldest waiting state is dropped.
+ *
+ * @param message_class class of the new message
+ * @return a free entry or NULL if the queue is full
+ */
+static SHC_MQTT_INTERFACE_ENTRY* shc_mqtt_interface_allocate(u8 message_class) {
+
+    u8 i = 0;
+    for ( ; i < SHC_MQTT_INTERFACE_QUEUE_SIZE ; i++) {
+        if (queue[i].state == SHC_MQTT_INTERFACE_ENTRY_FREE) {
+            return &queue[i];
+        }
+    }
+
+    if (message_class != SHC_MQTT_INTERFACE_CLASS_EVENT) {
+        return NULL;
+    }
+
+    SHC_MQTT_INTERFACE_ENTRY* p_entry = shc_mqtt_interface_find_oldest(
+        SHC_MQTT_INTERFACE_ENTRY_WAITING,
+        SHC_MQTT_INTERFACE_CLASS_STATE
+    );
+
+    if (p_entry == NULL) {
+        return NULL;
+    }
+
+    statistic.dropped += 1;
+    shc_mqtt_interface_fail(p_entry);
+
+    return p_entry;
+}
+
+/**
+ * @brief Adds a message to the publish-queue.
+ * A waiting state of the same name is replaced.
+ *
+ * @param p_message the message as zero-terminated string
+ */
+static void shc_mqtt_interface_enqueue(const char* p_message) {
+
+    size_t length = strlen(p_message);
+
+    if (length == 0 || length >= SHC_MQTT_INTERFACE_MESSAGE_MAX_LENGTH) {
+        DEBUG_TRACE_STR(p_message, "shc_mqtt_interface_enqueue() - Invalid length");
+        return;
+    }
+
+    const char* p_separator = strchr(p_message, '=');
+
+    u8 message_class = (p_separator != NULL) ? SHC_MQTT_INTERFACE_CLASS_STATE : SHC_MQTT_INTERFACE_CLASS_EVENT;
+    u16 key_length = (p_separator != NULL) ? (u16)(p_separator - p_message + 1) : 0;
+
+    SHC_MQTT_INTERFACE_ENTRY* p_entry = NULL;
+
+    if (message_class == SHC_MQTT_INTERFACE_CLASS_STATE) {
+
+        p_entry = shc_mqtt_interface_find_state(p_message, key_length);
+
+        if (p_entry != NULL) {
+
+            DEBUG_TRACE_STR(p_message, "shc_mqtt_interface_enqueue() - Coalesced");
+
+            memcpy(p_entry->message, p_message, length + 1);
+            p_entry->length = (u16)length;
+
+            statistic.coalesced += 1;
+            return;
+        }
+    }
+
+    p_entry = shc_mqtt_interface_allocate(message_class);
+
+    if (p_entry == NULL) {
+
+        DEBUG_TRACE_STR(p_message, "shc_mqtt_interface_enqueue() - Queue is full");
+
+        statistic.dropped += 1;
+        MQTT_MESSAGE_SEND_FAILED_SIGNAL_send(p_message);
+        return;
+    }
+
+    memcpy(p_entry->message, p_message, length + 1);
+
+    p_entry->state = SHC_MQTT_INTERFACE_ENTRY_WAITING;
+    p_entry->message_class = message_class;
+    p_entry->length = (u16)length;
+    p_entry->key_length = key_length;
+    p_entry->sequence = queue_sequence++;
+    p_entry->token = 0;
+    p_entry->enqueue_time_us = shc_event_loop_time_us();
+
+    statistic.queue_depth += 1;
+
+    if (statistic.queue_depth > statistic.queue_high_water) {
+        statistic.queue_high_water = statistic.queue_depth;
+    }
+
+    shc_event_loop_wakeup();
+}
+
+/**
+ * @brief The broker has acknowledged a message, it is removed
+ * from the publish-queue and MQTT_MESSAGE_SEND_SUCCEED_SIGNAL is send.
+ *
+ * @param p_entry the acknowledged message
+ */
+static void shc_mqtt_interface_complete(SHC_MQTT_INTERFACE_ENTRY* p_entry) {
+
+    u32 latency_us = (u32)(shc_event_loop_time_us() - p_entry->enqueue_time_us);
+
+    statistic.published += 1;
+    statistic.latency_sum_us += latency_us;
+
+    if (latency_us > statistic.latency_max_us) {
+        statistic.latency_max_us = latency_us;
+    }
+
+    shc_metrics_add_latency(
+        SHC_METRICS_STAGE_PUBLISH,
+        p_entry->message,
+        p_entry->key_length != 0 ? p_entry->key_length - 1 : p_entry->length,
+        latency_us
+    );
+
+    MQTT_MESSAGE_SEND_SUCCEED_SIGNAL_send(p_entry->message);
+    shc_mqtt_interface_release(p_entry);
+}
+
+/**
+ * @brief Get the message that is in flight with the given delivery-token
+ *
+ * @param token delivery-token of paho
+ * @return the message or NULL if the message has already timed out
+ */
+static SHC_MQTT_INTERFACE_ENTRY* shc_mqtt_interface_find_token(MQTTClient_deliveryToken token) {
+
+    u8 i = 0;
+    for ( ; i < SHC_MQTT_INTERFACE_QUEUE_SIZE ; i++) {
+
+        if (queue[i].state == SHC_MQTT_INTERFACE_ENTRY_INFLIGHT && queue[i].token == token) {
+            return &queue[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Publishes a message without waiting for the acknowledge.
+ * Messages with QoS 0 are complete as soon as they are written to the socket.
+ *
+ * @param p_entry the message to publish
+ * @return 1 if the message was published, otherwise 0
+ */
+static u8 shc_mqtt_interface_publish(SHC_MQTT_INTERFACE_ENTRY* p_entry) {
+
+    u8 qos = (p_entry->message_class == SHC_MQTT_INTERFACE_CLASS_STATE) ? qos_state : qos_event;
+    MQTTClient_deliveryToken token = 0;
+
+    int err_code = MQTTClient_publish(client, topic_name, p_entry->length, p_entry->message, qos, 0, &token);
+
+    if (err_code != MQTTCLIENT_SUCCESS) {
+        DEBUG_TRACE_long(err_code, "shc_mqtt_interface_publish() - Publish has FAILED !!! --- error:");
+        return 0;
+    }
+
+    DEBUG_TRACE_STR(p_entry->message, "shc_mqtt_interface_publish()");
+
+    p_entry->state = SHC_MQTT_INTERFACE_ENTRY_INFLIGHT;
+    p_entry->token = token;
+    p_entry->publish_time_us = shc_event_loop_time_us();
+
+    inflight_count += 1;
+
+    if (inflight_count > statistic.inflight_high_water) {
+        statistic.inflight_high_water = inflight_count;
+    }
+
+    if (qos == 0) {
+        shc_mqtt_interface_complete(p_entry);
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Connects to the broker and subscribes MQTT_TOPIC_NAME.
+ * A failed connection is retried after MQTT_RECONNECT_INTERVAL_MS.
+ *
+ */
+static void shc_mqtt_interface_connect(void) {
+
+    u64 now_us = shc_event_loop_time_us();
+
+    if (now_us < reconnect_time_us) {
+        shc_event_loop_set_deadline((u32)((reconnect_time_us - now_us) / 1000ULL) + 1);
+        return;
+    }
+
+    if (client_created == 0) {
+
+        if (MQTTClient_create(&client, host_address, client_id, MQTTCLIENT_PERSISTENCE_NONE, NULL) != MQTTCLIENT_SUCCESS) {
+            DEBUG_TRACE_STR(host_address, "shc_mqtt_interface_connect() - Create client has FAILED !!! ---");
+            connect_pending = 0;
+            MQTT_CONNECTION_FAILED_SIGNAL_send(NULL);
+            return;
+        }
+
+        MQTTClient_setCallbacks(
+            client,
+            NULL,
+            shc_mqtt_interface_connection_lost_callback,
+            shc_mqtt_interface_message_arrived_callback,
+            shc_mqtt_interface_delivery_complete_callback
+        );
+
+        client_created = 1;
+    }
+
+    MQTTClient_connectOptions connect_options = MQTTClient_connectOptions_initializer;
+    connect_options.keepAliveInterval = SHC_MQTT_INTERFACE_KEEP_ALIVE_S;
+    connect_options.cleansession = 1;
+    connect_options.connectTimeout = (int)((timeout_ms + 999) / 1000);
+    connect_options.maxInflightMessages = max_inflight;
+
+    int err_code = MQTTClient_connect(client, &connect_options);
+
+    if (err_code != MQTTCLIENT_SUCCESS) {
+
+        DEBUG_TRACE_long(err_code, "shc_mqtt_interface_connect() - Connect has FAILED !!! --- error:");
+
+        reconnect_time_us = shc_event_loop_time_us() + (u64)reconnect_interval_ms * 1000ULL;
+        shc_event_loop_set_deadline(reconnect_interval_ms);
+
+        MQTT_CONNECTION_FAILED_SIGNAL_send(NULL);
+        return;
+    }
+
+    MQTTClient_subscribe(client, topic_name, SHC_MQTT_INTERFACE_SUBSCRIBE_QOS);
+
+    DEBUG_TRACE_STR(host_address, "shc_mqtt_interface_connect() - Connected to:");
+
+    connected = 1;
+    MQTT_CONNECTION_ESTABLISHED_SIGNAL_send(NULL);
+
+    if (welcome_message[0] != '\0') {
+        shc_mqtt_interface_enqueue(welcome_message);
+    }
+}
+
+/**
+ * @brief The connection to the broker is broken. Messages that were
+ * in flight are published again after the reconnect.
+ *
+ * @param p_cause cause of the connection-loss, empty string if unknown
+ */
+static void shc_mqtt_interface_disconnected(const char* p_cause) {
+
+    if (connected == 0) {
+        return;
+    }
+
+    DEBUG_TRACE_STR(p_cause, "shc_mqtt_interface_disconnected() - Connection lost:");
+
+    connected = 0;
+    reconnect_time_us = 0;
+
+    u8 i = 0;
+    for ( ; i < SHC_MQTT_INTERFACE_QUEUE_SIZE ; i++) {
+        if (queue[i].state == SHC_MQTT_INTERFACE_ENTRY_INFLIGHT) {
+            queue[i].state = SHC_MQTT_INTERFACE_ENTRY_WAITING;
+        }
+    }
+
+    inflight_count = 0;
+
+    MQTT_CONNECTION_LOST_SIGNAL_send(p_cause[0] != '\0' ? p_cause : NULL);
+}
+
+/**
+ * @brief Destroys the client after MQTT_HOST_ADDRESS or MQTT_CLIENT_ID
+ * has changed. The queue is kept, messages that were in flight
+ * are published again after the client has reconnected.
+ *
+ */
+static void shc_mqtt_interface_recreate(void) {
+
+    client_outdated = 0;
+    resubscribe_pending = 0;
+
+    if (client_created == 0) {
+        return;
+    }
+
+    DEBUG_TRACE_STR(host_address, "shc_mqtt_interface_recreate() - New host-address:");
+
+    if (connected) {
+        MQTTClient_disconnect(client, (int)timeout_ms);
+        shc_mqtt_interface_disconnected("configuration changed");
+    }
+
+    MQTTClient_destroy(&client);
+    client_created = 0;
+    reconnect_time_us = 0;
+}
+
+/**
+ * @brief Subscribes the new topic after MQTT_TOPIC_NAME has changed
+ *
+ */
+static void shc_mqtt_interface_resubscribe(void) {
+
+    resubscribe_pending = 0;
+
+    if (connected == 0) {
+        return;
+    }
+
+    DEBUG_TRACE_STR(topic_name, "shc_mqtt_interface_resubscribe() - New topic-name:");
+
+    MQTTClient_unsubscribe(client, previous_topic_name);
+    MQTTClient_subscribe(client, topic_name, SHC_MQTT_INTERFACE_SUBSCRIBE_QOS);
+}
+
+/**
+ * @brief Sends MQTT_MESSAGE_RECEIVED_SIGNAL for every command of a received message.
+ * A plain message is a single command. A JSON-message is tokenized in place,
+ * its commands are given as
+ *
+ *  - ["cmd_a","cmd_b"]
+ *  - {"command":"cmd_a"}
+ *  - {"commands":["cmd_a","cmd_b"]}
+ *
+ * all other members are ignored. Invalid JSON is sent as it is,
+ * so it is reported like any other invalid command.
+ *
+ * @param p_message the received message, modified in place
+ * @param length number of characters of p_message
+ */
+static void shc_mqtt_interface_dispatch(char* p_message, u16 length) {
+
+    if (shc_json_is_structured(p_message, length) == 0) {
+        MQTT_MESSAGE_RECEIVED_SIGNAL_send(p_message);
+        return;
+    }
+
+    SHC_JSON_TOKEN token_list[SHC_MQTT_INTERFACE_JSON_MAX_TOKENS];
+    SHC_JSON_DOCUMENT document;
+
+    document.p_token_list = token_list;
+    document.max_tokens = SHC_MQTT_INTERFACE_JSON_MAX_TOKENS;
+
+    if (shc_json_tokenize(&document, p_message, length) == 0) {
+        DEBUG_TRACE_STR(p_message, "shc_mqtt_interface_dispatch() - Invalid JSON");
+        MQTT_MESSAGE_RECEIVED_SIGNAL_send(p_message);
+        return;
+    }
+
+    u16 list_index = 0;
+
+    if (token_list[0].type == SHC_JSON_TYPE_OBJECT) {
+
+        u16 command_index = shc_json_find(&document, 0, SHC_MQTT_INTERFACE_JSON_KEY_COMMAND);
+        list_index = shc_json_find(&document, 0, SHC_MQTT_INTERFACE_JSON_KEY_COMMANDS);
+
+        if (command_index == SHC_JSON_NOT_FOUND && list_index == SHC_JSON_NOT_FOUND) {
+            DEBUG_TRACE_STR(p_message, "shc_mqtt_interface_dispatch() - No command given");
+            MQTT_MESSAGE_RECEIVED_SIGNAL_send(p_message);
+            return;
+        }
+
+        const char* p_command = shc_json_get_string(&document, command_index);
+
+        if (p_command != NULL) {
+            MQTT_MESSAGE_RECEIVED_SIGNAL_send(p_command);
+
+        } else if (command_index != SHC_JSON_NOT_FOUND) {
+            DEBUG_PASS("shc_mqtt_interface_dispatch() - command is not a string");
+        }
+    }
+
+    if (list_index == SHC_JSON_NOT_FOUND) {
+        return;
+    }
+
+    if (token_list[list_index].type != SHC_JSON_TYPE_ARRAY) {
+        DEBUG_PASS("shc_mqtt_interface_dispatch() - commands is not an array");
+        return;
+    }
+
+    u16 end_index = token_list[list_index].next;
+    u16 index = shc_json_first_child(&document, list_index);
+
+    while (index != SHC_JSON_NOT_FOUND && index < end_index) {
+
+        const char* p_command = shc_json_get_string(&document, index);
+
+        if (p_command != NULL) {
+            MQTT_MESSAGE_RECEIVED_SIGNAL_send(p_command);
+        } else {
+            DEBUG_PASS("shc_mqtt_interface_dispatch() - command is not a string");
+        }
+
+        index = token_list[index].next;
+    }
+}
+
+/**
+ * @brief Sends the signals of everything that was reported
+ * by the paho-thread since the last call.
+ *
+ */
+static void shc_mqtt_interface_process_callbacks(void) {
+
+    MQTTClient_deliveryToken token_list[SHC_MQTT_INTERFACE_QUEUE_SIZE];
+    char cause[SHC_MQTT_INTERFACE_STRING_MAX_LENGTH];
+
+    pthread_mutex_lock(&callback_mutex);
+
+    u16 token_count = complete_count;
+    memcpy(token_list, complete_fifo, token_count * sizeof(token_list[0]));
+    complete_count = 0;
+
+    u8 is_lost = connection_lost;
+    memcpy(cause, connection_lost_cause, sizeof(cause));
+    connection_lost = 0;
+
+    pthread_mutex_unlock(&callback_mutex);
+
+    u16 i = 0;
+    for ( ; i < token_count ; i++) {
+
+        SHC_MQTT_INTERFACE_ENTRY* p_entry = shc_mqtt_interface_find_token(token_list[i]);
+
+        if (p_entry != NULL) {
+            shc_mqtt_interface_complete(p_entry);
+        }
+    }
+
+    while (1) {
+
+        pthread_mutex_lock(&callback_mutex);
+
+        u8 has_message = (receive_count != 0);
+        u8 read_index = receive_read_index;
+
+        pthread_mutex_unlock(&callback_mutex);
+
+        if (has_message == 0) {
+            break;
+        }
+
+        shc_mqtt_interface_dispatch(receive_fifo[read_index], receive_length_list[read_index]);
+
+        pthread_mutex_lock(&callback_mutex);
+
+        receive_read_index = (receive_read_index + 1) % SHC_MQTT_INTERFACE_RECEIVE_FIFO_SIZE;
+        receive_count -= 1;
+
+        pthread_mutex_unlock(&callback_mutex);
+    }
+
+    if (is_lost) {
+        shc_mqtt_interface_disconnected(cause);
+    }
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Adds the message to the publish-queue
+ *
+ * @param p_argument the message as zero-terminated string
+ */
+static void shc_mqtt_interface_MESSAGE_TO_SEND_SLOT_CALLBACK(const void* p_argument) {
+
+    if (p_argument == NULL) {
+        DEBUG_PASS("shc_mqtt_interface_MESSAGE_TO_SEND_SLOT_CALLBACK() - NULL_POINTER_EXCEPTION");
+        return;
+    }
+
+    shc_mqtt_interface_enqueue((const char*)p_argument);
+}
+
+/**
+ * @brief Checks a string-value of the configuration-file against the actual one.
+ * A value that does not fit into p_string is rejected, p_string keeps its value.
+ *
+ * @param p_string the actual value
+ * @param max_length size of p_string
+ * @param p_cfg_obj the configuration object
+ * @return 1 if the value fits and differs from p_string, otherwise 0
+ */
+static u8 shc_mqtt_interface_value_changed(const char* p_string, size_t max_length, const CFG_FILE_PARSER_CFG_OBJECT_TYPE* p_cfg_obj) {
+
+    if (strlen(p_cfg_obj->value) >= max_length) {
+        DEBUG_TRACE_STR(p_cfg_obj->key, "shc_mqtt_interface_value_changed() - Value too long - ignored:");
+        return 0;
+    }
+
+    return strcmp(p_string, p_cfg_obj->value) != 0;
+}
+
+/**
+ * @brief Takes the connection-parameters and the settings
+ * of the publish-queue from the configuration-file.
+ *
+ * @param p_argument the configuration object of type CFG_FILE_PARSER_CFG_OBJECT_TYPE
+ */
+static void shc_mqtt_interface_CFG_OBJECT_RECEIVED_SLOT_CALLBACK(const void* p_argument) {
+
+    if (p_argument == NULL) {
+        DEBUG_PASS("shc_mqtt_interface_CFG_OBJECT_RECEIVED_SLOT_CALLBACK() - NULL_POINTER_EXCEPTION");
+        return;
+    }
+
+    const CFG_FILE_PARSER_CFG_OBJECT_TYPE* p_cfg_obj = (const CFG_FILE_PARSER_CFG_OBJECT_TYPE*)p_argument;
+
+    if (strcmp(p_cfg_obj->key, "MQTT_HOST_ADDRESS") == 0) {
+
+        if (shc_mqtt_interface_value_changed(host_address, sizeof(host_address), p_cfg_obj)) {
+            memcpy(host_address, p_cfg_obj->value, strlen(p_cfg_obj->value) + 1);
+            client_outdated = client_created;
+        }
+
+    } else if (strcmp(p_cfg_obj->key, "MQTT_CLIENT_ID") == 0) {
+
+        if (shc_mqtt_interface_value_changed(client_id, sizeof(client_id), p_cfg_obj)) {
+            memcpy(client_id, p_cfg_obj->value, strlen(p_cfg_obj->value) + 1);
+            client_outdated = client_created;
+        }
+
+    } else if (strcmp(p_cfg_obj->key, "MQTT_TOPIC_NAME") == 0) {
+
+        if (shc_mqtt_interface_value_changed(topic_name, sizeof(topic_name), p_cfg_obj)) {
+
+            if (resubscribe_pending == 0) {
+                memcpy(previous_topic_name, topic_name, sizeof(previous_topic_name));
+            }
+
+            memcpy(topic_name, p_cfg_obj->value, strlen(p_cfg_obj->value) + 1);
+            resubscribe_pending = connected;
+        }
+
+    } else if (strcmp(p_cfg_obj->key, "MQTT_WELCOME_MESSAGE") == 0) {
+        snprintf(welcome_message, sizeof(welcome_message), "%s", p_cfg_obj->value);
+
+    } else if (strcmp(p_cfg_obj->key, "MQTT_TIMEOUT") == 0) {
+        timeout_ms = (u32)strtoul(p_cfg_obj->value, NULL, 10);
+
+    } else if (strcmp(p_cfg_obj->key, "MQTT_MAX_INFLIGHT") == 0) {
+
+        u32 inflight = (u32)strtoul(p_cfg_obj->value, NULL, 10);
+
+        if (inflight == 0 || inflight > SHC_MQTT_INTERFACE_QUEUE_SIZE) {
+            DEBUG_TRACE_long(inflight, "shc_mqtt_interface_CFG_OBJECT_RECEIVED_SLOT_CALLBACK() - Invalid number of in-flight messages");
+            inflight = SHC_MQTT_INTERFACE_MAX_INFLIGHT;
+        }
+
+        max_inflight = (u16)inflight;
+
+    } else if (strcmp(p_cfg_obj->key, "MQTT_QOS_STATE") == 0) {
+        qos_state = (u8)(strtoul(p_cfg_obj->value, NULL, 10) % 3);
+
+    } else if (strcmp(p_cfg_obj->key, "MQTT_QOS_EVENT") == 0) {
+        qos_event = (u8)(strtoul(p_cfg_obj->value, NULL, 10) % 3);
+
+    } else if (strcmp(p_cfg_obj->key, "MQTT_RECONNECT_INTERVAL_MS") == 0) {
+        reconnect_interval_ms = (u32)strtoul(p_cfg_obj->value, NULL, 10);
+    }
+}
+
+/**
+ * @brief The configuration is complete, the client connects to the broker.
+ * Also called after a reload of the configuration-file, changes of the
+ * connection-parameters are applied by shc_mqtt_interface_task().
+ *
+ * @param p_argument not used
+ */
+static void shc_mqtt_interface_CFG_COMPLETE_SLOT_CALLBACK(const void* p_argument) {
+
+    (void) p_argument;
+
+    if (host_address[0] == '\0' || topic_name[0] == '\0') {
+        DEBUG_PASS("shc_mqtt_interface_CFG_COMPLETE_SLOT_CALLBACK() - No host-address or topic-name");
+        return;
+    }
+
+    connect_pending = 1;
+    shc_event_loop_wakeup();
+}
+
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(MQTT_MESSAGE_TO_SEND_SIGNAL, SHC_MQTT_INTERFACE_MESSAGE_TO_SEND_SLOT, shc_mqtt_interface_MESSAGE_TO_SEND_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(CFG_PARSER_NEW_CFG_OBJECT_SIGNAL, SHC_MQTT_INTERFACE_CFG_OBJECT_RECEIVED_SLOT, shc_mqtt_interface_CFG_OBJECT_RECEIVED_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(CFG_PARSER_CFG_COMPLETE_SIGNAL, SHC_MQTT_INTERFACE_CFG_COMPLETE_SLOT, shc_mqtt_interface_CFG_COMPLETE_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(SHC_CFG_RELOAD_COMPLETE_SIGNAL, SHC_MQTT_INTERFACE_CFG_RELOAD_COMPLETE_SLOT, shc_mqtt_interface_CFG_COMPLETE_SLOT_CALLBACK)
+
+// --------------------------------------------------------------------------------
+
+void shc_mqtt_interface_init(void) {
+
+    DEBUG_PASS("shc_mqtt_interface_init()");
+
+    MQTT_MESSAGE_TO_SEND_SIGNAL_init();
+    MQTT_MESSAGE_RECEIVED_SIGNAL_init();
+    MQTT_MESSAGE_SEND_SUCCEED_SIGNAL_init();
+    MQTT_MESSAGE_SEND_FAILED_SIGNAL_init();
+    MQTT_CONNECTION_ESTABLISHED_SIGNAL_init();
+    MQTT_CONNECTION_LOST_SIGNAL_init();
+    MQTT_CONNECTION_FAILED_SIGNAL_init();
+
+    memset(queue, 0x00, sizeof(queue));
+    memset(&statistic, 0x00, sizeof(statistic));
+
+    inflight_count = 0;
+    connect_pending = 0;
+    connected = 0;
+
+    SHC_MQTT_INTERFACE_MESSAGE_TO_SEND_SLOT_connect();
+    SHC_MQTT_INTERFACE_CFG_OBJECT_RECEIVED_SLOT_connect();
+    SHC_MQTT_INTERFACE_CFG_COMPLETE_SLOT_connect();
+    SHC_MQTT_INTERFACE_CFG_RELOAD_COMPLETE_SLOT_connect();
+}
+
+void shc_mqtt_interface_deinit(void) {
+
+    DEBUG_PASS("shc_mqtt_interface_deinit()");
+
+    if (client_created == 0) {
+        return;
+    }
+
+    if (connected) {
+        MQTTClient_disconnect(client, (int)timeout_ms);
+        connected = 0;
+    }
+
+    MQTTClient_destroy(&client);
+    client_created = 0;
+}
+
+void shc_mqtt_interface_task(void) {
+
+    shc_mqtt_interface_process_callbacks();
+
+    if (client_outdated) {
+        shc_mqtt_interface_recreate();
+    }
+
+    if (resubscribe_pending) {
+        shc_mqtt_interface_resubscribe();
+    }
+
+    if (connected == 0) {
+
+        if (connect_pending == 0) {
+            return;
+        }
+
+        shc_mqtt_interface_connect();
+
+        if (connected == 0) {
+            return;
+        }
+    }
+
+    u64 now_us = shc_event_loop_time_us();
+
+    u8 i = 0;
+    for ( ; i < SHC_MQTT_INTERFACE_QUEUE_SIZE ; i++) {
+
+        SHC_MQTT_INTERFACE_ENTRY* p_entry = &queue[i];
+
+        if (p_entry->state != SHC_MQTT_INTERFACE_ENTRY_INFLIGHT) {
+            continue;
+        }
+
+        u32 elapsed_ms = (u32)((now_us - p_entry->publish_time_us) / 1000ULL);
+
+        if (elapsed_ms >= timeout_ms) {
+            statistic.failed += 1;
+            shc_mqtt_interface_fail(p_entry);
+            continue;
+        }
+
+        shc_event_loop_set_deadline(timeout_ms - elapsed_ms);
+    }
+
+    while (inflight_count < max_inflight) {
+
+        SHC_MQTT_INTERFACE_ENTRY* p_entry = shc_mqtt_interface_find_oldest(SHC_MQTT_INTERFACE_ENTRY_WAITING, 0xFF);
+
+        if (p_entry == NULL) {
+            break;
+        }
+
+        if (shc_mqtt_interface_publish(p_entry) == 0) {
+
+            if (MQTTClient_isConnected(client) == 0) {
+                shc_mqtt_interface_disconnected("");
+                return;
+            }
+
+            shc_event_loop_set_deadline(timeout_ms);
+            break;
+        }
+    }
+
+    if (inflight_count != 0) {
+        shc_event_loop_set_deadline(timeout_ms);
+    }
+}
+
+void shc_mqtt_interface_get_statistic(SHC_MQTT_INTERFACE_STATISTIC* p_statistic) {
+
+    if (p_statistic == NULL) {
+        return;
+    }
+
+    memcpy(p_statistic, &statistic, sizeof(SHC_MQTT_INTERFACE_STATISTIC));
+}
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,212 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_mqtt_interface.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   MQTT-client of the shcClient with an outgoing publish-queue.
+ *
+ *          Replaces the MQTT_PROTOCOL module of the framework.
+ *          Every MQTT_MESSAGE_TO_SEND_SIGNAL is put into a bounded queue
+ *          and up to MQTT_MAX_INFLIGHT messages are published without
+ *          waiting for the acknowledge of the broker. The acknowledge
+ *          of every message is reported via MQTT_MESSAGE_SEND_SUCCEED_SIGNAL
+ *          or MQTT_MESSAGE_SEND_FAILED_SIGNAL.
+ *
+ *          Messages are divided into two classes:
+ *
+ *          - state: <name>=<value>, e.g. the response of a report.
+ *            A state that is still waiting inside of the queue is
+ *            replaced by a newer state of the same name.
+ *          - event: all other messages, e.g. evt_ rules.
+ *            Events are never replaced and are published in order.
+ *
+ *          A received message is either a single command or a JSON-payload
+ *          that is tokenized in place, without copying the message:
+ *
+ *          - ["cmd_a","cmd_b"]
+ *          - {"command":"cmd_a", ...}
+ *          - {"commands":["cmd_a","cmd_b"], ...}
+ *
+ *          MQTT_MESSAGE_RECEIVED_SIGNAL is send for every command,
+ *          other members of the payload are ignored.
+ *
+ *          The callbacks of the paho-client are running in a thread of
+ *          the library. They only fill small fifos and wake up the main-loop,
+ *          all signals are send by shc_mqtt_interface_task().
+ *
+ *          Configuration (configuration-file):
+ *
+ *          - MQTT_HOST_ADDRESS, MQTT_CLIENT_ID, MQTT_TOPIC_NAME,
+ *            MQTT_WELCOME_MESSAGE, MQTT_TIMEOUT (same as before)
+ *          - MQTT_MAX_INFLIGHT=<number> (default 8)
+ *          - MQTT_QOS_STATE=0|1|2 (default 0)
+ *          - MQTT_QOS_EVENT=0|1|2 (default 1)
+ *          - MQTT_RECONNECT_INTERVAL_MS=<time_ms> (default 5000)
+ *
+ *          On a reload of the configuration-file the client only reconnects
+ *          if MQTT_HOST_ADDRESS or MQTT_CLIENT_ID has changed, a new
+ *          MQTT_TOPIC_NAME is subscribed without reconnect.
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_shc_mqtt_interface_
+#define _H_shc_mqtt_interface_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "common/signal_slot_interface.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Argument is the message to publish as zero-terminated string
+ *
+ */
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(MQTT_MESSAGE_TO_SEND_SIGNAL)
+
+/**
+ * @brief Argument is the received message as zero-terminated string
+ *
+ */
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(MQTT_MESSAGE_RECEIVED_SIGNAL)
+
+/**
+ * @brief Argument is the published message as zero-terminated string
+ *
+ */
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(MQTT_MESSAGE_SEND_SUCCEED_SIGNAL)
+
+/**
+ * @brief Argument is the message that was dropped or not acknowledged
+ * in time as zero-terminated string
+ *
+ */
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(MQTT_MESSAGE_SEND_FAILED_SIGNAL)
+
+/**
+ * @brief No argument
+ *
+ */
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(MQTT_CONNECTION_ESTABLISHED_SIGNAL)
+
+/**
+ * @brief Argument is the cause as zero-terminated string or NULL
+ *
+ */
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(MQTT_CONNECTION_LOST_SIGNAL)
+
+/**
+ * @brief No argument
+ *
+ */
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(MQTT_CONNECTION_FAILED_SIGNAL)
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Statistic of the publish-queue since shc_mqtt_interface_init()
+ *
+ */
+typedef struct SHC_MQTT_INTERFACE_STATISTIC_STRUCT {
+
+    /**
+     * @brief Number of acknowledged messages
+     *
+     */
+    u32 published;
+
+    /**
+     * @brief Number of states that were replaced by a newer state
+     *
+     */
+    u32 coalesced;
+
+    /**
+     * @brief Number of messages that were dropped because the queue was full
+     *
+     */
+    u32 dropped;
+
+    /**
+     * @brief Number of messages that were not acknowledged in time
+     *
+     */
+    u32 failed;
+
+    /**
+     * @brief Actual and maximum number of messages inside of the queue
+     *
+     */
+    u16 queue_depth;
+    u16 queue_high_water;
+
+    /**
+     * @brief Maximum number of messages that were in flight at the same time
+     *
+     */
+    u16 inflight_high_water;
+
+    /**
+     * @brief Sum and maximum of the time between MQTT_MESSAGE_TO_SEND_SIGNAL
+     * and the acknowledge of the broker in microseconds
+     *
+     */
+    u64 latency_sum_us;
+    u32 latency_max_us;
+
+} SHC_MQTT_INTERFACE_STATISTIC;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Creates all signals and connects to the configuration-parser.
+ * The connection to the broker is established by shc_mqtt_interface_task()
+ * as soon as the configuration is complete.
+ *
+ */
+void shc_mqtt_interface_init(void);
+
+/**
+ * @brief Disconnects from the broker
+ *
+ */
+void shc_mqtt_interface_deinit(void);
+
+/**
+ * @brief Connects to the broker, publishes waiting messages
+ * and sends the signals of the paho-callbacks.
+ * Must be called from the main-loop.
+ *
+ */
+void shc_mqtt_interface_task(void);
+
+/**
+ * @brief Get the actual statistic of the publish-queue
+ *
+ * @param p_statistic the statistic is copied into this structure
+ */
+void shc_mqtt_interface_get_statistic(SHC_MQTT_INTERFACE_STATISTIC* p_statistic);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_shc_mqtt_interface_
+
+// --------------------------------------------------------------------------------
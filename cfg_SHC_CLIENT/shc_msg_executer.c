@@ -0,0 +1,2279 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_msg_executer.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Implementation of the message-executer of the shcClient
+ *
+ * @see     shc_msg_executer.h
+ */
+
+#define TRACER_OFF
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "tracer.h"
+
+// --------------------------------------------------------------------------------
+
+#include "cpu.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --------------------------------------------------------------------------------
+
+#include "common/signal_slot_interface.h"
+#include "common/common_types.h"
+
+#include "ui/cfg_file_parser/cfg_file_parser.h"
+
+// --------------------------------------------------------------------------------
+
+#include "shc_event_loop.h"
+#include "shc_host_board.h"
+#include "shc_command_table.h"
+#include "shc_rpi_batch.h"
+#include "shc_rpi_window.h"
+#include "shc_event_line.h"
+#include "shc_cli_executer.h"
+#include "shc_metrics.h"
+#include "shc_mqtt_interface.h"
+#include "shc_cfg_reload.h"
+#include "shc_command_socket.h"
+#include "shc_response_cache.h"
+#include "shc_msg_executer.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Maximum number of requests of a single priority-class
+ * waiting for the control-board
+ *
+ */
+#ifndef SHC_MSG_EXECUTER_FIFO_SIZE
+#define SHC_MSG_EXECUTER_FIFO_SIZE                  32
+#endif
+
+/**
+ * @brief Time to wait for a response of the control-board.
+ * Used for every transaction if the control-board does not report
+ * a timeout and for every request in flight in windowed mode.
+ *
+ */
+#ifndef SHC_MSG_EXECUTER_RESPONSE_TIMEOUT_MS
+#define SHC_MSG_EXECUTER_RESPONSE_TIMEOUT_MS        2000
+#endif
+
+/**
+ * @brief Maximum length of a shell-command
+ *
+ */
+#ifndef SHC_MSG_EXECUTER_EXE_MAX_LENGTH
+#define SHC_MSG_EXECUTER_EXE_MAX_LENGTH             256
+#endif
+
+/**
+ * @brief Default intervals, overwritten by the configuration-file
+ *
+ */
+#ifndef SHC_MSG_EXECUTER_REPORT_INTERVAL_MS
+#define SHC_MSG_EXECUTER_REPORT_INTERVAL_MS         60000
+#endif
+
+#ifndef SHC_MSG_EXECUTER_EVENT_INTERVAL_MS
+#define SHC_MSG_EXECUTER_EVENT_INTERVAL_MS          1500
+#endif
+
+/**
+ * @brief Number of batches without response in a row
+ * before batches are disabled
+ *
+ */
+#ifndef SHC_MSG_EXECUTER_BATCH_MAX_TIMEOUTS
+#define SHC_MSG_EXECUTER_BATCH_MAX_TIMEOUTS         3
+#endif
+
+/**
+ * @brief Maximum number of requests in flight in windowed mode
+ *
+ */
+#ifndef SHC_MSG_EXECUTER_WINDOW_MAX_SIZE
+#define SHC_MSG_EXECUTER_WINDOW_MAX_SIZE            8
+#endif
+
+/**
+ * @brief Default number of requests in flight,
+ * overwritten by HOST_PROTOCOL_WINDOW_SIZE
+ *
+ */
+#ifndef SHC_MSG_EXECUTER_WINDOW_SIZE
+#define SHC_MSG_EXECUTER_WINDOW_SIZE                4
+#endif
+
+/**
+ * @brief Interval to poll the control-board for completed
+ * requests if there is nothing else to submit
+ *
+ */
+#ifndef SHC_MSG_EXECUTER_WINDOW_POLL_INTERVAL_MS
+#define SHC_MSG_EXECUTER_WINDOW_POLL_INTERVAL_MS    10
+#endif
+
+/**
+ * @brief Number of windowed transactions without response in a row
+ * before the single-command mode is used
+ *
+ */
+#ifndef SHC_MSG_EXECUTER_WINDOW_MAX_TIMEOUTS
+#define SHC_MSG_EXECUTER_WINDOW_MAX_TIMEOUTS        3
+#endif
+
+/**
+ * @brief Default time a request of a lower priority-class waits
+ * before it is sent ahead of the higher classes,
+ * overwritten by PRIORITY_MAX_WAIT_MS
+ *
+ */
+#ifndef SHC_MSG_EXECUTER_PRIORITY_MAX_WAIT_MS
+#define SHC_MSG_EXECUTER_PRIORITY_MAX_WAIT_MS       1000
+#endif
+
+/**
+ * @brief Maximum number of COMMAND_COALESCE_<n> groups
+ *
+ */
+#ifndef SHC_MSG_EXECUTER_COALESCE_MAX_GROUPS
+#define SHC_MSG_EXECUTER_COALESCE_MAX_GROUPS        8
+#endif
+
+/**
+ * @brief Maximum number of targets inside of their coalescing-window
+ * at the same time. Commands of further targets are not coalesced.
+ *
+ */
+#ifndef SHC_MSG_EXECUTER_COALESCE_MAX_TARGETS
+#define SHC_MSG_EXECUTER_COALESCE_MAX_TARGETS       32
+#endif
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief A command that was received via MQTT
+ *
+ */
+#define SHC_MSG_EXECUTER_REQUEST_COMMAND            0
+
+/**
+ * @brief A periodic report
+ *
+ */
+#define SHC_MSG_EXECUTER_REQUEST_REPORT             1
+
+/**
+ * @brief A poll of one or more events that share the same command
+ *
+ */
+#define SHC_MSG_EXECUTER_REQUEST_EVENT              2
+
+/**
+ * @brief Several reports inside of a single batch-frame
+ *
+ */
+#define SHC_MSG_EXECUTER_REQUEST_BATCH              3
+
+/**
+ * @brief A frame of a local client that is not part of the command-table
+ *
+ */
+#define SHC_MSG_EXECUTER_REQUEST_RAW                4
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief The raw command of a single request, single-command mode
+ *
+ */
+#define SHC_MSG_EXECUTER_TRANSACTION_SINGLE         0
+
+/**
+ * @brief Submit of a request with its sequence-number, windowed mode
+ *
+ */
+#define SHC_MSG_EXECUTER_TRANSACTION_SUBMIT         1
+
+/**
+ * @brief Poll of completed requests, windowed mode
+ *
+ */
+#define SHC_MSG_EXECUTER_TRANSACTION_POLL           2
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief A request for the control-board.
+ * Commands and reports are stored by name and resolved on dispatch,
+ * the command-table may have been reloaded in the meantime.
+ *
+ */
+typedef struct SHC_MSG_EXECUTER_REQUEST_STRUCT {
+    u8 type;
+    char key[SHC_COMMAND_TABLE_MAX_KEY_LENGTH];
+    u16 length;
+    u8 command[SHC_COMMAND_TABLE_MAX_COMMAND_LENGTH];
+
+    /**
+     * @brief reports of a batch, only valid for the
+     * command-table of the given generation
+     *
+     */
+    u32 generation;
+    u32 first_report;
+    u8 num_reports;
+
+    /**
+     * @brief Point in time the request was added to the fifo,
+     * start of the latency-measurement
+     *
+     */
+    u64 enqueue_time_us;
+
+    /**
+     * @brief client-id of a request of a local client,
+     * 0 if the result is published via MQTT
+     *
+     */
+    u32 client_id;
+
+    /**
+     * @brief The command is not supported inside of a batch or sequence
+     * and is always sent as single command, also in windowed mode
+     *
+     */
+    u8 single_command;
+
+} SHC_MSG_EXECUTER_REQUEST;
+
+/**
+ * @brief A request that was sent to the control-board
+ * and waits for its response
+ *
+ */
+typedef struct SHC_MSG_EXECUTER_WINDOW_ENTRY_STRUCT {
+    SHC_MSG_EXECUTER_REQUEST request;
+    u8 in_use;
+    u8 sequence;
+    u64 timestamp_us;
+} SHC_MSG_EXECUTER_WINDOW_ENTRY;
+
+/**
+ * @brief The requests of a single priority-class
+ *
+ */
+typedef struct SHC_MSG_EXECUTER_QUEUE_STRUCT {
+    SHC_MSG_EXECUTER_REQUEST request_fifo[SHC_MSG_EXECUTER_FIFO_SIZE];
+    u8 read_index;
+    u8 count;
+} SHC_MSG_EXECUTER_QUEUE;
+
+/**
+ * @brief State of a single control-board.
+ * Every board has its own fifos, window and transaction.
+ *
+ */
+typedef struct SHC_MSG_EXECUTER_BOARD_STRUCT {
+
+    /**
+     * @brief index of the board, see shc_host_board.h
+     *
+     */
+    u8 index;
+
+    /**
+     * @brief one fifo per SHC_MSG_EXECUTER_PRIORITY_xxx
+     *
+     */
+    SHC_MSG_EXECUTER_QUEUE queue_list[SHC_MSG_EXECUTER_NUM_PRIORITIES];
+
+    /**
+     * @brief number of waiting requests of all priority-classes
+     *
+     */
+    u16 fifo_count;
+
+    /**
+     * @brief Requests in flight. In single-command mode there is
+     * never more than one request in flight.
+     *
+     */
+    SHC_MSG_EXECUTER_WINDOW_ENTRY window_list[SHC_MSG_EXECUTER_WINDOW_MAX_SIZE];
+    u8 window_count;
+    u8 window_sequence;
+
+    /**
+     * @brief The windowed mode is used, set by HOST_PROTOCOL_MODE.
+     * Cleared if the control-board does not support the windowed mode.
+     *
+     */
+    u8 window_enabled;
+    u8 window_timeout_count;
+
+    /**
+     * @brief The mode given by HOST_PROTOCOL_MODE. A change is applied
+     * as soon as no request is in flight, no new request is sent until then.
+     *
+     */
+    u8 window_mode_requested;
+
+    /**
+     * @brief The frame that was sent to the control-board.
+     * There is only one transaction at a time.
+     *
+     */
+    u8 transaction_active;
+    u8 transaction_type;
+    u8 transaction_slot;
+    u64 transaction_timestamp_us;
+    u8 transaction_frame[SHC_RPI_WINDOW_MAX_FRAME_LENGTH];
+
+    /**
+     * @brief Next event-group to poll. The groups of this board are
+     * polled one after another if there is no other request pending.
+     *
+     */
+    u32 event_poll_cursor;
+    u8 event_poll_pending;
+
+    /**
+     * @brief Point in time of the edge of the event-line that has started
+     * the actual poll, 0 if the poll was started by the schedule.
+     *
+     */
+    u64 event_edge_timestamp_us;
+
+    /**
+     * @brief Reports are sent as batch-frames, set by REPORT_BATCH_MODE.
+     * Cleared if the control-board does not support batch-frames.
+     *
+     */
+    u8 batch_enabled;
+    u8 batch_timeout_count;
+
+} SHC_MSG_EXECUTER_BOARD;
+
+/**
+ * @brief A group of commands given by COMMAND_COALESCE_<n>
+ *
+ */
+typedef struct SHC_MSG_EXECUTER_COALESCE_GROUP_STRUCT {
+    char prefix[SHC_COMMAND_TABLE_MAX_KEY_LENGTH];
+    u16 prefix_length;
+    u32 window_ms;
+} SHC_MSG_EXECUTER_COALESCE_GROUP;
+
+/**
+ * @brief A target whose last command was added to a fifo
+ * less than window_ms ago. A further command of this target
+ * is held back until the window has elapsed, a newer command
+ * replaces the held one.
+ *
+ */
+typedef struct SHC_MSG_EXECUTER_COALESCE_TARGET_STRUCT {
+
+    u8 in_use;
+    u8 board;
+    char target[SHC_COMMAND_TABLE_MAX_KEY_LENGTH];
+    u32 window_ms;
+
+    /**
+     * @brief point in time the last command of this target was added to the fifo
+     *
+     */
+    u64 send_time_us;
+
+    /**
+     * @brief the held command, only valid if pending is set
+     *
+     */
+    u8 pending;
+    SHC_MSG_EXECUTER_REQUEST request;
+
+} SHC_MSG_EXECUTER_COALESCE_TARGET;
+
+// --------------------------------------------------------------------------------
+
+static SHC_MSG_EXECUTER_BOARD board_list[SHC_HOST_BOARD_MAX_COUNT];
+
+static SHC_MSG_EXECUTER_COALESCE_GROUP coalesce_group_list[SHC_MSG_EXECUTER_COALESCE_MAX_GROUPS];
+static SHC_MSG_EXECUTER_COALESCE_TARGET coalesce_target_list[SHC_MSG_EXECUTER_COALESCE_MAX_TARGETS];
+
+static u8 window_size = SHC_MSG_EXECUTER_WINDOW_SIZE;
+static u32 priority_max_wait_ms = SHC_MSG_EXECUTER_PRIORITY_MAX_WAIT_MS;
+
+/**
+ * @brief Responses of MQTT-commands are published like reports,
+ * set by MQTT_PUBLISH_COMMAND_RESPONSE
+ *
+ */
+static u8 publish_command_response = 0;
+
+static u32 report_interval_ms = SHC_MSG_EXECUTER_REPORT_INTERVAL_MS;
+static u32 event_interval_ms = SHC_MSG_EXECUTER_EVENT_INTERVAL_MS;
+static u64 report_timestamp_us = 0;
+static u64 event_timestamp_us = 0;
+
+/**
+ * @brief Last matching event of every event-group of the actual
+ * command-table as index + 1 or 0. An event is only published
+ * if it differs from the last matching event of its group.
+ *
+ */
+static u32* event_state_list = NULL;
+static u32 event_state_generation = 0;
+
+static char exe_command[SHC_MSG_EXECUTER_EXE_MAX_LENGTH];
+static char publish_message[SHC_COMMAND_TABLE_MAX_KEY_LENGTH + 1 + (SHC_COMMAND_TABLE_MAX_COMMAND_LENGTH * 2) + 1];
+
+// --------------------------------------------------------------------------------
+
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(MSG_EXECUTER_RESPONSE_RECEIVED_SIGNAL)
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(MSG_EXECUTER_RESPONSE_TIMEOUT_SIGNAL)
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(MSG_EXECUTER_INVALID_COMMAND_SIGNAL)
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(MSG_EXECUTER_INVALID_COMMAND_SYNTAX_SIGNAL)
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(MSG_EXECUTER_CLIENT_RESPONSE_SIGNAL)
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(MSG_EXECUTER_COMMAND_SUPERSEDED_SIGNAL)
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Gives the result of a request back to its local client
+ *
+ * @param client_id client-id of the request
+ * @param status one of SHC_MSG_EXECUTER_CLIENT_STATUS_xxx
+ * @param p_data response of the control-board, may be NULL
+ * @param length number of bytes of p_data
+ */
+static void shc_msg_executer_client_response(u32 client_id, u8 status, const u8* p_data, u16 length) {
+
+    SHC_MSG_EXECUTER_CLIENT_RESPONSE response = {
+        .client_id = client_id,
+        .status = status,
+        .length = length,
+        .p_data = p_data
+    };
+
+    MSG_EXECUTER_CLIENT_RESPONSE_SIGNAL_send(&response);
+}
+
+/**
+ * @brief Checks if the given request writes to the control-board,
+ * e.g. cmd_light_01_on. Status-queries, events and batches
+ * do not change the state of the control-board.
+ *
+ * @param p_request the request to check
+ * @return 1 if the request is a write-command, otherwise 0
+ */
+static u8 shc_msg_executer_is_write(const SHC_MSG_EXECUTER_REQUEST* p_request) {
+
+    if (p_request->type == SHC_MSG_EXECUTER_REQUEST_RAW) {
+        return 1;
+    }
+
+    if (p_request->type != SHC_MSG_EXECUTER_REQUEST_COMMAND) {
+        return 0;
+    }
+
+    const SHC_COMMAND_TABLE_ENTRY* p_entry = shc_command_table_lookup(shc_command_table_get(), p_request->key);
+    return p_entry != NULL && p_entry->type == SHC_COMMAND_TYPE_COM;
+}
+
+/**
+ * @brief Removes the cached responses that are related to the given
+ * write-command. Raw frames may change anything on their board.
+ *
+ * @param board the board of the request
+ * @param p_request the request
+ */
+static void shc_msg_executer_invalidate_cache(u8 board, const SHC_MSG_EXECUTER_REQUEST* p_request) {
+
+    if (shc_msg_executer_is_write(p_request) == 0) {
+        return;
+    }
+
+    shc_response_cache_invalidate(board, p_request->type == SHC_MSG_EXECUTER_REQUEST_RAW ? NULL : p_request->key);
+}
+
+/**
+ * @brief Get the priority-class of the given type of request
+ *
+ * @param type one of SHC_MSG_EXECUTER_REQUEST_xxx
+ * @return one of SHC_MSG_EXECUTER_PRIORITY_xxx
+ */
+static u8 shc_msg_executer_priority(u8 type) {
+
+    switch (type) {
+        case SHC_MSG_EXECUTER_REQUEST_EVENT:
+            return SHC_MSG_EXECUTER_PRIORITY_EVENT;
+
+        case SHC_MSG_EXECUTER_REQUEST_REPORT:
+        case SHC_MSG_EXECUTER_REQUEST_BATCH:
+            return SHC_MSG_EXECUTER_PRIORITY_REPORT;
+
+        default:
+            return SHC_MSG_EXECUTER_PRIORITY_INTERACTIVE;
+    }
+}
+
+/**
+ * @brief Get a waiting request of the given queue
+ *
+ * @param p_queue the queue
+ * @param position position inside of the queue, 0 is the oldest request
+ * @return the request
+ */
+static SHC_MSG_EXECUTER_REQUEST* shc_msg_executer_queue_get(SHC_MSG_EXECUTER_QUEUE* p_queue, u8 position) {
+    return &p_queue->request_fifo[(p_queue->read_index + position) % SHC_MSG_EXECUTER_FIFO_SIZE];
+}
+
+/**
+ * @brief Adds a new request to the fifo of its priority-class of the given board
+ *
+ * @param p_board the board that processes the request
+ * @param type one of SHC_MSG_EXECUTER_REQUEST_xxx
+ * @param p_key name of the command or report, NULL for events and batches
+ * @param p_command command of an event or batch, NULL for commands and reports
+ * @param length number of bytes of p_command
+ * @return the new request or NULL if the fifo is full
+ */
+static SHC_MSG_EXECUTER_REQUEST* shc_msg_executer_enqueue(SHC_MSG_EXECUTER_BOARD* p_board, u8 type, const char* p_key, const u8* p_command, u16 length) {
+
+    SHC_MSG_EXECUTER_QUEUE* p_queue = &p_board->queue_list[shc_msg_executer_priority(type)];
+
+    if (p_queue->count == SHC_MSG_EXECUTER_FIFO_SIZE) {
+        DEBUG_TRACE_byte(p_board->index, "shc_msg_executer_enqueue() - FIFO is full - Board:");
+        return NULL;
+    }
+
+    SHC_MSG_EXECUTER_REQUEST* p_request = shc_msg_executer_queue_get(p_queue, p_queue->count);
+
+    p_request->type = type;
+    p_request->key[0] = '\0';
+    p_request->length = 0;
+    p_request->num_reports = 0;
+    p_request->client_id = 0;
+    p_request->single_command = 0;
+    p_request->enqueue_time_us = shc_event_loop_time_us();
+
+    if (p_key != NULL) {
+        snprintf(p_request->key, sizeof(p_request->key), "%s", p_key);
+    }
+
+    if (p_command != NULL && length <= sizeof(p_request->command)) {
+        memcpy(p_request->command, p_command, length);
+        p_request->length = length;
+    }
+
+    p_queue->count += 1;
+    p_board->fifo_count += 1;
+    shc_event_loop_wakeup();
+
+    return p_request;
+}
+
+/**
+ * @brief Puts a request that was not processed by the control-board
+ * back to the front of the fifo of its priority-class of the given board.
+ *
+ * @param p_board the board that processes the request
+ * @param p_request the request to send again
+ */
+static void shc_msg_executer_requeue(SHC_MSG_EXECUTER_BOARD* p_board, const SHC_MSG_EXECUTER_REQUEST* p_request) {
+
+    SHC_MSG_EXECUTER_QUEUE* p_queue = &p_board->queue_list[shc_msg_executer_priority(p_request->type)];
+
+    if (p_queue->count == SHC_MSG_EXECUTER_FIFO_SIZE) {
+        DEBUG_TRACE_byte(p_board->index, "shc_msg_executer_requeue() - FIFO is full - Board:");
+
+        if (p_request->client_id != 0) {
+            shc_msg_executer_client_response(p_request->client_id, SHC_MSG_EXECUTER_CLIENT_STATUS_BUSY, NULL, 0);
+        }
+
+        return;
+    }
+
+    p_queue->read_index = (p_queue->read_index + SHC_MSG_EXECUTER_FIFO_SIZE - 1) % SHC_MSG_EXECUTER_FIFO_SIZE;
+    p_queue->count += 1;
+    p_board->fifo_count += 1;
+
+    memcpy(shc_msg_executer_queue_get(p_queue, 0), p_request, sizeof(SHC_MSG_EXECUTER_REQUEST));
+    shc_event_loop_wakeup();
+}
+
+/**
+ * @brief Get the queue of the request that is sent next.
+ * This is the fifo of the highest priority-class with a waiting request,
+ * unless a request of a lower class has waited longer than
+ * priority_max_wait_ms. Then the oldest of these requests is sent first.
+ *
+ * @param p_board the board
+ * @param now_us the actual time
+ * @return the queue or NULL if no request is waiting
+ */
+static SHC_MSG_EXECUTER_QUEUE* shc_msg_executer_select_queue(SHC_MSG_EXECUTER_BOARD* p_board, u64 now_us) {
+
+    SHC_MSG_EXECUTER_QUEUE* p_selected = NULL;
+    SHC_MSG_EXECUTER_QUEUE* p_starving = NULL;
+
+    u8 priority = 0;
+    for ( ; priority < SHC_MSG_EXECUTER_NUM_PRIORITIES ; priority++) {
+
+        SHC_MSG_EXECUTER_QUEUE* p_queue = &p_board->queue_list[priority];
+
+        if (p_queue->count == 0) {
+            continue;
+        }
+
+        if (p_selected == NULL) {
+            p_selected = p_queue;
+            continue;
+        }
+
+        if (priority_max_wait_ms == 0) {
+            break;
+        }
+
+        u64 enqueue_time_us = shc_msg_executer_queue_get(p_queue, 0)->enqueue_time_us;
+
+        if (now_us - enqueue_time_us < (u64)priority_max_wait_ms * 1000ULL) {
+            continue;
+        }
+
+        if (p_starving == NULL || enqueue_time_us < shc_msg_executer_queue_get(p_starving, 0)->enqueue_time_us) {
+            p_starving = p_queue;
+        }
+    }
+
+    if (p_starving != NULL) {
+        DEBUG_TRACE_byte(p_board->index, "shc_msg_executer_select_queue() - Starvation of a lower class - Board:");
+        return p_starving;
+    }
+
+    return p_selected;
+}
+
+/**
+ * @brief Get the number of requests that can be in flight at the same time
+ *
+ * @param p_board the board
+ * @return window_size in windowed mode, otherwise 1
+ */
+static u8 shc_msg_executer_window_limit(const SHC_MSG_EXECUTER_BOARD* p_board) {
+
+    if (p_board->window_mode_requested != p_board->window_enabled) {
+        return 0;
+    }
+
+    return p_board->window_enabled ? window_size : 1;
+}
+
+/**
+ * @brief Switches between windowed and single-command mode
+ * after HOST_PROTOCOL_MODE has changed and all requests
+ * in flight are complete.
+ *
+ * @param p_board the board
+ */
+static void shc_msg_executer_apply_window_mode(SHC_MSG_EXECUTER_BOARD* p_board) {
+
+    if (p_board->window_mode_requested == p_board->window_enabled || p_board->window_count != 0 || p_board->transaction_active) {
+        return;
+    }
+
+    DEBUG_TRACE_byte(p_board->window_mode_requested, "shc_msg_executer_apply_window_mode() - Windowed mode:");
+
+    p_board->window_enabled = p_board->window_mode_requested;
+    p_board->window_timeout_count = 0;
+}
+
+/**
+ * @brief Get the request in flight with the given sequence-number
+ *
+ * @param p_board the board
+ * @param sequence sequence-number of the request
+ * @return the request in flight or NULL if there is none
+ */
+static SHC_MSG_EXECUTER_WINDOW_ENTRY* shc_msg_executer_window_find(SHC_MSG_EXECUTER_BOARD* p_board, u8 sequence) {
+
+    u8 i = 0;
+    for ( ; i < SHC_MSG_EXECUTER_WINDOW_MAX_SIZE ; i++) {
+        if (p_board->window_list[i].in_use && p_board->window_list[i].request.single_command == 0 && p_board->window_list[i].sequence == sequence) {
+            return &p_board->window_list[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Removes a request from the window.
+ * The request itself stays valid until the next dispatch.
+ *
+ * @param p_board the board
+ * @param p_entry the request in flight
+ */
+static void shc_msg_executer_window_release(SHC_MSG_EXECUTER_BOARD* p_board, SHC_MSG_EXECUTER_WINDOW_ENTRY* p_entry) {
+
+    p_entry->in_use = 0;
+    p_board->window_count -= 1;
+
+    shc_event_loop_wakeup();
+}
+
+/**
+ * @brief Switches the given board to the single-command mode.
+ * All requests in flight are sent again.
+ *
+ * @param p_board the board
+ */
+static void shc_msg_executer_window_fallback(SHC_MSG_EXECUTER_BOARD* p_board) {
+
+    DEBUG_TRACE_byte(p_board->index, "shc_msg_executer_window_fallback() - Windowed mode not supported - using single commands - Board:");
+
+    p_board->window_enabled = 0;
+    p_board->window_mode_requested = 0;
+    p_board->window_timeout_count = 0;
+
+    u8 i = SHC_MSG_EXECUTER_WINDOW_MAX_SIZE;
+    while (i-- != 0) {
+
+        if (p_board->window_list[i].in_use) {
+            shc_msg_executer_window_release(p_board, &p_board->window_list[i]);
+            shc_msg_executer_requeue(p_board, &p_board->window_list[i].request);
+        }
+    }
+}
+
+/**
+ * @brief Sends a frame to the control-board
+ *
+ * @param p_board the board
+ * @param type one of SHC_MSG_EXECUTER_TRANSACTION_xxx
+ * @param p_frame the frame including its length-byte
+ * @param length number of bytes of p_frame
+ */
+static void shc_msg_executer_transaction_start(SHC_MSG_EXECUTER_BOARD* p_board, u8 type, const u8* p_frame, u16 length) {
+
+    p_board->transaction_active = 1;
+    p_board->transaction_type = type;
+    p_board->transaction_timestamp_us = shc_event_loop_time_us();
+
+    if (shc_host_board_send(p_board->index, p_frame, length) == 0) {
+        // times out within shc_msg_executer_task()
+        DEBUG_TRACE_byte(p_board->index, "shc_msg_executer_transaction_start() - Board not ready:");
+    }
+}
+
+/**
+ * @brief Checks if the given message is a valid command-name.
+ *
+ * @param p_message zero-terminated message
+ * @return 1 if the message is valid, otherwise 0
+ */
+static u8 shc_msg_executer_is_valid_key(const char* p_message) {
+
+    u16 length = 0;
+
+    while (p_message[length] != '\0') {
+
+        char character = p_message[length];
+
+        if ((character < 'a' || character > 'z') &&
+            (character < 'A' || character > 'Z') &&
+            (character < '0' || character > '9') &&
+            (character != '_')) {
+
+            return 0;
+        }
+
+        if (++length >= SHC_COMMAND_TABLE_MAX_KEY_LENGTH) {
+            return 0;
+        }
+    }
+
+    return length != 0;
+}
+
+/**
+ * @brief Allocates the event-states if a new command-table has been loaded.
+ *
+ * @param p_table the actual command-table
+ */
+static void shc_msg_executer_update_event_state(const SHC_COMMAND_TABLE* p_table) {
+
+    if (event_state_generation == p_table->generation && event_state_list != NULL) {
+        return;
+    }
+
+    free(event_state_list);
+
+    event_state_list = (u32*)calloc(p_table->event_matcher.num_groups + 1, sizeof(u32));
+    event_state_generation = p_table->generation;
+}
+
+/**
+ * @brief Enqueues the reports first_report ... first_report + num_reports - 1
+ * of the given table one by one, each on its own board.
+ *
+ * @param p_table the actual command-table
+ * @param first_report index of the first report inside of the report-list
+ * @param num_reports number of reports
+ */
+static void shc_msg_executer_enqueue_reports(const SHC_COMMAND_TABLE* p_table, u32 first_report, u32 num_reports) {
+
+    u32 i = first_report;
+    for ( ; i < first_report + num_reports && i < p_table->num_reports ; i++) {
+
+        const SHC_COMMAND_TABLE_ENTRY* p_entry = &p_table->entry_list[p_table->report_list[i]];
+
+        if (shc_msg_executer_enqueue(&board_list[p_entry->board], SHC_MSG_EXECUTER_REQUEST_REPORT, p_entry->key, NULL, 0) == NULL) {
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Enqueues a complete batch-frame
+ *
+ * @param p_board the board of all reports of the batch
+ * @param p_table the actual command-table
+ * @param p_builder the batch-frame
+ * @param first_report index of the first report of the batch
+ */
+static void shc_msg_executer_enqueue_batch(SHC_MSG_EXECUTER_BOARD* p_board, const SHC_COMMAND_TABLE* p_table, SHC_RPI_BATCH_BUILDER* p_builder, u32 first_report) {
+
+    if (p_builder->count == 0) {
+        return;
+    }
+
+    if (p_builder->count == 1) {
+        // a batch of a single report has no advantage
+        shc_msg_executer_enqueue_reports(p_table, first_report, 1);
+        return;
+    }
+
+    u16 length = shc_rpi_batch_finish(p_builder);
+    SHC_MSG_EXECUTER_REQUEST* p_request = shc_msg_executer_enqueue(p_board, SHC_MSG_EXECUTER_REQUEST_BATCH, NULL, p_builder->p_buffer, length);
+
+    if (p_request != NULL) {
+        p_request->generation = p_table->generation;
+        p_request->first_report = first_report;
+        p_request->num_reports = p_builder->count;
+    }
+}
+
+/**
+ * @brief Requests a report of all entries of the report-file.
+ * The reports of a board are packed into as few batch-frames
+ * as possible if batches are enabled for this board.
+ * The report-list is grouped by board.
+ *
+ */
+static void shc_msg_executer_schedule_reports(void) {
+
+    const SHC_COMMAND_TABLE* p_table = shc_command_table_get();
+
+    DEBUG_TRACE_long(p_table->num_reports, "shc_msg_executer_schedule_reports()");
+
+    u8 frame[SHC_COMMAND_TABLE_MAX_COMMAND_LENGTH];
+    SHC_RPI_BATCH_BUILDER builder;
+    SHC_MSG_EXECUTER_BOARD* p_board = &board_list[SHC_HOST_BOARD_DEFAULT];
+    u32 first_report = 0;
+
+    shc_rpi_batch_start(&builder, frame, sizeof(frame));
+
+    u32 i = 0;
+    for ( ; i < p_table->num_reports ; i++) {
+
+        const SHC_COMMAND_TABLE_ENTRY* p_entry = &p_table->entry_list[p_table->report_list[i]];
+
+        if (p_entry->board != p_board->index) {
+
+            shc_msg_executer_enqueue_batch(p_board, p_table, &builder, first_report);
+
+            p_board = &board_list[p_entry->board];
+            first_report = i;
+            shc_rpi_batch_start(&builder, frame, sizeof(frame));
+        }
+
+        if (p_board->batch_enabled == 0) {
+            shc_msg_executer_enqueue_reports(p_table, i, 1);
+            first_report = i + 1;
+            continue;
+        }
+
+        if (shc_rpi_batch_add(&builder, p_entry->p_payload, p_entry->length)) {
+            continue;
+        }
+
+        shc_msg_executer_enqueue_batch(p_board, p_table, &builder, first_report);
+
+        first_report = i;
+        shc_rpi_batch_start(&builder, frame, sizeof(frame));
+
+        if (shc_rpi_batch_add(&builder, p_entry->p_payload, p_entry->length) == 0) {
+            // does not fit into a batch at all
+            shc_msg_executer_enqueue_reports(p_table, i, 1);
+            first_report = i + 1;
+        }
+    }
+
+    shc_msg_executer_enqueue_batch(p_board, p_table, &builder, first_report);
+}
+
+/**
+ * @brief Starts a new poll of all event-groups on every board.
+ * A poll that is still running is not restarted.
+ *
+ */
+static void shc_msg_executer_schedule_events(void) {
+
+    u8 board = 0;
+    for ( ; board < SHC_HOST_BOARD_MAX_COUNT ; board++) {
+
+        SHC_MSG_EXECUTER_BOARD* p_board = &board_list[board];
+
+        if (p_board->event_poll_pending) {
+            DEBUG_TRACE_byte(board, "shc_msg_executer_schedule_events() - Last poll still running - Board:");
+            continue;
+        }
+
+        p_board->event_poll_cursor = 0;
+        p_board->event_poll_pending = 1;
+        p_board->event_edge_timestamp_us = 0;
+    }
+}
+
+/**
+ * @brief Adds a poll of the next event-group of the given board to its
+ * fifo if there is no other event-poll waiting.
+ *
+ * @param p_board the board
+ */
+static void shc_msg_executer_poll_next_event(SHC_MSG_EXECUTER_BOARD* p_board) {
+
+    if (p_board->event_poll_pending == 0 || p_board->window_count >= shc_msg_executer_window_limit(p_board)) {
+        return;
+    }
+
+    if (p_board->queue_list[SHC_MSG_EXECUTER_PRIORITY_EVENT].count != 0) {
+        return;
+    }
+
+    const SHC_EVENT_MATCHER* p_matcher = &shc_command_table_get()->event_matcher;
+
+    while (p_board->event_poll_cursor < p_matcher->num_groups && p_matcher->group_list[p_board->event_poll_cursor].board != p_board->index) {
+        p_board->event_poll_cursor += 1;
+    }
+
+    if (p_board->event_poll_cursor >= p_matcher->num_groups) {
+        p_board->event_poll_pending = 0;
+        return;
+    }
+
+    const SHC_EVENT_MATCHER_GROUP* p_group = &p_matcher->group_list[p_board->event_poll_cursor++];
+    shc_msg_executer_enqueue(p_board, SHC_MSG_EXECUTER_REQUEST_EVENT, NULL, p_group->p_command, p_group->command_length);
+}
+
+/**
+ * @brief Resolves a command or report by its name.
+ * Shell-commands are forwarded to the cli-executer immediately.
+ * A request whose board has been changed by a reload of the
+ * command-table is moved to the new board.
+ *
+ * @param p_board the board that has taken the request from its fifo
+ * @param p_request the request to resolve
+ * @return 1 if the request has to be sent to the control-board, otherwise 0
+ */
+static u8 shc_msg_executer_resolve(SHC_MSG_EXECUTER_BOARD* p_board, SHC_MSG_EXECUTER_REQUEST* p_request) {
+
+    if (p_request->type == SHC_MSG_EXECUTER_REQUEST_EVENT ||
+        p_request->type == SHC_MSG_EXECUTER_REQUEST_BATCH ||
+        p_request->type == SHC_MSG_EXECUTER_REQUEST_RAW) {
+        return 1;
+    }
+
+    const SHC_COMMAND_TABLE_ENTRY* p_entry = shc_command_table_lookup(shc_command_table_get(), p_request->key);
+
+    if (p_entry == NULL) {
+        // removed by a reload of the command-table
+        DEBUG_TRACE_STR(p_request->key, "shc_msg_executer_resolve() - Unknown command");
+
+        if (p_request->client_id != 0) {
+            shc_msg_executer_client_response(p_request->client_id, SHC_MSG_EXECUTER_CLIENT_STATUS_INVALID, NULL, 0);
+        } else {
+            MSG_EXECUTER_INVALID_COMMAND_SIGNAL_send(p_request->key);
+        }
+
+        return 0;
+    }
+
+    if (p_entry->type == SHC_COMMAND_TYPE_EXE) {
+        DEBUG_TRACE_STR(p_request->key, "shc_msg_executer_resolve() - EXE-command");
+        snprintf(exe_command, sizeof(exe_command), "%s", (const char*)p_entry->p_payload);
+        CLI_EXECUTER_COMMAND_RECEIVED_SIGNAL_send(exe_command);
+
+        if (p_request->client_id != 0) {
+            shc_msg_executer_client_response(p_request->client_id, SHC_MSG_EXECUTER_CLIENT_STATUS_OK, NULL, 0);
+        }
+
+        return 0;
+    }
+
+    if (p_entry->board != p_board->index) {
+        DEBUG_TRACE_STR(p_request->key, "shc_msg_executer_resolve() - Board has changed");
+        shc_msg_executer_requeue(&board_list[p_entry->board], p_request);
+        return 0;
+    }
+
+    memcpy(p_request->command, p_entry->p_payload, p_entry->length);
+    p_request->length = p_entry->length;
+
+    return 1;
+}
+
+/**
+ * @brief Sends the next request of the fifo to the control-board
+ * as long as the window has a free entry.
+ *
+ * @param p_board the board
+ */
+static void shc_msg_executer_dispatch(SHC_MSG_EXECUTER_BOARD* p_board) {
+
+    u64 now_us = shc_event_loop_time_us();
+
+    while (p_board->transaction_active == 0 &&
+           p_board->fifo_count != 0 &&
+           p_board->window_count < shc_msg_executer_window_limit(p_board) &&
+           shc_host_board_is_ready(p_board->index)) {
+
+        SHC_MSG_EXECUTER_QUEUE* p_queue = shc_msg_executer_select_queue(p_board, now_us);
+
+        u8 slot = 0;
+        while (p_board->window_list[slot].in_use) {
+            slot += 1;
+        }
+
+        SHC_MSG_EXECUTER_WINDOW_ENTRY* p_entry = &p_board->window_list[slot];
+        memcpy(&p_entry->request, shc_msg_executer_queue_get(p_queue, 0), sizeof(SHC_MSG_EXECUTER_REQUEST));
+
+        p_queue->read_index = (p_queue->read_index + 1) % SHC_MSG_EXECUTER_FIFO_SIZE;
+        p_queue->count -= 1;
+        p_board->fifo_count -= 1;
+
+        if (shc_msg_executer_resolve(p_board, &p_entry->request) == 0) {
+            continue;
+        }
+
+        DEBUG_TRACE_byte(p_entry->request.length, "shc_msg_executer_dispatch() - COM-command");
+
+        p_entry->in_use = 1;
+        p_entry->timestamp_us = shc_event_loop_time_us();
+        p_board->window_count += 1;
+        p_board->transaction_slot = slot;
+
+        if (p_board->window_enabled == 0 || p_entry->request.single_command) {
+            shc_msg_executer_transaction_start(p_board, SHC_MSG_EXECUTER_TRANSACTION_SINGLE, p_entry->request.command, p_entry->request.length);
+            continue;
+        }
+
+        p_board->window_sequence = shc_rpi_window_next_sequence(p_board->window_sequence);
+        p_entry->sequence = p_board->window_sequence;
+
+        u16 length = shc_rpi_window_build_submit(
+            p_board->transaction_frame,
+            sizeof(p_board->transaction_frame),
+            p_entry->sequence,
+            p_entry->request.command,
+            p_entry->request.length
+        );
+
+        if (length == 0) {
+            DEBUG_PASS("shc_msg_executer_dispatch() - Invalid command");
+            shc_msg_executer_window_release(p_board, p_entry);
+            continue;
+        }
+
+        shc_msg_executer_transaction_start(p_board, SHC_MSG_EXECUTER_TRANSACTION_SUBMIT, p_board->transaction_frame, length);
+    }
+}
+
+/**
+ * @brief Polls the control-board for completed requests
+ * if there is nothing else to submit.
+ *
+ * @param p_board the board
+ */
+static void shc_msg_executer_poll_window(SHC_MSG_EXECUTER_BOARD* p_board) {
+
+    if (p_board->window_enabled == 0 || p_board->transaction_active || p_board->window_count == 0) {
+        return;
+    }
+
+    if (p_board->fifo_count != 0 && p_board->window_count < window_size) {
+        return;
+    }
+
+    if (shc_host_board_is_ready(p_board->index) == 0) {
+        return;
+    }
+
+    u64 now_us = shc_event_loop_time_us();
+    u32 elapsed_ms = (u32)((now_us - p_board->transaction_timestamp_us) / 1000ULL);
+
+    if (elapsed_ms < SHC_MSG_EXECUTER_WINDOW_POLL_INTERVAL_MS) {
+        shc_event_loop_set_deadline(SHC_MSG_EXECUTER_WINDOW_POLL_INTERVAL_MS - elapsed_ms);
+        return;
+    }
+
+    u16 length = shc_rpi_window_build_poll(p_board->transaction_frame, sizeof(p_board->transaction_frame));
+    shc_msg_executer_transaction_start(p_board, SHC_MSG_EXECUTER_TRANSACTION_POLL, p_board->transaction_frame, length);
+}
+
+/**
+ * @brief Publishes the event that matches the given response
+ * of an event-poll.
+ *
+ * @param p_board the board that was polled
+ * @param p_request the event-poll
+ * @param p_data the response without the length-byte
+ * @param length number of bytes of p_data
+ */
+static void shc_msg_executer_process_events(const SHC_MSG_EXECUTER_BOARD* p_board, const SHC_MSG_EXECUTER_REQUEST* p_request, const u8* p_data, u16 length) {
+
+    const SHC_COMMAND_TABLE* p_table = shc_command_table_get();
+    shc_msg_executer_update_event_state(p_table);
+
+    if (event_state_list == NULL) {
+        return;
+    }
+
+    u32 group = shc_event_matcher_find_group(&p_table->event_matcher, p_board->index, p_request->command, p_request->length);
+    if (group == SHC_EVENT_MATCHER_NOT_FOUND) {
+        // removed by a reload of the command-table
+        return;
+    }
+
+    u32 index = shc_event_matcher_match(&p_table->event_matcher, group, p_data, length);
+    u32 state = (index == SHC_EVENT_MATCHER_NOT_FOUND) ? 0 : index + 1;
+
+    if (state != 0 && state != event_state_list[group]) {
+        DEBUG_TRACE_STR(p_table->event_list[index].key, "shc_msg_executer_process_events() - Event");
+        MQTT_MESSAGE_TO_SEND_SIGNAL_send(p_table->event_list[index].key);
+
+        if (p_board->event_edge_timestamp_us != 0) {
+            shc_event_line_add_latency((u32)(shc_event_loop_time_us() - p_board->event_edge_timestamp_us));
+        }
+    }
+
+    event_state_list[group] = state;
+}
+
+/**
+ * @brief Formats the response of a command or report as
+ * <name>=<hex-response> and sends it.
+ *
+ * @param p_key name of the command or report
+ * @param p_data the response without the length-byte
+ * @param length number of bytes of p_data
+ * @param publish the response is published via MQTT
+ */
+static void shc_msg_executer_publish_response(const char* p_key, const u8* p_data, u16 length, u8 publish) {
+
+    u16 key_length = (u16)strlen(p_key);
+
+    memcpy(publish_message, p_key, key_length);
+    publish_message[key_length] = '=';
+
+    shc_command_table_bytes_to_hex(
+        p_data,
+        length,
+        publish_message + key_length + 1,
+        (u16)(sizeof(publish_message) - key_length - 1)
+    );
+
+    if (publish) {
+        MQTT_MESSAGE_TO_SEND_SIGNAL_send(publish_message);
+    }
+
+    MSG_EXECUTER_RESPONSE_RECEIVED_SIGNAL_send(publish_message);
+}
+
+/**
+ * @brief Publishes all reports of a batch.
+ * Batches are disabled if the control-board does not support them
+ * and the reports of this batch are requested one by one.
+ * Reports that have not been processed inside of the batch,
+ * or whose response is missing, are requested one by one.
+ *
+ * @param p_board the board of the batch
+ * @param p_request the batch
+ * @param p_data the response without the length-byte
+ * @param length number of bytes of p_data
+ * @param send_time_us point in time the batch was sent to the control-board
+ */
+static void shc_msg_executer_process_batch(SHC_MSG_EXECUTER_BOARD* p_board, const SHC_MSG_EXECUTER_REQUEST* p_request, const u8* p_data, u16 length, u64 send_time_us) {
+
+    const SHC_COMMAND_TABLE* p_table = shc_command_table_get();
+    SHC_RPI_BATCH_ITERATOR iterator;
+
+    p_board->batch_timeout_count = 0;
+
+    if (shc_rpi_batch_begin(&iterator, p_data, length, p_request->num_reports) == 0) {
+
+        DEBUG_TRACE_byte(p_board->index, "shc_msg_executer_process_batch() - Batch not supported - using single commands - Board:");
+        p_board->batch_enabled = 0;
+
+        if (p_request->generation == p_table->generation) {
+            shc_msg_executer_enqueue_reports(p_table, p_request->first_report, p_request->num_reports);
+        }
+
+        return;
+    }
+
+    if (p_request->generation != p_table->generation) {
+        // the reports may have been changed by a reload of the command-table
+        DEBUG_PASS("shc_msg_executer_process_batch() - Command-table has changed");
+        return;
+    }
+
+    const u8* p_response = NULL;
+    u16 response_length = 0;
+    u32 report = p_request->first_report;
+    u32 last_report = p_request->first_report + p_request->num_reports;
+
+    while (shc_rpi_batch_next(&iterator, &p_response, &response_length) && report < p_table->num_reports) {
+
+        const SHC_COMMAND_TABLE_ENTRY* p_entry = &p_table->entry_list[p_table->report_list[report++]];
+
+        if (shc_rpi_batch_is_processed(p_response, response_length) == 0) {
+
+            SHC_MSG_EXECUTER_REQUEST* p_single = shc_msg_executer_enqueue(&board_list[p_entry->board], SHC_MSG_EXECUTER_REQUEST_REPORT, p_entry->key, NULL, 0);
+
+            if (p_single != NULL) {
+                p_single->single_command = 1;
+            }
+
+            continue;
+        }
+
+        shc_response_cache_store(p_entry->board, p_entry->key, p_entry->p_payload, p_entry->length, p_response, response_length, send_time_us);
+        shc_msg_executer_publish_response(p_entry->key, p_response, response_length, 1);
+    }
+
+    if (report < last_report) {
+        DEBUG_TRACE_long(last_report - report, "shc_msg_executer_process_batch() - Batch truncated - missing responses:");
+        shc_msg_executer_enqueue_reports(p_table, report, last_report - report);
+    }
+}
+
+/**
+ * @brief Adds the latencies of a completed request to the metrics.
+ * Events and batches are measured under a common name.
+ *
+ * @param p_entry the completed request with the point in time of its dispatch
+ */
+static void shc_msg_executer_add_latency(const SHC_MSG_EXECUTER_WINDOW_ENTRY* p_entry) {
+
+    const SHC_MSG_EXECUTER_REQUEST* p_request = &p_entry->request;
+    const char* p_key = p_request->key;
+
+    if (p_request->type == SHC_MSG_EXECUTER_REQUEST_EVENT) {
+        p_key = "event_poll";
+    } else if (p_request->type == SHC_MSG_EXECUTER_REQUEST_BATCH) {
+        p_key = "report_batch";
+    } else if (p_request->type == SHC_MSG_EXECUTER_REQUEST_RAW) {
+        p_key = "raw_command";
+    }
+
+    u16 key_length = (u16)strlen(p_key);
+    u64 now_us = shc_event_loop_time_us();
+
+    shc_metrics_add_latency(SHC_METRICS_STAGE_QUEUE, p_key, key_length, (u32)(p_entry->timestamp_us - p_request->enqueue_time_us));
+    shc_metrics_add_queue_wait(shc_msg_executer_priority(p_request->type), (u32)(p_entry->timestamp_us - p_request->enqueue_time_us));
+    shc_metrics_add_latency(SHC_METRICS_STAGE_HOST, p_key, key_length, (u32)(now_us - p_entry->timestamp_us));
+    shc_metrics_add_latency(SHC_METRICS_STAGE_TOTAL, p_key, key_length, (u32)(now_us - p_request->enqueue_time_us));
+}
+
+/**
+ * @brief Processes the response of the control-board to the given request.
+ *
+ * @param p_board the board of the request
+ * @param p_request the completed request
+ * @param p_data the response without the length-byte
+ * @param length number of bytes of p_data
+ * @param send_time_us point in time the request was sent to the control-board
+ */
+static void shc_msg_executer_complete(SHC_MSG_EXECUTER_BOARD* p_board, const SHC_MSG_EXECUTER_REQUEST* p_request, const u8* p_data, u16 length, u64 send_time_us) {
+
+    if (p_request->type == SHC_MSG_EXECUTER_REQUEST_EVENT) {
+        shc_msg_executer_process_events(p_board, p_request, p_data, length);
+        return;
+    }
+
+    if (p_request->type == SHC_MSG_EXECUTER_REQUEST_BATCH) {
+        shc_msg_executer_process_batch(p_board, p_request, p_data, length, send_time_us);
+        return;
+    }
+
+    if (shc_msg_executer_is_write(p_request)) {
+        // status-queries sent in the meantime may have read the old state
+        shc_msg_executer_invalidate_cache(p_board->index, p_request);
+    } else {
+        shc_response_cache_store(p_board->index, p_request->key, p_request->command, p_request->length, p_data, length, send_time_us);
+    }
+
+    if (p_request->client_id != 0) {
+        shc_msg_executer_client_response(p_request->client_id, SHC_MSG_EXECUTER_CLIENT_STATUS_OK, p_data, length);
+    }
+
+    if (p_request->type == SHC_MSG_EXECUTER_REQUEST_RAW) {
+        return;
+    }
+
+    shc_msg_executer_publish_response(
+        p_request->key,
+        p_data,
+        length,
+        p_request->type == SHC_MSG_EXECUTER_REQUEST_REPORT || (publish_command_response && p_request->client_id == 0)
+    );
+}
+
+/**
+ * @brief The control-board has not responded to the given request.
+ *
+ * @param p_board the board of the request
+ * @param p_request the request without response
+ */
+static void shc_msg_executer_timeout(SHC_MSG_EXECUTER_BOARD* p_board, const SHC_MSG_EXECUTER_REQUEST* p_request) {
+
+    DEBUG_TRACE_STR(p_request->key, "shc_msg_executer_timeout()");
+
+    // the write-command may have been processed without response
+    shc_msg_executer_invalidate_cache(p_board->index, p_request);
+
+    if (p_request->client_id != 0) {
+        shc_msg_executer_client_response(p_request->client_id, SHC_MSG_EXECUTER_CLIENT_STATUS_TIMEOUT, NULL, 0);
+    }
+
+    if (p_request->type == SHC_MSG_EXECUTER_REQUEST_BATCH) {
+
+        const SHC_COMMAND_TABLE* p_table = shc_command_table_get();
+
+        if (++p_board->batch_timeout_count >= SHC_MSG_EXECUTER_BATCH_MAX_TIMEOUTS) {
+            DEBUG_TRACE_byte(p_board->index, "shc_msg_executer_timeout() - Batch disabled - Board:");
+            p_board->batch_enabled = 0;
+        }
+
+        if (p_request->generation == p_table->generation) {
+            shc_msg_executer_enqueue_reports(p_table, p_request->first_report, p_request->num_reports);
+        }
+
+    } else if (p_request->type != SHC_MSG_EXECUTER_REQUEST_EVENT && p_request->type != SHC_MSG_EXECUTER_REQUEST_RAW) {
+        MSG_EXECUTER_RESPONSE_TIMEOUT_SIGNAL_send(p_request->key);
+    }
+}
+
+/**
+ * @brief Processes the response to a submit or poll.
+ * Completed requests are matched by their sequence-number,
+ * in any order.
+ *
+ * @param p_board the board
+ * @param p_data the response without the length-byte
+ * @param length number of bytes of p_data
+ */
+static void shc_msg_executer_process_window(SHC_MSG_EXECUTER_BOARD* p_board, const u8* p_data, u16 length) {
+
+    SHC_RPI_WINDOW_ITERATOR iterator;
+
+    if (shc_rpi_window_begin(&iterator, p_data, length) == 0) {
+        shc_msg_executer_window_fallback(p_board);
+        return;
+    }
+
+    if (p_board->transaction_type == SHC_MSG_EXECUTER_TRANSACTION_SUBMIT && iterator.status == SHC_RPI_WINDOW_STATUS_QUEUE_FULL) {
+
+        DEBUG_TRACE_byte(p_board->index, "shc_msg_executer_process_window() - Queue of the control-board is full - Board:");
+
+        SHC_MSG_EXECUTER_WINDOW_ENTRY* p_entry = &p_board->window_list[p_board->transaction_slot];
+        shc_msg_executer_window_release(p_board, p_entry);
+        shc_msg_executer_requeue(p_board, &p_entry->request);
+    }
+
+    u8 sequence = 0;
+    const u8* p_response = NULL;
+    u16 response_length = 0;
+
+    while (shc_rpi_window_next(&iterator, &sequence, &p_response, &response_length)) {
+
+        SHC_MSG_EXECUTER_WINDOW_ENTRY* p_entry = shc_msg_executer_window_find(p_board, sequence);
+
+        if (p_entry == NULL) {
+            // the request has already timed out
+            DEBUG_TRACE_byte(sequence, "shc_msg_executer_process_window() - Unknown sequence");
+            continue;
+        }
+
+        shc_msg_executer_window_release(p_board, p_entry);
+
+        if (shc_rpi_window_is_processed(p_response, response_length) == 0) {
+            DEBUG_TRACE_byte(sequence, "shc_msg_executer_process_window() - Not supported - using single command - Sequence:");
+            p_entry->request.single_command = 1;
+            shc_msg_executer_requeue(p_board, &p_entry->request);
+            continue;
+        }
+
+        shc_msg_executer_add_latency(p_entry);
+        shc_msg_executer_complete(p_board, &p_entry->request, p_response, response_length, p_entry->timestamp_us);
+    }
+}
+
+/**
+ * @brief Drops all requests in flight that have not been completed
+ * within SHC_MSG_EXECUTER_RESPONSE_TIMEOUT_MS.
+ * Only used in windowed mode, in single-command mode the request
+ * times out together with its transaction.
+ *
+ * @param p_board the board
+ * @param now_us the actual time
+ */
+static void shc_msg_executer_window_timeout(SHC_MSG_EXECUTER_BOARD* p_board, u64 now_us) {
+
+    if (p_board->window_enabled == 0) {
+        return;
+    }
+
+    u8 i = 0;
+    for ( ; i < SHC_MSG_EXECUTER_WINDOW_MAX_SIZE ; i++) {
+
+        SHC_MSG_EXECUTER_WINDOW_ENTRY* p_entry = &p_board->window_list[i];
+
+        if (p_entry->in_use == 0 || p_entry->request.single_command) {
+            // a single command times out together with its transaction
+            continue;
+        }
+
+        u32 elapsed_ms = (u32)((now_us - p_entry->timestamp_us) / 1000ULL);
+
+        if (elapsed_ms < SHC_MSG_EXECUTER_RESPONSE_TIMEOUT_MS) {
+            shc_event_loop_set_deadline(SHC_MSG_EXECUTER_RESPONSE_TIMEOUT_MS - elapsed_ms);
+            continue;
+        }
+
+        DEBUG_TRACE_byte(p_entry->sequence, "shc_msg_executer_window_timeout() - Sequence:");
+
+        shc_msg_executer_window_release(p_board, p_entry);
+        shc_msg_executer_timeout(p_board, &p_entry->request);
+    }
+}
+
+/**
+ * @brief Processes the response of the control-board to the actual transaction.
+ *
+ * @param p_board the board
+ * @param p_data the response without the length-byte
+ * @param length number of bytes of p_data
+ */
+static void shc_msg_executer_transaction_complete(SHC_MSG_EXECUTER_BOARD* p_board, const u8* p_data, u16 length) {
+
+    p_board->transaction_active = 0;
+    p_board->transaction_timestamp_us = shc_event_loop_time_us();
+    p_board->window_timeout_count = 0;
+    shc_event_loop_wakeup();
+
+    if (p_board->transaction_type != SHC_MSG_EXECUTER_TRANSACTION_SINGLE) {
+        shc_msg_executer_process_window(p_board, p_data, length);
+        return;
+    }
+
+    SHC_MSG_EXECUTER_WINDOW_ENTRY* p_entry = &p_board->window_list[p_board->transaction_slot];
+
+    shc_msg_executer_window_release(p_board, p_entry);
+    shc_msg_executer_add_latency(p_entry);
+    shc_msg_executer_complete(p_board, &p_entry->request, p_data, length, p_entry->timestamp_us);
+}
+
+/**
+ * @brief The control-board has not responded to the actual transaction.
+ * In windowed mode the requests in flight time out on their own,
+ * the single-command mode is used after several transactions
+ * without response in a row.
+ *
+ * @param p_board the board
+ */
+static void shc_msg_executer_transaction_timeout(SHC_MSG_EXECUTER_BOARD* p_board) {
+
+    DEBUG_TRACE_byte(p_board->transaction_type, "shc_msg_executer_transaction_timeout() - Transaction:");
+
+    p_board->transaction_active = 0;
+    shc_event_loop_wakeup();
+
+    if (p_board->transaction_type != SHC_MSG_EXECUTER_TRANSACTION_SINGLE) {
+
+        if (++p_board->window_timeout_count >= SHC_MSG_EXECUTER_WINDOW_MAX_TIMEOUTS) {
+            shc_msg_executer_window_fallback(p_board);
+        }
+
+        return;
+    }
+
+    SHC_MSG_EXECUTER_WINDOW_ENTRY* p_entry = &p_board->window_list[p_board->transaction_slot];
+
+    shc_msg_executer_window_release(p_board, p_entry);
+    shc_msg_executer_timeout(p_board, &p_entry->request);
+}
+
+/**
+ * @brief Runs all steps of a single board
+ *
+ * @param p_board the board
+ * @param now_us the actual time
+ */
+static void shc_msg_executer_board_task(SHC_MSG_EXECUTER_BOARD* p_board, u64 now_us) {
+
+    if (p_board->transaction_active && now_us - p_board->transaction_timestamp_us >= (u64)SHC_MSG_EXECUTER_RESPONSE_TIMEOUT_MS * 1000ULL) {
+        DEBUG_TRACE_byte(p_board->index, "shc_msg_executer_board_task() - Response timeout - Board:");
+        shc_msg_executer_transaction_timeout(p_board);
+    }
+
+    shc_msg_executer_window_timeout(p_board, now_us);
+
+    shc_msg_executer_apply_window_mode(p_board);
+    shc_msg_executer_poll_next_event(p_board);
+    shc_msg_executer_dispatch(p_board);
+    shc_msg_executer_poll_window(p_board);
+
+    if (p_board->transaction_active) {
+        now_us = shc_event_loop_time_us();
+        u32 elapsed_ms = (u32)((now_us - p_board->transaction_timestamp_us) / 1000ULL);
+        shc_event_loop_set_deadline(elapsed_ms < SHC_MSG_EXECUTER_RESPONSE_TIMEOUT_MS ? SHC_MSG_EXECUTER_RESPONSE_TIMEOUT_MS - elapsed_ms : 1);
+    }
+}
+
+/**
+ * @brief Get the target of the given command. The target is the name
+ * of the command up to the first '_' behind the prefix of its group,
+ * e.g. cmd_light_01 for cmd_light_01_on and the group cmd_light_.
+ * The longest matching prefix is used.
+ *
+ * @param p_key zero-terminated name of the command
+ * @param p_target the target is written into this buffer
+ * @param max_length size of p_target
+ * @return the coalescing-window of the group in milliseconds,
+ * 0 if the command is not part of a group
+ */
+static u32 shc_msg_executer_coalesce_target(const char* p_key, char* p_target, u16 max_length) {
+
+    const SHC_MSG_EXECUTER_COALESCE_GROUP* p_match = NULL;
+
+    u8 i = 0;
+    for ( ; i < SHC_MSG_EXECUTER_COALESCE_MAX_GROUPS ; i++) {
+
+        const SHC_MSG_EXECUTER_COALESCE_GROUP* p_group = &coalesce_group_list[i];
+
+        if (p_group->window_ms == 0 || strncmp(p_key, p_group->prefix, p_group->prefix_length) != 0) {
+            continue;
+        }
+
+        if (p_match == NULL || p_group->prefix_length > p_match->prefix_length) {
+            p_match = p_group;
+        }
+    }
+
+    if (p_match == NULL) {
+        return 0;
+    }
+
+    const char* p_end = strchr(p_key + p_match->prefix_length, '_');
+    int length = (p_end != NULL) ? (int)(p_end - p_key) : (int)strlen(p_key);
+
+    snprintf(p_target, max_length, "%.*s", length, p_key);
+
+    return p_match->window_ms;
+}
+
+/**
+ * @brief Completes a command that was replaced by a newer command
+ * of the same target. The command is answered with an empty response.
+ *
+ * @param p_request the superseded command
+ */
+static void shc_msg_executer_supersede(const SHC_MSG_EXECUTER_REQUEST* p_request) {
+
+    DEBUG_TRACE_STR(p_request->key, "shc_msg_executer_supersede()");
+
+    MSG_EXECUTER_COMMAND_SUPERSEDED_SIGNAL_send(p_request->key);
+
+    if (p_request->client_id != 0) {
+        shc_msg_executer_client_response(p_request->client_id, SHC_MSG_EXECUTER_CLIENT_STATUS_OK, NULL, 0);
+    }
+
+    shc_msg_executer_publish_response(p_request->key, NULL, 0, publish_command_response && p_request->client_id == 0);
+}
+
+/**
+ * @brief Searches the interactive fifo of the given board for a command
+ * of the given target that has not been sent yet.
+ *
+ * @param p_board the board
+ * @param p_target zero-terminated target
+ * @return the waiting command or NULL
+ */
+static SHC_MSG_EXECUTER_REQUEST* shc_msg_executer_coalesce_find_waiting(SHC_MSG_EXECUTER_BOARD* p_board, const char* p_target) {
+
+    SHC_MSG_EXECUTER_QUEUE* p_queue = &p_board->queue_list[SHC_MSG_EXECUTER_PRIORITY_INTERACTIVE];
+    char target[SHC_COMMAND_TABLE_MAX_KEY_LENGTH];
+
+    u8 i = 0;
+    for ( ; i < p_queue->count ; i++) {
+
+        SHC_MSG_EXECUTER_REQUEST* p_request = shc_msg_executer_queue_get(p_queue, i);
+
+        if (p_request->type != SHC_MSG_EXECUTER_REQUEST_COMMAND) {
+            continue;
+        }
+
+        if (shc_msg_executer_coalesce_target(p_request->key, target, sizeof(target)) != 0 && strcmp(target, p_target) == 0) {
+            return p_request;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Get the state of the given target. A new state is created
+ * if the target is not inside of its coalescing-window.
+ *
+ * @param board the board of the target
+ * @param p_target zero-terminated target
+ * @param now_us the actual time
+ * @return the state of the target or NULL if there is no free state
+ */
+static SHC_MSG_EXECUTER_COALESCE_TARGET* shc_msg_executer_coalesce_get(u8 board, const char* p_target, u64 now_us) {
+
+    SHC_MSG_EXECUTER_COALESCE_TARGET* p_free = NULL;
+
+    u8 i = 0;
+    for ( ; i < SHC_MSG_EXECUTER_COALESCE_MAX_TARGETS ; i++) {
+
+        SHC_MSG_EXECUTER_COALESCE_TARGET* p_state = &coalesce_target_list[i];
+
+        if (p_state->in_use && p_state->pending == 0 && now_us - p_state->send_time_us >= (u64)p_state->window_ms * 1000ULL) {
+            // window has elapsed
+            p_state->in_use = 0;
+        }
+
+        if (p_state->in_use == 0) {
+
+            if (p_free == NULL) {
+                p_free = p_state;
+            }
+
+            continue;
+        }
+
+        if (p_state->board == board && strcmp(p_state->target, p_target) == 0) {
+            return p_state;
+        }
+    }
+
+    return p_free;
+}
+
+/**
+ * @brief Coalesces a write-command with the other commands of its target.
+ * A command of the same target that waits inside of the fifo is replaced.
+ * Inside of the coalescing-window of the target the command is held back
+ * and replaces an already held command. Replaced commands are completed
+ * immediately.
+ *
+ * @param p_entry the requested command
+ * @param client_id client-id of a local client, 0 for MQTT
+ * @return 1 if the command was coalesced, 0 if it has to be added to the fifo
+ */
+static u8 shc_msg_executer_coalesce(const SHC_COMMAND_TABLE_ENTRY* p_entry, u32 client_id) {
+
+    char target[SHC_COMMAND_TABLE_MAX_KEY_LENGTH];
+
+    if (p_entry->type != SHC_COMMAND_TYPE_COM) {
+        return 0;
+    }
+
+    u32 window_ms = shc_msg_executer_coalesce_target(p_entry->key, target, sizeof(target));
+
+    if (window_ms == 0) {
+        return 0;
+    }
+
+    u64 now_us = shc_event_loop_time_us();
+    SHC_MSG_EXECUTER_REQUEST* p_request = shc_msg_executer_coalesce_find_waiting(&board_list[p_entry->board], target);
+
+    if (p_request != NULL) {
+        shc_msg_executer_supersede(p_request);
+
+    } else {
+
+        SHC_MSG_EXECUTER_COALESCE_TARGET* p_state = shc_msg_executer_coalesce_get(p_entry->board, target, now_us);
+
+        if (p_state == NULL) {
+            DEBUG_TRACE_STR(target, "shc_msg_executer_coalesce() - No free target");
+            return 0;
+        }
+
+        if (p_state->in_use == 0) {
+            // first command of this target, opens the window
+            p_state->in_use = 1;
+            p_state->board = p_entry->board;
+            p_state->window_ms = window_ms;
+            p_state->send_time_us = now_us;
+            snprintf(p_state->target, sizeof(p_state->target), "%s", target);
+            return 0;
+        }
+
+        p_request = &p_state->request;
+
+        if (p_state->pending) {
+            shc_msg_executer_supersede(p_request);
+
+        } else {
+            DEBUG_TRACE_STR(p_entry->key, "shc_msg_executer_coalesce() - Hold");
+            p_state->pending = 1;
+            p_request->type = SHC_MSG_EXECUTER_REQUEST_COMMAND;
+            p_request->length = 0;
+            p_request->num_reports = 0;
+            shc_event_loop_wakeup();
+        }
+    }
+
+    snprintf(p_request->key, sizeof(p_request->key), "%s", p_entry->key);
+    p_request->client_id = client_id;
+    p_request->enqueue_time_us = now_us;
+
+    return 1;
+}
+
+/**
+ * @brief Adds held commands to the fifo of their board
+ * as soon as the coalescing-window of their target has elapsed.
+ *
+ * @param now_us the actual time
+ */
+static void shc_msg_executer_coalesce_task(u64 now_us) {
+
+    u8 i = 0;
+    for ( ; i < SHC_MSG_EXECUTER_COALESCE_MAX_TARGETS ; i++) {
+
+        SHC_MSG_EXECUTER_COALESCE_TARGET* p_state = &coalesce_target_list[i];
+
+        if (p_state->pending == 0) {
+            continue;
+        }
+
+        u64 due_time_us = p_state->send_time_us + (u64)p_state->window_ms * 1000ULL;
+
+        if (now_us < due_time_us) {
+            shc_event_loop_set_deadline((u32)((due_time_us - now_us + 999ULL) / 1000ULL));
+            continue;
+        }
+
+        p_state->pending = 0;
+        p_state->send_time_us = now_us;
+
+        SHC_MSG_EXECUTER_REQUEST* p_request = shc_msg_executer_enqueue(&board_list[p_state->board], SHC_MSG_EXECUTER_REQUEST_COMMAND, p_state->request.key, NULL, 0);
+
+        if (p_request == NULL) {
+
+            if (p_state->request.client_id != 0) {
+                shc_msg_executer_client_response(p_state->request.client_id, SHC_MSG_EXECUTER_CLIENT_STATUS_BUSY, NULL, 0);
+            }
+
+            continue;
+        }
+
+        // the time of holding back is part of the queue-latency
+        p_request->client_id = p_state->request.client_id;
+        p_request->enqueue_time_us = p_state->request.enqueue_time_us;
+    }
+}
+
+/**
+ * @brief Answers a status-query from the response-cache.
+ * The response is given back the same way as if it has been
+ * received from the control-board.
+ *
+ * @param p_entry the requested report
+ * @param client_id client-id of a local client, 0 for MQTT
+ * @return 1 if the query was answered, 0 if it has to be sent to the control-board
+ */
+static u8 shc_msg_executer_answer_from_cache(const SHC_COMMAND_TABLE_ENTRY* p_entry, u32 client_id) {
+
+    if (p_entry->type != SHC_COMMAND_TYPE_REPORT || shc_response_cache_get_ttl_ms(p_entry->key) == 0) {
+        return 0;
+    }
+
+    u16 length = 0;
+    const u8* p_data = shc_response_cache_lookup(p_entry->board, p_entry->key, p_entry->p_payload, p_entry->length, &length);
+
+    if (p_data == NULL) {
+        return 0;
+    }
+
+    if (client_id != 0) {
+        shc_msg_executer_client_response(client_id, SHC_MSG_EXECUTER_CLIENT_STATUS_OK, p_data, length);
+    }
+
+    shc_msg_executer_publish_response(p_entry->key, p_data, length, publish_command_response && client_id == 0);
+    return 1;
+}
+
+/**
+ * @brief Adds a command or status-query to the fifo of its board.
+ * Status-queries are answered from the response-cache if possible,
+ * write-commands invalidate the related cached responses and are
+ * coalesced with the other commands of their target.
+ *
+ * @param p_entry the requested command
+ * @param client_id client-id of a local client, 0 for MQTT
+ * @return the new request or NULL if the request is already answered
+ * or held back (*p_handled = 1) or the fifo is full (*p_handled = 0)
+ */
+static SHC_MSG_EXECUTER_REQUEST* shc_msg_executer_enqueue_command(const SHC_COMMAND_TABLE_ENTRY* p_entry, u32 client_id, u8* p_handled) {
+
+    *p_handled = shc_msg_executer_answer_from_cache(p_entry, client_id);
+
+    if (*p_handled) {
+        return NULL;
+    }
+
+    if (p_entry->type == SHC_COMMAND_TYPE_COM) {
+        shc_response_cache_invalidate(p_entry->board, p_entry->key);
+    }
+
+    *p_handled = shc_msg_executer_coalesce(p_entry, client_id);
+
+    if (*p_handled) {
+        return NULL;
+    }
+
+    SHC_MSG_EXECUTER_REQUEST* p_request = shc_msg_executer_enqueue(&board_list[p_entry->board], SHC_MSG_EXECUTER_REQUEST_COMMAND, p_entry->key, NULL, 0);
+
+    if (p_request != NULL) {
+        p_request->client_id = client_id;
+    }
+
+    return p_request;
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Looks up a received MQTT-message in the command-table
+ * and adds it to the fifo of its board.
+ *
+ * @param p_argument the received message as zero-terminated string
+ */
+static void shc_msg_executer_MQTT_MESSAGE_RECEIVED_SLOT_CALLBACK(const void* p_argument) {
+
+    if (p_argument == NULL) {
+        DEBUG_PASS("shc_msg_executer_MQTT_MESSAGE_RECEIVED_SLOT_CALLBACK() - NULL_POINTER_EXCEPTION");
+        return;
+    }
+
+    const char* p_message = (const char*)p_argument;
+
+    if (shc_msg_executer_is_valid_key(p_message) == 0) {
+        DEBUG_TRACE_STR(p_message, "shc_msg_executer_MQTT_MESSAGE_RECEIVED_SLOT_CALLBACK() - Invalid syntax");
+        MSG_EXECUTER_INVALID_COMMAND_SYNTAX_SIGNAL_send(p_message);
+        return;
+    }
+
+    const SHC_COMMAND_TABLE_ENTRY* p_entry = shc_command_table_lookup(shc_command_table_get(), p_message);
+
+    if (p_entry == NULL) {
+        DEBUG_TRACE_STR(p_message, "shc_msg_executer_MQTT_MESSAGE_RECEIVED_SLOT_CALLBACK() - Unknown command");
+        MSG_EXECUTER_INVALID_COMMAND_SIGNAL_send(p_message);
+        return;
+    }
+
+    u8 handled = 0;
+    shc_msg_executer_enqueue_command(p_entry, 0, &handled);
+}
+
+/**
+ * @brief Adds the request of a local client to the fifo of its board.
+ * Commands are looked up in the command-table like MQTT-messages,
+ * frames are sent as they are.
+ *
+ * @param p_argument the request of type SHC_COMMAND_SOCKET_REQUEST
+ */
+static void shc_msg_executer_COMMAND_SOCKET_REQUEST_SLOT_CALLBACK(const void* p_argument) {
+
+    if (p_argument == NULL) {
+        DEBUG_PASS("shc_msg_executer_COMMAND_SOCKET_REQUEST_SLOT_CALLBACK() - NULL_POINTER_EXCEPTION");
+        return;
+    }
+
+    const SHC_COMMAND_SOCKET_REQUEST* p_client_request = (const SHC_COMMAND_SOCKET_REQUEST*)p_argument;
+    SHC_MSG_EXECUTER_REQUEST* p_request = NULL;
+
+    if (p_client_request->p_key != NULL) {
+
+        const SHC_COMMAND_TABLE_ENTRY* p_entry = NULL;
+
+        if (shc_msg_executer_is_valid_key(p_client_request->p_key)) {
+            p_entry = shc_command_table_lookup(shc_command_table_get(), p_client_request->p_key);
+        }
+
+        if (p_entry == NULL) {
+            DEBUG_TRACE_STR(p_client_request->p_key, "shc_msg_executer_COMMAND_SOCKET_REQUEST_SLOT_CALLBACK() - Unknown command");
+            shc_msg_executer_client_response(p_client_request->client_id, SHC_MSG_EXECUTER_CLIENT_STATUS_INVALID, NULL, 0);
+            return;
+        }
+
+        u8 handled = 0;
+        p_request = shc_msg_executer_enqueue_command(p_entry, p_client_request->client_id, &handled);
+
+        if (handled) {
+            return;
+        }
+
+    } else {
+
+        if (p_client_request->board >= SHC_HOST_BOARD_MAX_COUNT ||
+            p_client_request->length == 0 ||
+            p_client_request->length > SHC_COMMAND_TABLE_MAX_COMMAND_LENGTH) {
+
+            DEBUG_PASS("shc_msg_executer_COMMAND_SOCKET_REQUEST_SLOT_CALLBACK() - Invalid frame");
+            shc_msg_executer_client_response(p_client_request->client_id, SHC_MSG_EXECUTER_CLIENT_STATUS_INVALID, NULL, 0);
+            return;
+        }
+
+        p_request = shc_msg_executer_enqueue(
+            &board_list[p_client_request->board],
+            SHC_MSG_EXECUTER_REQUEST_RAW,
+            NULL,
+            p_client_request->p_frame,
+            p_client_request->length
+        );
+
+        if (p_request != NULL) {
+            shc_response_cache_invalidate(p_client_request->board, NULL);
+        }
+    }
+
+    if (p_request == NULL) {
+        shc_msg_executer_client_response(p_client_request->client_id, SHC_MSG_EXECUTER_CLIENT_STATUS_BUSY, NULL, 0);
+        return;
+    }
+
+    p_request->client_id = p_client_request->client_id;
+}
+
+/**
+ * @brief Processes the result of the actual transaction of a board.
+ *
+ * @param p_argument the result of type SHC_HOST_BOARD_RESPONSE
+ */
+static void shc_msg_executer_HOST_BOARD_RESPONSE_SLOT_CALLBACK(const void* p_argument) {
+
+    if (p_argument == NULL) {
+        DEBUG_PASS("shc_msg_executer_HOST_BOARD_RESPONSE_SLOT_CALLBACK() - NULL_POINTER_EXCEPTION");
+        return;
+    }
+
+    const SHC_HOST_BOARD_RESPONSE* p_response = (const SHC_HOST_BOARD_RESPONSE*)p_argument;
+
+    if (p_response->board >= SHC_HOST_BOARD_MAX_COUNT) {
+        return;
+    }
+
+    SHC_MSG_EXECUTER_BOARD* p_board = &board_list[p_response->board];
+
+    if (p_board->transaction_active == 0) {
+        DEBUG_TRACE_byte(p_board->index, "shc_msg_executer_HOST_BOARD_RESPONSE_SLOT_CALLBACK() - No active transaction - Board:");
+        return;
+    }
+
+    if (p_response->status != SHC_HOST_BOARD_STATUS_OK) {
+        shc_msg_executer_transaction_timeout(p_board);
+        return;
+    }
+
+    shc_msg_executer_transaction_complete(p_board, p_response->p_data, p_response->length);
+}
+
+/**
+ * @brief The control-boards have signaled pending events.
+ * All event-groups of every board are polled again,
+ * a running poll is restarted.
+ *
+ * @param p_argument point in time of the edge as const u64*
+ */
+static void shc_msg_executer_EVENT_LINE_TRIGGERED_SLOT_CALLBACK(const void* p_argument) {
+
+    if (p_argument == NULL) {
+        DEBUG_PASS("shc_msg_executer_EVENT_LINE_TRIGGERED_SLOT_CALLBACK() - NULL_POINTER_EXCEPTION");
+        return;
+    }
+
+    DEBUG_PASS("shc_msg_executer_EVENT_LINE_TRIGGERED_SLOT_CALLBACK()");
+
+    u8 board = 0;
+    for ( ; board < SHC_HOST_BOARD_MAX_COUNT ; board++) {
+
+        SHC_MSG_EXECUTER_BOARD* p_board = &board_list[board];
+
+        if (p_board->event_edge_timestamp_us == 0) {
+            p_board->event_edge_timestamp_us = *(const u64*)p_argument;
+        }
+
+        p_board->event_poll_cursor = 0;
+        p_board->event_poll_pending = 1;
+    }
+
+    shc_event_loop_wakeup();
+}
+
+/**
+ * @brief Parses a coalescing-group of the configuration-file,
+ * COMMAND_COALESCE_<n>=<name-prefix>:<window_ms>
+ *
+ * @param p_index the index <n> of the group
+ * @param p_value the value of the configuration-object
+ */
+static void shc_msg_executer_parse_coalesce_group(const char* p_index, const char* p_value) {
+
+    u32 index = (u32)strtoul(p_index, NULL, 10);
+    const char* p_separator = strrchr(p_value, ':');
+
+    if (index >= SHC_MSG_EXECUTER_COALESCE_MAX_GROUPS ||
+        p_separator == NULL ||
+        p_separator == p_value ||
+        (size_t)(p_separator - p_value) >= SHC_COMMAND_TABLE_MAX_KEY_LENGTH) {
+
+        DEBUG_TRACE_STR(p_value, "shc_msg_executer_parse_coalesce_group() - Invalid group");
+        return;
+    }
+
+    SHC_MSG_EXECUTER_COALESCE_GROUP* p_group = &coalesce_group_list[index];
+
+    p_group->prefix_length = (u16)(p_separator - p_value);
+    memcpy(p_group->prefix, p_value, p_group->prefix_length);
+    p_group->prefix[p_group->prefix_length] = '\0';
+    p_group->window_ms = (u32)strtoul(p_separator + 1, NULL, 10);
+}
+
+/**
+ * @brief Takes the file-paths and scheduling intervals
+ * from the configuration-file.
+ *
+ * @param p_argument the configuration object of type CFG_FILE_PARSER_CFG_OBJECT_TYPE
+ */
+static void shc_msg_executer_CFG_OBJECT_RECEIVED_SLOT_CALLBACK(const void* p_argument) {
+
+    if (p_argument == NULL) {
+        DEBUG_PASS("shc_msg_executer_CFG_OBJECT_RECEIVED_SLOT_CALLBACK() - NULL_POINTER_EXCEPTION");
+        return;
+    }
+
+    const CFG_FILE_PARSER_CFG_OBJECT_TYPE* p_cfg_obj = (const CFG_FILE_PARSER_CFG_OBJECT_TYPE*)p_argument;
+    u8 board = 0;
+
+    if (strcmp(p_cfg_obj->key, "COMMAND_FILE_PATH") == 0) {
+        shc_command_table_set_file(SHC_COMMAND_TABLE_FILE_COMMAND, p_cfg_obj->value);
+
+    } else if (strcmp(p_cfg_obj->key, "REPORT_FILE_PATH") == 0) {
+        shc_command_table_set_file(SHC_COMMAND_TABLE_FILE_REPORT, p_cfg_obj->value);
+
+    } else if (strcmp(p_cfg_obj->key, "EVENT_FILE_PATH") == 0) {
+        shc_command_table_set_file(SHC_COMMAND_TABLE_FILE_EVENT, p_cfg_obj->value);
+
+    } else if (strcmp(p_cfg_obj->key, "EXECUTE_FILE_PATH") == 0) {
+        shc_command_table_set_file(SHC_COMMAND_TABLE_FILE_EXECUTE, p_cfg_obj->value);
+
+    } else if (strcmp(p_cfg_obj->key, "SCHEDULE_INTERVAL_REPORT_MS") == 0) {
+        report_interval_ms = (u32)strtoul(p_cfg_obj->value, NULL, 10);
+
+    } else if (strcmp(p_cfg_obj->key, "SCHEDULE_INTERVAL_EVENT_MS") == 0) {
+        event_interval_ms = (u32)strtoul(p_cfg_obj->value, NULL, 10);
+
+    } else if (strcmp(p_cfg_obj->key, "REPORT_BATCH_MODE") == 0) {
+
+        for ( ; board < SHC_HOST_BOARD_MAX_COUNT ; board++) {
+            board_list[board].batch_enabled = strcmp(p_cfg_obj->value, "OFF") != 0;
+            board_list[board].batch_timeout_count = 0;
+        }
+
+    } else if (strcmp(p_cfg_obj->key, "MQTT_PUBLISH_COMMAND_RESPONSE") == 0) {
+        publish_command_response = strcmp(p_cfg_obj->value, "ON") == 0;
+
+    } else if (strcmp(p_cfg_obj->key, "HOST_PROTOCOL_MODE") == 0) {
+
+        for ( ; board < SHC_HOST_BOARD_MAX_COUNT ; board++) {
+            board_list[board].window_mode_requested = strcmp(p_cfg_obj->value, "SINGLE") != 0;
+        }
+
+    } else if (strcmp(p_cfg_obj->key, "HOST_PROTOCOL_WINDOW_SIZE") == 0) {
+
+        u32 size = (u32)strtoul(p_cfg_obj->value, NULL, 10);
+
+        if (size == 0 || size > SHC_MSG_EXECUTER_WINDOW_MAX_SIZE) {
+            DEBUG_TRACE_long(size, "shc_msg_executer_CFG_OBJECT_RECEIVED_SLOT_CALLBACK() - Invalid window-size");
+            size = SHC_MSG_EXECUTER_WINDOW_MAX_SIZE;
+        }
+
+        window_size = (u8)size;
+
+    } else if (strcmp(p_cfg_obj->key, "SCHEDULE_INTERVAL_CONFIG_MS") == 0) {
+        shc_command_table_set_poll_interval((u32)strtoul(p_cfg_obj->value, NULL, 10));
+
+    } else if (strcmp(p_cfg_obj->key, "PRIORITY_MAX_WAIT_MS") == 0) {
+        priority_max_wait_ms = (u32)strtoul(p_cfg_obj->value, NULL, 10);
+
+    } else if (strncmp(p_cfg_obj->key, "COMMAND_COALESCE_", 17) == 0) {
+        shc_msg_executer_parse_coalesce_group(p_cfg_obj->key + 17, p_cfg_obj->value);
+    }
+}
+
+/**
+ * @brief The configuration-file was reloaded. The command-, report-,
+ * event- and execute-file are reloaded too, even if their paths
+ * have not changed. Waiting requests are resolved with the new table.
+ *
+ * @param p_argument not used
+ */
+static void shc_msg_executer_CFG_RELOAD_COMPLETE_SLOT_CALLBACK(const void* p_argument) {
+
+    (void) p_argument;
+
+    DEBUG_PASS("shc_msg_executer_CFG_RELOAD_COMPLETE_SLOT_CALLBACK()");
+    shc_command_table_request_reload();
+}
+
+// --------------------------------------------------------------------------------
+
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(MQTT_MESSAGE_RECEIVED_SIGNAL, SHC_MSG_EXECUTER_MQTT_MESSAGE_RECEIVED_SLOT, shc_msg_executer_MQTT_MESSAGE_RECEIVED_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(SHC_COMMAND_SOCKET_REQUEST_SIGNAL, SHC_MSG_EXECUTER_COMMAND_SOCKET_REQUEST_SLOT, shc_msg_executer_COMMAND_SOCKET_REQUEST_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(SHC_HOST_BOARD_RESPONSE_SIGNAL, SHC_MSG_EXECUTER_HOST_BOARD_RESPONSE_SLOT, shc_msg_executer_HOST_BOARD_RESPONSE_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(SHC_EVENT_LINE_TRIGGERED_SIGNAL, SHC_MSG_EXECUTER_EVENT_LINE_TRIGGERED_SLOT, shc_msg_executer_EVENT_LINE_TRIGGERED_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(CFG_PARSER_NEW_CFG_OBJECT_SIGNAL, SHC_MSG_EXECUTER_CFG_OBJECT_RECEIVED_SLOT, shc_msg_executer_CFG_OBJECT_RECEIVED_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(SHC_CFG_RELOAD_COMPLETE_SIGNAL, SHC_MSG_EXECUTER_CFG_RELOAD_COMPLETE_SLOT, shc_msg_executer_CFG_RELOAD_COMPLETE_SLOT_CALLBACK)
+
+// --------------------------------------------------------------------------------
+
+void shc_msg_executer_init(void) {
+
+    DEBUG_PASS("shc_msg_executer_init()");
+
+    MSG_EXECUTER_RESPONSE_RECEIVED_SIGNAL_init();
+    MSG_EXECUTER_RESPONSE_TIMEOUT_SIGNAL_init();
+    MSG_EXECUTER_INVALID_COMMAND_SIGNAL_init();
+    MSG_EXECUTER_INVALID_COMMAND_SYNTAX_SIGNAL_init();
+    MSG_EXECUTER_CLIENT_RESPONSE_SIGNAL_init();
+    MSG_EXECUTER_COMMAND_SUPERSEDED_SIGNAL_init();
+
+    shc_command_table_init();
+    shc_response_cache_init();
+
+    memset(board_list, 0x00, sizeof(board_list));
+    memset(coalesce_group_list, 0x00, sizeof(coalesce_group_list));
+    memset(coalesce_target_list, 0x00, sizeof(coalesce_target_list));
+
+    u8 board = 0;
+    for ( ; board < SHC_HOST_BOARD_MAX_COUNT ; board++) {
+
+        SHC_MSG_EXECUTER_BOARD* p_board = &board_list[board];
+
+        p_board->index = board;
+        p_board->window_enabled = 1;
+        p_board->window_mode_requested = 1;
+        p_board->batch_enabled = 1;
+    }
+
+    report_timestamp_us = shc_event_loop_time_us();
+    event_timestamp_us = report_timestamp_us;
+
+    SHC_MSG_EXECUTER_MQTT_MESSAGE_RECEIVED_SLOT_connect();
+    SHC_MSG_EXECUTER_COMMAND_SOCKET_REQUEST_SLOT_connect();
+    SHC_MSG_EXECUTER_HOST_BOARD_RESPONSE_SLOT_connect();
+    SHC_MSG_EXECUTER_EVENT_LINE_TRIGGERED_SLOT_connect();
+    SHC_MSG_EXECUTER_CFG_OBJECT_RECEIVED_SLOT_connect();
+    SHC_MSG_EXECUTER_CFG_RELOAD_COMPLETE_SLOT_connect();
+}
+
+void shc_msg_executer_deinit(void) {
+
+    DEBUG_PASS("shc_msg_executer_deinit()");
+
+    shc_command_table_deinit();
+
+    free(event_state_list);
+    event_state_list = NULL;
+}
+
+void shc_msg_executer_task(void) {
+
+    shc_command_table_task();
+
+    u64 now_us = shc_event_loop_time_us();
+
+    if (report_interval_ms != 0) {
+
+        if (now_us - report_timestamp_us >= (u64)report_interval_ms * 1000ULL) {
+            report_timestamp_us = now_us;
+            shc_msg_executer_schedule_reports();
+        }
+
+        shc_event_loop_set_deadline(report_interval_ms - (u32)((now_us - report_timestamp_us) / 1000ULL));
+    }
+
+    if (event_interval_ms != 0) {
+
+        if (now_us - event_timestamp_us >= (u64)event_interval_ms * 1000ULL) {
+            event_timestamp_us = now_us;
+            shc_msg_executer_schedule_events();
+        }
+
+        shc_event_loop_set_deadline(event_interval_ms - (u32)((now_us - event_timestamp_us) / 1000ULL));
+    }
+
+    shc_msg_executer_coalesce_task(now_us);
+
+    u8 board = 0;
+    for ( ; board < SHC_HOST_BOARD_MAX_COUNT ; board++) {
+        shc_msg_executer_board_task(&board_list[board], now_us);
+    }
+}
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,216 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_msg_executer.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Message-executer of the shcClient.
+ *
+ *          Replaces the MSG_EXECUTER module of the framework.
+ *          Commands are resolved via the in-memory command-table
+ *          instead of scanning the command-file on every message.
+ *
+ *          - MQTT-messages are looked up in the command-table and
+ *            forwarded to the control-board or the cli-executer
+ *          - reports are requested every SCHEDULE_INTERVAL_REPORT_MS,
+ *            packed into batch-frames if REPORT_BATCH_MODE is not OFF
+ *          - events are polled every SCHEDULE_INTERVAL_EVENT_MS
+ *
+ *          In windowed mode up to HOST_PROTOCOL_WINDOW_SIZE commands are
+ *          in flight, tagged with a sequence-number and completed in any
+ *          order. A control-board without windowed mode is detected and
+ *          the single-command mode is used, one command at a time.
+ *          All other commands wait inside of a fifo.
+ *
+ *          Every board has one fifo per priority-class: MQTT-commands and
+ *          requests of local clients (interactive) are sent before
+ *          event-polls, event-polls before reports. A request of a lower
+ *          class that waits longer than PRIORITY_MAX_WAIT_MS is sent
+ *          before all other requests, the oldest one first.
+ *
+ *          Requests of local clients (see shc_command_socket.h) use the
+ *          same fifo, their result is given back via
+ *          MSG_EXECUTER_CLIENT_RESPONSE_SIGNAL instead of being published.
+ *
+ *          Reports requested via MQTT or a local client are answered
+ *          from the response-cache if possible (see shc_response_cache.h).
+ *          Write-commands invalidate the related cached responses.
+ *
+ *          Write-commands of a coalescing-group (COMMAND_COALESCE_<n>) are
+ *          grouped by their target, the name up to the first '_' behind
+ *          the prefix of the group, e.g. cmd_light_01 for cmd_light_01_on
+ *          and the group cmd_light_. A command replaces a command of the
+ *          same target that still waits inside of the fifo. The first
+ *          command of a target opens its coalescing-window, further
+ *          commands inside of the window are held back and only the
+ *          latest one is sent when the window has elapsed. Replaced
+ *          commands are completed with an empty response (<name>=).
+ *
+ *          Configuration (configuration-file):
+ *
+ *          - COMMAND_FILE_PATH=<path>
+ *          - REPORT_FILE_PATH=<path>
+ *          - EVENT_FILE_PATH=<path>
+ *          - EXECUTE_FILE_PATH=<path>
+ *          - SCHEDULE_INTERVAL_REPORT_MS=<time_ms>
+ *          - SCHEDULE_INTERVAL_EVENT_MS=<time_ms>
+ *          - SCHEDULE_INTERVAL_CONFIG_MS=<time_ms>
+ *          - REPORT_BATCH_MODE=ON|OFF
+ *          - HOST_PROTOCOL_MODE=WINDOW|SINGLE
+ *          - HOST_PROTOCOL_WINDOW_SIZE=<1 ... 8>
+ *          - MQTT_PUBLISH_COMMAND_RESPONSE=ON|OFF (default OFF),
+ *            publishes <name>=<hex-response> of MQTT-commands too
+ *          - PRIORITY_MAX_WAIT_MS=<time_ms> (default 1000),
+ *            0 disables the starvation-protection
+ *          - COMMAND_COALESCE_<n>=<name-prefix>:<window_ms>
+ *            coalescing-group of write-commands, n = 0 ... 7
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_shc_msg_executer_
+#define _H_shc_msg_executer_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "common/signal_slot_interface.h"
+
+// --------------------------------------------------------------------------------
+
+#define SHC_MSG_EXECUTER_CLIENT_STATUS_OK           0
+#define SHC_MSG_EXECUTER_CLIENT_STATUS_TIMEOUT      1
+#define SHC_MSG_EXECUTER_CLIENT_STATUS_INVALID      2
+#define SHC_MSG_EXECUTER_CLIENT_STATUS_BUSY         3
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Priority-classes of the requests of a control-board.
+ * A lower value is sent first.
+ *
+ */
+#define SHC_MSG_EXECUTER_PRIORITY_INTERACTIVE       0
+#define SHC_MSG_EXECUTER_PRIORITY_EVENT             1
+#define SHC_MSG_EXECUTER_PRIORITY_REPORT            2
+
+#define SHC_MSG_EXECUTER_NUM_PRIORITIES             3
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Argument of MSG_EXECUTER_CLIENT_RESPONSE_SIGNAL
+ *
+ */
+typedef struct SHC_MSG_EXECUTER_CLIENT_RESPONSE_STRUCT {
+
+    /**
+     * @brief client-id of the corresponding request
+     *
+     */
+    u32 client_id;
+
+    /**
+     * @brief one of SHC_MSG_EXECUTER_CLIENT_STATUS_xxx
+     *
+     */
+    u8 status;
+
+    /**
+     * @brief response of the control-board without length-byte,
+     * only valid for SHC_MSG_EXECUTER_CLIENT_STATUS_OK
+     *
+     */
+    u16 length;
+    const u8* p_data;
+
+} SHC_MSG_EXECUTER_CLIENT_RESPONSE;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Is send if the control-board has responded to a command.
+ * Argument is the published message as zero-terminated string, e.g.
+ * rpt_light_01=06000103
+ *
+ */
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(MSG_EXECUTER_RESPONSE_RECEIVED_SIGNAL)
+
+/**
+ * @brief Is send if the control-board has not responded to a command.
+ * Argument is the name of the command as zero-terminated string
+ *
+ */
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(MSG_EXECUTER_RESPONSE_TIMEOUT_SIGNAL)
+
+/**
+ * @brief Is send if a received message is not part of the command-table.
+ * Argument is the received message as zero-terminated string
+ *
+ */
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(MSG_EXECUTER_INVALID_COMMAND_SIGNAL)
+
+/**
+ * @brief Is send if a received message is not a valid command-name.
+ * Argument is the received message as zero-terminated string
+ *
+ */
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(MSG_EXECUTER_INVALID_COMMAND_SYNTAX_SIGNAL)
+
+/**
+ * @brief Is send once for every request of a local client.
+ * Argument is of type SHC_MSG_EXECUTER_CLIENT_RESPONSE
+ *
+ */
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(MSG_EXECUTER_CLIENT_RESPONSE_SIGNAL)
+
+/**
+ * @brief Is send if a command was replaced by a newer command
+ * of the same target and is not sent to the control-board.
+ * Argument is the name of the command as zero-terminated string
+ *
+ */
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(MSG_EXECUTER_COMMAND_SUPERSEDED_SIGNAL)
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Initializes the message-executer and the command-table
+ * and connects to all needed signals.
+ *
+ */
+void shc_msg_executer_init(void);
+
+/**
+ * @brief Releases the command-table
+ *
+ */
+void shc_msg_executer_deinit(void);
+
+/**
+ * @brief Processes pending commands, reports and events.
+ * Must be called from the main-loop.
+ *
+ */
+void shc_msg_executer_task(void);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_shc_msg_executer_
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,479 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_response_cache.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Implementation of the response-cache of the shcClient
+ *
+ * @see     shc_response_cache.h
+ */
+
+#define TRACER_OFF
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "tracer.h"
+
+// --------------------------------------------------------------------------------
+
+#include "cpu.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --------------------------------------------------------------------------------
+
+#include "common/signal_slot_interface.h"
+#include "common/common_types.h"
+
+#include "ui/cfg_file_parser/cfg_file_parser.h"
+
+// --------------------------------------------------------------------------------
+
+#include "shc_event_loop.h"
+#include "shc_host_board.h"
+#include "shc_command_table.h"
+#include "shc_response_cache.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Default time-to-live of all reports without class,
+ * overwritten by RESPONSE_CACHE_TTL_MS
+ *
+ */
+#ifndef SHC_RESPONSE_CACHE_TTL_MS
+#define SHC_RESPONSE_CACHE_TTL_MS                   0
+#endif
+
+/**
+ * @brief Prefix of write-commands and reports,
+ * ignored when reports are related to a write-command
+ *
+ */
+#define SHC_RESPONSE_CACHE_COMMAND_PREFIX           "cmd_"
+#define SHC_RESPONSE_CACHE_REPORT_PREFIX            "rpt_"
+#define SHC_RESPONSE_CACHE_PREFIX_LENGTH            4
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief A single cached response
+ *
+ */
+typedef struct SHC_RESPONSE_CACHE_ENTRY_STRUCT {
+
+    u8 in_use;
+    u8 board;
+
+    /**
+     * @brief hash of the board and the command-bytes
+     *
+     */
+    u32 hash;
+
+    u16 command_length;
+    u8 command[SHC_COMMAND_TABLE_MAX_COMMAND_LENGTH];
+
+    u16 response_length;
+    u8 response[SHC_COMMAND_TABLE_MAX_COMMAND_LENGTH];
+
+    /**
+     * @brief name of the report, used to find the
+     * responses that are related to a write-command
+     *
+     */
+    char key[SHC_COMMAND_TABLE_MAX_KEY_LENGTH];
+
+    /**
+     * @brief the response is not used after this point in time
+     *
+     */
+    u64 expire_time_us;
+
+} SHC_RESPONSE_CACHE_ENTRY;
+
+/**
+ * @brief A time-to-live given by RESPONSE_CACHE_CLASS_<n>
+ *
+ */
+typedef struct SHC_RESPONSE_CACHE_CLASS_STRUCT {
+    char prefix[SHC_COMMAND_TABLE_MAX_KEY_LENGTH];
+    u16 prefix_length;
+    u32 ttl_ms;
+} SHC_RESPONSE_CACHE_CLASS;
+
+// --------------------------------------------------------------------------------
+
+static SHC_RESPONSE_CACHE_ENTRY entry_list[SHC_RESPONSE_CACHE_SIZE];
+static SHC_RESPONSE_CACHE_CLASS class_list[SHC_RESPONSE_CACHE_MAX_CLASSES];
+
+static u32 default_ttl_ms = SHC_RESPONSE_CACHE_TTL_MS;
+
+/**
+ * @brief Point in time of the last invalidation of every board.
+ * Responses of commands that were sent before are not stored.
+ *
+ */
+static u64 invalidate_time_list[SHC_HOST_BOARD_MAX_COUNT];
+
+// --------------------------------------------------------------------------------
+
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(SHC_RESPONSE_CACHE_HIT_SIGNAL)
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(SHC_RESPONSE_CACHE_MISS_SIGNAL)
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief FNV-1a hash of the board and the command-bytes
+ *
+ * @param board control-board of the command
+ * @param p_command the command
+ * @param length number of bytes of p_command
+ * @return hash of board and command
+ */
+static u32 shc_response_cache_hash(u8 board, const u8* p_command, u16 length) {
+
+    u32 hash = 2166136261UL;
+
+    hash ^= board;
+    hash *= 16777619UL;
+
+    u16 i = 0;
+    for ( ; i < length ; i++) {
+        hash ^= p_command[i];
+        hash *= 16777619UL;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief Searches for the entry of the given command, expired or not
+ *
+ * @param board control-board of the command
+ * @param hash hash of board and command
+ * @param p_command the command
+ * @param length number of bytes of p_command
+ * @return the entry or NULL if the command is not part of the cache
+ */
+static SHC_RESPONSE_CACHE_ENTRY* shc_response_cache_find(u8 board, u32 hash, const u8* p_command, u16 length) {
+
+    u16 i = 0;
+    for ( ; i < SHC_RESPONSE_CACHE_SIZE ; i++) {
+
+        SHC_RESPONSE_CACHE_ENTRY* p_entry = &entry_list[i];
+
+        if (p_entry->in_use &&
+            p_entry->hash == hash &&
+            p_entry->board == board &&
+            p_entry->command_length == length &&
+            memcmp(p_entry->command, p_command, length) == 0) {
+
+            return p_entry;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Get an entry for a new response. Unused entries are taken
+ * first, then the entry that expires first.
+ *
+ * @return the entry to overwrite, never NULL
+ */
+static SHC_RESPONSE_CACHE_ENTRY* shc_response_cache_allocate(void) {
+
+    SHC_RESPONSE_CACHE_ENTRY* p_oldest = &entry_list[0];
+
+    u16 i = 0;
+    for ( ; i < SHC_RESPONSE_CACHE_SIZE ; i++) {
+
+        if (entry_list[i].in_use == 0) {
+            return &entry_list[i];
+        }
+
+        if (entry_list[i].expire_time_us < p_oldest->expire_time_us) {
+            p_oldest = &entry_list[i];
+        }
+    }
+
+    return p_oldest;
+}
+
+/**
+ * @brief Checks if the given report is related to the given write-command.
+ * The name of the report without rpt_ must be the beginning of the name
+ * of the write-command without cmd_, followed by '_' or the end of the name.
+ *
+ * @param p_report zero-terminated name of the report
+ * @param p_command zero-terminated name of the write-command
+ * @return 1 if the report is related, otherwise 0
+ */
+static u8 shc_response_cache_is_related(const char* p_report, const char* p_command) {
+
+    if (strncmp(p_report, SHC_RESPONSE_CACHE_REPORT_PREFIX, SHC_RESPONSE_CACHE_PREFIX_LENGTH) == 0) {
+        p_report += SHC_RESPONSE_CACHE_PREFIX_LENGTH;
+    }
+
+    if (strncmp(p_command, SHC_RESPONSE_CACHE_COMMAND_PREFIX, SHC_RESPONSE_CACHE_PREFIX_LENGTH) == 0) {
+        p_command += SHC_RESPONSE_CACHE_PREFIX_LENGTH;
+    }
+
+    size_t length = strlen(p_report);
+
+    if (length == 0 || strncmp(p_report, p_command, length) != 0) {
+        return 0;
+    }
+
+    return p_command[length] == '_' || p_command[length] == '\0';
+}
+
+/**
+ * @brief Checks if the given write-command is related
+ * to at least one report of its board.
+ *
+ * @param board control-board of the write-command
+ * @param p_key zero-terminated name of the write-command
+ * @return 1 if there is a related report, otherwise 0
+ */
+static u8 shc_response_cache_has_related_report(u8 board, const char* p_key) {
+
+    const SHC_COMMAND_TABLE* p_table = shc_command_table_get();
+
+    u32 i = 0;
+    for ( ; i < p_table->num_reports ; i++) {
+
+        const SHC_COMMAND_TABLE_ENTRY* p_entry = &p_table->entry_list[p_table->report_list[i]];
+
+        if (p_entry->board == board && shc_response_cache_is_related(p_entry->key, p_key)) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Takes the time-to-live of all classes from the configuration-file.
+ *
+ * @param p_argument the configuration object of type CFG_FILE_PARSER_CFG_OBJECT_TYPE
+ */
+static void shc_response_cache_CFG_OBJECT_RECEIVED_SLOT_CALLBACK(const void* p_argument) {
+
+    if (p_argument == NULL) {
+        DEBUG_PASS("shc_response_cache_CFG_OBJECT_RECEIVED_SLOT_CALLBACK() - NULL_POINTER_EXCEPTION");
+        return;
+    }
+
+    const CFG_FILE_PARSER_CFG_OBJECT_TYPE* p_cfg_obj = (const CFG_FILE_PARSER_CFG_OBJECT_TYPE*)p_argument;
+
+    if (strcmp(p_cfg_obj->key, "RESPONSE_CACHE_TTL_MS") == 0) {
+        default_ttl_ms = (u32)strtoul(p_cfg_obj->value, NULL, 10);
+        return;
+    }
+
+    if (strncmp(p_cfg_obj->key, "RESPONSE_CACHE_CLASS_", 21) != 0) {
+        return;
+    }
+
+    u32 index = (u32)strtoul(p_cfg_obj->key + 21, NULL, 10);
+    const char* p_separator = strrchr(p_cfg_obj->value, ':');
+
+    if (index >= SHC_RESPONSE_CACHE_MAX_CLASSES ||
+        p_separator == NULL ||
+        p_separator == p_cfg_obj->value ||
+        (size_t)(p_separator - p_cfg_obj->value) >= SHC_COMMAND_TABLE_MAX_KEY_LENGTH) {
+
+        DEBUG_TRACE_STR(p_cfg_obj->key, "shc_response_cache_CFG_OBJECT_RECEIVED_SLOT_CALLBACK() - Invalid class");
+        return;
+    }
+
+    SHC_RESPONSE_CACHE_CLASS* p_class = &class_list[index];
+
+    p_class->prefix_length = (u16)(p_separator - p_cfg_obj->value);
+    memcpy(p_class->prefix, p_cfg_obj->value, p_class->prefix_length);
+    p_class->prefix[p_class->prefix_length] = '\0';
+    p_class->ttl_ms = (u32)strtoul(p_separator + 1, NULL, 10);
+}
+
+/**
+ * @brief A new command-table has been loaded, the commands
+ * of the cached responses may have been changed.
+ *
+ * @param p_argument not used
+ */
+static void shc_response_cache_COMMAND_TABLE_LOADED_SLOT_CALLBACK(const void* p_argument) {
+
+    (void) p_argument;
+
+    DEBUG_PASS("shc_response_cache_COMMAND_TABLE_LOADED_SLOT_CALLBACK()");
+    shc_response_cache_clear();
+}
+
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(CFG_PARSER_NEW_CFG_OBJECT_SIGNAL, SHC_RESPONSE_CACHE_CFG_OBJECT_RECEIVED_SLOT, shc_response_cache_CFG_OBJECT_RECEIVED_SLOT_CALLBACK)
+SIGNAL_SLOT_INTERFACE_CREATE_SLOT(SHC_COMMAND_TABLE_LOADED_SIGNAL, SHC_RESPONSE_CACHE_COMMAND_TABLE_LOADED_SLOT, shc_response_cache_COMMAND_TABLE_LOADED_SLOT_CALLBACK)
+
+// --------------------------------------------------------------------------------
+
+void shc_response_cache_init(void) {
+
+    DEBUG_PASS("shc_response_cache_init()");
+
+    SHC_RESPONSE_CACHE_HIT_SIGNAL_init();
+    SHC_RESPONSE_CACHE_MISS_SIGNAL_init();
+
+    memset(class_list, 0x00, sizeof(class_list));
+    shc_response_cache_clear();
+
+    SHC_RESPONSE_CACHE_CFG_OBJECT_RECEIVED_SLOT_connect();
+    SHC_RESPONSE_CACHE_COMMAND_TABLE_LOADED_SLOT_connect();
+}
+
+void shc_response_cache_clear(void) {
+
+    memset(entry_list, 0x00, sizeof(entry_list));
+
+    u8 board = 0;
+    for ( ; board < SHC_HOST_BOARD_MAX_COUNT ; board++) {
+        invalidate_time_list[board] = shc_event_loop_time_us();
+    }
+}
+
+u32 shc_response_cache_get_ttl_ms(const char* p_key) {
+
+    const SHC_RESPONSE_CACHE_CLASS* p_match = NULL;
+
+    u8 i = 0;
+    for ( ; i < SHC_RESPONSE_CACHE_MAX_CLASSES ; i++) {
+
+        const SHC_RESPONSE_CACHE_CLASS* p_class = &class_list[i];
+
+        if (p_class->prefix_length == 0 || strncmp(p_key, p_class->prefix, p_class->prefix_length) != 0) {
+            continue;
+        }
+
+        if (p_match == NULL || p_class->prefix_length > p_match->prefix_length) {
+            p_match = p_class;
+        }
+    }
+
+    return p_match != NULL ? p_match->ttl_ms : default_ttl_ms;
+}
+
+const u8* shc_response_cache_lookup(u8 board, const char* p_key, const u8* p_command, u16 command_length, u16* p_response_length) {
+
+    SHC_RESPONSE_CACHE_ENTRY* p_entry = shc_response_cache_find(
+        board,
+        shc_response_cache_hash(board, p_command, command_length),
+        p_command,
+        command_length
+    );
+
+    if (p_entry == NULL || shc_event_loop_time_us() >= p_entry->expire_time_us) {
+        DEBUG_TRACE_STR(p_key, "shc_response_cache_lookup() - Miss");
+        SHC_RESPONSE_CACHE_MISS_SIGNAL_send(p_key);
+        return NULL;
+    }
+
+    DEBUG_TRACE_STR(p_key, "shc_response_cache_lookup() - Hit");
+    SHC_RESPONSE_CACHE_HIT_SIGNAL_send(p_key);
+
+    *p_response_length = p_entry->response_length;
+    return p_entry->response;
+}
+
+void shc_response_cache_store(u8 board, const char* p_key, const u8* p_command, u16 command_length, const u8* p_response, u16 response_length, u64 send_time_us) {
+
+    if (board >= SHC_HOST_BOARD_MAX_COUNT ||
+        command_length > SHC_COMMAND_TABLE_MAX_COMMAND_LENGTH ||
+        response_length < 2 ||
+        response_length > SHC_COMMAND_TABLE_MAX_COMMAND_LENGTH ||
+        p_response[1] != SHC_RESPONSE_CACHE_STATUS_OK) {
+
+        return;
+    }
+
+    if (send_time_us <= invalidate_time_list[board]) {
+        // a write-command may have been processed in the meantime
+        DEBUG_TRACE_STR(p_key, "shc_response_cache_store() - Invalidated while in flight");
+        return;
+    }
+
+    u32 ttl_ms = shc_response_cache_get_ttl_ms(p_key);
+
+    if (ttl_ms == 0) {
+        return;
+    }
+
+    u32 hash = shc_response_cache_hash(board, p_command, command_length);
+    SHC_RESPONSE_CACHE_ENTRY* p_entry = shc_response_cache_find(board, hash, p_command, command_length);
+
+    if (p_entry == NULL) {
+        p_entry = shc_response_cache_allocate();
+    }
+
+    p_entry->in_use = 1;
+    p_entry->board = board;
+    p_entry->hash = hash;
+    p_entry->command_length = command_length;
+    p_entry->response_length = response_length;
+    p_entry->expire_time_us = send_time_us + (u64)ttl_ms * 1000ULL;
+
+    memcpy(p_entry->command, p_command, command_length);
+    memcpy(p_entry->response, p_response, response_length);
+    snprintf(p_entry->key, sizeof(p_entry->key), "%s", p_key);
+}
+
+void shc_response_cache_invalidate(u8 board, const char* p_key) {
+
+    if (board >= SHC_HOST_BOARD_MAX_COUNT) {
+        return;
+    }
+
+    invalidate_time_list[board] = shc_event_loop_time_us();
+
+    if (p_key != NULL && shc_response_cache_has_related_report(board, p_key) == 0) {
+        DEBUG_TRACE_STR(p_key, "shc_response_cache_invalidate() - No related report - invalidating board");
+        p_key = NULL;
+    }
+
+    u16 i = 0;
+    for ( ; i < SHC_RESPONSE_CACHE_SIZE ; i++) {
+
+        SHC_RESPONSE_CACHE_ENTRY* p_entry = &entry_list[i];
+
+        if (p_entry->in_use == 0 || p_entry->board != board) {
+            continue;
+        }
+
+        if (p_key == NULL || shc_response_cache_is_related(p_entry->key, p_key)) {
+            p_entry->in_use = 0;
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------
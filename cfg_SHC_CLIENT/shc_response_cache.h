@@ -0,0 +1,172 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_response_cache.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Response-cache of status-queries of the shcClient.
+ *
+ *          Responses of reports (rpt_) are remembered by board and
+ *          command-bytes for a limited time. A report that is requested
+ *          via MQTT or a local client is answered from the cache as
+ *          long as its response is younger than the time-to-live of
+ *          its class. The periodic reports fill the cache but are
+ *          always sent to the control-board.
+ *
+ *          A write-command (cmd_) invalidates the reports it is related
+ *          to by name: cmd_light_01_on invalidates rpt_light_01 and
+ *          rpt_light, but not rpt_light_010. A write-command without
+ *          any related report and every raw frame of a local client
+ *          invalidates all responses of its board. A response of a
+ *          request that was sent before the last invalidation of its
+ *          board is not stored.
+ *
+ *          Only responses with status SHC_RESPONSE_CACHE_STATUS_OK
+ *          are stored. The cache is cleared if the command-table has
+ *          been reloaded.
+ *
+ *          Configuration (configuration-file):
+ *
+ *          - RESPONSE_CACHE_TTL_MS=<time_ms> (default 0)
+ *            time-to-live of all reports without class,
+ *            0 disables the cache for these reports
+ *          - RESPONSE_CACHE_CLASS_<n>=<name-prefix>:<time_ms>
+ *            time-to-live of all reports starting with <name-prefix>,
+ *            the longest matching prefix is used,
+ *            n = 0 ... SHC_RESPONSE_CACHE_MAX_CLASSES - 1
+ *
+ *          The cache must only be accessed from the main-loop.
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_shc_response_cache_
+#define _H_shc_response_cache_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "common/signal_slot_interface.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Maximum number of cached responses
+ *
+ */
+#ifndef SHC_RESPONSE_CACHE_SIZE
+#define SHC_RESPONSE_CACHE_SIZE                     64
+#endif
+
+/**
+ * @brief Maximum number of RESPONSE_CACHE_CLASS_<n> entries
+ *
+ */
+#ifndef SHC_RESPONSE_CACHE_MAX_CLASSES
+#define SHC_RESPONSE_CACHE_MAX_CLASSES              8
+#endif
+
+/**
+ * @brief Status-byte of a response that is stored,
+ * the response is [cmd_id][status][data ...]
+ *
+ */
+#define SHC_RESPONSE_CACHE_STATUS_OK                0x00
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Is send if a status-query was answered from the cache.
+ * Argument is the name of the report as zero-terminated string
+ *
+ */
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(SHC_RESPONSE_CACHE_HIT_SIGNAL)
+
+/**
+ * @brief Is send if a status-query could not be answered from the cache
+ * and is sent to the control-board.
+ * Argument is the name of the report as zero-terminated string
+ *
+ */
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(SHC_RESPONSE_CACHE_MISS_SIGNAL)
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Clears the cache and connects to all needed signals.
+ *
+ */
+void shc_response_cache_init(void);
+
+/**
+ * @brief Removes all responses.
+ *
+ */
+void shc_response_cache_clear(void);
+
+/**
+ * @brief Get the time-to-live of the given report
+ *
+ * @param p_key zero-terminated name of the report
+ * @return time-to-live in milliseconds, 0 if the report is not cached
+ */
+u32 shc_response_cache_get_ttl_ms(const char* p_key);
+
+/**
+ * @brief Searches for a valid response of the given status-query.
+ * Sends SHC_RESPONSE_CACHE_HIT_SIGNAL or SHC_RESPONSE_CACHE_MISS_SIGNAL.
+ *
+ * @param board control-board of the command, see shc_host_board.h
+ * @param p_key zero-terminated name of the report
+ * @param p_command the command including its length-byte
+ * @param command_length number of bytes of p_command
+ * @param p_response_length number of bytes of the response on a hit
+ * @return the response without its length-byte or NULL
+ */
+const u8* shc_response_cache_lookup(u8 board, const char* p_key, const u8* p_command, u16 command_length, u16* p_response_length);
+
+/**
+ * @brief Stores the response of a report. Nothing is stored if the
+ * report is not cached, the response is not successful or the board
+ * was invalidated after the command was sent.
+ *
+ * @param board control-board of the command, see shc_host_board.h
+ * @param p_key zero-terminated name of the report
+ * @param p_command the command including its length-byte
+ * @param command_length number of bytes of p_command
+ * @param p_response the response without its length-byte
+ * @param response_length number of bytes of p_response
+ * @param send_time_us point in time the command was sent to the control-board
+ */
+void shc_response_cache_store(u8 board, const char* p_key, const u8* p_command, u16 command_length, const u8* p_response, u16 response_length, u64 send_time_us);
+
+/**
+ * @brief Removes all responses of the given board that are
+ * related to the given write-command.
+ *
+ * @param board control-board of the command, see shc_host_board.h
+ * @param p_key zero-terminated name of the write-command,
+ * NULL removes all responses of the board
+ */
+void shc_response_cache_invalidate(u8 board, const char* p_key);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_shc_response_cache_
+
+// --------------------------------------------------------------------------------
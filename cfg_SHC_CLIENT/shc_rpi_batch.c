@@ -0,0 +1,144 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_rpi_batch.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Implementation of the batch-frame of the rpi host-protocol
+ *
+ * @see     shc_rpi_batch.h
+ */
+
+#define TRACER_OFF
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "tracer.h"
+
+// --------------------------------------------------------------------------------
+
+#include "cpu.h"
+
+// --------------------------------------------------------------------------------
+
+#include <string.h>
+
+// --------------------------------------------------------------------------------
+
+#include "shc_rpi_batch.h"
+
+// --------------------------------------------------------------------------------
+
+void shc_rpi_batch_start(SHC_RPI_BATCH_BUILDER* p_builder, u8* p_buffer, u16 max_length) {
+
+    p_builder->p_buffer = p_buffer;
+    p_builder->max_length = max_length < SHC_RPI_BATCH_MAX_FRAME_LENGTH ? max_length : SHC_RPI_BATCH_MAX_FRAME_LENGTH;
+    p_builder->length = SHC_RPI_BATCH_HEADER_LENGTH;
+    p_builder->count = 0;
+}
+
+u8 shc_rpi_batch_add(SHC_RPI_BATCH_BUILDER* p_builder, const u8* p_command, u16 length) {
+
+    if (length < 2 || p_command[0] != length - 1) {
+        DEBUG_PASS("shc_rpi_batch_add() - Invalid command");
+        return 0;
+    }
+
+    if (p_builder->length + length > p_builder->max_length || p_builder->count == 0xFF) {
+        return 0;
+    }
+
+    memcpy(p_builder->p_buffer + p_builder->length, p_command, length);
+
+    p_builder->length += length;
+    p_builder->count += 1;
+
+    return 1;
+}
+
+u16 shc_rpi_batch_finish(SHC_RPI_BATCH_BUILDER* p_builder) {
+
+    p_builder->p_buffer[0] = (u8)(p_builder->length - 1);
+    p_builder->p_buffer[1] = SHC_RPI_BATCH_COMMAND_ID;
+    p_builder->p_buffer[2] = p_builder->count;
+
+    DEBUG_TRACE_byte(p_builder->count, "shc_rpi_batch_finish() - Commands:");
+
+    return p_builder->length;
+}
+
+u8 shc_rpi_batch_begin(SHC_RPI_BATCH_ITERATOR* p_iterator, const u8* p_data, u16 length, u8 expected_count) {
+
+    if (length < SHC_RPI_BATCH_HEADER_LENGTH) {
+        DEBUG_PASS("shc_rpi_batch_begin() - Response too short");
+        return 0;
+    }
+
+    if (p_data[0] != SHC_RPI_BATCH_COMMAND_ID || p_data[1] != SHC_RPI_BATCH_STATUS_OK) {
+        DEBUG_TRACE_byte(p_data[1], "shc_rpi_batch_begin() - Batch not supported - status:");
+        return 0;
+    }
+
+    if (p_data[2] > expected_count) {
+        DEBUG_TRACE_byte(p_data[2], "shc_rpi_batch_begin() - Invalid number of responses:");
+        return 0;
+    }
+
+    p_iterator->p_data = p_data;
+    p_iterator->length = length;
+    p_iterator->position = SHC_RPI_BATCH_HEADER_LENGTH;
+    p_iterator->count = p_data[2];
+    p_iterator->index = 0;
+
+    return 1;
+}
+
+u8 shc_rpi_batch_next(SHC_RPI_BATCH_ITERATOR* p_iterator, const u8** pp_response, u16* p_length) {
+
+    if (p_iterator->index == p_iterator->count || p_iterator->position >= p_iterator->length) {
+        return 0;
+    }
+
+    u8 response_length = p_iterator->p_data[p_iterator->position];
+
+    if (p_iterator->position + 1 + response_length > p_iterator->length) {
+        DEBUG_PASS("shc_rpi_batch_next() - Response truncated");
+        return 0;
+    }
+
+    *pp_response = p_iterator->p_data + p_iterator->position + 1;
+    *p_length = response_length;
+
+    p_iterator->position += 1 + response_length;
+    p_iterator->index += 1;
+
+    return 1;
+}
+
+u8 shc_rpi_batch_is_processed(const u8* p_response, u16 length) {
+
+    if (length < 2 || p_response[1] == SHC_RPI_BATCH_STATUS_UNKNOWN_COMMAND) {
+        DEBUG_PASS("shc_rpi_batch_is_processed() - Command not supported inside of a batch");
+        return 0;
+    }
+
+    return 1;
+}
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,185 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_rpi_batch.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Batch-frame of the rpi host-protocol.
+ *
+ *          A batch carries several commands to the control-board
+ *          and returns all of their responses within a single
+ *          transaction. Every command and response inside of a
+ *          batch keeps its own length-byte.
+ *
+ *          Command:
+ *
+ *              [length][CMD_BATCH][count]
+ *              [length_1][cmd_1][arg_1 ...] ... [length_n][cmd_n][arg_n ...]
+ *
+ *          Response (without the length-byte of the frame):
+ *
+ *              [CMD_BATCH][status][count]
+ *              [length_1][cmd_1][status_1][data_1 ...] ...
+ *
+ *          A control-board that does not know CMD_BATCH answers with
+ *          an error-status or not at all. The shcClient then falls
+ *          back to single commands. A command without handler inside
+ *          of a batch is answered with [cmd_n][0xFF], a truncated batch
+ *          has less responses than commands. These commands are sent
+ *          again as single commands.
+ *
+ * @see     cfg_rpi_hat_control_board_v2/cmd_handler_batch.c
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_shc_rpi_batch_
+#define _H_shc_rpi_batch_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Command-id of the batch-frame,
+ * must be the same as CMD_BATCH of the control-board
+ *
+ */
+#ifndef SHC_RPI_BATCH_COMMAND_ID
+#define SHC_RPI_BATCH_COMMAND_ID                    0x20
+#endif
+
+/**
+ * @brief Maximum number of bytes of a batch-frame including its length-byte.
+ * Must not exceed the size of the command-buffer of the control-board.
+ *
+ */
+#ifndef SHC_RPI_BATCH_MAX_FRAME_LENGTH
+#define SHC_RPI_BATCH_MAX_FRAME_LENGTH              64
+#endif
+
+/**
+ * @brief Number of bytes of the header [length][CMD_BATCH][count]
+ *
+ */
+#define SHC_RPI_BATCH_HEADER_LENGTH                 3
+
+/**
+ * @brief Status of a successful batch
+ *
+ */
+#define SHC_RPI_BATCH_STATUS_OK                     0x00
+
+/**
+ * @brief Status of a response inside of a batch
+ * if the command is not supported inside of a batch
+ *
+ */
+#define SHC_RPI_BATCH_STATUS_UNKNOWN_COMMAND        0xFF
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Builds a batch-frame inside of a user-buffer
+ *
+ */
+typedef struct SHC_RPI_BATCH_BUILDER_STRUCT {
+    u8* p_buffer;
+    u16 max_length;
+    u16 length;
+    u8 count;
+} SHC_RPI_BATCH_BUILDER;
+
+/**
+ * @brief Walks through the responses of a batch
+ *
+ */
+typedef struct SHC_RPI_BATCH_ITERATOR_STRUCT {
+    const u8* p_data;
+    u16 length;
+    u16 position;
+    u8 count;
+    u8 index;
+} SHC_RPI_BATCH_ITERATOR;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Starts a new batch-frame
+ *
+ * @param p_builder the builder
+ * @param p_buffer the frame is written into this buffer
+ * @param max_length size of p_buffer, at most SHC_RPI_BATCH_MAX_FRAME_LENGTH is used
+ */
+void shc_rpi_batch_start(SHC_RPI_BATCH_BUILDER* p_builder, u8* p_buffer, u16 max_length);
+
+/**
+ * @brief Adds a command to the batch
+ *
+ * @param p_builder the builder
+ * @param p_command the command including its length-byte, e.g. 020501
+ * @param length number of bytes of p_command
+ * @return 1 if the command was added, 0 if the batch is full
+ */
+u8 shc_rpi_batch_add(SHC_RPI_BATCH_BUILDER* p_builder, const u8* p_command, u16 length);
+
+/**
+ * @brief Completes the header of the batch
+ *
+ * @param p_builder the builder
+ * @return number of bytes of the complete frame
+ */
+u16 shc_rpi_batch_finish(SHC_RPI_BATCH_BUILDER* p_builder);
+
+/**
+ * @brief Checks the header of a batch-response
+ *
+ * @param p_iterator the iterator to initialize
+ * @param p_data the response without the length-byte of the frame
+ * @param length number of bytes of p_data
+ * @param expected_count number of commands of the batch
+ * @return 1 if the response is a valid batch-response, otherwise 0.
+ * The number of responses can be less than expected_count.
+ */
+u8 shc_rpi_batch_begin(SHC_RPI_BATCH_ITERATOR* p_iterator, const u8* p_data, u16 length, u8 expected_count);
+
+/**
+ * @brief Get the next response of the batch
+ *
+ * @param p_iterator the iterator
+ * @param pp_response pointer to the response without its length-byte
+ * @param p_length number of bytes of the response
+ * @return 1 if there was a response, 0 if all responses were read
+ * or the batch is truncated
+ */
+u8 shc_rpi_batch_next(SHC_RPI_BATCH_ITERATOR* p_iterator, const u8** pp_response, u16* p_length);
+
+/**
+ * @brief Checks the status of a single response of a batch
+ *
+ * @param p_response the response without its length-byte, [cmd][status][data ...]
+ * @param length number of bytes of p_response
+ * @return 0 if the command has not been processed inside of the batch,
+ * it has to be sent again as single command, otherwise 1
+ */
+u8 shc_rpi_batch_is_processed(const u8* p_response, u16 length);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_shc_rpi_batch_
+
+// --------------------------------------------------------------------------------
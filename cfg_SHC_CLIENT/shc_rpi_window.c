@@ -0,0 +1,147 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_rpi_window.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Implementation of the windowed mode of the rpi host-protocol
+ *
+ * @see     shc_rpi_window.h
+ */
+
+#define TRACER_OFF
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "tracer.h"
+
+// --------------------------------------------------------------------------------
+
+#include "cpu.h"
+
+// --------------------------------------------------------------------------------
+
+#include <string.h>
+
+// --------------------------------------------------------------------------------
+
+#include "shc_rpi_window.h"
+
+// --------------------------------------------------------------------------------
+
+u8 shc_rpi_window_next_sequence(u8 sequence) {
+
+    sequence += 1;
+
+    if (sequence == 0) {
+        sequence = 1;
+    }
+
+    return sequence;
+}
+
+u16 shc_rpi_window_build_submit(u8* p_buffer, u16 max_length, u8 sequence, const u8* p_command, u16 length) {
+
+    if (max_length > SHC_RPI_WINDOW_MAX_FRAME_LENGTH) {
+        max_length = SHC_RPI_WINDOW_MAX_FRAME_LENGTH;
+    }
+
+    if (length < 2 || p_command[0] != length - 1 || length + 3 > max_length) {
+        DEBUG_PASS("shc_rpi_window_build_submit() - Invalid command");
+        return 0;
+    }
+
+    p_buffer[0] = (u8)(length + 2);
+    p_buffer[1] = SHC_RPI_WINDOW_COMMAND_ID;
+    p_buffer[2] = sequence;
+
+    memcpy(p_buffer + 3, p_command, length);
+
+    return length + 3;
+}
+
+u16 shc_rpi_window_build_poll(u8* p_buffer, u16 max_length) {
+
+    if (max_length < 2) {
+        return 0;
+    }
+
+    p_buffer[0] = 1;
+    p_buffer[1] = SHC_RPI_WINDOW_COMMAND_ID;
+
+    return 2;
+}
+
+u8 shc_rpi_window_begin(SHC_RPI_WINDOW_ITERATOR* p_iterator, const u8* p_data, u16 length) {
+
+    if (length < SHC_RPI_WINDOW_HEADER_LENGTH || p_data[0] != SHC_RPI_WINDOW_COMMAND_ID) {
+        DEBUG_PASS("shc_rpi_window_begin() - Windowed mode not supported");
+        return 0;
+    }
+
+    if (p_data[1] != SHC_RPI_WINDOW_STATUS_OK && p_data[1] != SHC_RPI_WINDOW_STATUS_QUEUE_FULL) {
+        DEBUG_TRACE_byte(p_data[1], "shc_rpi_window_begin() - Windowed mode not supported - status:");
+        return 0;
+    }
+
+    p_iterator->p_data = p_data;
+    p_iterator->length = length;
+    p_iterator->position = SHC_RPI_WINDOW_HEADER_LENGTH;
+    p_iterator->status = p_data[1];
+    p_iterator->count = p_data[2];
+    p_iterator->index = 0;
+
+    return 1;
+}
+
+u8 shc_rpi_window_next(SHC_RPI_WINDOW_ITERATOR* p_iterator, u8* p_sequence, const u8** pp_response, u16* p_length) {
+
+    if (p_iterator->index == p_iterator->count || p_iterator->position + 2 > p_iterator->length) {
+        return 0;
+    }
+
+    u8 sequence = p_iterator->p_data[p_iterator->position];
+    u8 response_length = p_iterator->p_data[p_iterator->position + 1];
+
+    if (p_iterator->position + 2 + response_length > p_iterator->length) {
+        DEBUG_PASS("shc_rpi_window_next() - Response truncated");
+        return 0;
+    }
+
+    *p_sequence = sequence;
+    *pp_response = p_iterator->p_data + p_iterator->position + 2;
+    *p_length = response_length;
+
+    p_iterator->position += 2 + response_length;
+    p_iterator->index += 1;
+
+    return 1;
+}
+
+u8 shc_rpi_window_is_processed(const u8* p_response, u16 length) {
+
+    if (length < 2 || p_response[1] == SHC_RPI_WINDOW_STATUS_UNKNOWN_COMMAND) {
+        DEBUG_PASS("shc_rpi_window_is_processed() - Command not supported inside of a sequence");
+        return 0;
+    }
+
+    return 1;
+}
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,190 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_rpi_window.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Windowed mode of the rpi host-protocol.
+ *
+ *          Every command is tagged with a sequence-number. Responses
+ *          are returned with their sequence-number, in any order,
+ *          together with the acknowledge of the next command or on an
+ *          explicit poll. Several commands can be in flight at the same
+ *          time, so the shcClient does not wait for a response before it
+ *          submits the next command. The control-board executes a command
+ *          while it is submitted, a slow command still delays the
+ *          acknowledge of its own submit.
+ *
+ *          Submit:
+ *
+ *              [length][CMD_SEQUENCE][sequence][length_cmd][cmd][arg ...]
+ *
+ *          Poll:
+ *
+ *              [1][CMD_SEQUENCE]
+ *
+ *          Response (without the length-byte of the frame):
+ *
+ *              [CMD_SEQUENCE][status][count]
+ *              [sequence_1][length_1][cmd_1][status_1][data_1 ...] ...
+ *
+ *          A control-board that does not know CMD_SEQUENCE answers with
+ *          an error-status or not at all. The shcClient then falls
+ *          back to the single-command mode. A command without handler
+ *          inside of a sequence is completed with [cmd][0xFF], only this
+ *          command is sent again as single command.
+ *
+ * @see     cfg_rpi_hat_control_board_v2/cmd_handler_sequence.c
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_shc_rpi_window_
+#define _H_shc_rpi_window_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Command-id of the windowed mode,
+ * must be the same as CMD_SEQUENCE of the control-board
+ *
+ */
+#ifndef SHC_RPI_WINDOW_COMMAND_ID
+#define SHC_RPI_WINDOW_COMMAND_ID                   0x21
+#endif
+
+/**
+ * @brief Maximum number of bytes of a submit-frame including its length-byte.
+ * A command of 64 bytes and the header of the submit-frame must fit.
+ *
+ */
+#ifndef SHC_RPI_WINDOW_MAX_FRAME_LENGTH
+#define SHC_RPI_WINDOW_MAX_FRAME_LENGTH             67
+#endif
+
+/**
+ * @brief Number of bytes of the response header [CMD_SEQUENCE][status][count]
+ *
+ */
+#define SHC_RPI_WINDOW_HEADER_LENGTH                3
+
+/**
+ * @brief The submitted command was accepted, or nothing was submitted
+ *
+ */
+#define SHC_RPI_WINDOW_STATUS_OK                    0x00
+
+/**
+ * @brief The submitted command was rejected because the queue of the
+ * control-board is full. The command has to be submitted again.
+ *
+ */
+#define SHC_RPI_WINDOW_STATUS_QUEUE_FULL            0x02
+
+/**
+ * @brief Status of a completed response
+ * if the command is not supported inside of a sequence
+ *
+ */
+#define SHC_RPI_WINDOW_STATUS_UNKNOWN_COMMAND       0xFF
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Walks through the completed responses of a windowed response
+ *
+ */
+typedef struct SHC_RPI_WINDOW_ITERATOR_STRUCT {
+    const u8* p_data;
+    u16 length;
+    u16 position;
+    u8 status;
+    u8 count;
+    u8 index;
+} SHC_RPI_WINDOW_ITERATOR;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Get the sequence-number that follows the given one.
+ * 0 is never used as sequence-number.
+ *
+ * @param sequence the actual sequence-number
+ * @return the next sequence-number
+ */
+u8 shc_rpi_window_next_sequence(u8 sequence);
+
+/**
+ * @brief Builds a submit-frame
+ *
+ * @param p_buffer the frame is written into this buffer
+ * @param max_length size of p_buffer
+ * @param sequence sequence-number of the command
+ * @param p_command the command including its length-byte
+ * @param length number of bytes of p_command
+ * @return number of bytes of the frame, 0 if the command does not fit
+ */
+u16 shc_rpi_window_build_submit(u8* p_buffer, u16 max_length, u8 sequence, const u8* p_command, u16 length);
+
+/**
+ * @brief Builds a poll-frame
+ *
+ * @param p_buffer the frame is written into this buffer
+ * @param max_length size of p_buffer
+ * @return number of bytes of the frame, 0 if p_buffer is too small
+ */
+u16 shc_rpi_window_build_poll(u8* p_buffer, u16 max_length);
+
+/**
+ * @brief Checks the header of a windowed response
+ *
+ * @param p_iterator the iterator to initialize
+ * @param p_data the response without the length-byte of the frame
+ * @param length number of bytes of p_data
+ * @return 1 if the response is a valid windowed response, otherwise 0
+ */
+u8 shc_rpi_window_begin(SHC_RPI_WINDOW_ITERATOR* p_iterator, const u8* p_data, u16 length);
+
+/**
+ * @brief Get the next completed response
+ *
+ * @param p_iterator the iterator
+ * @param p_sequence sequence-number of the completed command
+ * @param pp_response pointer to the response without its length-byte
+ * @param p_length number of bytes of the response
+ * @return 1 if there was a response, 0 if all responses were read
+ * or the frame is truncated
+ */
+u8 shc_rpi_window_next(SHC_RPI_WINDOW_ITERATOR* p_iterator, u8* p_sequence, const u8** pp_response, u16* p_length);
+
+/**
+ * @brief Checks the status of a single completed response
+ *
+ * @param p_response the response without sequence and length, [cmd][status][data ...]
+ * @param length number of bytes of p_response
+ * @return 0 if the command has not been processed inside of the sequence,
+ * it has to be sent again as single command, otherwise 1
+ */
+u8 shc_rpi_window_is_processed(const u8* p_response, u16 length);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_shc_rpi_window_
+
+// --------------------------------------------------------------------------------
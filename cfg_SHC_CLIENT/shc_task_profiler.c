@@ -0,0 +1,313 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_task_profiler.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Implementation of the runtime profiling of the main-loop tasks
+ *
+ * @see     shc_task_profiler.h
+ */
+
+#define TRACER_OFF
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "tracer.h"
+
+// --------------------------------------------------------------------------------
+
+#include "cpu.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/signalfd.h>
+
+// --------------------------------------------------------------------------------
+
+#include "shc_event_loop.h"
+#include "shc_task_profiler.h"
+
+// --------------------------------------------------------------------------------
+
+#if SHC_TASK_PROFILER_ENABLED
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Names of the tasks, in the order of SHC_TASK_PROFILER_TASK_xxx
+ *
+ */
+static const char* task_name_list[SHC_TASK_PROFILER_NUM_TASKS] = {
+    "framework",
+    "cfg_reload",
+    "event_line",
+    "host_board",
+    "msg_executer",
+    "cli_executer",
+    "mqtt",
+    "metrics",
+    "command_socket",
+    "statistic",
+    "fd_callback"
+};
+
+static SHC_TASK_PROFILER_STATISTIC statistic_list[SHC_TASK_PROFILER_NUM_TASKS];
+
+/**
+ * @brief Next requested run of every task, 0 if the task has not requested a run
+ *
+ */
+static u64 due_time_list[SHC_TASK_PROFILER_NUM_TASKS];
+
+/**
+ * @brief The task that is running at the moment
+ *
+ */
+static u8 active_task = SHC_TASK_PROFILER_TASK_NONE;
+static u64 active_start_us = 0;
+
+/**
+ * @brief Earliest deadline requested by the running task
+ *
+ */
+static u64 active_deadline_us = 0;
+
+/**
+ * @brief Receives SIGUSR1, watched by the event-loop
+ *
+ */
+static int signal_handle = -1;
+static u8 signal_registered = 0;
+
+/**
+ * @brief SIGUSR1 was received, reported by shc_task_profiler_task()
+ *
+ */
+static u8 dump_pending = 0;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Is called by the event-loop if SIGUSR1 was received.
+ * Several signals in a row are reported once.
+ *
+ * @param fd the signalfd
+ * @param p_context not used
+ */
+static void shc_task_profiler_signal_callback(int fd, void* p_context) {
+
+    (void) p_context;
+
+    struct signalfd_siginfo signal_info;
+
+    while (read(fd, &signal_info, sizeof(signal_info)) == sizeof(signal_info)) {
+        DEBUG_TRACE_long(signal_info.ssi_pid, "shc_task_profiler_signal_callback() - SIGUSR1 from pid:");
+        dump_pending = 1;
+    }
+}
+
+// --------------------------------------------------------------------------------
+
+void shc_task_profiler_init(void) {
+
+    DEBUG_PASS("shc_task_profiler_init()");
+
+    memset(statistic_list, 0x00, sizeof(statistic_list));
+    memset(due_time_list, 0x00, sizeof(due_time_list));
+
+    active_task = SHC_TASK_PROFILER_TASK_NONE;
+    dump_pending = 0;
+
+    sigset_t signal_mask;
+    sigemptyset(&signal_mask);
+    sigaddset(&signal_mask, SIGUSR1);
+
+    // inherited by every thread that is created afterwards
+    pthread_sigmask(SIG_BLOCK, &signal_mask, NULL);
+
+    signal_handle = signalfd(-1, &signal_mask, SFD_NONBLOCK | SFD_CLOEXEC);
+    if (signal_handle < 0) {
+        DEBUG_PASS("shc_task_profiler_init() - Create signalfd has FAILED !!! ---");
+    }
+}
+
+void shc_task_profiler_deinit(void) {
+
+    DEBUG_PASS("shc_task_profiler_deinit()");
+
+    if (signal_handle < 0) {
+        return;
+    }
+
+    if (signal_registered) {
+        shc_event_loop_remove_fd(signal_handle);
+        signal_registered = 0;
+    }
+
+    close(signal_handle);
+    signal_handle = -1;
+}
+
+u8 shc_task_profiler_task(void) {
+
+    if (signal_handle >= 0 && signal_registered == 0) {
+
+        // the event-loop is initialized after the signalfd was created
+        if (shc_event_loop_add_fd(signal_handle, shc_task_profiler_signal_callback, NULL)) {
+            signal_registered = 1;
+        } else {
+            shc_task_profiler_signal_callback(signal_handle, NULL);
+        }
+    }
+
+    if (dump_pending == 0) {
+        return 0;
+    }
+
+    dump_pending = 0;
+    return 1;
+}
+
+void shc_task_profiler_begin(u8 task_id) {
+
+    if (task_id >= SHC_TASK_PROFILER_NUM_TASKS || active_task != SHC_TASK_PROFILER_TASK_NONE) {
+        return;
+    }
+
+    u64 now_us = shc_event_loop_time_us();
+    u64 due_us = due_time_list[task_id];
+
+    if (due_us != 0 && now_us >= due_us) {
+
+        SHC_TASK_PROFILER_STATISTIC* p_statistic = &statistic_list[task_id];
+        u64 lateness_us = now_us - due_us;
+
+        p_statistic->due_count += 1;
+        p_statistic->lateness_sum_us += lateness_us;
+
+        if (lateness_us > p_statistic->lateness_max_us) {
+            p_statistic->lateness_max_us = (u32)lateness_us;
+        }
+
+        due_time_list[task_id] = 0;
+    }
+
+    active_task = task_id;
+    active_start_us = now_us;
+    active_deadline_us = 0;
+}
+
+void shc_task_profiler_end(u8 task_id) {
+
+    if (task_id != active_task) {
+        return;
+    }
+
+    SHC_TASK_PROFILER_STATISTIC* p_statistic = &statistic_list[task_id];
+    u64 runtime_us = shc_event_loop_time_us() - active_start_us;
+
+    p_statistic->count += 1;
+    p_statistic->runtime_sum_us += runtime_us;
+
+    if (runtime_us > p_statistic->runtime_max_us) {
+        p_statistic->runtime_max_us = (u32)runtime_us;
+    }
+
+    // a task that did not request a new deadline is still due at the old one
+    if (active_deadline_us != 0) {
+        due_time_list[task_id] = active_deadline_us;
+    }
+
+    active_task = SHC_TASK_PROFILER_TASK_NONE;
+}
+
+void shc_task_profiler_deadline(u64 deadline_us) {
+
+    if (active_task == SHC_TASK_PROFILER_TASK_NONE) {
+        return;
+    }
+
+    if (active_deadline_us == 0 || deadline_us < active_deadline_us) {
+        active_deadline_us = deadline_us;
+    }
+}
+
+void shc_task_profiler_get_statistic(u8 task_id, SHC_TASK_PROFILER_STATISTIC* p_statistic) {
+
+    if (p_statistic == NULL) {
+        return;
+    }
+
+    if (task_id >= SHC_TASK_PROFILER_NUM_TASKS) {
+        memset(p_statistic, 0x00, sizeof(SHC_TASK_PROFILER_STATISTIC));
+        return;
+    }
+
+    memcpy(p_statistic, &statistic_list[task_id], sizeof(SHC_TASK_PROFILER_STATISTIC));
+}
+
+const char* shc_task_profiler_get_name(u8 task_id) {
+
+    if (task_id >= SHC_TASK_PROFILER_NUM_TASKS) {
+        return "unknown";
+    }
+
+    return task_name_list[task_id];
+}
+
+void shc_task_profiler_format(u8 task_id, char* p_buffer, u16 buffer_size) {
+
+    if (p_buffer == NULL || buffer_size == 0) {
+        return;
+    }
+
+    SHC_TASK_PROFILER_STATISTIC task_statistic;
+    shc_task_profiler_get_statistic(task_id, &task_statistic);
+
+    u32 runtime_avg_us = 0;
+    if (task_statistic.count != 0) {
+        runtime_avg_us = (u32)(task_statistic.runtime_sum_us / task_statistic.count);
+    }
+
+    u32 lateness_avg_us = 0;
+    if (task_statistic.due_count != 0) {
+        lateness_avg_us = (u32)(task_statistic.lateness_sum_us / task_statistic.due_count);
+    }
+
+    snprintf(p_buffer, buffer_size,
+        "%-14s calls:%u total:%llums avg:%uus max:%uus - due:%u late avg:%uus max:%uus",
+        shc_task_profiler_get_name(task_id),
+        task_statistic.count,
+        (unsigned long long)(task_statistic.runtime_sum_us / 1000ULL),
+        runtime_avg_us, task_statistic.runtime_max_us,
+        task_statistic.due_count, lateness_avg_us, task_statistic.lateness_max_us
+    );
+}
+
+// --------------------------------------------------------------------------------
+
+#endif // SHC_TASK_PROFILER_ENABLED
+
+// --------------------------------------------------------------------------------
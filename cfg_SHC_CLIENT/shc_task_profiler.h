@@ -0,0 +1,233 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_task_profiler.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Runtime profiling of the tasks of the shcClient main-loop.
+ *
+ *          Every task that is called by the main-loop is wrapped by
+ *          SHC_TASK_PROFILER_RUN(). For every task the number of calls,
+ *          the total and the maximum run-time are measured with the
+ *          monotonic clock. The framework-tasks of mcu_task_controller
+ *          are measured as a single task, the callbacks of readable
+ *          file-descriptors of the event-loop as another one.
+ *
+ *          Lateness: a task that requests its next run via
+ *          shc_event_loop_set_deadline() is due at this deadline.
+ *          On its next call after the deadline, the time between the
+ *          deadline and the start of the call is its lateness.
+ *
+ *          The statistic is written into the log-file on SIGUSR1 and,
+ *          if the shcClient was started with -stats, also printed on
+ *          stdout on SIGUSR1 and on exit.
+ *
+ *          SIGUSR1 is received via signalfd and handled by the main-loop.
+ *          shc_task_profiler_init() blocks SIGUSR1 and must be called
+ *          before any thread is created.
+ *
+ *          Build with SHC_TASK_PROFILER_ENABLED=0 to remove the profiler
+ *          completely, SHC_TASK_PROFILER_RUN() then only calls the task.
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_shc_task_profiler_
+#define _H_shc_task_profiler_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief 1 builds the profiler, 0 removes it completely
+ *
+ */
+#ifndef SHC_TASK_PROFILER_ENABLED
+#define SHC_TASK_PROFILER_ENABLED                   1
+#endif
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Tasks of the main-loop
+ *
+ */
+#define SHC_TASK_PROFILER_TASK_FRAMEWORK            0
+#define SHC_TASK_PROFILER_TASK_CFG_RELOAD           1
+#define SHC_TASK_PROFILER_TASK_EVENT_LINE           2
+#define SHC_TASK_PROFILER_TASK_HOST_BOARD           3
+#define SHC_TASK_PROFILER_TASK_MSG_EXECUTER         4
+#define SHC_TASK_PROFILER_TASK_CLI_EXECUTER         5
+#define SHC_TASK_PROFILER_TASK_MQTT_INTERFACE       6
+#define SHC_TASK_PROFILER_TASK_METRICS              7
+#define SHC_TASK_PROFILER_TASK_COMMAND_SOCKET       8
+#define SHC_TASK_PROFILER_TASK_STATISTIC            9
+
+/**
+ * @brief Callbacks of readable file-descriptors,
+ * called from inside of shc_event_loop_wait()
+ *
+ */
+#define SHC_TASK_PROFILER_TASK_FD_CALLBACK          10
+
+#define SHC_TASK_PROFILER_NUM_TASKS                 11
+
+/**
+ * @brief No task is running
+ *
+ */
+#define SHC_TASK_PROFILER_TASK_NONE                 0xFF
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Statistic of a single task since shc_task_profiler_init()
+ *
+ */
+typedef struct SHC_TASK_PROFILER_STATISTIC_STRUCT {
+
+    /**
+     * @brief Number of calls
+     *
+     */
+    u32 count;
+
+    /**
+     * @brief Sum and maximum of the run-time of all calls in microseconds
+     *
+     */
+    u64 runtime_sum_us;
+    u32 runtime_max_us;
+
+    /**
+     * @brief Number of calls after a requested deadline
+     *
+     */
+    u32 due_count;
+
+    /**
+     * @brief Sum and maximum of the lateness of all calls
+     * after a requested deadline in microseconds
+     *
+     */
+    u64 lateness_sum_us;
+    u32 lateness_max_us;
+
+} SHC_TASK_PROFILER_STATISTIC;
+
+// --------------------------------------------------------------------------------
+
+#if SHC_TASK_PROFILER_ENABLED
+
+/**
+ * @brief Measures a single call of a task of the main-loop
+ *
+ * @param task_id one of SHC_TASK_PROFILER_TASK_xxx
+ * @param call the call of the task, e.g. shc_host_board_task()
+ */
+#define SHC_TASK_PROFILER_RUN(task_id, call)                \
+    do {                                                    \
+        shc_task_profiler_begin(task_id);                   \
+        call;                                               \
+        shc_task_profiler_end(task_id);                     \
+    } while (0)
+
+/**
+ * @brief Clears the statistic, blocks SIGUSR1 and creates its signalfd.
+ * Must be called before any other thread is created.
+ *
+ */
+void shc_task_profiler_init(void);
+
+/**
+ * @brief Closes the signalfd
+ *
+ */
+void shc_task_profiler_deinit(void);
+
+/**
+ * @brief Registers the signalfd at the event-loop. Must be called
+ * from the main-loop.
+ *
+ * @return 1 if SIGUSR1 was received since the last call, otherwise 0
+ */
+u8 shc_task_profiler_task(void);
+
+/**
+ * @brief Starts the measurement of a task
+ *
+ * @param task_id one of SHC_TASK_PROFILER_TASK_xxx
+ */
+void shc_task_profiler_begin(u8 task_id);
+
+/**
+ * @brief Stops the measurement of the task that was started by
+ * shc_task_profiler_begin()
+ *
+ * @param task_id one of SHC_TASK_PROFILER_TASK_xxx
+ */
+void shc_task_profiler_end(u8 task_id);
+
+/**
+ * @brief Remembers the deadline that was requested by the actual task.
+ * Is called by shc_event_loop_set_deadline().
+ *
+ * @param deadline_us point in time of the requested run of the actual task
+ */
+void shc_task_profiler_deadline(u64 deadline_us);
+
+/**
+ * @brief Get the statistic of a task
+ *
+ * @param task_id one of SHC_TASK_PROFILER_TASK_xxx
+ * @param p_statistic the statistic is copied into this structure
+ */
+void shc_task_profiler_get_statistic(u8 task_id, SHC_TASK_PROFILER_STATISTIC* p_statistic);
+
+/**
+ * @brief Get the name of a task
+ *
+ * @param task_id one of SHC_TASK_PROFILER_TASK_xxx
+ * @return zero-terminated name of the task
+ */
+const char* shc_task_profiler_get_name(u8 task_id);
+
+/**
+ * @brief Writes the statistic of a task as a single line
+ *
+ * @param task_id one of SHC_TASK_PROFILER_TASK_xxx
+ * @param p_buffer the line is written into this buffer
+ * @param buffer_size size of p_buffer
+ */
+void shc_task_profiler_format(u8 task_id, char* p_buffer, u16 buffer_size);
+
+#else
+
+#define SHC_TASK_PROFILER_RUN(task_id, call)        call
+#define shc_task_profiler_init()                    do { } while (0)
+#define shc_task_profiler_deinit()                  do { } while (0)
+#define shc_task_profiler_task()                    0
+#define shc_task_profiler_deadline(deadline_us)     do { } while (0)
+
+#endif // SHC_TASK_PROFILER_ENABLED
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_shc_task_profiler_
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,260 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    benchmark_shc_event_loop.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Compares the main-loop of the shcClient up to version 5.12
+ *          (spinning without any sleep) with the event-loop.
+ *
+ *          For every scheduling variant two phases are measured:
+ *
+ *          - idle: nothing happens, the CPU-time of the process is
+ *            measured over BENCHMARK_PHASE_MS
+ *
+ *          - wakeup: a second thread requests work every
+ *            BENCHMARK_WAKEUP_INTERVAL_MS, like the paho-thread does
+ *            on a received message. The time from the request until
+ *            the main-loop dispatches the work is measured.
+ *
+ *          The tasks of the framework are not part of the benchmark,
+ *          the main-loop only checks for the requested work.
+ *
+ *              make -f module_tests.mk benchmark
+ *
+ * @see     shc_event_loop.h
+ */
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/resource.h>
+
+// --------------------------------------------------------------------------------
+
+#include "shc_event_loop.h"
+
+// --------------------------------------------------------------------------------
+
+#define BENCHMARK_PHASE_MS                          3000
+#define BENCHMARK_WAKEUP_INTERVAL_MS                10
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief The main-loop of version 5.12
+ *
+ */
+#define BENCHMARK_VARIANT_SPIN                      0
+
+/**
+ * @brief SCHEDULE_MODE=EVENT without activity
+ *
+ */
+#define BENCHMARK_VARIANT_EVENT                     1
+
+/**
+ * @brief SCHEDULE_MODE=EVENT while a command is in progress,
+ * the main-loop is polled every SHC_EVENT_LOOP_BUSY_INTERVAL_US
+ *
+ */
+#define BENCHMARK_VARIANT_EVENT_ACTIVITY            2
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Result of a single variant
+ *
+ */
+typedef struct BENCHMARK_RESULT_STRUCT {
+    u32 idle_cpu_permille;
+    u32 loop_count;
+    u32 wakeup_count;
+    u32 latency_avg_us;
+    u32 latency_max_us;
+} BENCHMARK_RESULT;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Time of the last work-request of the waker-thread, 0 if there is none
+ *
+ */
+static u64 request_time_us = 0;
+
+static u8 waker_running = 0;
+
+// --------------------------------------------------------------------------------
+
+static u64 benchmark_cpu_time_us(void) {
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+
+    return    (u64)usage.ru_utime.tv_sec * 1000000ULL + (u64)usage.ru_utime.tv_usec
+            + (u64)usage.ru_stime.tv_sec * 1000000ULL + (u64)usage.ru_stime.tv_usec;
+}
+
+static void* benchmark_waker_thread(void* p_argument) {
+
+    u8 variant = (u8)(uintptr_t)p_argument;
+
+    struct timespec interval;
+    interval.tv_sec = 0;
+    interval.tv_nsec = BENCHMARK_WAKEUP_INTERVAL_MS * 1000000L;
+
+    while (__atomic_load_n(&waker_running, __ATOMIC_ACQUIRE)) {
+
+        nanosleep(&interval, NULL);
+
+        u64 expected = 0;
+        __atomic_compare_exchange_n(&request_time_us, &expected, shc_event_loop_time_us(), 0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+
+        if (variant != BENCHMARK_VARIANT_SPIN) {
+            shc_event_loop_wakeup();
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Runs the main-loop of the given variant for BENCHMARK_PHASE_MS
+ *
+ * @param variant one of BENCHMARK_VARIANT_xxx
+ * @param p_result the latency of the dispatched work-requests is added
+ * @return number of loop-cycles
+ */
+static u32 benchmark_main_loop(u8 variant, BENCHMARK_RESULT* p_result) {
+
+    u64 end_us = shc_event_loop_time_us() + BENCHMARK_PHASE_MS * 1000ULL;
+    u32 loop_count = 0;
+
+    for (;;) {
+
+        u64 now_us = shc_event_loop_time_us();
+        if (now_us >= end_us) {
+            break;
+        }
+
+        loop_count += 1;
+
+        u64 requested_us = __atomic_exchange_n(&request_time_us, 0, __ATOMIC_ACQ_REL);
+        if (requested_us != 0) {
+
+            u64 latency_us = now_us > requested_us ? now_us - requested_us : 0;
+
+            p_result->wakeup_count += 1;
+            p_result->latency_avg_us += (u32)latency_us;
+
+            if ((u32)latency_us > p_result->latency_max_us) {
+                p_result->latency_max_us = (u32)latency_us;
+            }
+        }
+
+        if (variant == BENCHMARK_VARIANT_SPIN) {
+            continue;
+        }
+
+        if (variant == BENCHMARK_VARIANT_EVENT_ACTIVITY) {
+            shc_event_loop_activity();
+        }
+
+        shc_event_loop_wait();
+    }
+
+    return loop_count;
+}
+
+static void benchmark_run(u8 variant, BENCHMARK_RESULT* p_result) {
+
+    memset(p_result, 0x00, sizeof(BENCHMARK_RESULT));
+
+    shc_event_loop_init();
+    shc_event_loop_set_mode(variant == BENCHMARK_VARIANT_SPIN ? SHC_EVENT_LOOP_MODE_POLLING : SHC_EVENT_LOOP_MODE_EVENT);
+
+    // idle
+    BENCHMARK_RESULT idle_result;
+    memset(&idle_result, 0x00, sizeof(idle_result));
+
+    u64 start_us = shc_event_loop_time_us();
+    u64 start_cpu_us = benchmark_cpu_time_us();
+
+    p_result->loop_count = benchmark_main_loop(variant, &idle_result);
+
+    u64 wall_us = shc_event_loop_time_us() - start_us;
+    u64 cpu_us = benchmark_cpu_time_us() - start_cpu_us;
+
+    p_result->idle_cpu_permille = (u32)(cpu_us * 1000ULL / wall_us);
+
+    // wakeup
+    pthread_t waker;
+    __atomic_store_n(&request_time_us, 0, __ATOMIC_RELEASE);
+    __atomic_store_n(&waker_running, 1, __ATOMIC_RELEASE);
+    pthread_create(&waker, NULL, benchmark_waker_thread, (void*)(uintptr_t)variant);
+
+    benchmark_main_loop(variant, p_result);
+
+    __atomic_store_n(&waker_running, 0, __ATOMIC_RELEASE);
+    pthread_join(waker, NULL);
+
+    if (p_result->wakeup_count != 0) {
+        p_result->latency_avg_us /= p_result->wakeup_count;
+    }
+
+    shc_event_loop_deinit();
+}
+
+static void benchmark_print(const char* p_name, const BENCHMARK_RESULT* p_result) {
+
+    printf("%-24s %4u.%u %% %12u %9u %9u us %9u us\n",
+        p_name,
+        p_result->idle_cpu_permille / 10, p_result->idle_cpu_permille % 10,
+        p_result->loop_count,
+        p_result->wakeup_count,
+        p_result->latency_avg_us,
+        p_result->latency_max_us
+    );
+}
+
+// --------------------------------------------------------------------------------
+
+int main(void) {
+
+    printf("phase: %u ms, wakeup-interval: %u ms\n\n", BENCHMARK_PHASE_MS, BENCHMARK_WAKEUP_INTERVAL_MS);
+    printf("%-24s %8s %12s %9s %12s %12s\n", "variant", "idle-cpu", "idle-loops", "wakeups", "latency-avg", "latency-max");
+
+    BENCHMARK_RESULT result;
+
+    benchmark_run(BENCHMARK_VARIANT_SPIN, &result);
+    benchmark_print("spin (<= 5.12)", &result);
+
+    benchmark_run(BENCHMARK_VARIANT_EVENT, &result);
+    benchmark_print("EVENT", &result);
+
+    benchmark_run(BENCHMARK_VARIANT_EVENT_ACTIVITY, &result);
+    benchmark_print("EVENT + activity-hold", &result);
+
+    return 0;
+}
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,45 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    benchmark_shc_json_tokenizer.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Runs the receive-path benchmark of shcLoadTest -json_benchmark
+ *          without the framework
+ *
+ *              make -f module_tests.mk benchmark
+ *
+ * @see     ../../cfg_SHC_LOADTEST/shc_json_benchmark.h
+ */
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "../../cfg_SHC_LOADTEST/shc_json_benchmark.h"
+
+// --------------------------------------------------------------------------------
+
+#define BENCHMARK_NUM_MESSAGES                      1000000
+
+// --------------------------------------------------------------------------------
+
+int main(void) {
+    return shc_json_benchmark_run(BENCHMARK_NUM_MESSAGES) ? 0 : 1;
+}
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,101 @@
+#-----------------------------------------------------------------------------
+#       Module-tests of the shcClient
+#-----------------------------------------------------------------------------
+# The modules are built without the framework, against the dummy-headers
+# of ./stub. stub/config.h is included first, it uses the include-guard
+# of ../config.h, so the configuration of the framework is never read.
+#
+#   make -f module_tests.mk             builds and runs all module-tests
+#   make -f module_tests.mk benchmark   builds and runs all benchmarks
+#   make -f module_tests.mk clean
+#-----------------------------------------------------------------------------
+
+CC          ?= gcc
+BUILD_DIR   ?= module_tests_build
+
+CFLAGS      = -std=gnu99 -Wall -Wextra -O2 -g -pthread
+CFLAGS      += -include stub/config.h
+CFLAGS      += -Istub -I. -I..
+LDLIBS      = -pthread -lrt
+
+#-----------------------------------------------------------------------------
+
+STUB_SRCS   = stub/unittest_stub.c
+
+#-----------------------------------------------------------------------------
+
+UNITTESTS   =
+UNITTESTS   += shc_log_interface
+UNITTESTS   += shc_command_table
+UNITTESTS   += shc_cli_executer
+UNITTESTS   += shc_mqtt_interface
+UNITTESTS   += shc_json_tokenizer
+UNITTESTS   += shc_rpi_batch
+UNITTESTS   += shc_rpi_window
+
+unittest_shc_log_interface_SRCS     = ../shc_log_interface.c
+
+unittest_shc_command_table_SRCS     = ../shc_command_table.c
+unittest_shc_command_table_SRCS     += ../shc_event_matcher.c
+unittest_shc_command_table_SRCS     += ../shc_event_loop.c
+unittest_shc_command_table_SRCS     += ../shc_task_profiler.c
+
+unittest_shc_cli_executer_SRCS      = ../shc_cli_executer.c
+unittest_shc_cli_executer_SRCS      += ../shc_event_loop.c
+unittest_shc_cli_executer_SRCS      += ../shc_task_profiler.c
+
+unittest_shc_mqtt_interface_SRCS    = ../shc_mqtt_interface.c
+unittest_shc_mqtt_interface_SRCS    += ../shc_json_tokenizer.c
+unittest_shc_mqtt_interface_SRCS    += ../shc_event_loop.c
+unittest_shc_mqtt_interface_SRCS    += ../shc_task_profiler.c
+unittest_shc_mqtt_interface_SRCS    += stub/mqtt_client_stub.c
+
+unittest_shc_json_tokenizer_SRCS    = ../shc_json_tokenizer.c
+
+unittest_shc_rpi_batch_SRCS         = ../shc_rpi_batch.c
+
+unittest_shc_rpi_window_SRCS        = ../shc_rpi_window.c
+
+#-----------------------------------------------------------------------------
+
+BENCHMARKS  =
+BENCHMARKS  += shc_event_loop
+BENCHMARKS  += shc_json_tokenizer
+
+benchmark_shc_event_loop_SRCS       = ../shc_event_loop.c
+benchmark_shc_event_loop_SRCS       += ../shc_task_profiler.c
+
+benchmark_shc_json_tokenizer_SRCS   = ../shc_json_tokenizer.c
+benchmark_shc_json_tokenizer_SRCS   += ../../cfg_SHC_LOADTEST/shc_json_benchmark.c
+
+#-----------------------------------------------------------------------------
+
+UNITTEST_PROGRAMS = $(addprefix $(BUILD_DIR)/unittest_,$(UNITTESTS))
+
+all: $(UNITTEST_PROGRAMS)
+	@for program in $(UNITTEST_PROGRAMS) ; do \
+		echo "--- $$program" ; \
+		$$program || exit 1 ; \
+	done
+
+BENCHMARK_PROGRAMS = $(addprefix $(BUILD_DIR)/benchmark_,$(BENCHMARKS))
+
+benchmark: $(BENCHMARK_PROGRAMS)
+	@for program in $(BENCHMARK_PROGRAMS) ; do \
+		echo "--- $$program" ; \
+		$$program || exit 1 ; \
+	done
+
+.SECONDEXPANSION:
+$(BUILD_DIR)/unittest_%: unittest_%.c $$(unittest_%_SRCS) $(STUB_SRCS) unittest.h $$(wildcard ../*.h)
+	@mkdir -p $(BUILD_DIR)
+	$(CC) $(CFLAGS) -o $@ unittest_$*.c $(unittest_$*_SRCS) $(STUB_SRCS) $(LDLIBS)
+
+clean:
+	rm -rf $(BUILD_DIR)
+
+$(BUILD_DIR)/benchmark_%: benchmark_%.c $$(benchmark_%_SRCS) $(STUB_SRCS) $$(wildcard ../*.h)
+	@mkdir -p $(BUILD_DIR)
+	$(CC) $(CFLAGS) -o $@ benchmark_$*.c $(benchmark_$*_SRCS) $(STUB_SRCS) $(LDLIBS)
+
+.PHONY: all benchmark clean
@@ -0,0 +1,111 @@
+#ifndef   _MQTTCLIENT_H_
+#define   _MQTTCLIENT_H_
+
+//-------------------------------------------------------------------------
+
+// This is a dummy-file only to enable the module-tests without the
+// paho-library. It declares the part of the paho-API that is used by
+// shc_mqtt_interface.c, the fake client is implemented in
+// mqtt_client_stub.c and controlled by the unittest_mqtt_xxx() functions.
+
+//-------------------------------------------------------------------------
+
+#include "config.h"
+
+//-------------------------------------------------------------------------
+
+#define MQTTCLIENT_SUCCESS                  0
+#define MQTTCLIENT_FAILURE                  -1
+#define MQTTCLIENT_DISCONNECTED             -3
+#define MQTTCLIENT_PERSISTENCE_NONE         1
+
+//-------------------------------------------------------------------------
+
+typedef void* MQTTClient;
+typedef int MQTTClient_deliveryToken;
+
+typedef struct {
+    int payloadlen;
+    void* payload;
+    int qos;
+    int retained;
+    int dup;
+    int msgid;
+} MQTTClient_message;
+
+typedef struct {
+    int keepAliveInterval;
+    int cleansession;
+    int reliable;
+    const char* username;
+    const char* password;
+    int connectTimeout;
+    int retryInterval;
+    int MQTTVersion;
+    int maxInflightMessages;
+} MQTTClient_connectOptions;
+
+#define MQTTClient_connectOptions_initializer { 60, 1, 1, NULL, NULL, 30, 0, 0, -1 }
+
+typedef void MQTTClient_connectionLost(void* context, char* cause);
+typedef int MQTTClient_messageArrived(void* context, char* topicName, int topicLen, MQTTClient_message* message);
+typedef void MQTTClient_deliveryComplete(void* context, MQTTClient_deliveryToken dt);
+
+//-------------------------------------------------------------------------
+
+int MQTTClient_create(MQTTClient* handle, const char* serverURI, const char* clientId, int persistence_type, void* persistence_context);
+int MQTTClient_setCallbacks(MQTTClient handle, void* context, MQTTClient_connectionLost* cl, MQTTClient_messageArrived* ma, MQTTClient_deliveryComplete* dc);
+int MQTTClient_connect(MQTTClient handle, MQTTClient_connectOptions* options);
+int MQTTClient_disconnect(MQTTClient handle, int timeout);
+int MQTTClient_isConnected(MQTTClient handle);
+int MQTTClient_subscribe(MQTTClient handle, const char* topic, int qos);
+int MQTTClient_unsubscribe(MQTTClient handle, const char* topic);
+int MQTTClient_publish(MQTTClient handle, const char* topicName, int payloadlen, const void* payload, int qos, int retained, MQTTClient_deliveryToken* dt);
+void MQTTClient_freeMessage(MQTTClient_message** msg);
+void MQTTClient_free(void* ptr);
+void MQTTClient_destroy(MQTTClient* handle);
+
+//-------------------------------------------------------------------------
+
+/**
+ * @brief A message that was published via the fake client
+ *
+ */
+typedef struct {
+    char topic[128];
+    char payload[256];
+    int qos;
+    MQTTClient_deliveryToken token;
+    u8 acknowledged;
+} UNITTEST_MQTT_PUBLISH;
+
+/**
+ * @brief Number of calls of the paho-API since unittest_mqtt_reset()
+ *
+ */
+typedef struct {
+    u32 create;
+    u32 destroy;
+    u32 connect;
+    u32 disconnect;
+    u32 subscribe;
+    u32 unsubscribe;
+    char server_uri[128];
+    char subscribed_topic[128];
+    char unsubscribed_topic[128];
+    int max_inflight;
+} UNITTEST_MQTT_CALLS;
+
+void unittest_mqtt_reset(void);
+void unittest_mqtt_fail_connects(u32 count);
+void unittest_mqtt_lose_connection(const char* p_cause);
+void unittest_mqtt_receive(const char* p_payload);
+u8 unittest_mqtt_acknowledge(u32 index);
+
+u32 unittest_mqtt_num_published(void);
+const UNITTEST_MQTT_PUBLISH* unittest_mqtt_get_published(u32 index);
+const UNITTEST_MQTT_CALLS* unittest_mqtt_get_calls(void);
+
+//-------------------------------------------------------------------------
+
+#endif // _MQTTCLIENT_H_
@@ -0,0 +1,10 @@
+#ifndef   _COMMON_TYPES_H_
+#define   _COMMON_TYPES_H_
+
+//-------------------------------------------------------------------------
+
+// This is a dummy-file only to enable the module-tests without the framework
+
+//-------------------------------------------------------------------------
+
+#endif // _COMMON_TYPES_H_
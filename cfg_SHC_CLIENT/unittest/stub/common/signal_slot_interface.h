@@ -0,0 +1,38 @@
+#ifndef   _SIGNAL_SLOT_INTERFACE_H_
+#define   _SIGNAL_SLOT_INTERFACE_H_
+
+//-------------------------------------------------------------------------
+
+// This is a dummy-file only to enable the module-tests without the framework.
+// Signals are delivered synchronously to all connected slots,
+// see unittest_stub.c
+
+//-------------------------------------------------------------------------
+
+#include "config.h"
+
+//-------------------------------------------------------------------------
+
+typedef void (*UNITTEST_SLOT_CALLBACK)(const void* p_argument);
+
+void unittest_signal_connect(const char* p_signal_name, UNITTEST_SLOT_CALLBACK p_callback);
+void unittest_signal_send(const char* p_signal_name, const void* p_argument);
+u32 unittest_signal_count(const char* p_signal_name);
+void unittest_signal_reset(void);
+
+//-------------------------------------------------------------------------
+
+#define SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(name)                                      \
+    void name##_init(void);                                                             \
+    void name##_send(const void* p_argument);
+
+#define SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(name)                                       \
+    void name##_init(void) { }                                                          \
+    void name##_send(const void* p_argument) { unittest_signal_send(#name, p_argument); }
+
+#define SIGNAL_SLOT_INTERFACE_CREATE_SLOT(signal_name, name, callback)                  \
+    static void name##_connect(void) { unittest_signal_connect(#signal_name, callback); }
+
+//-------------------------------------------------------------------------
+
+#endif // _SIGNAL_SLOT_INTERFACE_H_
@@ -0,0 +1,27 @@
+#ifndef   _config_H_
+#define   _config_H_
+
+//-------------------------------------------------------------------------
+
+// This is a dummy-file only to enable the module-tests without the framework
+
+//-------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stddef.h>
+
+//-------------------------------------------------------------------------
+
+typedef uint8_t     u8;
+typedef uint16_t    u16;
+typedef uint32_t    u32;
+typedef uint64_t    u64;
+
+typedef int8_t      i8;
+typedef int16_t     i16;
+typedef int32_t     i32;
+typedef int64_t     i64;
+
+//-------------------------------------------------------------------------
+
+#endif // _config_H_
@@ -0,0 +1,257 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    mqtt_client_stub.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Fake paho-client for the module-tests. There is no broker:
+ *          published messages are recorded and the callbacks of the
+ *          paho-thread are invoked synchronously by the test, e.g. by
+ *          unittest_mqtt_acknowledge() or unittest_mqtt_lose_connection().
+ */
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --------------------------------------------------------------------------------
+
+#include "MQTTClient.h"
+
+// --------------------------------------------------------------------------------
+
+#define UNITTEST_MQTT_MAX_PUBLISH                   64
+
+// --------------------------------------------------------------------------------
+
+static UNITTEST_MQTT_PUBLISH publish_list[UNITTEST_MQTT_MAX_PUBLISH];
+static u32 num_published = 0;
+
+static UNITTEST_MQTT_CALLS calls;
+
+static u32 failing_connects = 0;
+static u8 is_connected = 0;
+static u8 is_created = 0;
+static MQTTClient_deliveryToken next_token = 1;
+
+static void* p_callback_context = NULL;
+static MQTTClient_connectionLost* p_connection_lost = NULL;
+static MQTTClient_messageArrived* p_message_arrived = NULL;
+static MQTTClient_deliveryComplete* p_delivery_complete = NULL;
+
+// --------------------------------------------------------------------------------
+
+int MQTTClient_create(MQTTClient* handle, const char* serverURI, const char* clientId, int persistence_type, void* persistence_context) {
+
+    (void) clientId;
+    (void) persistence_type;
+    (void) persistence_context;
+
+    calls.create += 1;
+    snprintf(calls.server_uri, sizeof(calls.server_uri), "%s", serverURI);
+
+    is_created = 1;
+    *handle = (MQTTClient)&is_created;
+
+    return MQTTCLIENT_SUCCESS;
+}
+
+int MQTTClient_setCallbacks(MQTTClient handle, void* context, MQTTClient_connectionLost* cl, MQTTClient_messageArrived* ma, MQTTClient_deliveryComplete* dc) {
+
+    (void) handle;
+
+    p_callback_context = context;
+    p_connection_lost = cl;
+    p_message_arrived = ma;
+    p_delivery_complete = dc;
+
+    return MQTTCLIENT_SUCCESS;
+}
+
+int MQTTClient_connect(MQTTClient handle, MQTTClient_connectOptions* options) {
+
+    (void) handle;
+
+    calls.connect += 1;
+    calls.max_inflight = options->maxInflightMessages;
+
+    if (failing_connects != 0) {
+        failing_connects -= 1;
+        return MQTTCLIENT_FAILURE;
+    }
+
+    is_connected = 1;
+    return MQTTCLIENT_SUCCESS;
+}
+
+int MQTTClient_disconnect(MQTTClient handle, int timeout) {
+
+    (void) handle;
+    (void) timeout;
+
+    calls.disconnect += 1;
+    is_connected = 0;
+
+    return MQTTCLIENT_SUCCESS;
+}
+
+int MQTTClient_isConnected(MQTTClient handle) {
+    (void) handle;
+    return is_connected;
+}
+
+int MQTTClient_subscribe(MQTTClient handle, const char* topic, int qos) {
+
+    (void) handle;
+    (void) qos;
+
+    calls.subscribe += 1;
+    snprintf(calls.subscribed_topic, sizeof(calls.subscribed_topic), "%s", topic);
+
+    return MQTTCLIENT_SUCCESS;
+}
+
+int MQTTClient_unsubscribe(MQTTClient handle, const char* topic) {
+
+    (void) handle;
+
+    calls.unsubscribe += 1;
+    snprintf(calls.unsubscribed_topic, sizeof(calls.unsubscribed_topic), "%s", topic);
+
+    return MQTTCLIENT_SUCCESS;
+}
+
+int MQTTClient_publish(MQTTClient handle, const char* topicName, int payloadlen, const void* payload, int qos, int retained, MQTTClient_deliveryToken* dt) {
+
+    (void) handle;
+    (void) retained;
+
+    if (is_connected == 0) {
+        return MQTTCLIENT_DISCONNECTED;
+    }
+
+    if (num_published == UNITTEST_MQTT_MAX_PUBLISH) {
+        return MQTTCLIENT_FAILURE;
+    }
+
+    UNITTEST_MQTT_PUBLISH* p_publish = &publish_list[num_published++];
+
+    snprintf(p_publish->topic, sizeof(p_publish->topic), "%s", topicName);
+    snprintf(p_publish->payload, sizeof(p_publish->payload), "%.*s", payloadlen, (const char*)payload);
+
+    p_publish->qos = qos;
+    p_publish->token = next_token++;
+    p_publish->acknowledged = 0;
+
+    *dt = p_publish->token;
+
+    return MQTTCLIENT_SUCCESS;
+}
+
+void MQTTClient_freeMessage(MQTTClient_message** msg) {
+
+    free((*msg)->payload);
+    free(*msg);
+    *msg = NULL;
+}
+
+void MQTTClient_free(void* ptr) {
+    free(ptr);
+}
+
+void MQTTClient_destroy(MQTTClient* handle) {
+
+    calls.destroy += 1;
+
+    is_created = 0;
+    is_connected = 0;
+    *handle = NULL;
+}
+
+// --------------------------------------------------------------------------------
+
+void unittest_mqtt_reset(void) {
+
+    memset(publish_list, 0x00, sizeof(publish_list));
+    memset(&calls, 0x00, sizeof(calls));
+
+    num_published = 0;
+    failing_connects = 0;
+}
+
+void unittest_mqtt_fail_connects(u32 count) {
+    failing_connects = count;
+}
+
+void unittest_mqtt_lose_connection(const char* p_cause) {
+
+    is_connected = 0;
+
+    if (p_connection_lost != NULL) {
+        p_connection_lost(p_callback_context, (char*)p_cause);
+    }
+}
+
+void unittest_mqtt_receive(const char* p_payload) {
+
+    if (p_message_arrived == NULL) {
+        return;
+    }
+
+    MQTTClient_message* p_message = calloc(1, sizeof(MQTTClient_message));
+
+    p_message->payloadlen = (int)strlen(p_payload);
+    p_message->payload = malloc((size_t)p_message->payloadlen);
+    memcpy(p_message->payload, p_payload, (size_t)p_message->payloadlen);
+
+    char* p_topic = strdup(calls.subscribed_topic);
+
+    p_message_arrived(p_callback_context, p_topic, 0, p_message);
+}
+
+u8 unittest_mqtt_acknowledge(u32 index) {
+
+    if (index >= num_published || publish_list[index].acknowledged) {
+        return 0;
+    }
+
+    publish_list[index].acknowledged = 1;
+
+    if (p_delivery_complete != NULL) {
+        p_delivery_complete(p_callback_context, publish_list[index].token);
+    }
+
+    return 1;
+}
+
+u32 unittest_mqtt_num_published(void) {
+    return num_published;
+}
+
+const UNITTEST_MQTT_PUBLISH* unittest_mqtt_get_published(u32 index) {
+    return index < num_published ? &publish_list[index] : NULL;
+}
+
+const UNITTEST_MQTT_CALLS* unittest_mqtt_get_calls(void) {
+    return &calls;
+}
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,27 @@
+#ifndef   _CFG_FILE_PARSER_H_
+#define   _CFG_FILE_PARSER_H_
+
+//-------------------------------------------------------------------------
+
+// This is a dummy-file only to enable the module-tests without the framework
+
+//-------------------------------------------------------------------------
+
+#include "config.h"
+#include "common/signal_slot_interface.h"
+
+//-------------------------------------------------------------------------
+
+typedef struct {
+    char key[64];
+    char value[256];
+} CFG_FILE_PARSER_CFG_OBJECT_TYPE;
+
+//-------------------------------------------------------------------------
+
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(CFG_PARSER_NEW_CFG_OBJECT_SIGNAL)
+SIGNAL_SLOT_INTERFACE_INCLUDE_SIGNAL(CFG_PARSER_CFG_COMPLETE_SIGNAL)
+
+//-------------------------------------------------------------------------
+
+#endif // _CFG_FILE_PARSER_H_
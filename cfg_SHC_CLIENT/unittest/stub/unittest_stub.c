@@ -0,0 +1,178 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    unittest_stub.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Replacement of the signal-slot interface and of the
+ *          configuration-parser of the framework for the module-tests.
+ *          A signal is delivered synchronously to all connected slots
+ *          and the number of sent signals is counted by name.
+ */
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+
+// --------------------------------------------------------------------------------
+
+#include "common/signal_slot_interface.h"
+#include "ui/cfg_file_parser/cfg_file_parser.h"
+
+// --------------------------------------------------------------------------------
+
+#include "../unittest.h"
+
+// --------------------------------------------------------------------------------
+
+#define UNITTEST_MAX_SIGNALS                        64
+#define UNITTEST_MAX_SLOTS                          64
+#define UNITTEST_SIGNAL_NAME_MAX_LENGTH             64
+
+// --------------------------------------------------------------------------------
+
+typedef struct UNITTEST_SIGNAL_STRUCT {
+    char name[UNITTEST_SIGNAL_NAME_MAX_LENGTH];
+    u32 count;
+} UNITTEST_SIGNAL;
+
+typedef struct UNITTEST_SLOT_STRUCT {
+    char signal_name[UNITTEST_SIGNAL_NAME_MAX_LENGTH];
+    UNITTEST_SLOT_CALLBACK p_callback;
+} UNITTEST_SLOT;
+
+// --------------------------------------------------------------------------------
+
+static UNITTEST_SIGNAL signal_list[UNITTEST_MAX_SIGNALS];
+static u32 num_signals = 0;
+
+static UNITTEST_SLOT slot_list[UNITTEST_MAX_SLOTS];
+static u32 num_slots = 0;
+
+static pthread_mutex_t signal_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+// --------------------------------------------------------------------------------
+
+void unittest_signal_connect(const char* p_signal_name, UNITTEST_SLOT_CALLBACK p_callback) {
+
+    pthread_mutex_lock(&signal_mutex);
+
+    u32 i = 0;
+    for ( ; i < num_slots ; i++) {
+        if (slot_list[i].p_callback == p_callback && strcmp(slot_list[i].signal_name, p_signal_name) == 0) {
+            pthread_mutex_unlock(&signal_mutex);
+            return;
+        }
+    }
+
+    if (num_slots < UNITTEST_MAX_SLOTS) {
+        snprintf(slot_list[num_slots].signal_name, UNITTEST_SIGNAL_NAME_MAX_LENGTH, "%s", p_signal_name);
+        slot_list[num_slots].p_callback = p_callback;
+        num_slots += 1;
+    }
+
+    pthread_mutex_unlock(&signal_mutex);
+}
+
+void unittest_signal_send(const char* p_signal_name, const void* p_argument) {
+
+    UNITTEST_SLOT_CALLBACK callback_list[UNITTEST_MAX_SLOTS];
+    u32 num_callbacks = 0;
+
+    pthread_mutex_lock(&signal_mutex);
+
+    u32 i = 0;
+    for ( ; i < num_signals ; i++) {
+        if (strcmp(signal_list[i].name, p_signal_name) == 0) {
+            break;
+        }
+    }
+
+    if (i == num_signals && num_signals < UNITTEST_MAX_SIGNALS) {
+        snprintf(signal_list[i].name, UNITTEST_SIGNAL_NAME_MAX_LENGTH, "%s", p_signal_name);
+        signal_list[i].count = 0;
+        num_signals += 1;
+    }
+
+    if (i < num_signals) {
+        signal_list[i].count += 1;
+    }
+
+    for (i = 0 ; i < num_slots ; i++) {
+        if (strcmp(slot_list[i].signal_name, p_signal_name) == 0) {
+            callback_list[num_callbacks++] = slot_list[i].p_callback;
+        }
+    }
+
+    pthread_mutex_unlock(&signal_mutex);
+
+    // the slots are called without the lock, a slot may send a signal itself
+    for (i = 0 ; i < num_callbacks ; i++) {
+        callback_list[i](p_argument);
+    }
+}
+
+u32 unittest_signal_count(const char* p_signal_name) {
+
+    u32 count = 0;
+
+    pthread_mutex_lock(&signal_mutex);
+
+    u32 i = 0;
+    for ( ; i < num_signals ; i++) {
+        if (strcmp(signal_list[i].name, p_signal_name) == 0) {
+            count = signal_list[i].count;
+            break;
+        }
+    }
+
+    pthread_mutex_unlock(&signal_mutex);
+
+    return count;
+}
+
+void unittest_signal_reset(void) {
+
+    pthread_mutex_lock(&signal_mutex);
+    num_signals = 0;
+    num_slots = 0;
+    pthread_mutex_unlock(&signal_mutex);
+}
+
+// --------------------------------------------------------------------------------
+
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(CFG_PARSER_NEW_CFG_OBJECT_SIGNAL)
+SIGNAL_SLOT_INTERFACE_CREATE_SIGNAL(CFG_PARSER_CFG_COMPLETE_SIGNAL)
+
+// --------------------------------------------------------------------------------
+
+void unittest_send_cfg_object(const char* p_key, const char* p_value) {
+
+    CFG_FILE_PARSER_CFG_OBJECT_TYPE cfg_object;
+    memset(&cfg_object, 0x00, sizeof(cfg_object));
+
+    snprintf(cfg_object.key, sizeof(cfg_object.key), "%s", p_key);
+    snprintf(cfg_object.value, sizeof(cfg_object.value), "%s", p_value);
+
+    CFG_PARSER_NEW_CFG_OBJECT_SIGNAL_send(&cfg_object);
+}
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,127 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    unittest.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Minimal test-macros of the module-tests of the shcClient.
+ *
+ *          Every unittest_<module>.c is a program of its own that runs
+ *          all of its test-cases and returns 0 if all of them passed.
+ *          The modules are built against the dummy-headers of ./stub,
+ *          see module_tests.mk.
+ *
+ *              static void unittest_xyz(void) {
+ *                  UT_ASSERT(shc_xyz() == 1);
+ *              }
+ *
+ *              int main(void) {
+ *                  UT_RUN(unittest_xyz);
+ *                  return UT_RESULT();
+ *              }
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_unittest_
+#define _H_unittest_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+
+// --------------------------------------------------------------------------------
+
+#include "common/signal_slot_interface.h"
+
+// --------------------------------------------------------------------------------
+
+static u32 unittest_num_tests __attribute__((unused)) = 0;
+static u32 unittest_num_failed __attribute__((unused)) = 0;
+static u8 unittest_actual_failed __attribute__((unused)) = 0;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Aborts the actual test-case if the condition is false
+ *
+ */
+#define UT_ASSERT(condition)                                                            \
+    do {                                                                                \
+        if (!(condition)) {                                                             \
+            printf("    %s:%d: %s\n", __FILE__, __LINE__, #condition);                  \
+            unittest_actual_failed = 1;                                                 \
+            return;                                                                     \
+        }                                                                               \
+    } while (0)
+
+/**
+ * @brief Aborts the actual test-case if the two integers are not equal
+ *
+ */
+#define UT_ASSERT_EQUAL(expected, actual)                                               \
+    do {                                                                                \
+        long long ut_expected = (long long)(expected);                                  \
+        long long ut_actual = (long long)(actual);                                      \
+        if (ut_expected != ut_actual) {                                                 \
+            printf("    %s:%d: %s == %lld, expected %lld\n",                            \
+                __FILE__, __LINE__, #actual, ut_actual, ut_expected);                   \
+            unittest_actual_failed = 1;                                                 \
+            return;                                                                     \
+        }                                                                               \
+    } while (0)
+
+/**
+ * @brief Runs a single test-case
+ *
+ */
+#define UT_RUN(test_case)                                                               \
+    do {                                                                                \
+        unittest_actual_failed = 0;                                                     \
+        test_case();                                                                    \
+        unittest_num_tests += 1;                                                        \
+        if (unittest_actual_failed) {                                                   \
+            unittest_num_failed += 1;                                                   \
+        }                                                                               \
+        printf("%s - %s\n", unittest_actual_failed ? "FAILED" : "PASSED", #test_case);  \
+    } while (0)
+
+/**
+ * @brief Prints the summary, use as return-value of main()
+ *
+ */
+#define UT_RESULT()                                                                     \
+    (printf("%u of %u test-cases passed\n",                                             \
+        unittest_num_tests - unittest_num_failed, unittest_num_tests),                  \
+     unittest_num_failed == 0 ? 0 : 1)
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Sends CFG_PARSER_NEW_CFG_OBJECT_SIGNAL with the given key and value,
+ * see stub/unittest_stub.c
+ *
+ */
+void unittest_send_cfg_object(const char* p_key, const char* p_value);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_unittest_
+
+// --------------------------------------------------------------------------------
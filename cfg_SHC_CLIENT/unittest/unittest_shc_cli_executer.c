@@ -0,0 +1,335 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    unittest_shc_cli_executer.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Module-test of the process-pool of the shell-commands,
+ *          especially of the timeout of a running command
+ *
+ * @see     shc_cli_executer.h
+ */
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// --------------------------------------------------------------------------------
+
+#include "unittest.h"
+#include "shc_event_loop.h"
+#include "shc_cli_executer.h"
+
+// --------------------------------------------------------------------------------
+
+#define UNITTEST_MAX_RESULTS                        8
+#define UNITTEST_RESULT_MAX_LENGTH                  256
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Arguments of the signals of the cli-executer in the order they were sent
+ *
+ */
+typedef struct UNITTEST_RESULT_LIST_STRUCT {
+    u32 count;
+    char list[UNITTEST_MAX_RESULTS][UNITTEST_RESULT_MAX_LENGTH];
+} UNITTEST_RESULT_LIST;
+
+static UNITTEST_RESULT_LIST response_list;
+static UNITTEST_RESULT_LIST timeout_list;
+static UNITTEST_RESULT_LIST not_found_list;
+
+static char pid_file[64];
+
+// --------------------------------------------------------------------------------
+
+static void unittest_add_result(UNITTEST_RESULT_LIST* p_list, const void* p_argument) {
+
+    if (p_list->count < UNITTEST_MAX_RESULTS) {
+        snprintf(p_list->list[p_list->count], UNITTEST_RESULT_MAX_LENGTH, "%s", (const char*)p_argument);
+    }
+
+    p_list->count += 1;
+}
+
+static void unittest_RESPONSE_SLOT_CALLBACK(const void* p_argument) {
+    unittest_add_result(&response_list, p_argument);
+}
+
+static void unittest_TIMEOUT_SLOT_CALLBACK(const void* p_argument) {
+    unittest_add_result(&timeout_list, p_argument);
+}
+
+static void unittest_NOT_FOUND_SLOT_CALLBACK(const void* p_argument) {
+    unittest_add_result(&not_found_list, p_argument);
+}
+
+// --------------------------------------------------------------------------------
+
+static void unittest_setup(const char* p_max_jobs, const char* p_timeout_ms) {
+
+    memset(&response_list, 0x00, sizeof(response_list));
+    memset(&timeout_list, 0x00, sizeof(timeout_list));
+    memset(&not_found_list, 0x00, sizeof(not_found_list));
+
+    snprintf(pid_file, sizeof(pid_file), "/tmp/unittest_shc_cli_executer_%d.pid", (int)getpid());
+    unlink(pid_file);
+
+    unittest_signal_reset();
+
+    // the helper-process is forked before the event-loop is created
+    shc_cli_executer_init();
+    shc_event_loop_init();
+
+    unittest_signal_connect("CLI_EXECUTER_COMMAND_RESPONSE_SIGNAL", unittest_RESPONSE_SLOT_CALLBACK);
+    unittest_signal_connect("CLI_EXECUTER_COMMAND_TIMEOUT_SIGNAL", unittest_TIMEOUT_SLOT_CALLBACK);
+    unittest_signal_connect("CLI_EXECUTER_COMMAND_NOT_FOUND_SIGNAL", unittest_NOT_FOUND_SLOT_CALLBACK);
+
+    unittest_send_cfg_object("CLI_EXECUTER_MAX_JOBS", p_max_jobs);
+    unittest_send_cfg_object("CLI_EXECUTER_TIMEOUT_MS", p_timeout_ms);
+}
+
+static void unittest_teardown(void) {
+
+    shc_cli_executer_deinit();
+    shc_event_loop_deinit();
+
+    unlink(pid_file);
+}
+
+/**
+ * @brief Runs the main-loop until the given number of commands
+ * has finished, was killed or was not found
+ *
+ * @return time in milliseconds until the commands have finished or 0xFFFFFFFF on timeout
+ */
+static u32 unittest_run(u32 num_commands, u32 timeout_ms) {
+
+    u64 start_us = shc_event_loop_time_us();
+    u64 end_us = start_us + (u64)timeout_ms * 1000ULL;
+
+    while (shc_event_loop_time_us() < end_us) {
+
+        shc_cli_executer_task();
+
+        if (response_list.count + timeout_list.count + not_found_list.count >= num_commands) {
+            return (u32)((shc_event_loop_time_us() - start_us) / 1000ULL);
+        }
+
+        shc_event_loop_set_deadline(10);
+        shc_event_loop_wait();
+    }
+
+    return 0xFFFFFFFF;
+}
+
+static void unittest_execute(const char* p_command) {
+    CLI_EXECUTER_COMMAND_RECEIVED_SIGNAL_send(p_command);
+}
+
+/**
+ * @brief Checks if the process of the given pid-file does not exist
+ * anymore or is a zombie that nobody has reaped yet
+ *
+ */
+static u8 unittest_process_is_dead(void) {
+
+    FILE* p_file = fopen(pid_file, "r");
+    if (p_file == NULL) {
+        return 0;
+    }
+
+    int pid = 0;
+    int count = fscanf(p_file, "%d", &pid);
+    fclose(p_file);
+
+    if (count != 1 || pid <= 0) {
+        return 0;
+    }
+
+    char stat_path[64];
+    snprintf(stat_path, sizeof(stat_path), "/proc/%d/stat", pid);
+
+    p_file = fopen(stat_path, "r");
+    if (p_file == NULL) {
+        return 1;
+    }
+
+    char state = 'R';
+    count = fscanf(p_file, "%*d %*s %c", &state);
+    fclose(p_file);
+
+    return count == 1 && (state == 'Z' || state == 'X');
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief The output of a command is sent without the trailing line-break
+ *
+ */
+static void unittest_response(void) {
+
+    unittest_setup("4", "2000");
+
+    unittest_execute("echo hello; echo world");
+    u32 duration_ms = unittest_run(1, 3000);
+
+    unittest_teardown();
+
+    UT_ASSERT(duration_ms != 0xFFFFFFFF);
+    UT_ASSERT_EQUAL(1, response_list.count);
+    UT_ASSERT(strcmp(response_list.list[0], "hello\nworld") == 0);
+}
+
+/**
+ * @brief A command that is still running after CLI_EXECUTER_TIMEOUT_MS
+ * is killed, not earlier and not much later
+ *
+ */
+static void unittest_timeout(void) {
+
+    unittest_setup("4", "300");
+
+    unittest_execute("sleep 10");
+    u32 duration_ms = unittest_run(1, 3000);
+
+    unittest_teardown();
+
+    UT_ASSERT(duration_ms != 0xFFFFFFFF);
+    UT_ASSERT(duration_ms >= 290);
+    UT_ASSERT(duration_ms < 1300);
+    UT_ASSERT_EQUAL(0, response_list.count);
+    UT_ASSERT_EQUAL(1, timeout_list.count);
+    UT_ASSERT(strcmp(timeout_list.list[0], "sleep 10") == 0);
+}
+
+/**
+ * @brief A killed command takes the processes it has started with it
+ *
+ */
+static void unittest_timeout_kills_process_group(void) {
+
+    unittest_setup("4", "300");
+
+    char command[160];
+    snprintf(command, sizeof(command), "sleep 10 & echo $! > %s; wait", pid_file);
+
+    unittest_execute(command);
+    u32 duration_ms = unittest_run(1, 3000);
+
+    // SIGKILL is delivered asynchronously
+    u8 is_dead = 0;
+    u32 i = 0;
+    for ( ; i < 100 && is_dead == 0 ; i++) {
+        is_dead = unittest_process_is_dead();
+        usleep(10000);
+    }
+
+    unittest_teardown();
+
+    UT_ASSERT(duration_ms != 0xFFFFFFFF);
+    UT_ASSERT_EQUAL(1, timeout_list.count);
+    UT_ASSERT(is_dead);
+}
+
+/**
+ * @brief A short command that runs beside a command that times out
+ * is answered, the timeout of one job does not affect the other one
+ *
+ */
+static void unittest_timeout_beside_response(void) {
+
+    unittest_setup("4", "300");
+
+    unittest_execute("sleep 10");
+    unittest_execute("sleep 0.1; echo fast");
+    u32 duration_ms = unittest_run(2, 3000);
+
+    unittest_teardown();
+
+    UT_ASSERT(duration_ms != 0xFFFFFFFF);
+    UT_ASSERT_EQUAL(1, response_list.count);
+    UT_ASSERT(strcmp(response_list.list[0], "fast") == 0);
+    UT_ASSERT_EQUAL(1, timeout_list.count);
+}
+
+/**
+ * @brief The timeout starts when the command is started,
+ * not while it is waiting for a free job
+ *
+ */
+static void unittest_timeout_starts_with_job(void) {
+
+    unittest_setup("1", "500");
+
+    unittest_execute("sleep 0.3; echo first");
+    unittest_execute("sleep 0.3; echo second");
+    u32 duration_ms = unittest_run(2, 3000);
+
+    unittest_teardown();
+
+    UT_ASSERT(duration_ms != 0xFFFFFFFF);
+    UT_ASSERT(duration_ms >= 550);
+    UT_ASSERT_EQUAL(0, timeout_list.count);
+    UT_ASSERT_EQUAL(2, response_list.count);
+    UT_ASSERT(strcmp(response_list.list[0], "first") == 0);
+    UT_ASSERT(strcmp(response_list.list[1], "second") == 0);
+}
+
+/**
+ * @brief An unknown command is reported by CLI_EXECUTER_COMMAND_NOT_FOUND_SIGNAL
+ *
+ */
+static void unittest_not_found(void) {
+
+    unittest_setup("4", "2000");
+
+    unittest_execute("unittest_no_such_command_1234");
+    u32 duration_ms = unittest_run(1, 3000);
+
+    unittest_teardown();
+
+    UT_ASSERT(duration_ms != 0xFFFFFFFF);
+    UT_ASSERT_EQUAL(0, response_list.count);
+    UT_ASSERT_EQUAL(1, not_found_list.count);
+    UT_ASSERT(strcmp(not_found_list.list[0], "unittest_no_such_command_1234") == 0);
+}
+
+// --------------------------------------------------------------------------------
+
+int main(void) {
+
+    alarm(60);
+
+    UT_RUN(unittest_response);
+    UT_RUN(unittest_timeout);
+    UT_RUN(unittest_timeout_kills_process_group);
+    UT_RUN(unittest_timeout_beside_response);
+    UT_RUN(unittest_timeout_starts_with_job);
+    UT_RUN(unittest_not_found);
+
+    return UT_RESULT();
+}
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,388 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    unittest_shc_command_table.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Module-test of the command-table: lookup of the commands
+ *          and reload of the files via inotify
+ *
+ * @see     shc_command_table.h
+ */
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// --------------------------------------------------------------------------------
+
+#include "unittest.h"
+#include "shc_event_loop.h"
+#include "shc_host_board.h"
+#include "shc_command_table.h"
+
+// --------------------------------------------------------------------------------
+
+#define UNITTEST_NUM_GENERATED_COMMANDS             2000
+
+// --------------------------------------------------------------------------------
+
+static char directory[64];
+static char file_list[SHC_COMMAND_TABLE_NUM_FILES][128];
+
+static const char* file_name_list[SHC_COMMAND_TABLE_NUM_FILES] = {
+    "command_file.txt",
+    "report_file.txt",
+    "event_file.txt",
+    "execute_file.txt"
+};
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Replacement of the board-list of shc_host_board.c,
+ * board 1 is named "kitchen"
+ *
+ */
+u8 shc_host_board_find(const char* p_name, u16 name_length) {
+
+    if (name_length == 7 && memcmp(p_name, "kitchen", 7) == 0) {
+        return 1;
+    }
+
+    return SHC_HOST_BOARD_INVALID;
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Replaces the content of a file the way an editor does:
+ * a temporary file is renamed over the original one
+ *
+ */
+static void unittest_write_file(u8 file_id, const char* p_content) {
+
+    char temp_path[160];
+    snprintf(temp_path, sizeof(temp_path), "%s.tmp", file_list[file_id]);
+
+    FILE* p_file = fopen(temp_path, "w");
+    if (p_file == NULL) {
+        perror("fopen");
+        exit(1);
+    }
+
+    fputs(p_content, p_file);
+    fclose(p_file);
+
+    rename(temp_path, file_list[file_id]);
+}
+
+static void unittest_setup(void) {
+
+    snprintf(directory, sizeof(directory), "/tmp/unittest_shc_command_table_XXXXXX");
+
+    if (mkdtemp(directory) == NULL) {
+        perror("mkdtemp");
+        exit(1);
+    }
+
+    u8 file_id = 0;
+    for ( ; file_id < SHC_COMMAND_TABLE_NUM_FILES ; file_id++) {
+        snprintf(file_list[file_id], sizeof(file_list[file_id]), "%s/%s", directory, file_name_list[file_id]);
+        unittest_write_file(file_id, "version=0101\n");
+    }
+
+    unittest_signal_reset();
+
+    shc_event_loop_init();
+    shc_command_table_init();
+
+    for (file_id = 0 ; file_id < SHC_COMMAND_TABLE_NUM_FILES ; file_id++) {
+        shc_command_table_set_file(file_id, file_list[file_id]);
+    }
+}
+
+static void unittest_teardown(void) {
+
+    shc_command_table_deinit();
+    shc_event_loop_deinit();
+
+    u8 file_id = 0;
+    for ( ; file_id < SHC_COMMAND_TABLE_NUM_FILES ; file_id++) {
+        unlink(file_list[file_id]);
+    }
+
+    rmdir(directory);
+}
+
+/**
+ * @brief Runs the main-loop until the table has the given generation
+ *
+ * @return 1 if the generation was reached within timeout_ms
+ */
+static u8 unittest_run_until_generation(u32 generation, u32 timeout_ms) {
+
+    u64 end_us = shc_event_loop_time_us() + (u64)timeout_ms * 1000ULL;
+
+    while (shc_event_loop_time_us() < end_us) {
+
+        shc_command_table_task();
+
+        if (shc_command_table_get()->generation >= generation) {
+            return 1;
+        }
+
+        shc_event_loop_set_deadline(10);
+        shc_event_loop_wait();
+    }
+
+    return 0;
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Commands, shell-commands, reports and events of all files
+ * are found with their type, board and payload
+ *
+ */
+static void unittest_lookup(void) {
+
+    unittest_setup();
+
+    unittest_write_file(SHC_COMMAND_TABLE_FILE_COMMAND,
+        "# comment\n"
+        "version=0101\n"
+        "cmd_light_on=com:0704010100000000\n"
+        "cmd_kitchen_on=com@kitchen:0A0B\n"
+        "cmd_unknown_board=com@garage:0A0B\n"
+        "cmd_reboot=EXE:sudo reboot\n"
+        "cmd_invalid=com:0G\n"
+    );
+
+    unittest_write_file(SHC_COMMAND_TABLE_FILE_REPORT,
+        "rpt_temperature=com:0301\n"
+        "rpt_kitchen_temperature=com@kitchen:0302\n"
+    );
+
+    unittest_write_file(SHC_COMMAND_TABLE_FILE_EVENT,
+        "evt_motion=0501=050101\n"
+    );
+
+    unittest_write_file(SHC_COMMAND_TABLE_FILE_EXECUTE,
+        "exe_uptime=  uptime -p\n"
+    );
+
+    u8 is_loaded = shc_command_table_load();
+    const SHC_COMMAND_TABLE* p_table = shc_command_table_get();
+
+    const SHC_COMMAND_TABLE_ENTRY* p_light = shc_command_table_lookup(p_table, "cmd_light_on");
+    const SHC_COMMAND_TABLE_ENTRY* p_kitchen = shc_command_table_lookup(p_table, "cmd_kitchen_on");
+    const SHC_COMMAND_TABLE_ENTRY* p_reboot = shc_command_table_lookup(p_table, "cmd_reboot");
+    const SHC_COMMAND_TABLE_ENTRY* p_report = shc_command_table_lookup(p_table, "rpt_kitchen_temperature");
+    const SHC_COMMAND_TABLE_ENTRY* p_uptime = shc_command_table_lookup(p_table, "exe_uptime");
+
+    u8 light_ok = p_light != NULL && p_light->type == SHC_COMMAND_TYPE_COM && p_light->board == SHC_HOST_BOARD_DEFAULT;
+    u8 light_payload_ok = p_light != NULL && p_light->length == 8 && memcmp(p_light->p_payload, "\x07\x04\x01\x01\x00\x00\x00\x00", 8) == 0;
+    u8 kitchen_ok = p_kitchen != NULL && p_kitchen->board == 1 && p_kitchen->length == 2 && p_kitchen->p_payload[1] == 0x0B;
+    u8 reboot_ok = p_reboot != NULL && p_reboot->type == SHC_COMMAND_TYPE_EXE && strcmp((const char*)p_reboot->p_payload, "sudo reboot") == 0;
+    u8 report_ok = p_report != NULL && p_report->type == SHC_COMMAND_TYPE_REPORT && p_report->board == 1;
+    u8 uptime_ok = p_uptime != NULL && p_uptime->type == SHC_COMMAND_TYPE_EXE && strcmp((const char*)p_uptime->p_payload, "uptime -p") == 0;
+
+    u8 unknown_board_ignored = shc_command_table_lookup(p_table, "cmd_unknown_board") == NULL;
+    u8 invalid_ignored = shc_command_table_lookup(p_table, "cmd_invalid") == NULL;
+    u8 missing_not_found = shc_command_table_lookup(p_table, "cmd_light_off") == NULL;
+    u8 num_reports = (u8)p_table->num_reports;
+    u8 num_events = (u8)p_table->num_events;
+    u32 num_loaded_signals = unittest_signal_count("SHC_COMMAND_TABLE_LOADED_SIGNAL");
+
+    // the table is released by the teardown, only the results are kept
+    unittest_teardown();
+
+    UT_ASSERT(is_loaded);
+    UT_ASSERT(light_ok);
+    UT_ASSERT(light_payload_ok);
+    UT_ASSERT(kitchen_ok);
+    UT_ASSERT(reboot_ok);
+    UT_ASSERT(report_ok);
+    UT_ASSERT(uptime_ok);
+    UT_ASSERT(unknown_board_ignored);
+    UT_ASSERT(invalid_ignored);
+    UT_ASSERT(missing_not_found);
+    UT_ASSERT_EQUAL(2, num_reports);
+    UT_ASSERT_EQUAL(1, num_events);
+    UT_ASSERT_EQUAL(1, num_loaded_signals);
+}
+
+/**
+ * @brief Every command of a large file is found by its own name,
+ * also if the hash-values of several commands collide in a bucket
+ *
+ */
+static void unittest_lookup_many_commands(void) {
+
+    unittest_setup();
+
+    char* p_content = malloc(UNITTEST_NUM_GENERATED_COMMANDS * 48);
+    u32 length = 0;
+
+    u32 i = 0;
+    for ( ; i < UNITTEST_NUM_GENERATED_COMMANDS ; i++) {
+        length += (u32)sprintf(p_content + length, "cmd_generated_%u=com:%04X\n", i, i);
+    }
+
+    unittest_write_file(SHC_COMMAND_TABLE_FILE_COMMAND, p_content);
+    free(p_content);
+
+    u8 is_loaded = shc_command_table_load();
+    const SHC_COMMAND_TABLE* p_table = shc_command_table_get();
+
+    u32 num_found = 0;
+
+    for (i = 0 ; i < UNITTEST_NUM_GENERATED_COMMANDS ; i++) {
+
+        char key[32];
+        snprintf(key, sizeof(key), "cmd_generated_%u", i);
+
+        const SHC_COMMAND_TABLE_ENTRY* p_entry = shc_command_table_lookup(p_table, key);
+
+        if (p_entry != NULL && p_entry->length == 2 && ((p_entry->p_payload[0] << 8) | p_entry->p_payload[1]) == (int)i) {
+            num_found += 1;
+        }
+    }
+
+    u8 not_found = shc_command_table_lookup(p_table, "cmd_generated_") == NULL;
+
+    unittest_teardown();
+
+    UT_ASSERT(is_loaded);
+    UT_ASSERT_EQUAL(UNITTEST_NUM_GENERATED_COMMANDS, num_found);
+    UT_ASSERT(not_found);
+}
+
+/**
+ * @brief A changed file is reloaded by the main-loop after it was
+ * replaced, the old table is swapped with the new one
+ *
+ */
+static void unittest_reload_on_change(void) {
+
+    unittest_setup();
+
+    unittest_write_file(SHC_COMMAND_TABLE_FILE_COMMAND, "cmd_light_on=com:0101\n");
+
+    // the files are loaded on the first call of the task
+    u8 first_loaded = unittest_run_until_generation(1, 1000);
+    u32 first_generation = shc_command_table_get()->generation;
+
+    unittest_write_file(SHC_COMMAND_TABLE_FILE_COMMAND, "cmd_light_off=com:0100\n");
+
+    u8 reloaded = unittest_run_until_generation(first_generation + 1, 2000);
+    const SHC_COMMAND_TABLE* p_table = shc_command_table_get();
+
+    u8 old_removed = shc_command_table_lookup(p_table, "cmd_light_on") == NULL;
+    u8 new_added = shc_command_table_lookup(p_table, "cmd_light_off") != NULL;
+    u32 num_loaded_signals = unittest_signal_count("SHC_COMMAND_TABLE_LOADED_SIGNAL");
+
+    unittest_teardown();
+
+    UT_ASSERT(first_loaded);
+    UT_ASSERT(reloaded);
+    UT_ASSERT(old_removed);
+    UT_ASSERT(new_added);
+    UT_ASSERT_EQUAL(2, num_loaded_signals);
+}
+
+/**
+ * @brief The actual table stays active if one of the files is missing
+ *
+ */
+static void unittest_reload_keeps_table_on_error(void) {
+
+    unittest_setup();
+
+    unittest_write_file(SHC_COMMAND_TABLE_FILE_COMMAND, "cmd_light_on=com:0101\n");
+
+    u8 first_loaded = shc_command_table_load();
+    u32 generation = shc_command_table_get()->generation;
+
+    unlink(file_list[SHC_COMMAND_TABLE_FILE_EXECUTE]);
+
+    u8 second_loaded = shc_command_table_load();
+    const SHC_COMMAND_TABLE* p_table = shc_command_table_get();
+
+    u8 generation_kept = p_table->generation == generation;
+    u8 command_kept = shc_command_table_lookup(p_table, "cmd_light_on") != NULL;
+    u32 num_failed_signals = unittest_signal_count("MSG_EXECUTER_FILE_OPEN_FAILED_SIGNAL");
+
+    unittest_teardown();
+
+    UT_ASSERT(first_loaded);
+    UT_ASSERT(second_loaded == 0);
+    UT_ASSERT(generation_kept);
+    UT_ASSERT(command_kept);
+    UT_ASSERT_EQUAL(1, num_failed_signals);
+}
+
+/**
+ * @brief Conversion between hex-strings and binary commands
+ *
+ */
+static void unittest_hex_conversion(void) {
+
+    u8 buffer[8];
+    char hex[17];
+
+    UT_ASSERT_EQUAL(4, shc_command_table_hex_to_bytes("0aFF1000", buffer, sizeof(buffer)));
+    UT_ASSERT(memcmp(buffer, "\x0A\xFF\x10\x00", 4) == 0);
+
+    shc_command_table_bytes_to_hex(buffer, 4, hex, sizeof(hex));
+    UT_ASSERT(strcmp(hex, "0AFF1000") == 0);
+
+    // stops at a blank, e.g. "0101 # comment"
+    UT_ASSERT_EQUAL(2, shc_command_table_hex_to_bytes("0101 0202", buffer, sizeof(buffer)));
+
+    UT_ASSERT_EQUAL(0, shc_command_table_hex_to_bytes("0G", buffer, sizeof(buffer)));
+    UT_ASSERT_EQUAL(0, shc_command_table_hex_to_bytes("010", buffer, sizeof(buffer)));
+    UT_ASSERT_EQUAL(0, shc_command_table_hex_to_bytes("010203", buffer, 2));
+
+    // the hex-string is truncated to the size of the buffer
+    shc_command_table_bytes_to_hex((const u8*)"\x01\x02\x03", 3, hex, 5);
+    UT_ASSERT(strcmp(hex, "0102") == 0);
+}
+
+// --------------------------------------------------------------------------------
+
+int main(void) {
+
+    alarm(60);
+
+    UT_RUN(unittest_lookup);
+    UT_RUN(unittest_lookup_many_commands);
+    UT_RUN(unittest_reload_on_change);
+    UT_RUN(unittest_reload_keeps_table_on_error);
+    UT_RUN(unittest_hex_conversion);
+
+    return UT_RESULT();
+}
+
+// --------------------------------------------------------------------------------
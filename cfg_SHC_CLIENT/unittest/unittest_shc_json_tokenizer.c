@@ -0,0 +1,256 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    unittest_shc_json_tokenizer.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Module-test of the in-place JSON tokenizer
+ *
+ * @see     shc_json_tokenizer.h
+ */
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+// --------------------------------------------------------------------------------
+
+#include "unittest.h"
+#include "shc_json_tokenizer.h"
+
+// --------------------------------------------------------------------------------
+
+#define UNITTEST_MAX_TOKENS                         32
+#define UNITTEST_PAYLOAD_MAX_LENGTH                 256
+
+// --------------------------------------------------------------------------------
+
+static char payload[UNITTEST_PAYLOAD_MAX_LENGTH];
+static SHC_JSON_TOKEN token_list[UNITTEST_MAX_TOKENS];
+static SHC_JSON_DOCUMENT document;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Copies the given payload into a writable buffer and tokenizes it
+ *
+ * @return number of tokens, 0 if the payload is invalid
+ */
+static u16 unittest_tokenize(const char* p_json, u16 max_tokens) {
+
+    snprintf(payload, sizeof(payload), "%s", p_json);
+
+    document.p_token_list = token_list;
+    document.max_tokens = max_tokens;
+    document.num_tokens = 0;
+
+    return shc_json_tokenize(&document, payload, (u16)strlen(payload));
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Token-list of the example of shc_json_tokenizer.h
+ *
+ */
+static void unittest_token_list(void) {
+
+    u16 num_tokens = unittest_tokenize("{\"commands\":[\"cmd_light_01_on\",\"cmd_light_02_off\"]}", UNITTEST_MAX_TOKENS);
+
+    UT_ASSERT_EQUAL(5, num_tokens);
+
+    UT_ASSERT_EQUAL(SHC_JSON_TYPE_OBJECT, token_list[0].type);
+    UT_ASSERT_EQUAL(1, token_list[0].size);
+    UT_ASSERT_EQUAL(5, token_list[0].next);
+
+    UT_ASSERT_EQUAL(SHC_JSON_TYPE_STRING, token_list[1].type);
+
+    UT_ASSERT_EQUAL(SHC_JSON_TYPE_ARRAY, token_list[2].type);
+    UT_ASSERT_EQUAL(2, token_list[2].size);
+    UT_ASSERT_EQUAL(5, token_list[2].next);
+
+    UT_ASSERT_EQUAL(1, shc_json_first_child(&document, 0));
+    UT_ASSERT_EQUAL(3, shc_json_first_child(&document, 2));
+    UT_ASSERT_EQUAL(4, token_list[3].next);
+
+    // strings without escape-sequence are terminated by the tokenizer
+    UT_ASSERT_EQUAL(1, token_list[3].terminated);
+    UT_ASSERT(shc_json_get_string(&document, 3) == &payload[token_list[3].start]);
+
+    UT_ASSERT(strcmp(shc_json_get_string(&document, 3), "cmd_light_01_on") == 0);
+    UT_ASSERT(strcmp(shc_json_get_string(&document, 4), "cmd_light_02_off") == 0);
+    UT_ASSERT(shc_json_get_string(&document, 2) == NULL);
+}
+
+/**
+ * @brief A member is found behind a nested value that is skipped,
+ * the typed accessors only accept their own type
+ *
+ */
+static void unittest_find_and_values(void) {
+
+    u16 num_tokens = unittest_tokenize(
+        " { \"nested\" : {\"a\":[1,2,{\"b\":3}]}, \"count\" : 42, \"big\":4294967296,"
+        " \"on\":true, \"off\":false, \"none\":null, \"name\":\"lamp\" } ",
+        UNITTEST_MAX_TOKENS
+    );
+
+    UT_ASSERT(num_tokens != 0);
+
+    u32 count = 0;
+    u32 big = 0;
+    u8 on = 0;
+    u8 off = 1;
+
+    UT_ASSERT(shc_json_get_u32(&document, shc_json_find(&document, 0, "count"), &count));
+    UT_ASSERT_EQUAL(42, count);
+    UT_ASSERT(shc_json_get_u32(&document, shc_json_find(&document, 0, "big"), &big) == 0);
+    UT_ASSERT(shc_json_get_bool(&document, shc_json_find(&document, 0, "on"), &on));
+    UT_ASSERT(shc_json_get_bool(&document, shc_json_find(&document, 0, "off"), &off));
+    UT_ASSERT_EQUAL(1, on);
+    UT_ASSERT_EQUAL(0, off);
+    UT_ASSERT(shc_json_get_bool(&document, shc_json_find(&document, 0, "none"), &on) == 0);
+    UT_ASSERT(shc_json_get_u32(&document, shc_json_find(&document, 0, "name"), &count) == 0);
+    UT_ASSERT(strcmp(shc_json_get_string(&document, shc_json_find(&document, 0, "name")), "lamp") == 0);
+
+    // members of nested objects are not members of the root
+    UT_ASSERT_EQUAL(SHC_JSON_NOT_FOUND, shc_json_find(&document, 0, "a"));
+    UT_ASSERT_EQUAL(SHC_JSON_NOT_FOUND, shc_json_find(&document, 0, "b"));
+    UT_ASSERT_EQUAL(SHC_JSON_NOT_FOUND, shc_json_find(&document, 0, "missing"));
+}
+
+/**
+ * @brief Escape-sequences are resolved in place on first access,
+ * a second access returns the same string
+ *
+ */
+static void unittest_escape_sequences(void) {
+
+    u16 num_tokens = unittest_tokenize("[\"a\\\"b\\\\c\\/d\\n\", \"\\u00e9\\u20ac\", \"\\ud83d\\ude00\"]", UNITTEST_MAX_TOKENS);
+
+    UT_ASSERT_EQUAL(4, num_tokens);
+
+    UT_ASSERT(strcmp(shc_json_get_string(&document, 1), "a\"b\\c/d\n") == 0);
+    UT_ASSERT(strcmp(shc_json_get_string(&document, 1), "a\"b\\c/d\n") == 0);
+    UT_ASSERT(strcmp(shc_json_get_string(&document, 2), "\xC3\xA9\xE2\x82\xAC") == 0);
+    UT_ASSERT(strcmp(shc_json_get_string(&document, 3), "\xF0\x9F\x98\x80") == 0);
+
+    // an escaped key is found before and after it was unescaped
+    UT_ASSERT(unittest_tokenize("{\"com\\u006dand\":\"cmd_a\"}", UNITTEST_MAX_TOKENS) != 0);
+    UT_ASSERT_EQUAL(0, token_list[1].terminated);
+    UT_ASSERT_EQUAL(1, token_list[2].terminated);
+    UT_ASSERT_EQUAL(SHC_JSON_NOT_FOUND, shc_json_find(&document, 0, "command"));
+    UT_ASSERT(strcmp(shc_json_get_string(&document, 1), "command") == 0);
+    UT_ASSERT_EQUAL(2, shc_json_find(&document, 0, "command"));
+}
+
+/**
+ * @brief Invalid payloads are rejected as a whole
+ *
+ */
+static void unittest_invalid_payload(void) {
+
+    static const char* invalid_list[] = {
+        "",
+        "   ",
+        "{",
+        "[1,2",
+        "{\"a\" 1}",
+        "{\"a\":1,}",
+        "[1,,2]",
+        "[1 2]",
+        "{1:2}",
+        "[\"unterminated]",
+        "[\"bad escape \\x\"]",
+        "[\"bad unicode \\u12g4\"]",
+        "[tru]",
+        "[1] [2]",
+        "{\"a\":1]"
+    };
+
+    u8 i = 0;
+    for ( ; i < sizeof(invalid_list) / sizeof(invalid_list[0]) ; i++) {
+
+        if (unittest_tokenize(invalid_list[i], UNITTEST_MAX_TOKENS) != 0) {
+            printf("    accepted: %s\n", invalid_list[i]);
+            UT_ASSERT(0);
+        }
+    }
+}
+
+/**
+ * @brief A payload with more tokens than available
+ * or with a deeper nesting than supported is rejected
+ *
+ */
+static void unittest_limits(void) {
+
+    UT_ASSERT_EQUAL(4, unittest_tokenize("[1,2,3]", 4));
+    UT_ASSERT_EQUAL(0, unittest_tokenize("[1,2,3,4]", 4));
+
+    char nested[UNITTEST_PAYLOAD_MAX_LENGTH];
+    u8 accepted = 0;
+
+    memset(nested, '[', SHC_JSON_TOKENIZER_MAX_DEPTH);
+    memset(nested + SHC_JSON_TOKENIZER_MAX_DEPTH, ']', SHC_JSON_TOKENIZER_MAX_DEPTH);
+    nested[SHC_JSON_TOKENIZER_MAX_DEPTH * 2] = '\0';
+
+    accepted = unittest_tokenize(nested, UNITTEST_MAX_TOKENS) != 0;
+    UT_ASSERT_EQUAL(1, accepted);
+
+    memset(nested, '[', SHC_JSON_TOKENIZER_MAX_DEPTH + 1);
+    memset(nested + SHC_JSON_TOKENIZER_MAX_DEPTH + 1, ']', SHC_JSON_TOKENIZER_MAX_DEPTH + 1);
+    nested[(SHC_JSON_TOKENIZER_MAX_DEPTH + 1) * 2] = '\0';
+
+    accepted = unittest_tokenize(nested, UNITTEST_MAX_TOKENS) != 0;
+    UT_ASSERT_EQUAL(0, accepted);
+}
+
+/**
+ * @brief Plain MQTT-messages are not structured
+ *
+ */
+static void unittest_is_structured(void) {
+
+    UT_ASSERT(shc_json_is_structured("  {\"command\":\"x\"}", 18));
+    UT_ASSERT(shc_json_is_structured("\n[]", 3));
+    UT_ASSERT(shc_json_is_structured("cmd_light_01_on", 15) == 0);
+    UT_ASSERT(shc_json_is_structured("   ", 3) == 0);
+    UT_ASSERT(shc_json_is_structured("", 0) == 0);
+}
+
+// --------------------------------------------------------------------------------
+
+int main(void) {
+
+    alarm(60);
+
+    UT_RUN(unittest_token_list);
+    UT_RUN(unittest_find_and_values);
+    UT_RUN(unittest_escape_sequences);
+    UT_RUN(unittest_invalid_payload);
+    UT_RUN(unittest_limits);
+    UT_RUN(unittest_is_structured);
+
+    return UT_RESULT();
+}
+
+// --------------------------------------------------------------------------------
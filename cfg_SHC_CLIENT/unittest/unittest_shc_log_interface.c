@@ -0,0 +1,336 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    unittest_shc_log_interface.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Module-test of the asynchronous log-backend
+ *
+ * @see     shc_log_interface.h
+ */
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+
+// --------------------------------------------------------------------------------
+
+#include "unittest.h"
+#include "shc_log_interface.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Must be equal to SHC_LOG_INTERFACE_QUEUE_SIZE of shc_log_interface.c
+ *
+ */
+#define UNITTEST_QUEUE_SIZE                         512
+
+#define UNITTEST_NUM_PRODUCERS                      4
+#define UNITTEST_RECORDS_PER_PRODUCER               5000
+
+#define UNITTEST_MAX_LINES                          (UNITTEST_NUM_PRODUCERS * UNITTEST_RECORDS_PER_PRODUCER + 16)
+#define UNITTEST_LINE_MAX_LENGTH                    256
+
+// --------------------------------------------------------------------------------
+
+static char directory[64];
+static char file_name[128];
+
+static char line_list[UNITTEST_MAX_LINES][UNITTEST_LINE_MAX_LENGTH];
+static u32 num_lines = 0;
+
+// --------------------------------------------------------------------------------
+
+static void unittest_sleep_ms(u32 time_ms) {
+
+    struct timespec duration;
+    duration.tv_sec = (time_t)(time_ms / 1000);
+    duration.tv_nsec = (long)(time_ms % 1000) * 1000000L;
+    nanosleep(&duration, NULL);
+}
+
+/**
+ * @brief Waits until the writer has written the given number of records
+ *
+ * @return 1 if the records have been written within timeout_ms
+ */
+static u8 unittest_wait_written(u32 expected, u32 timeout_ms) {
+
+    u32 waited_ms = 0;
+
+    for (;;) {
+
+        SHC_LOG_INTERFACE_STATISTIC statistic;
+        shc_log_interface_get_statistic(&statistic);
+
+        if (statistic.written >= expected) {
+            return 1;
+        }
+
+        if (waited_ms >= timeout_ms) {
+            return 0;
+        }
+
+        unittest_sleep_ms(5);
+        waited_ms += 5;
+    }
+}
+
+/**
+ * @brief Starts the log-backend with an empty directory
+ * that is not known to the log-backend yet
+ *
+ */
+static void unittest_setup(u8 policy, const char* p_flush_interval_ms) {
+
+    snprintf(directory, sizeof(directory), "/tmp/unittest_shc_log_XXXXXX");
+
+    if (mkdtemp(directory) == NULL) {
+        perror("mkdtemp");
+        exit(1);
+    }
+
+    snprintf(file_name, sizeof(file_name), "%s/shc_log.txt", directory);
+
+    unittest_signal_reset();
+    shc_log_interface_init();
+    shc_log_interface_set_overflow_policy(policy);
+    unittest_send_cfg_object("LOG_FLUSH_INTERVAL_MS", p_flush_interval_ms);
+}
+
+static void unittest_set_file_path(void) {
+
+    char path[80];
+    snprintf(path, sizeof(path), "%s/", directory);
+    unittest_send_cfg_object("LOG_FILE_PATH", path);
+}
+
+/**
+ * @brief Stops the log-backend and reads the log-file into line_list,
+ * the time-stamp of every record is skipped
+ *
+ */
+static void unittest_teardown(void) {
+
+    shc_log_interface_deinit();
+
+    num_lines = 0;
+
+    FILE* p_file = fopen(file_name, "r");
+    if (p_file != NULL) {
+
+        char line[UNITTEST_LINE_MAX_LENGTH];
+
+        while (num_lines < UNITTEST_MAX_LINES && fgets(line, sizeof(line), p_file) != NULL) {
+
+            line[strcspn(line, "\n")] = '\0';
+
+            const char* p_message = strstr(line, " - ");
+            snprintf(line_list[num_lines], UNITTEST_LINE_MAX_LENGTH, "%s", p_message != NULL && line[0] != '-' ? p_message + 3 : line);
+            num_lines += 1;
+        }
+
+        fclose(p_file);
+        unlink(file_name);
+    }
+
+    rmdir(directory);
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Records logged before LOG_FILE_PATH is known are kept
+ * and written in order as soon as the log-file is opened
+ *
+ */
+static void unittest_records_before_file_path(void) {
+
+    unittest_setup(SHC_LOG_INTERFACE_OVERFLOW_DROP_NEWEST, "10");
+
+    u32 i = 0;
+    for ( ; i < 10 ; i++) {
+        char number[16];
+        snprintf(number, sizeof(number), "%u", i);
+        log_message_string("record ", number);
+    }
+
+    unittest_sleep_ms(50);
+
+    SHC_LOG_INTERFACE_STATISTIC statistic;
+    shc_log_interface_get_statistic(&statistic);
+
+    unittest_set_file_path();
+    u8 written = unittest_wait_written(10, 2000);
+
+    unittest_teardown();
+
+    UT_ASSERT_EQUAL(0, statistic.written);
+    UT_ASSERT_EQUAL(10, statistic.queue_depth);
+    UT_ASSERT(written);
+    UT_ASSERT_EQUAL(10, num_lines);
+
+    for (i = 0 ; i < 10 ; i++) {
+        char expected[32];
+        snprintf(expected, sizeof(expected), "record %u", i);
+        UT_ASSERT(strcmp(line_list[i], expected) == 0);
+    }
+}
+
+/**
+ * @brief BLOCK must not block while no log-file is available,
+ * the dropped records are counted and reported inside of the log-file
+ *
+ */
+static void unittest_overflow_without_file(void) {
+
+    unittest_setup(SHC_LOG_INTERFACE_OVERFLOW_BLOCK, "10");
+
+    u32 i = 0;
+    for ( ; i < UNITTEST_QUEUE_SIZE + 20 ; i++) {
+        log_message("overflow");
+    }
+
+    SHC_LOG_INTERFACE_STATISTIC statistic;
+    shc_log_interface_get_statistic(&statistic);
+
+    unittest_set_file_path();
+    u8 written = unittest_wait_written(UNITTEST_QUEUE_SIZE, 2000);
+
+    unittest_teardown();
+
+    UT_ASSERT_EQUAL(20, statistic.dropped);
+    UT_ASSERT_EQUAL(20, statistic.dropped_without_file);
+    UT_ASSERT(written);
+    UT_ASSERT_EQUAL(UNITTEST_QUEUE_SIZE + 1, num_lines);
+    UT_ASSERT(strstr(line_list[UNITTEST_QUEUE_SIZE], "20 records dropped") != NULL);
+}
+
+/**
+ * @brief The writer is woken up before the flush-interval has expired
+ * as soon as the ring-buffer is half full, not earlier
+ *
+ */
+static void unittest_wakeup_at_half_full(void) {
+
+    unittest_setup(SHC_LOG_INTERFACE_OVERFLOW_DROP_NEWEST, "60000");
+    unittest_set_file_path();
+
+    // the writer opens the log-file and waits for the next flush-interval
+    unittest_sleep_ms(100);
+
+    u32 i = 0;
+    for ( ; i < UNITTEST_QUEUE_SIZE / 2 - 1 ; i++) {
+        log_message("below threshold");
+    }
+
+    u8 written_early = unittest_wait_written(1, 300);
+
+    log_message("threshold");
+    u8 written = unittest_wait_written(UNITTEST_QUEUE_SIZE / 2, 2000);
+
+    unittest_teardown();
+
+    UT_ASSERT(written_early == 0);
+    UT_ASSERT(written);
+    UT_ASSERT_EQUAL(UNITTEST_QUEUE_SIZE / 2, num_lines);
+}
+
+static void* unittest_producer_thread(void* p_argument) {
+
+    u32 producer = (u32)(uintptr_t)p_argument;
+
+    u32 i = 0;
+    for ( ; i < UNITTEST_RECORDS_PER_PRODUCER ; i++) {
+        char message[64];
+        snprintf(message, sizeof(message), "producer %u record %u", producer, i);
+        log_message(message);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief With BLOCK no record of concurrent producers is lost
+ * and the records of every producer stay in order
+ *
+ */
+static void unittest_concurrent_producers_block(void) {
+
+    unittest_setup(SHC_LOG_INTERFACE_OVERFLOW_BLOCK, "10");
+    unittest_set_file_path();
+    unittest_sleep_ms(50);
+
+    pthread_t thread_list[UNITTEST_NUM_PRODUCERS];
+
+    u32 i = 0;
+    for ( ; i < UNITTEST_NUM_PRODUCERS ; i++) {
+        pthread_create(&thread_list[i], NULL, unittest_producer_thread, (void*)(uintptr_t)i);
+    }
+
+    for (i = 0 ; i < UNITTEST_NUM_PRODUCERS ; i++) {
+        pthread_join(thread_list[i], NULL);
+    }
+
+    unittest_teardown();
+
+    SHC_LOG_INTERFACE_STATISTIC statistic;
+    shc_log_interface_get_statistic(&statistic);
+
+    UT_ASSERT_EQUAL(0, statistic.dropped);
+    UT_ASSERT_EQUAL(UNITTEST_NUM_PRODUCERS * UNITTEST_RECORDS_PER_PRODUCER, statistic.written);
+    UT_ASSERT_EQUAL(UNITTEST_NUM_PRODUCERS * UNITTEST_RECORDS_PER_PRODUCER, num_lines);
+
+    u32 next_record[UNITTEST_NUM_PRODUCERS] = { 0 };
+
+    for (i = 0 ; i < num_lines ; i++) {
+
+        u32 producer = 0;
+        u32 record = 0;
+
+        UT_ASSERT(sscanf(line_list[i], "producer %u record %u", &producer, &record) == 2);
+        UT_ASSERT(producer < UNITTEST_NUM_PRODUCERS);
+        UT_ASSERT_EQUAL(next_record[producer], record);
+
+        next_record[producer] += 1;
+    }
+}
+
+// --------------------------------------------------------------------------------
+
+int main(void) {
+
+    // a blocked producer must fail the test instead of hanging forever
+    alarm(60);
+
+    UT_RUN(unittest_records_before_file_path);
+    UT_RUN(unittest_overflow_without_file);
+    UT_RUN(unittest_wakeup_at_half_full);
+    UT_RUN(unittest_concurrent_producers_block);
+
+    return UT_RESULT();
+}
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,483 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    unittest_shc_mqtt_interface.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Module-test of the MQTT publish-queue: QoS of the message-
+ *          classes, in-flight window, acknowledge-timeout and reconnect.
+ *          The broker is replaced by the fake client of stub/mqtt_client_stub.c
+ *
+ * @see     shc_mqtt_interface.h
+ */
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <MQTTClient.h>
+
+// --------------------------------------------------------------------------------
+
+#include "unittest.h"
+#include "ui/cfg_file_parser/cfg_file_parser.h"
+#include "shc_event_loop.h"
+#include "shc_metrics.h"
+#include "shc_mqtt_interface.h"
+
+// --------------------------------------------------------------------------------
+
+#define UNITTEST_HOST_ADDRESS                       "tcp://localhost:1883"
+#define UNITTEST_TOPIC_NAME                         "shc/unittest"
+
+#define UNITTEST_TIMEOUT                            0xFFFFFFFF
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Replacement of the latency-histograms of shc_metrics.c
+ *
+ */
+void shc_metrics_add_latency(u8 stage, const char* p_key, u16 key_length, u32 latency_us) {
+    (void) stage;
+    (void) p_key;
+    (void) key_length;
+    (void) latency_us;
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Configures the client with the given settings, it connects
+ * to the fake broker after unittest_configuration_complete()
+ *
+ */
+static void unittest_setup(const char* p_qos_state, const char* p_qos_event, const char* p_max_inflight, const char* p_timeout_ms) {
+
+    unittest_signal_reset();
+    unittest_mqtt_reset();
+
+    shc_event_loop_init();
+    shc_mqtt_interface_init();
+
+    unittest_send_cfg_object("MQTT_HOST_ADDRESS", UNITTEST_HOST_ADDRESS);
+    unittest_send_cfg_object("MQTT_CLIENT_ID", "unittest");
+    unittest_send_cfg_object("MQTT_TOPIC_NAME", UNITTEST_TOPIC_NAME);
+    unittest_send_cfg_object("MQTT_WELCOME_MESSAGE", "");
+    unittest_send_cfg_object("MQTT_TIMEOUT", p_timeout_ms);
+    unittest_send_cfg_object("MQTT_MAX_INFLIGHT", p_max_inflight);
+    unittest_send_cfg_object("MQTT_QOS_STATE", p_qos_state);
+    unittest_send_cfg_object("MQTT_QOS_EVENT", p_qos_event);
+    unittest_send_cfg_object("MQTT_RECONNECT_INTERVAL_MS", "100");
+}
+
+static void unittest_teardown(void) {
+
+    shc_mqtt_interface_deinit();
+    shc_event_loop_deinit();
+}
+
+static void unittest_configuration_complete(void) {
+    CFG_PARSER_CFG_COMPLETE_SIGNAL_send(NULL);
+}
+
+static void unittest_send(const char* p_message) {
+    MQTT_MESSAGE_TO_SEND_SIGNAL_send(p_message);
+}
+
+/**
+ * @brief Runs the main-loop until the given signal was sent
+ * the given number of times
+ *
+ * @return time in milliseconds or UNITTEST_TIMEOUT
+ */
+static u32 unittest_run_until_signal(const char* p_signal_name, u32 count, u32 timeout_ms) {
+
+    u64 start_us = shc_event_loop_time_us();
+    u64 end_us = start_us + (u64)timeout_ms * 1000ULL;
+
+    while (shc_event_loop_time_us() < end_us) {
+
+        shc_mqtt_interface_task();
+
+        if (unittest_signal_count(p_signal_name) >= count) {
+            return (u32)((shc_event_loop_time_us() - start_us) / 1000ULL);
+        }
+
+        shc_event_loop_set_deadline(5);
+        shc_event_loop_wait();
+    }
+
+    return UNITTEST_TIMEOUT;
+}
+
+/**
+ * @brief Runs the main-loop for the given time
+ *
+ */
+static void unittest_run(u32 time_ms) {
+    unittest_run_until_signal("UNITTEST_NEVER_SENT", 1, time_ms);
+}
+
+static u8 unittest_is_published(u32 index, const char* p_payload, int qos) {
+
+    const UNITTEST_MQTT_PUBLISH* p_publish = unittest_mqtt_get_published(index);
+
+    return p_publish != NULL
+        && strcmp(p_publish->payload, p_payload) == 0
+        && strcmp(p_publish->topic, UNITTEST_TOPIC_NAME) == 0
+        && p_publish->qos == qos;
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief States are published with MQTT_QOS_STATE, events with MQTT_QOS_EVENT.
+ * A message with QoS 0 is complete as soon as it was published,
+ * all other messages after the acknowledge of the broker.
+ *
+ */
+static void unittest_qos_of_state_and_event(void) {
+
+    unittest_setup("0", "1", "8", "1000");
+    unittest_configuration_complete();
+
+    u32 connect_time_ms = unittest_run_until_signal("MQTT_CONNECTION_ESTABLISHED_SIGNAL", 1, 1000);
+
+    unittest_send("temperature=21");
+    unittest_send("evt_motion");
+    unittest_run(20);
+
+    u32 num_published = unittest_mqtt_num_published();
+    u8 state_published = unittest_is_published(0, "temperature=21", 0);
+    u8 event_published = unittest_is_published(1, "evt_motion", 1);
+    u32 succeed_before_ack = unittest_signal_count("MQTT_MESSAGE_SEND_SUCCEED_SIGNAL");
+
+    unittest_mqtt_acknowledge(1);
+    u32 ack_time_ms = unittest_run_until_signal("MQTT_MESSAGE_SEND_SUCCEED_SIGNAL", 2, 1000);
+
+    SHC_MQTT_INTERFACE_STATISTIC statistic;
+    shc_mqtt_interface_get_statistic(&statistic);
+
+    unittest_teardown();
+
+    UT_ASSERT(connect_time_ms != UNITTEST_TIMEOUT);
+    UT_ASSERT_EQUAL(2, num_published);
+    UT_ASSERT(state_published);
+    UT_ASSERT(event_published);
+    UT_ASSERT_EQUAL(1, succeed_before_ack);
+    UT_ASSERT(ack_time_ms != UNITTEST_TIMEOUT);
+    UT_ASSERT_EQUAL(2, statistic.published);
+    UT_ASSERT_EQUAL(0, statistic.queue_depth);
+}
+
+/**
+ * @brief The QoS of both classes is taken from the configuration-file
+ *
+ */
+static void unittest_qos_from_configuration(void) {
+
+    unittest_setup("2", "0", "8", "1000");
+    unittest_configuration_complete();
+
+    unittest_run_until_signal("MQTT_CONNECTION_ESTABLISHED_SIGNAL", 1, 1000);
+
+    unittest_send("humidity=40");
+    unittest_send("evt_door");
+    unittest_run(20);
+
+    u8 state_published = unittest_is_published(0, "humidity=40", 2);
+    u8 event_published = unittest_is_published(1, "evt_door", 0);
+    u32 succeed_before_ack = unittest_signal_count("MQTT_MESSAGE_SEND_SUCCEED_SIGNAL");
+
+    unittest_mqtt_acknowledge(0);
+    u32 ack_time_ms = unittest_run_until_signal("MQTT_MESSAGE_SEND_SUCCEED_SIGNAL", 2, 1000);
+
+    unittest_teardown();
+
+    UT_ASSERT(state_published);
+    UT_ASSERT(event_published);
+    UT_ASSERT_EQUAL(1, succeed_before_ack);
+    UT_ASSERT(ack_time_ms != UNITTEST_TIMEOUT);
+}
+
+/**
+ * @brief Not more than MQTT_MAX_INFLIGHT messages wait for their
+ * acknowledge, the next message is published after an acknowledge
+ *
+ */
+static void unittest_inflight_window(void) {
+
+    unittest_setup("0", "1", "2", "1000");
+    unittest_configuration_complete();
+
+    unittest_run_until_signal("MQTT_CONNECTION_ESTABLISHED_SIGNAL", 1, 1000);
+
+    u32 i = 0;
+    for ( ; i < 5 ; i++) {
+        char message[16];
+        snprintf(message, sizeof(message), "evt_%u", i);
+        unittest_send(message);
+    }
+
+    unittest_run(20);
+    u32 published_before_ack = unittest_mqtt_num_published();
+
+    unittest_mqtt_acknowledge(0);
+    unittest_run_until_signal("MQTT_MESSAGE_SEND_SUCCEED_SIGNAL", 1, 1000);
+    unittest_run(20);
+    u32 published_after_ack = unittest_mqtt_num_published();
+
+    u8 third_published = unittest_is_published(2, "evt_2", 1);
+    int max_inflight = unittest_mqtt_get_calls()->max_inflight;
+
+    SHC_MQTT_INTERFACE_STATISTIC statistic;
+    shc_mqtt_interface_get_statistic(&statistic);
+
+    unittest_teardown();
+
+    UT_ASSERT_EQUAL(2, published_before_ack);
+    UT_ASSERT_EQUAL(3, published_after_ack);
+    UT_ASSERT(third_published);
+    UT_ASSERT_EQUAL(2, max_inflight);
+    UT_ASSERT_EQUAL(2, statistic.inflight_high_water);
+}
+
+/**
+ * @brief A message that is not acknowledged within MQTT_TIMEOUT has failed,
+ * a late acknowledge is ignored
+ *
+ */
+static void unittest_acknowledge_timeout(void) {
+
+    unittest_setup("0", "1", "8", "100");
+    unittest_configuration_complete();
+
+    unittest_run_until_signal("MQTT_CONNECTION_ESTABLISHED_SIGNAL", 1, 1000);
+
+    unittest_send("evt_lost");
+    u32 fail_time_ms = unittest_run_until_signal("MQTT_MESSAGE_SEND_FAILED_SIGNAL", 1, 2000);
+
+    unittest_mqtt_acknowledge(0);
+    unittest_run(20);
+
+    u32 num_succeed = unittest_signal_count("MQTT_MESSAGE_SEND_SUCCEED_SIGNAL");
+
+    SHC_MQTT_INTERFACE_STATISTIC statistic;
+    shc_mqtt_interface_get_statistic(&statistic);
+
+    unittest_teardown();
+
+    UT_ASSERT(fail_time_ms != UNITTEST_TIMEOUT);
+    UT_ASSERT(fail_time_ms >= 90);
+    UT_ASSERT(fail_time_ms < 600);
+    UT_ASSERT_EQUAL(0, num_succeed);
+    UT_ASSERT_EQUAL(1, statistic.failed);
+    UT_ASSERT_EQUAL(0, statistic.queue_depth);
+}
+
+/**
+ * @brief A failed connect is retried after MQTT_RECONNECT_INTERVAL_MS.
+ * Messages are queued meanwhile, a state is replaced by a newer one
+ * of the same name and events are published in order.
+ *
+ */
+static void unittest_reconnect_after_failed_connect(void) {
+
+    unittest_setup("1", "1", "8", "1000");
+    unittest_mqtt_fail_connects(2);
+    unittest_configuration_complete();
+
+    unittest_send("temperature=20");
+    unittest_send("evt_a");
+    unittest_send("temperature=21");
+    unittest_send("evt_b");
+
+    u32 connect_time_ms = unittest_run_until_signal("MQTT_CONNECTION_ESTABLISHED_SIGNAL", 1, 2000);
+    unittest_run(20);
+
+    u32 num_failed_connects = unittest_signal_count("MQTT_CONNECTION_FAILED_SIGNAL");
+    u32 num_connects = unittest_mqtt_get_calls()->connect;
+    u32 num_published = unittest_mqtt_num_published();
+
+    u8 order_ok = unittest_is_published(0, "temperature=21", 1)
+        && unittest_is_published(1, "evt_a", 1)
+        && unittest_is_published(2, "evt_b", 1);
+
+    SHC_MQTT_INTERFACE_STATISTIC statistic;
+    shc_mqtt_interface_get_statistic(&statistic);
+
+    unittest_teardown();
+
+    UT_ASSERT(connect_time_ms != UNITTEST_TIMEOUT);
+    UT_ASSERT(connect_time_ms >= 190);
+    UT_ASSERT_EQUAL(2, num_failed_connects);
+    UT_ASSERT_EQUAL(3, num_connects);
+    UT_ASSERT_EQUAL(3, num_published);
+    UT_ASSERT(order_ok);
+    UT_ASSERT_EQUAL(1, statistic.coalesced);
+}
+
+/**
+ * @brief Messages that were in flight when the connection was lost
+ * are published again after the reconnect and complete only once
+ *
+ */
+static void unittest_reconnect_republishes_inflight(void) {
+
+    unittest_setup("1", "1", "8", "1000");
+    unittest_configuration_complete();
+
+    unittest_run_until_signal("MQTT_CONNECTION_ESTABLISHED_SIGNAL", 1, 1000);
+
+    unittest_send("evt_first");
+    unittest_send("evt_second");
+    unittest_run(20);
+
+    unittest_mqtt_lose_connection("broker restarted");
+
+    u32 reconnect_time_ms = unittest_run_until_signal("MQTT_CONNECTION_ESTABLISHED_SIGNAL", 2, 1000);
+    unittest_run(20);
+
+    u32 num_lost = unittest_signal_count("MQTT_CONNECTION_LOST_SIGNAL");
+    u32 num_published = unittest_mqtt_num_published();
+    u8 republished = unittest_is_published(2, "evt_first", 1) && unittest_is_published(3, "evt_second", 1);
+
+    // the acknowledge of the first publish was lost together with the connection
+    u8 stale_ack_sent = unittest_mqtt_acknowledge(0);
+    unittest_mqtt_acknowledge(2);
+    unittest_mqtt_acknowledge(3);
+
+    unittest_run_until_signal("MQTT_MESSAGE_SEND_SUCCEED_SIGNAL", 2, 1000);
+    unittest_run(20);
+
+    u32 num_succeed = unittest_signal_count("MQTT_MESSAGE_SEND_SUCCEED_SIGNAL");
+    u32 num_failed = unittest_signal_count("MQTT_MESSAGE_SEND_FAILED_SIGNAL");
+
+    unittest_teardown();
+
+    UT_ASSERT_EQUAL(1, num_lost);
+    UT_ASSERT(reconnect_time_ms != UNITTEST_TIMEOUT);
+    UT_ASSERT_EQUAL(4, num_published);
+    UT_ASSERT(republished);
+    UT_ASSERT(stale_ack_sent);
+    UT_ASSERT_EQUAL(2, num_succeed);
+    UT_ASSERT_EQUAL(0, num_failed);
+}
+
+/**
+ * @brief A new topic is subscribed without reconnect,
+ * a new host-address creates a new client
+ *
+ */
+static void unittest_reload_of_configuration(void) {
+
+    unittest_setup("0", "1", "8", "1000");
+    unittest_configuration_complete();
+
+    unittest_run_until_signal("MQTT_CONNECTION_ESTABLISHED_SIGNAL", 1, 1000);
+
+    unittest_send_cfg_object("MQTT_TOPIC_NAME", "shc/unittest_new");
+    unittest_configuration_complete();
+    unittest_run(20);
+
+    UNITTEST_MQTT_CALLS calls_after_topic = *unittest_mqtt_get_calls();
+
+    unittest_send_cfg_object("MQTT_HOST_ADDRESS", "tcp://otherhost:1883");
+    unittest_configuration_complete();
+    u32 reconnect_time_ms = unittest_run_until_signal("MQTT_CONNECTION_ESTABLISHED_SIGNAL", 2, 1000);
+
+    UNITTEST_MQTT_CALLS calls_after_host = *unittest_mqtt_get_calls();
+
+    // restore the topic of the other test-cases
+    unittest_send_cfg_object("MQTT_TOPIC_NAME", UNITTEST_TOPIC_NAME);
+    unittest_teardown();
+
+    UT_ASSERT_EQUAL(1, calls_after_topic.connect);
+    UT_ASSERT_EQUAL(1, calls_after_topic.unsubscribe);
+    UT_ASSERT(strcmp(calls_after_topic.unsubscribed_topic, UNITTEST_TOPIC_NAME) == 0);
+    UT_ASSERT(strcmp(calls_after_topic.subscribed_topic, "shc/unittest_new") == 0);
+
+    UT_ASSERT(reconnect_time_ms != UNITTEST_TIMEOUT);
+    UT_ASSERT_EQUAL(1, calls_after_host.destroy);
+    UT_ASSERT_EQUAL(2, calls_after_host.create);
+    UT_ASSERT_EQUAL(2, calls_after_host.connect);
+    UT_ASSERT(strcmp(calls_after_host.server_uri, "tcp://otherhost:1883") == 0);
+}
+
+/**
+ * @brief A connection-parameter that does not fit is ignored,
+ * the client is not created again
+ *
+ */
+static void unittest_value_too_long(void) {
+
+    char host_address[200];
+    memset(host_address, 'x', sizeof(host_address) - 1);
+    memcpy(host_address, "tcp://", 6);
+    host_address[sizeof(host_address) - 1] = '\0';
+
+    unittest_setup("0", "1", "8", "1000");
+    unittest_configuration_complete();
+
+    unittest_run_until_signal("MQTT_CONNECTION_ESTABLISHED_SIGNAL", 1, 1000);
+
+    unittest_send_cfg_object("MQTT_HOST_ADDRESS", host_address);
+    unittest_send_cfg_object("MQTT_TOPIC_NAME", host_address);
+    unittest_configuration_complete();
+    unittest_run(50);
+
+    // the same value again is no change
+    unittest_send_cfg_object("MQTT_HOST_ADDRESS", UNITTEST_HOST_ADDRESS);
+    unittest_configuration_complete();
+    unittest_run(50);
+
+    UNITTEST_MQTT_CALLS calls = *unittest_mqtt_get_calls();
+
+    unittest_teardown();
+
+    UT_ASSERT_EQUAL(1, calls.create);
+    UT_ASSERT_EQUAL(0, calls.destroy);
+    UT_ASSERT_EQUAL(1, calls.connect);
+    UT_ASSERT_EQUAL(0, calls.unsubscribe);
+    UT_ASSERT(strcmp(calls.server_uri, UNITTEST_HOST_ADDRESS) == 0);
+}
+
+// --------------------------------------------------------------------------------
+
+int main(void) {
+
+    alarm(60);
+
+    UT_RUN(unittest_qos_of_state_and_event);
+    UT_RUN(unittest_qos_from_configuration);
+    UT_RUN(unittest_inflight_window);
+    UT_RUN(unittest_acknowledge_timeout);
+    UT_RUN(unittest_reconnect_after_failed_connect);
+    UT_RUN(unittest_reconnect_republishes_inflight);
+    UT_RUN(unittest_reload_of_configuration);
+    UT_RUN(unittest_value_too_long);
+
+    return UT_RESULT();
+}
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,147 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    unittest_shc_rpi_batch.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Module-test of the batch-frame of the rpi host-protocol.
+ *          The responses are the responses of
+ *          cfg_rpi_hat_control_board_v2/cmd_handler_batch.c
+ *
+ * @see     shc_rpi_batch.h
+ */
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include <string.h>
+#include <unistd.h>
+
+// --------------------------------------------------------------------------------
+
+#include "unittest.h"
+#include "shc_rpi_batch.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief rpt_light_01=com:020501 and rpt_temperature=com:0107
+ *
+ */
+static void unittest_build(void) {
+
+    const u8 rpt_light_01[] = {0x02, 0x05, 0x01};
+    const u8 rpt_temperature[] = {0x01, 0x07};
+    const u8 invalid[] = {0x05, 0x07};
+
+    const u8 expected[] = {
+        0x07, SHC_RPI_BATCH_COMMAND_ID, 2,
+        0x02, 0x05, 0x01,
+        0x01, 0x07
+    };
+
+    u8 frame[SHC_RPI_BATCH_MAX_FRAME_LENGTH];
+    SHC_RPI_BATCH_BUILDER builder;
+
+    shc_rpi_batch_start(&builder, frame, sizeof(frame));
+
+    u8 added_light = shc_rpi_batch_add(&builder, rpt_light_01, sizeof(rpt_light_01));
+    u8 added_invalid = shc_rpi_batch_add(&builder, invalid, sizeof(invalid));
+    u8 added_temperature = shc_rpi_batch_add(&builder, rpt_temperature, sizeof(rpt_temperature));
+    u16 length = shc_rpi_batch_finish(&builder);
+
+    UT_ASSERT(added_light);
+    UT_ASSERT_EQUAL(0, added_invalid);
+    UT_ASSERT(added_temperature);
+    UT_ASSERT_EQUAL(sizeof(expected), length);
+    UT_ASSERT(memcmp(expected, frame, sizeof(expected)) == 0);
+}
+
+/**
+ * @brief The second command has no handler inside of the batch
+ *
+ */
+static void unittest_unknown_command(void) {
+
+    const u8 response[] = {
+        SHC_RPI_BATCH_COMMAND_ID, SHC_RPI_BATCH_STATUS_OK, 3,
+        0x03, 0x05, 0x00, 0x01,
+        0x02, 0x30, SHC_RPI_BATCH_STATUS_UNKNOWN_COMMAND,
+        0x03, 0x07, 0x00, 21
+    };
+
+    SHC_RPI_BATCH_ITERATOR iterator;
+    const u8* p_response = NULL;
+    u16 length = 0;
+    u8 processed_list[4] = {0, 0, 0, 0};
+    u8 count = 0;
+
+    UT_ASSERT(shc_rpi_batch_begin(&iterator, response, sizeof(response), 3));
+
+    while (shc_rpi_batch_next(&iterator, &p_response, &length) && count < sizeof(processed_list)) {
+        processed_list[count++] = shc_rpi_batch_is_processed(p_response, length);
+    }
+
+    UT_ASSERT_EQUAL(3, count);
+    UT_ASSERT_EQUAL(1, processed_list[0]);
+    UT_ASSERT_EQUAL(0, processed_list[1]);
+    UT_ASSERT_EQUAL(1, processed_list[2]);
+}
+
+/**
+ * @brief A truncated batch is valid, more responses than commands are not
+ *
+ */
+static void unittest_truncated(void) {
+
+    const u8 response[] = {
+        SHC_RPI_BATCH_COMMAND_ID, SHC_RPI_BATCH_STATUS_OK, 1,
+        0x03, 0x07, 0x00, 21
+    };
+
+    const u8 not_supported[] = {
+        SHC_RPI_BATCH_COMMAND_ID, 0xFF
+    };
+
+    SHC_RPI_BATCH_ITERATOR iterator;
+    const u8* p_response = NULL;
+    u16 length = 0;
+
+    UT_ASSERT(shc_rpi_batch_begin(&iterator, response, sizeof(response), 3));
+    UT_ASSERT(shc_rpi_batch_next(&iterator, &p_response, &length));
+    UT_ASSERT_EQUAL(3, length);
+    UT_ASSERT_EQUAL(0, shc_rpi_batch_next(&iterator, &p_response, &length));
+
+    UT_ASSERT_EQUAL(0, shc_rpi_batch_begin(&iterator, response, sizeof(response), 0));
+    UT_ASSERT_EQUAL(0, shc_rpi_batch_begin(&iterator, not_supported, sizeof(not_supported), 1));
+}
+
+// --------------------------------------------------------------------------------
+
+int main(void) {
+
+    alarm(60);
+
+    UT_RUN(unittest_build);
+    UT_RUN(unittest_unknown_command);
+    UT_RUN(unittest_truncated);
+
+    return UT_RESULT();
+}
+
+// --------------------------------------------------------------------------------
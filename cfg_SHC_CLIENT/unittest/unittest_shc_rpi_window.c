@@ -0,0 +1,126 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    unittest_shc_rpi_window.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Module-test of the windowed mode of the rpi host-protocol.
+ *          The responses are the responses of
+ *          cfg_rpi_hat_control_board_v2/cmd_handler_sequence.c
+ *
+ * @see     shc_rpi_window.h
+ */
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include <string.h>
+#include <unistd.h>
+
+// --------------------------------------------------------------------------------
+
+#include "unittest.h"
+#include "shc_rpi_window.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Submit of cmd_light_01_off=com:03040100
+ *
+ */
+static void unittest_submit(void) {
+
+    const u8 cmd_light_01_off[] = {0x03, 0x04, 0x01, 0x00};
+
+    const u8 expected[] = {
+        0x06, SHC_RPI_WINDOW_COMMAND_ID, 0x11, 0x03, 0x04, 0x01, 0x00
+    };
+
+    u8 frame[SHC_RPI_WINDOW_MAX_FRAME_LENGTH];
+    u16 length = shc_rpi_window_build_submit(frame, sizeof(frame), 0x11, cmd_light_01_off, sizeof(cmd_light_01_off));
+
+    UT_ASSERT_EQUAL(sizeof(expected), length);
+    UT_ASSERT(memcmp(expected, frame, sizeof(expected)) == 0);
+}
+
+/**
+ * @brief The second completion has no handler inside of the sequence
+ *
+ */
+static void unittest_unknown_command(void) {
+
+    const u8 response[] = {
+        SHC_RPI_WINDOW_COMMAND_ID, SHC_RPI_WINDOW_STATUS_OK, 3,
+        0x11, 0x02, 0x04, 0x00,
+        0x12, 0x02, 0x30, SHC_RPI_WINDOW_STATUS_UNKNOWN_COMMAND,
+        0x13, 0x03, 0x07, 0x00, 21
+    };
+
+    SHC_RPI_WINDOW_ITERATOR iterator;
+    const u8* p_response = NULL;
+    u16 length = 0;
+    u8 sequence = 0;
+    u8 sequence_list[4] = {0, 0, 0, 0};
+    u8 processed_list[4] = {0, 0, 0, 0};
+    u8 count = 0;
+
+    UT_ASSERT(shc_rpi_window_begin(&iterator, response, sizeof(response)));
+
+    while (shc_rpi_window_next(&iterator, &sequence, &p_response, &length) && count < sizeof(processed_list)) {
+        sequence_list[count] = sequence;
+        processed_list[count++] = shc_rpi_window_is_processed(p_response, length);
+    }
+
+    UT_ASSERT_EQUAL(3, count);
+    UT_ASSERT_EQUAL(0x11, sequence_list[0]);
+    UT_ASSERT_EQUAL(1, processed_list[0]);
+    UT_ASSERT_EQUAL(0x12, sequence_list[1]);
+    UT_ASSERT_EQUAL(0, processed_list[1]);
+    UT_ASSERT_EQUAL(0x13, sequence_list[2]);
+    UT_ASSERT_EQUAL(1, processed_list[2]);
+}
+
+/**
+ * @brief A control-board without CMD_SEQUENCE answers with an error-status
+ *
+ */
+static void unittest_not_supported(void) {
+
+    const u8 response[] = {
+        SHC_RPI_WINDOW_COMMAND_ID, 0xFF, 0
+    };
+
+    SHC_RPI_WINDOW_ITERATOR iterator;
+
+    UT_ASSERT_EQUAL(0, shc_rpi_window_begin(&iterator, response, sizeof(response)));
+}
+
+// --------------------------------------------------------------------------------
+
+int main(void) {
+
+    alarm(60);
+
+    UT_RUN(unittest_submit);
+    UT_RUN(unittest_unknown_command);
+    UT_RUN(unittest_not_supported);
+
+    return UT_RESULT();
+}
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,26 @@
+#ifndef   _config_H_ /* parse include file only once */
+#define   _config_H_
+
+//-------------------------------------------------------------------------
+
+/**
+ * shcLoadTest does not use the framework, so it can be build
+ * and run on any linux-system without a control-board.
+ */
+
+#include <stdint.h>
+
+typedef uint8_t     u8;
+typedef uint16_t    u16;
+typedef uint32_t    u32;
+typedef uint64_t    u64;
+typedef int32_t     i32;
+
+//-------------------------------------------------------------------------
+
+#define VERSION_MAJOR                                   1
+#define VERSION_MINOR                                   0
+
+//-------------------------------------------------------------------------
+
+#endif /* _config_H_ */
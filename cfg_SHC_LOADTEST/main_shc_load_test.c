@@ -0,0 +1,319 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    main_shc_load_test.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   SHC Load-Test main source file
+ *          End-to-end load-test of the shcClient without control-board
+ *          and without MQTT-broker. Provides a simulated control-board,
+ *          a minimal MQTT-broker and a load-generator. The shcClient is
+ *          started separately with a configuration that uses both,
+ *          see cfg/shc_load_test_configuration_file.txt
+ *
+ */
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <pthread.h>
+
+// --------------------------------------------------------------------------------
+
+#include "shc_sim_board.h"
+#include "shc_sim_broker.h"
+#include "shc_load_generator.h"
+#include "shc_json_benchmark.h"
+
+// --------------------------------------------------------------------------------
+
+#define MAIN_DEFAULT_BOARD_PATH                     "/tmp/shc_sim_board.sock"
+#define MAIN_DEFAULT_BROKER_PORT                    18830
+#define MAIN_DEFAULT_TOPIC                          "shc_load_test"
+#define MAIN_DEFAULT_MIX                            "cmd_load_test"
+
+// --------------------------------------------------------------------------------
+
+/*!
+ *
+ */
+static void main_print_help(void);
+
+/*!
+ *
+ */
+static u8 main_parse_arguments(int argc, char* argv[]);
+
+/*!
+ *
+ */
+static void main_print_result(const SHC_LOAD_GENERATOR_RESULT* p_result);
+
+// --------------------------------------------------------------------------------
+
+static SHC_SIM_BOARD_CONFIG board_config = {
+    .p_socket_path = MAIN_DEFAULT_BOARD_PATH,
+    .delay_min_us = 500,
+    .delay_max_us = 2000,
+    .error_rate_percent = 0
+};
+
+static SHC_LOAD_GENERATOR_CONFIG generator_config = {
+    .port = MAIN_DEFAULT_BROKER_PORT,
+    .p_topic = MAIN_DEFAULT_TOPIC,
+    .rate = 100,
+    .duration_s = 30,
+    .window = 8,
+    .timeout_ms = 2000
+};
+
+/**
+ * @brief The simulated control-board is not started if set to 0
+ *
+ */
+static u8 board_enabled = 1;
+
+/**
+ * @brief Number of messages of the json-benchmark,
+ * the benchmark is run instead of the load-test if not 0
+ *
+ */
+static u32 json_benchmark_iterations = 0;
+
+// --------------------------------------------------------------------------------
+
+int main(int argc, char* argv[]) {
+
+    shc_load_generator_parse_mix(&generator_config, MAIN_DEFAULT_MIX);
+
+    if (main_parse_arguments(argc, argv) == 0) {
+        main_print_help();
+        return 1;
+    }
+
+    if (json_benchmark_iterations != 0) {
+        return shc_json_benchmark_run(json_benchmark_iterations) ? 0 : 1;
+    }
+
+    // signals are handled by sigwait() only
+    sigset_t signal_set;
+    sigemptyset(&signal_set);
+    sigaddset(&signal_set, SIGINT);
+    sigaddset(&signal_set, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signal_set, NULL);
+
+    if (board_enabled && shc_sim_board_start(&board_config) == 0) {
+        printf("shcLoadTest: open board-socket %s has FAILED !!! ---\n", board_config.p_socket_path);
+        return 1;
+    }
+
+    if (shc_sim_broker_start(generator_config.port) == 0) {
+        printf("shcLoadTest: open broker-port %u has FAILED !!! ---\n", generator_config.port);
+        shc_sim_board_stop();
+        return 1;
+    }
+
+    printf("shcLoadTest: board: %s - broker: tcp://127.0.0.1:%u - topic: %s\n",
+        board_enabled ? board_config.p_socket_path : "none",
+        generator_config.port,
+        generator_config.p_topic
+    );
+
+    int exit_code = 0;
+
+    if (generator_config.rate == 0) {
+
+        printf("shcLoadTest: no load - press CTRL-C to exit\n");
+
+        int signal_number = 0;
+        sigwait(&signal_set, &signal_number);
+
+    } else {
+
+        SHC_LOAD_GENERATOR_RESULT result;
+
+        if (shc_load_generator_run(&generator_config, &result)) {
+            main_print_result(&result);
+        } else {
+            printf("shcLoadTest: connect to broker has FAILED !!! ---\n");
+            exit_code = 1;
+        }
+    }
+
+    shc_sim_broker_stop();
+
+    if (board_enabled) {
+        shc_sim_board_stop();
+    }
+
+    return exit_code;
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Parses the command-line arguments into the configuration
+ *
+ * @param argc number of arguments
+ * @param argv the arguments
+ * @return 1 on success, 0 on invalid arguments or -help
+ */
+static u8 main_parse_arguments(int argc, char* argv[]) {
+
+    int i = 1;
+    for ( ; i < argc ; i++) {
+
+        const char* p_argument = argv[i];
+        const char* p_value = i + 1 < argc ? argv[i + 1] : NULL;
+
+        if (strcmp(p_argument, "-help") == 0 || p_value == NULL) {
+            return 0;
+        }
+
+        i += 1;
+
+        if (strcmp(p_argument, "-board") == 0) {
+
+            if (strcmp(p_value, "none") == 0) {
+                board_enabled = 0;
+            } else {
+                board_config.p_socket_path = p_value;
+            }
+
+        } else if (strcmp(p_argument, "-delay") == 0) {
+
+            char* p_end = NULL;
+
+            board_config.delay_min_us = (u32)strtoul(p_value, &p_end, 10);
+            board_config.delay_max_us = *p_end == ':' ? (u32)strtoul(p_end + 1, NULL, 10) : board_config.delay_min_us;
+
+            if (board_config.delay_max_us < board_config.delay_min_us) {
+                return 0;
+            }
+
+        } else if (strcmp(p_argument, "-errors") == 0) {
+
+            board_config.error_rate_percent = (u32)strtoul(p_value, NULL, 10);
+
+            if (board_config.error_rate_percent > 100) {
+                return 0;
+            }
+
+        } else if (strcmp(p_argument, "-port") == 0) {
+
+            generator_config.port = (u16)strtoul(p_value, NULL, 10);
+
+        } else if (strcmp(p_argument, "-topic") == 0) {
+
+            generator_config.p_topic = p_value;
+
+        } else if (strcmp(p_argument, "-mix") == 0) {
+
+            if (shc_load_generator_parse_mix(&generator_config, p_value) == 0) {
+                return 0;
+            }
+
+        } else if (strcmp(p_argument, "-rate") == 0) {
+
+            generator_config.rate = (u32)strtoul(p_value, NULL, 10);
+
+        } else if (strcmp(p_argument, "-duration") == 0) {
+
+            generator_config.duration_s = (u32)strtoul(p_value, NULL, 10);
+
+        } else if (strcmp(p_argument, "-window") == 0) {
+
+            generator_config.window = (u32)strtoul(p_value, NULL, 10);
+
+        } else if (strcmp(p_argument, "-timeout") == 0) {
+
+            generator_config.timeout_ms = (u32)strtoul(p_value, NULL, 10);
+
+        } else if (strcmp(p_argument, "-json_benchmark") == 0) {
+
+            json_benchmark_iterations = (u32)strtoul(p_value, NULL, 10);
+
+        } else {
+            printf("Unknown argument given %s\n", p_argument);
+            return 0;
+        }
+    }
+
+    return generator_config.port != 0 && generator_config.window != 0 && generator_config.timeout_ms != 0;
+}
+
+/**
+ * @brief Prints the usage of the program
+ *
+ */
+static void main_print_help(void) {
+
+    printf("SHC Load-Test Version: %u.%u\n\n", VERSION_MAJOR, VERSION_MINOR);
+    printf("Usage: shcLoadTest [options]\n\n");
+    printf("Options:\n");
+    printf("-board <path>|none                   : unix-socket of the simulated control-board (default %s)\n", MAIN_DEFAULT_BOARD_PATH);
+    printf("-delay <min_us>[:<max_us>]           : response-delay of the control-board (default 500:2000)\n");
+    printf("-errors <percent>                    : frames without response (default 0)\n");
+    printf("-port <port>                         : TCP-port of the MQTT-broker on 127.0.0.1 (default %u)\n", MAIN_DEFAULT_BROKER_PORT);
+    printf("-topic <name>                        : MQTT_TOPIC_NAME of the shcClient (default %s)\n", MAIN_DEFAULT_TOPIC);
+    printf("-mix <name>[:<weight>],...           : commands to send (default %s)\n", MAIN_DEFAULT_MIX);
+    printf("-rate <cmd_per_s>                    : 0 only starts control-board and broker (default 100)\n");
+    printf("-duration <s>                        : duration of the test (default 30)\n");
+    printf("-window <number>                     : maximum number of outstanding commands (default 8)\n");
+    printf("-timeout <ms>                        : a command without response is lost (default 2000)\n");
+    printf("-json_benchmark <number>             : only runs the receive-path benchmark with <number> messages per payload\n");
+}
+
+/**
+ * @brief Prints the result of the load-test
+ *
+ * @param p_result the result
+ */
+static void main_print_result(const SHC_LOAD_GENERATOR_RESULT* p_result) {
+
+    SHC_SIM_BOARD_STATISTIC board_statistic;
+    SHC_SIM_BROKER_STATISTIC broker_statistic;
+
+    memset(&board_statistic, 0x00, sizeof(board_statistic));
+
+    if (board_enabled) {
+        shc_sim_board_get_statistic(&board_statistic);
+    }
+
+    shc_sim_broker_get_statistic(&broker_statistic);
+
+    double elapsed_s = (double)p_result->elapsed_us / 1000000.0;
+
+    printf("\n");
+    printf("commands sent:       %u\n", p_result->sent);
+    printf("commands completed:  %u\n", p_result->completed);
+    printf("commands lost:       %u\n", p_result->lost);
+    printf("throughput:          %.1f cmd/s\n", elapsed_s > 0.0 ? (double)p_result->completed / elapsed_s : 0.0);
+    printf("latency p50:         %.3f ms\n", (double)p_result->latency_p50_us / 1000.0);
+    printf("latency p90:         %.3f ms\n", (double)p_result->latency_p90_us / 1000.0);
+    printf("latency p99:         %.3f ms\n", (double)p_result->latency_p99_us / 1000.0);
+    printf("latency max:         %.3f ms\n", (double)p_result->latency_max_us / 1000.0);
+    printf("board frames:        %u (dropped %u)\n", board_statistic.frames, board_statistic.dropped);
+    printf("broker messages:     %u (forwarded %u)\n", broker_statistic.received, broker_statistic.forwarded);
+}
+
+// --------------------------------------------------------------------------------
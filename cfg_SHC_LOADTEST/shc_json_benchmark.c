@@ -0,0 +1,468 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_json_benchmark.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Implementation of the receive-path micro-benchmark
+ *
+ * @see     shc_json_benchmark.h
+ */
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+// --------------------------------------------------------------------------------
+
+#include "../cfg_SHC_CLIENT/shc_json_tokenizer.h"
+#include "shc_json_benchmark.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Same sizes as used by shc_mqtt_interface
+ *
+ */
+#define SHC_JSON_BENCHMARK_MESSAGE_MAX_LENGTH       256
+#define SHC_JSON_BENCHMARK_MAX_TOKENS               64
+
+/**
+ * @brief Maximum number of commands of a single payload
+ *
+ */
+#define SHC_JSON_BENCHMARK_MAX_COMMANDS             16
+
+/**
+ * @brief Maximum number of members of the copy-based parser
+ *
+ */
+#define SHC_JSON_BENCHMARK_MAX_MEMBERS              16
+
+/**
+ * @brief Maximum length of the name of a member of the copy-based parser
+ *
+ */
+#define SHC_JSON_BENCHMARK_KEY_MAX_LENGTH           32
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief A member of the copy-based parser,
+ * the elements of an array are stored as members without key
+ *
+ */
+typedef struct SHC_JSON_BENCHMARK_MEMBER_STRUCT {
+    char key[SHC_JSON_BENCHMARK_KEY_MAX_LENGTH];
+    char value[SHC_JSON_BENCHMARK_MESSAGE_MAX_LENGTH];
+} SHC_JSON_BENCHMARK_MEMBER;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Typical payloads of the MQTT-topic of the shcClient
+ *
+ */
+static const char* payload_list[] = {
+    "cmd_light_01_on",
+    "{\"command\":\"cmd_light_01_on\"}",
+    "{\"command\":\"cmd_light_01_on\",\"source\":\"dashboard\",\"user\":\"living_room_panel\",\"timestamp\":1700000000,\"retain\":false}",
+    "{\"commands\":[\"cmd_light_01_on\",\"cmd_light_02_on\",\"cmd_light_03_off\",\"cmd_shutter_01_up\",\"cmd_shutter_02_down\",\"rpt_temperature\"],\"source\":\"scene_evening\"}"
+};
+
+#define SHC_JSON_BENCHMARK_NUM_PAYLOADS             (sizeof(payload_list) / sizeof(payload_list[0]))
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Receive-fifo slot, written by the simulated paho-callback
+ *
+ */
+static char receive_slot[SHC_JSON_BENCHMARK_MESSAGE_MAX_LENGTH];
+
+/**
+ * @brief Sum of the length of all found commands,
+ * keeps the compiler from removing the work
+ *
+ */
+static volatile u32 checksum = 0;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Get the actual time
+ *
+ * @return monotonic time in nanoseconds
+ */
+static u64 shc_json_benchmark_time_ns(void) {
+
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (u64)now.tv_sec * 1000000000ULL + (u64)now.tv_nsec;
+}
+
+/**
+ * @brief Simulates the paho-callback that copies the payload into the receive-fifo
+ *
+ * @param p_payload the payload to receive
+ * @return number of characters of the payload
+ */
+static u16 shc_json_benchmark_receive(const char* p_payload) {
+
+    u16 length = (u16)strlen(p_payload);
+
+    memcpy(receive_slot, p_payload, length);
+    receive_slot[length] = '\0';
+
+    return length;
+}
+
+/**
+ * @brief Copies the string-value that starts at p_quote into p_buffer
+ *
+ * @param p_quote position of the opening '"'
+ * @param p_buffer the value is copied into this buffer
+ * @param buffer_size size of p_buffer, longer values are truncated
+ * @return position behind the closing '"' or NULL if the string has no end
+ */
+static const char* shc_json_benchmark_copy_string(const char* p_quote, char* p_buffer, size_t buffer_size) {
+
+    const char* p_end = strchr(p_quote + 1, '"');
+
+    if (p_end == NULL) {
+        return NULL;
+    }
+
+    size_t length = (size_t)(p_end - p_quote - 1);
+
+    if (length > buffer_size - 1) {
+        length = buffer_size - 1;
+    }
+
+    memcpy(p_buffer, p_quote + 1, length);
+    p_buffer[length] = '\0';
+
+    return p_end + 1;
+}
+
+/**
+ * @brief Copies the primitive that starts at p_value into p_buffer
+ *
+ * @param p_value first character of the primitive
+ * @param p_buffer the value is copied into this buffer
+ * @return position behind the primitive
+ */
+static const char* shc_json_benchmark_copy_primitive(const char* p_value, char* p_buffer) {
+
+    size_t length = strcspn(p_value, ",]} \t\r\n");
+
+    if (length > SHC_JSON_BENCHMARK_MESSAGE_MAX_LENGTH - 1) {
+        length = SHC_JSON_BENCHMARK_MESSAGE_MAX_LENGTH - 1;
+    }
+
+    memcpy(p_buffer, p_value, length);
+    p_buffer[length] = '\0';
+
+    return p_value + length;
+}
+
+/**
+ * @brief Receive-path of a copy-based parser: the message is copied out
+ * of the fifo, every member of the object and every element of an array is
+ * copied into its own buffer and the commands are looked up by strcmp().
+ * Nested objects are not supported.
+ *
+ * @param p_payload the payload to receive
+ * @return number of found commands
+ */
+static u8 shc_json_benchmark_copy(const char* p_payload) {
+
+    char message[SHC_JSON_BENCHMARK_MESSAGE_MAX_LENGTH];
+    SHC_JSON_BENCHMARK_MEMBER member_list[SHC_JSON_BENCHMARK_MAX_MEMBERS];
+    u8 member_count = 0;
+
+    shc_json_benchmark_receive(p_payload);
+    memcpy(message, receive_slot, sizeof(message));
+
+    if (message[0] != '{' && message[0] != '[') {
+        checksum += (u32)strlen(message);
+        return 1;
+    }
+
+    const char* p_read = message + 1;
+    char key[SHC_JSON_BENCHMARK_KEY_MAX_LENGTH] = "";
+    u8 in_array = (message[0] == '[');
+
+    while (p_read != NULL && *p_read != '\0' && member_count < SHC_JSON_BENCHMARK_MAX_MEMBERS) {
+
+        p_read += strspn(p_read, " \t\r\n,:");
+
+        if (*p_read == ']') {
+            in_array = 0;
+            key[0] = '\0';
+            p_read += 1;
+            continue;
+        }
+
+        if (*p_read == '}' || *p_read == '\0') {
+            break;
+        }
+
+        if (in_array == 0 && key[0] == '\0') {
+
+            // key of the next member
+
+            if (*p_read != '"') {
+                return 0;
+            }
+
+            p_read = shc_json_benchmark_copy_string(p_read, key, sizeof(key));
+            continue;
+        }
+
+        if (*p_read == '[') {
+            in_array = 1;
+            p_read += 1;
+            continue;
+        }
+
+        SHC_JSON_BENCHMARK_MEMBER* p_member = &member_list[member_count++];
+        memcpy(p_member->key, key, sizeof(key));
+
+        if (*p_read == '"') {
+            p_read = shc_json_benchmark_copy_string(p_read, p_member->value, sizeof(p_member->value));
+        } else {
+            p_read = shc_json_benchmark_copy_primitive(p_read, p_member->value);
+        }
+
+        if (in_array == 0) {
+            key[0] = '\0';
+        }
+    }
+
+    u8 command_count = 0;
+
+    u8 i = 0;
+    for ( ; i < member_count; i++) {
+
+        const SHC_JSON_BENCHMARK_MEMBER* p_member = &member_list[i];
+
+        if (strcmp(p_member->key, "command") == 0 || strcmp(p_member->key, "commands") == 0 || (message[0] == '[' && p_member->key[0] == '\0')) {
+            checksum += (u32)strlen(p_member->value);
+            command_count += 1;
+        }
+    }
+
+    return command_count;
+}
+
+/**
+ * @brief Receive-path with a hand-written scan: the message is copied out
+ * of the fifo and the commands are searched by strstr() and copied into
+ * their own buffers. Invalid payloads are not detected.
+ *
+ * @param p_payload the payload to receive
+ * @return number of found commands
+ */
+static u8 shc_json_benchmark_scan(const char* p_payload) {
+
+    char message[SHC_JSON_BENCHMARK_MESSAGE_MAX_LENGTH];
+    char command_list[SHC_JSON_BENCHMARK_MAX_COMMANDS][SHC_JSON_BENCHMARK_MESSAGE_MAX_LENGTH];
+    u8 command_count = 0;
+
+    shc_json_benchmark_receive(p_payload);
+    memcpy(message, receive_slot, sizeof(message));
+
+    if (message[0] != '{' && message[0] != '[') {
+        checksum += (u32)strlen(message);
+        return 1;
+    }
+
+    const char* p_command = strstr(message, "\"command\"");
+
+    if (p_command != NULL) {
+
+        const char* p_quote = strchr(p_command + 9, '"');
+
+        if (p_quote != NULL && shc_json_benchmark_copy_string(p_quote, command_list[command_count], sizeof(command_list[0])) != NULL) {
+            command_count += 1;
+        }
+    }
+
+    const char* p_list = strstr(message, "\"commands\"");
+
+    if (p_list != NULL) {
+        p_list = strchr(p_list, '[');
+    }
+
+    const char* p_list_end = (p_list != NULL) ? strchr(p_list, ']') : NULL;
+
+    while (p_list != NULL && p_list_end != NULL && command_count < SHC_JSON_BENCHMARK_MAX_COMMANDS) {
+
+        const char* p_quote = strchr(p_list, '"');
+
+        if (p_quote == NULL || p_quote > p_list_end) {
+            break;
+        }
+
+        p_list = shc_json_benchmark_copy_string(p_quote, command_list[command_count], sizeof(command_list[0]));
+        command_count += 1;
+    }
+
+    u8 i = 0;
+    for ( ; i < command_count; i++) {
+        checksum += (u32)strlen(command_list[i]);
+    }
+
+    return command_count;
+}
+
+/**
+ * @brief Receive-path of shc_mqtt_interface: the payload is tokenized
+ * inside of the fifo and the commands are used where they are.
+ *
+ * @param p_payload the payload to receive
+ * @return number of found commands
+ */
+static u8 shc_json_benchmark_in_place(const char* p_payload) {
+
+    u16 length = shc_json_benchmark_receive(p_payload);
+
+    if (shc_json_is_structured(receive_slot, length) == 0) {
+        checksum += length;
+        return 1;
+    }
+
+    SHC_JSON_TOKEN token_list[SHC_JSON_BENCHMARK_MAX_TOKENS];
+    SHC_JSON_DOCUMENT document;
+
+    document.p_token_list = token_list;
+    document.max_tokens = SHC_JSON_BENCHMARK_MAX_TOKENS;
+
+    if (shc_json_tokenize(&document, receive_slot, length) == 0) {
+        return 0;
+    }
+
+    u8 command_count = 0;
+    u16 list_index = 0;
+
+    if (token_list[0].type == SHC_JSON_TYPE_OBJECT) {
+
+        const char* p_command = shc_json_get_string(&document, shc_json_find(&document, 0, "command"));
+
+        if (p_command != NULL) {
+            checksum += (u32)strlen(p_command);
+            command_count += 1;
+        }
+
+        list_index = shc_json_find(&document, 0, "commands");
+    }
+
+    if (list_index == SHC_JSON_NOT_FOUND || token_list[list_index].type != SHC_JSON_TYPE_ARRAY) {
+        return command_count;
+    }
+
+    u16 index = shc_json_first_child(&document, list_index);
+
+    while (index != SHC_JSON_NOT_FOUND && index < token_list[list_index].next) {
+
+        const char* p_command = shc_json_get_string(&document, index);
+
+        if (p_command != NULL) {
+            checksum += (u32)strlen(p_command);
+            command_count += 1;
+        }
+
+        index = token_list[index].next;
+    }
+
+    return command_count;
+}
+
+/**
+ * @brief Runs a method of the receive-path the given number of times
+ *
+ * @param p_method the method to measure
+ * @param p_payload the payload to receive
+ * @param iterations number of messages
+ * @return average time per message in nanoseconds
+ */
+static double shc_json_benchmark_measure(u8 (*p_method)(const char*), const char* p_payload, u32 iterations) {
+
+    if (iterations == 0) {
+        return 0.0;
+    }
+
+    u64 start_ns = shc_json_benchmark_time_ns();
+
+    u32 n = 0;
+    for ( ; n < iterations; n++) {
+        p_method(p_payload);
+    }
+
+    return (double)(shc_json_benchmark_time_ns() - start_ns) / (double)iterations;
+}
+
+// --------------------------------------------------------------------------------
+
+u8 shc_json_benchmark_run(u32 iterations) {
+
+    u8 is_valid = 1;
+
+    printf("shcLoadTest: json-benchmark - %u messages per payload\n\n", iterations);
+    printf("%-8s %-6s %-9s %10s %10s %12s %8s\n", "payload", "length", "commands", "copy ns", "scan ns", "in-place ns", "speedup");
+
+    u8 i = 0;
+    for ( ; i < SHC_JSON_BENCHMARK_NUM_PAYLOADS; i++) {
+
+        const char* p_payload = payload_list[i];
+
+        u8 copy_count = shc_json_benchmark_copy(p_payload);
+        u8 scan_count = shc_json_benchmark_scan(p_payload);
+        u8 in_place_count = shc_json_benchmark_in_place(p_payload);
+
+        if (copy_count != in_place_count || scan_count != in_place_count) {
+            printf("shcLoadTest: payload %u - different number of commands (%u / %u / %u) !!! ---\n", i, copy_count, scan_count, in_place_count);
+            is_valid = 0;
+        }
+
+        double copy_ns = shc_json_benchmark_measure(shc_json_benchmark_copy, p_payload, iterations);
+        double scan_ns = shc_json_benchmark_measure(shc_json_benchmark_scan, p_payload, iterations);
+        double in_place_ns = shc_json_benchmark_measure(shc_json_benchmark_in_place, p_payload, iterations);
+
+        printf("%-8u %-6u %-9u %10.1f %10.1f %12.1f %7.2fx\n",
+            i,
+            (u32)strlen(p_payload),
+            in_place_count,
+            copy_ns,
+            scan_ns,
+            in_place_ns,
+            in_place_ns > 0.0 ? copy_ns / in_place_ns : 0.0
+        );
+    }
+
+    printf("\nspeedup: copy ns / in-place ns\n");
+
+    return is_valid;
+}
+
+// --------------------------------------------------------------------------------
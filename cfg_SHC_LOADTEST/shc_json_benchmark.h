@@ -0,0 +1,63 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_json_benchmark.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Micro-benchmark of the receive-path of MQTT-messages.
+ *
+ *          Compares three ways to get the commands out of a received
+ *          payload that already is inside of the receive-fifo:
+ *
+ *          - copy: the message is copied out of the fifo and every
+ *            member is copied into its own key- and value-buffer,
+ *            the commands are looked up with strcmp(). Models the
+ *            copy-based JSON_PARSER of the framework
+ *          - scan: the message is copied out of the fifo and only the
+ *            members "command" and "commands" are searched with
+ *            strstr(), without validating the payload. Lower bound
+ *            of any copy-based receive-path
+ *          - in-place: the payload is validated and tokenized inside
+ *            of the fifo by shc_json_tokenizer and the commands are
+ *            zero-terminated where they are (receive-path of shcClient)
+ *
+ *          All methods are run on typical payloads of the MQTT-topic
+ *          and the time per message is printed.
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_shc_json_benchmark_
+#define _H_shc_json_benchmark_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Runs the benchmark and prints the result
+ *
+ * @param iterations number of messages per payload and method
+ * @return 1 if all methods found the same commands, otherwise 0
+ */
+u8 shc_json_benchmark_run(u32 iterations);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_shc_json_benchmark_
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,674 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_load_generator.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Implementation of the load-generator of shcLoadTest
+ *
+ * @see     shc_load_generator.h
+ */
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+// --------------------------------------------------------------------------------
+
+#include "shc_load_generator.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Maximum size of a single MQTT-packet
+ *
+ */
+#define SHC_LOAD_GENERATOR_PACKET_MAX_LENGTH        4096
+
+#define SHC_LOAD_GENERATOR_CONNECT                  0x10
+#define SHC_LOAD_GENERATOR_PUBLISH                  0x30
+#define SHC_LOAD_GENERATOR_SUBSCRIBE                0x82
+#define SHC_LOAD_GENERATOR_DISCONNECT               0xE0
+
+/**
+ * @brief Initial number of latency-samples, grows on demand
+ *
+ */
+#define SHC_LOAD_GENERATOR_SAMPLES_INITIAL          4096
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief A command that waits for its response
+ *
+ */
+typedef struct SHC_LOAD_GENERATOR_PENDING_STRUCT {
+
+    u8 used;
+    u8 command;
+    u64 send_time_us;
+
+} SHC_LOAD_GENERATOR_PENDING;
+
+// --------------------------------------------------------------------------------
+
+static const SHC_LOAD_GENERATOR_CONFIG* p_generator_config = NULL;
+
+static int socket_handle = -1;
+
+/**
+ * @brief Everything below is protected by generator_mutex.
+ * The condition is signalled for every completed command.
+ *
+ */
+static pthread_mutex_t generator_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t generator_condition = PTHREAD_COND_INITIALIZER;
+
+static SHC_LOAD_GENERATOR_PENDING* pending_list = NULL;
+static u32 pending_count = 0;
+
+static u32* sample_list = NULL;
+static u32 sample_count = 0;
+static u32 sample_capacity = 0;
+
+static u32 lost_count = 0;
+static u64 last_response_us = 0;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Get the actual point in time
+ *
+ * @return monotonic time in microseconds
+ */
+static u64 shc_load_generator_time_us(void) {
+
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (u64)now.tv_sec * 1000000ULL + (u64)(now.tv_nsec / 1000);
+}
+
+/**
+ * @brief Writes a complete packet to the broker
+ *
+ * @param p_packet the packet
+ * @param length number of bytes of p_packet
+ * @return 1 on success, otherwise 0
+ */
+static u8 shc_load_generator_write(const u8* p_packet, u32 length) {
+
+    u32 written = 0;
+
+    while (written < length) {
+
+        ssize_t count = send(socket_handle, p_packet + written, length - written, MSG_NOSIGNAL);
+        if (count <= 0) {
+            return 0;
+        }
+
+        written += (u32)count;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Adds a zero-terminated string with its length-prefix to a packet
+ *
+ * @param p_packet the packet
+ * @param length actual length of the packet
+ * @param p_string the string
+ * @return new length of the packet
+ */
+static u32 shc_load_generator_add_string(u8* p_packet, u32 length, const char* p_string) {
+
+    u16 string_length = (u16)strlen(p_string);
+
+    p_packet[length++] = (u8)(string_length >> 8);
+    p_packet[length++] = (u8)(string_length);
+
+    memcpy(p_packet + length, p_string, string_length);
+    return length + string_length;
+}
+
+/**
+ * @brief Builds a packet out of the given fixed header and body
+ *
+ * @param header first byte of the fixed header
+ * @param p_body variable header and payload
+ * @param body_length number of bytes of p_body
+ * @return 1 if the packet was written, otherwise 0
+ */
+static u8 shc_load_generator_send_packet(u8 header, const u8* p_body, u32 body_length) {
+
+    u8 packet[SHC_LOAD_GENERATOR_PACKET_MAX_LENGTH + 8];
+    u32 remaining_length = body_length;
+    u32 length = 0;
+
+    packet[length++] = header;
+
+    do {
+        u8 digit = remaining_length % 128;
+        remaining_length /= 128;
+        packet[length++] = remaining_length > 0 ? (digit | 0x80) : digit;
+    } while (remaining_length > 0);
+
+    memcpy(packet + length, p_body, body_length);
+    return shc_load_generator_write(packet, length + body_length);
+}
+
+/**
+ * @brief Connects to the broker and subscribes the topic
+ *
+ * @return 1 on success, otherwise 0
+ */
+static u8 shc_load_generator_connect(void) {
+
+    struct sockaddr_in address;
+    memset(&address, 0x00, sizeof(address));
+
+    address.sin_family = AF_INET;
+    address.sin_port = htons(p_generator_config->port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    socket_handle = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (socket_handle < 0) {
+        return 0;
+    }
+
+    if (connect(socket_handle, (struct sockaddr*)&address, sizeof(address)) != 0) {
+        close(socket_handle);
+        socket_handle = -1;
+        return 0;
+    }
+
+    int no_delay = 1;
+    setsockopt(socket_handle, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+
+    u8 body[SHC_LOAD_GENERATOR_PACKET_MAX_LENGTH];
+    u32 length = shc_load_generator_add_string(body, 0, "MQTT");
+
+    body[length++] = 4;     // protocol level 3.1.1
+    body[length++] = 0x02;  // clean session
+    body[length++] = 0;     // no keep-alive
+    body[length++] = 0;
+
+    length = shc_load_generator_add_string(body, length, "shc_load_test");
+
+    if (shc_load_generator_send_packet(SHC_LOAD_GENERATOR_CONNECT, body, length) == 0) {
+        return 0;
+    }
+
+    body[0] = 0;
+    body[1] = 1;            // packet-id
+
+    length = shc_load_generator_add_string(body, 2, p_generator_config->p_topic);
+    body[length++] = 0;     // QoS 0
+
+    return shc_load_generator_send_packet(SHC_LOAD_GENERATOR_SUBSCRIBE, body, length);
+}
+
+/**
+ * @brief Completes the oldest pending command of the given name
+ *
+ * @param p_name name of the command, must not be zero-terminated
+ * @param name_length number of characters of p_name
+ */
+static void shc_load_generator_complete(const char* p_name, u32 name_length) {
+
+    u8 command = 0;
+    for ( ; command < p_generator_config->command_count ; command++) {
+
+        const char* p_command_name = p_generator_config->name_list[command];
+
+        if (strncmp(p_command_name, p_name, name_length) == 0 && p_command_name[name_length] == '\0') {
+            break;
+        }
+    }
+
+    if (command == p_generator_config->command_count) {
+        return;
+    }
+
+    u64 now_us = shc_load_generator_time_us();
+
+    pthread_mutex_lock(&generator_mutex);
+
+    SHC_LOAD_GENERATOR_PENDING* p_oldest = NULL;
+
+    u32 i = 0;
+    for ( ; i < p_generator_config->window ; i++) {
+
+        SHC_LOAD_GENERATOR_PENDING* p_pending = &pending_list[i];
+
+        if (p_pending->used && p_pending->command == command) {
+            if (p_oldest == NULL || p_pending->send_time_us < p_oldest->send_time_us) {
+                p_oldest = p_pending;
+            }
+        }
+    }
+
+    if (p_oldest != NULL) {
+
+        if (sample_count == sample_capacity) {
+
+            u32* p_samples = realloc(sample_list, sample_capacity * 2 * sizeof(u32));
+
+            if (p_samples != NULL) {
+                sample_list = p_samples;
+                sample_capacity *= 2;
+            }
+        }
+
+        if (sample_count < sample_capacity) {
+            sample_list[sample_count++] = (u32)(now_us - p_oldest->send_time_us);
+        }
+
+        p_oldest->used = 0;
+        pending_count -= 1;
+        last_response_us = now_us;
+
+        pthread_cond_signal(&generator_condition);
+    }
+
+    pthread_mutex_unlock(&generator_mutex);
+}
+
+/**
+ * @brief Receives the messages of the broker until the connection is closed.
+ * Every <name>=<value> of a command of the mix completes a command.
+ *
+ * @param p_argument not used
+ * @return always NULL
+ */
+static void* shc_load_generator_receive_thread(void* p_argument) {
+
+    (void) p_argument;
+
+    u8 rx_buffer[SHC_LOAD_GENERATOR_PACKET_MAX_LENGTH];
+    u32 rx_length = 0;
+
+    while (1) {
+
+        ssize_t count = recv(socket_handle, rx_buffer + rx_length, sizeof(rx_buffer) - rx_length, 0);
+        if (count <= 0) {
+            break;
+        }
+
+        rx_length += (u32)count;
+
+        while (rx_length >= 2) {
+
+            u32 remaining_length = 0;
+            u32 multiplier = 1;
+            u32 position = 1;
+            u8 digit = 0;
+
+            do {
+                digit = rx_buffer[position++];
+                remaining_length += (digit & 0x7F) * multiplier;
+                multiplier *= 128;
+            } while ((digit & 0x80) != 0 && position < rx_length && position <= 4);
+
+            if ((digit & 0x80) != 0 || position + remaining_length > rx_length) {
+
+                if (position + remaining_length > sizeof(rx_buffer)) {
+                    // too large for this client, dropped
+                    rx_length = 0;
+                }
+
+                break;
+            }
+
+            const u8* p_body = rx_buffer + position;
+
+            if ((rx_buffer[0] & 0xF0) == SHC_LOAD_GENERATOR_PUBLISH && remaining_length >= 2) {
+
+                u32 topic_length = (u32)((p_body[0] << 8) | p_body[1]);
+                u32 payload_position = 2 + topic_length + (((rx_buffer[0] >> 1) & 0x03) != 0 ? 2 : 0);
+
+                if (payload_position <= remaining_length) {
+
+                    const char* p_payload = (const char*)p_body + payload_position;
+                    const char* p_separator = memchr(p_payload, '=', remaining_length - payload_position);
+
+                    if (p_separator != NULL) {
+                        shc_load_generator_complete(p_payload, (u32)(p_separator - p_payload));
+                    }
+                }
+            }
+
+            rx_length -= position + remaining_length;
+            memmove(rx_buffer, rx_buffer + position + remaining_length, rx_length);
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Counts all pending commands that are older than the timeout as lost.
+ * Must be called with generator_mutex locked.
+ *
+ * @param now_us actual point in time
+ */
+static void shc_load_generator_expire(u64 now_us) {
+
+    u64 timeout_us = (u64)p_generator_config->timeout_ms * 1000ULL;
+
+    u32 i = 0;
+    for ( ; i < p_generator_config->window ; i++) {
+
+        SHC_LOAD_GENERATOR_PENDING* p_pending = &pending_list[i];
+
+        if (p_pending->used && now_us - p_pending->send_time_us > timeout_us) {
+            p_pending->used = 0;
+            pending_count -= 1;
+            lost_count += 1;
+        }
+    }
+}
+
+/**
+ * @brief Waits until the given point in time or until a command completes
+ * Must be called with generator_mutex locked.
+ *
+ * @param until_us point in time of shc_load_generator_time_us()
+ */
+static void shc_load_generator_wait(u64 until_us) {
+
+    u64 now_us = shc_load_generator_time_us();
+    if (until_us <= now_us) {
+        return;
+    }
+
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+
+    u64 wait_ns = (until_us - now_us) * 1000ULL + (u64)deadline.tv_nsec;
+
+    deadline.tv_sec += (time_t)(wait_ns / 1000000000ULL);
+    deadline.tv_nsec = (long)(wait_ns % 1000000000ULL);
+
+    pthread_cond_timedwait(&generator_condition, &generator_mutex, &deadline);
+}
+
+/**
+ * @brief Publishes a single command and adds it to the pending commands
+ *
+ * @param command index of the command inside of the mix
+ * @return 1 on success, otherwise 0
+ */
+static u8 shc_load_generator_publish(u8 command) {
+
+    u8 body[SHC_LOAD_GENERATOR_PACKET_MAX_LENGTH];
+    const char* p_name = p_generator_config->name_list[command];
+
+    u32 length = shc_load_generator_add_string(body, 0, p_generator_config->p_topic);
+    u32 name_length = (u32)strlen(p_name);
+
+    memcpy(body + length, p_name, name_length);
+    length += name_length;
+
+    pthread_mutex_lock(&generator_mutex);
+
+    u32 i = 0;
+    for ( ; i < p_generator_config->window ; i++) {
+
+        if (pending_list[i].used == 0) {
+            pending_list[i].used = 1;
+            pending_list[i].command = command;
+            pending_list[i].send_time_us = shc_load_generator_time_us();
+            pending_count += 1;
+            break;
+        }
+    }
+
+    pthread_mutex_unlock(&generator_mutex);
+
+    return shc_load_generator_send_packet(SHC_LOAD_GENERATOR_PUBLISH, body, length);
+}
+
+/**
+ * @brief Chooses the next command of the mix by its weight
+ *
+ * @param p_seed state of the random-generator
+ * @return index of the command
+ */
+static u8 shc_load_generator_choose(unsigned int* p_seed) {
+
+    u32 weight_sum = 0;
+
+    u8 i = 0;
+    for ( ; i < p_generator_config->command_count ; i++) {
+        weight_sum += p_generator_config->weight_list[i];
+    }
+
+    u32 value = (u32)rand_r(p_seed) % weight_sum;
+
+    for (i = 0 ; i < p_generator_config->command_count - 1 ; i++) {
+
+        if (value < p_generator_config->weight_list[i]) {
+            break;
+        }
+
+        value -= p_generator_config->weight_list[i];
+    }
+
+    return i;
+}
+
+/**
+ * @brief Compares two latency-samples for qsort()
+ *
+ */
+static int shc_load_generator_compare(const void* p_a, const void* p_b) {
+
+    u32 a = *(const u32*)p_a;
+    u32 b = *(const u32*)p_b;
+
+    return (a > b) - (a < b);
+}
+
+/**
+ * @brief Get a percentile of the sorted latency-samples
+ *
+ * @param percent 0 ... 100
+ * @return the latency in microseconds
+ */
+static u32 shc_load_generator_percentile(u32 percent) {
+
+    if (sample_count == 0) {
+        return 0;
+    }
+
+    u32 index = (u32)(((u64)sample_count * percent + 99) / 100);
+    return sample_list[index == 0 ? 0 : index - 1];
+}
+
+// --------------------------------------------------------------------------------
+
+u8 shc_load_generator_parse_mix(SHC_LOAD_GENERATOR_CONFIG* p_config, const char* p_mix) {
+
+    p_config->command_count = 0;
+
+    while (*p_mix != '\0') {
+
+        if (p_config->command_count == SHC_LOAD_GENERATOR_MAX_COMMANDS) {
+            return 0;
+        }
+
+        const char* p_end = strchr(p_mix, ',');
+        if (p_end == NULL) {
+            p_end = p_mix + strlen(p_mix);
+        }
+
+        const char* p_weight = memchr(p_mix, ':', (size_t)(p_end - p_mix));
+        const char* p_name_end = p_weight != NULL ? p_weight : p_end;
+
+        if (p_name_end == p_mix || p_name_end - p_mix >= SHC_LOAD_GENERATOR_NAME_MAX_LENGTH) {
+            return 0;
+        }
+
+        u8 command = p_config->command_count++;
+
+        snprintf(p_config->name_list[command], SHC_LOAD_GENERATOR_NAME_MAX_LENGTH, "%.*s", (int)(p_name_end - p_mix), p_mix);
+        p_config->weight_list[command] = p_weight != NULL ? (u32)strtoul(p_weight + 1, NULL, 10) : 1;
+
+        if (p_config->weight_list[command] == 0) {
+            return 0;
+        }
+
+        p_mix = *p_end == ',' ? p_end + 1 : p_end;
+    }
+
+    return p_config->command_count != 0;
+}
+
+u8 shc_load_generator_run(const SHC_LOAD_GENERATOR_CONFIG* p_config, SHC_LOAD_GENERATOR_RESULT* p_result) {
+
+    memset(p_result, 0x00, sizeof(SHC_LOAD_GENERATOR_RESULT));
+
+    p_generator_config = p_config;
+
+    pending_list = calloc(p_config->window, sizeof(SHC_LOAD_GENERATOR_PENDING));
+    sample_list = malloc(SHC_LOAD_GENERATOR_SAMPLES_INITIAL * sizeof(u32));
+    sample_capacity = SHC_LOAD_GENERATOR_SAMPLES_INITIAL;
+    sample_count = 0;
+    pending_count = 0;
+    lost_count = 0;
+
+    pthread_t receive_thread;
+
+    if (pending_list == NULL || sample_list == NULL || shc_load_generator_connect() == 0 ||
+        pthread_create(&receive_thread, NULL, shc_load_generator_receive_thread, NULL) != 0) {
+
+        if (socket_handle >= 0) {
+            close(socket_handle);
+            socket_handle = -1;
+        }
+
+        free(pending_list);
+        free(sample_list);
+        return 0;
+    }
+
+    unsigned int seed = (unsigned int)time(NULL);
+
+    u64 interval_us = 1000000ULL / p_config->rate;
+    u64 start_us = shc_load_generator_time_us();
+    u64 end_us = start_us + (u64)p_config->duration_s * 1000000ULL;
+    u64 next_send_us = start_us;
+    u64 next_report_us = start_us + 1000000ULL;
+    u32 reported_count = 0;
+
+    pthread_mutex_lock(&generator_mutex);
+
+    last_response_us = start_us;
+
+    while (1) {
+
+        u64 now_us = shc_load_generator_time_us();
+        shc_load_generator_expire(now_us);
+
+        if (now_us >= next_report_us) {
+            printf("shcLoadTest: %6u cmd/s - outstanding: %u - lost: %u\n", sample_count - reported_count, pending_count, lost_count);
+            reported_count = sample_count;
+            next_report_us += 1000000ULL;
+        }
+
+        if (now_us >= end_us) {
+
+            if (pending_count == 0 || now_us >= end_us + (u64)p_config->timeout_ms * 1000ULL) {
+                break;
+            }
+
+            shc_load_generator_wait(now_us + 10000ULL);
+            continue;
+        }
+
+        if (now_us < next_send_us || pending_count >= p_config->window) {
+            shc_load_generator_wait(next_send_us > now_us ? next_send_us : now_us + 1000ULL);
+            continue;
+        }
+
+        pthread_mutex_unlock(&generator_mutex);
+
+        u8 is_sent = shc_load_generator_publish(shc_load_generator_choose(&seed));
+
+        pthread_mutex_lock(&generator_mutex);
+
+        if (is_sent == 0) {
+            printf("shcLoadTest: connection to broker lost\n");
+            break;
+        }
+
+        p_result->sent += 1;
+        next_send_us += interval_us;
+
+        if (next_send_us + 1000000ULL < now_us) {
+            // the window has blocked for a long time, no burst afterwards
+            next_send_us = now_us;
+        }
+    }
+
+    shc_load_generator_expire(shc_load_generator_time_us() + (u64)p_config->timeout_ms * 1000ULL + 1);
+
+    p_result->completed = sample_count;
+    p_result->lost = lost_count;
+    p_result->elapsed_us = last_response_us - start_us;
+
+    pthread_mutex_unlock(&generator_mutex);
+
+    u8 disconnect[2] = { SHC_LOAD_GENERATOR_DISCONNECT, 0 };
+    shc_load_generator_write(disconnect, sizeof(disconnect));
+
+    shutdown(socket_handle, SHUT_RDWR);
+    pthread_join(receive_thread, NULL);
+
+    close(socket_handle);
+    socket_handle = -1;
+
+    qsort(sample_list, sample_count, sizeof(u32), shc_load_generator_compare);
+
+    p_result->latency_p50_us = shc_load_generator_percentile(50);
+    p_result->latency_p90_us = shc_load_generator_percentile(90);
+    p_result->latency_p99_us = shc_load_generator_percentile(99);
+    p_result->latency_max_us = sample_count != 0 ? sample_list[sample_count - 1] : 0;
+
+    free(pending_list);
+    free(sample_list);
+
+    pending_list = NULL;
+    sample_list = NULL;
+
+    return 1;
+}
+
+// --------------------------------------------------------------------------------
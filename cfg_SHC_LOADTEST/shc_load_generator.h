@@ -0,0 +1,146 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_load_generator.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Load-generator of shcLoadTest.
+ *
+ *          Connects to a MQTT-broker as an ordinary client and publishes
+ *          the names of commands of the command-file of the shcClient
+ *          on its topic, at a fixed rate and with a weighted random mix.
+ *          A command is complete when the shcClient publishes its
+ *          response <name>=<hex> on the same topic. Responses of the same
+ *          name are assigned in the order of their commands.
+ *          The shcClient needs MQTT_PUBLISH_COMMAND_RESPONSE=ON for this.
+ *
+ *          At most window commands are outstanding at the same time.
+ *          A command without response after timeout_ms is counted as lost.
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_shc_load_generator_
+#define _H_shc_load_generator_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Maximum number of different commands of the mix
+ *
+ */
+#define SHC_LOAD_GENERATOR_MAX_COMMANDS             16
+
+/**
+ * @brief Maximum length of the name of a command
+ *
+ */
+#define SHC_LOAD_GENERATOR_NAME_MAX_LENGTH          64
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Configuration of the load-generator
+ *
+ */
+typedef struct SHC_LOAD_GENERATOR_CONFIG_STRUCT {
+
+    /**
+     * @brief broker on 127.0.0.1 and the topic of the shcClient
+     *
+     */
+    u16 port;
+    const char* p_topic;
+
+    /**
+     * @brief the mix, every command is chosen with a probability
+     * of its weight divided by the sum of all weights
+     *
+     */
+    char name_list[SHC_LOAD_GENERATOR_MAX_COMMANDS][SHC_LOAD_GENERATOR_NAME_MAX_LENGTH];
+    u32 weight_list[SHC_LOAD_GENERATOR_MAX_COMMANDS];
+    u8 command_count;
+
+    /**
+     * @brief commands per second, duration of the test in seconds,
+     * maximum number of outstanding commands, timeout of a command
+     *
+     */
+    u32 rate;
+    u32 duration_s;
+    u32 window;
+    u32 timeout_ms;
+
+} SHC_LOAD_GENERATOR_CONFIG;
+
+/**
+ * @brief Result of a load-test
+ *
+ */
+typedef struct SHC_LOAD_GENERATOR_RESULT_STRUCT {
+
+    u32 sent;
+    u32 completed;
+    u32 lost;
+
+    /**
+     * @brief time from the first command until the last response
+     *
+     */
+    u64 elapsed_us;
+
+    /**
+     * @brief latency from publish of the command until the
+     * response was received, in microseconds
+     *
+     */
+    u32 latency_p50_us;
+    u32 latency_p90_us;
+    u32 latency_p99_us;
+    u32 latency_max_us;
+
+} SHC_LOAD_GENERATOR_RESULT;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Parses the mix of commands, e.g. cmd_light_on:3,cmd_light_off:1
+ * The weight is optional and defaults to 1.
+ *
+ * @param p_config the commands are stored into this configuration
+ * @param p_mix zero-terminated mix
+ * @return 1 on success, 0 if the mix is invalid
+ */
+u8 shc_load_generator_parse_mix(SHC_LOAD_GENERATOR_CONFIG* p_config, const char* p_mix);
+
+/**
+ * @brief Runs the load-test, blocks for the configured duration.
+ * Prints the throughput of every second.
+ *
+ * @param p_config configuration of the test
+ * @param p_result the result of the test
+ * @return 1 on success, 0 if the broker is not available
+ */
+u8 shc_load_generator_run(const SHC_LOAD_GENERATOR_CONFIG* p_config, SHC_LOAD_GENERATOR_RESULT* p_result);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_shc_load_generator_
+
+// --------------------------------------------------------------------------------
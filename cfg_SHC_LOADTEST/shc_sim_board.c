@@ -0,0 +1,323 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_sim_board.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Implementation of the simulated control-board of shcLoadTest
+ *
+ * @see     shc_sim_board.h
+ */
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+// --------------------------------------------------------------------------------
+
+#include "shc_sim_board.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Maximum number of boards of the shcClient connected at the same time
+ *
+ */
+#ifndef SHC_SIM_BOARD_MAX_CONNECTIONS
+#define SHC_SIM_BOARD_MAX_CONNECTIONS               8
+#endif
+
+/**
+ * @brief Status of every response
+ *
+ */
+#define SHC_SIM_BOARD_STATUS_OK                     0x00
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief A connection of the shcClient and its thread
+ *
+ */
+typedef struct SHC_SIM_BOARD_CONNECTION_STRUCT {
+
+    /**
+     * @brief file-descriptor of the connection, -1 if not used
+     *
+     */
+    int handle;
+
+    pthread_t thread;
+    u8 thread_running;
+
+} SHC_SIM_BOARD_CONNECTION;
+
+// --------------------------------------------------------------------------------
+
+static const SHC_SIM_BOARD_CONFIG* p_board_config = NULL;
+
+static SHC_SIM_BOARD_CONNECTION connection_list[SHC_SIM_BOARD_MAX_CONNECTIONS];
+
+static int socket_handle = -1;
+static pthread_t accept_thread;
+static u8 accept_thread_running = 0;
+
+/**
+ * @brief Protects the statistic and the connection-list
+ *
+ */
+static pthread_mutex_t board_mutex = PTHREAD_MUTEX_INITIALIZER;
+static SHC_SIM_BOARD_STATISTIC board_statistic;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Reads exactly the given number of bytes
+ *
+ * @param handle file-descriptor of the connection
+ * @param p_buffer buffer of the received bytes
+ * @param length number of bytes to read
+ * @return 1 on success, 0 if the connection was closed
+ */
+static u8 shc_sim_board_read(int handle, u8* p_buffer, u16 length) {
+
+    u16 received = 0;
+
+    while (received < length) {
+
+        ssize_t count = recv(handle, p_buffer + received, length - received, 0);
+        if (count <= 0) {
+            return 0;
+        }
+
+        received += (u16)count;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Waits for the response-delay of a single frame
+ *
+ * @param p_seed state of the random-generator of the connection
+ */
+static void shc_sim_board_delay(unsigned int* p_seed) {
+
+    u32 delay_us = p_board_config->delay_min_us;
+
+    if (p_board_config->delay_max_us > p_board_config->delay_min_us) {
+        delay_us += (u32)rand_r(p_seed) % (p_board_config->delay_max_us - p_board_config->delay_min_us + 1);
+    }
+
+    struct timespec delay = { (time_t)(delay_us / 1000000), (long)(delay_us % 1000000) * 1000L };
+    nanosleep(&delay, NULL);
+}
+
+/**
+ * @brief Answers the frames of a single connection
+ * until the connection is closed.
+ *
+ * @param p_argument the connection of type SHC_SIM_BOARD_CONNECTION
+ * @return always NULL
+ */
+static void* shc_sim_board_connection_thread(void* p_argument) {
+
+    SHC_SIM_BOARD_CONNECTION* p_connection = (SHC_SIM_BOARD_CONNECTION*)p_argument;
+    unsigned int seed = (unsigned int)time(NULL) ^ (unsigned int)(p_connection - connection_list);
+
+    u8 frame[256];
+    u8 response[3];
+
+    while (1) {
+
+        if (shc_sim_board_read(p_connection->handle, frame, 1) == 0) {
+            break;
+        }
+
+        if (frame[0] != 0 && shc_sim_board_read(p_connection->handle, frame + 1, frame[0]) == 0) {
+            break;
+        }
+
+        u8 drop = (u32)rand_r(&seed) % 100 < p_board_config->error_rate_percent;
+
+        pthread_mutex_lock(&board_mutex);
+        board_statistic.frames += 1;
+        board_statistic.dropped += drop;
+        pthread_mutex_unlock(&board_mutex);
+
+        shc_sim_board_delay(&seed);
+
+        if (drop) {
+            continue;
+        }
+
+        response[0] = 2;
+        response[1] = frame[0] != 0 ? frame[1] : 0x00;
+        response[2] = SHC_SIM_BOARD_STATUS_OK;
+
+        if (send(p_connection->handle, response, sizeof(response), MSG_NOSIGNAL) != (ssize_t)sizeof(response)) {
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Accepts the connections of the shcClient
+ * until the unix-socket is shut down.
+ *
+ * @param p_argument not used
+ * @return always NULL
+ */
+static void* shc_sim_board_accept_thread(void* p_argument) {
+
+    (void) p_argument;
+
+    while (1) {
+
+        int client_handle = accept(socket_handle, NULL, NULL);
+        if (client_handle < 0) {
+            break;
+        }
+
+        SHC_SIM_BOARD_CONNECTION* p_connection = NULL;
+
+        pthread_mutex_lock(&board_mutex);
+
+        u8 i = 0;
+        for ( ; i < SHC_SIM_BOARD_MAX_CONNECTIONS ; i++) {
+            if (connection_list[i].handle < 0 && connection_list[i].thread_running == 0) {
+                p_connection = &connection_list[i];
+                p_connection->handle = client_handle;
+                break;
+            }
+        }
+
+        pthread_mutex_unlock(&board_mutex);
+
+        if (p_connection == NULL) {
+            printf("shcLoadTest: too many board connections\n");
+            close(client_handle);
+            continue;
+        }
+
+        if (pthread_create(&p_connection->thread, NULL, shc_sim_board_connection_thread, p_connection) != 0) {
+            close(client_handle);
+            p_connection->handle = -1;
+            continue;
+        }
+
+        p_connection->thread_running = 1;
+    }
+
+    return NULL;
+}
+
+// --------------------------------------------------------------------------------
+
+u8 shc_sim_board_start(const SHC_SIM_BOARD_CONFIG* p_config) {
+
+    p_board_config = p_config;
+    memset(&board_statistic, 0x00, sizeof(board_statistic));
+
+    u8 i = 0;
+    for ( ; i < SHC_SIM_BOARD_MAX_CONNECTIONS ; i++) {
+        connection_list[i].handle = -1;
+        connection_list[i].thread_running = 0;
+    }
+
+    struct sockaddr_un address;
+    memset(&address, 0x00, sizeof(address));
+
+    address.sun_family = AF_UNIX;
+    snprintf(address.sun_path, sizeof(address.sun_path), "%s", p_config->p_socket_path);
+
+    socket_handle = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (socket_handle < 0) {
+        return 0;
+    }
+
+    // a socket of a previous run
+    unlink(p_config->p_socket_path);
+
+    if (bind(socket_handle, (struct sockaddr*)&address, sizeof(address)) != 0 || listen(socket_handle, 4) != 0) {
+        close(socket_handle);
+        socket_handle = -1;
+        return 0;
+    }
+
+    if (pthread_create(&accept_thread, NULL, shc_sim_board_accept_thread, NULL) != 0) {
+        close(socket_handle);
+        unlink(p_config->p_socket_path);
+        socket_handle = -1;
+        return 0;
+    }
+
+    accept_thread_running = 1;
+    return 1;
+}
+
+void shc_sim_board_stop(void) {
+
+    if (accept_thread_running) {
+        shutdown(socket_handle, SHUT_RDWR);
+        pthread_join(accept_thread, NULL);
+        accept_thread_running = 0;
+    }
+
+    u8 i = 0;
+    for ( ; i < SHC_SIM_BOARD_MAX_CONNECTIONS ; i++) {
+
+        SHC_SIM_BOARD_CONNECTION* p_connection = &connection_list[i];
+
+        if (p_connection->thread_running) {
+            shutdown(p_connection->handle, SHUT_RDWR);
+            pthread_join(p_connection->thread, NULL);
+            p_connection->thread_running = 0;
+        }
+
+        if (p_connection->handle >= 0) {
+            close(p_connection->handle);
+            p_connection->handle = -1;
+        }
+    }
+
+    if (socket_handle >= 0) {
+        close(socket_handle);
+        unlink(p_board_config->p_socket_path);
+        socket_handle = -1;
+    }
+}
+
+void shc_sim_board_get_statistic(SHC_SIM_BOARD_STATISTIC* p_statistic) {
+
+    pthread_mutex_lock(&board_mutex);
+    memcpy(p_statistic, &board_statistic, sizeof(SHC_SIM_BOARD_STATISTIC));
+    pthread_mutex_unlock(&board_mutex);
+}
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,121 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_sim_board.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Simulated control-board of shcLoadTest.
+ *
+ *          Behaves like the RPI_PROTOCOL_CLIENT of a control-board behind
+ *          the unix-socket transport of the shcClient
+ *          (HOST_BOARD_<n>=<name>:unix=<socket-path>).
+ *
+ *          A frame is read as length-byte followed by the command.
+ *          After a random delay between delay_min_us and delay_max_us
+ *          the board answers with a length-byte followed by the
+ *          command-id and status 0x00. With a probability of
+ *          error_rate_percent the frame is not answered at all.
+ *
+ *          Every connection is served by its own thread, so several
+ *          boards of the shcClient can be connected at the same time.
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_shc_sim_board_
+#define _H_shc_sim_board_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Configuration of the simulated control-board
+ *
+ */
+typedef struct SHC_SIM_BOARD_CONFIG_STRUCT {
+
+    /**
+     * @brief path of the unix-socket
+     *
+     */
+    const char* p_socket_path;
+
+    /**
+     * @brief range of the response-delay in microseconds
+     *
+     */
+    u32 delay_min_us;
+    u32 delay_max_us;
+
+    /**
+     * @brief probability of a missing response, 0 ... 100
+     *
+     */
+    u32 error_rate_percent;
+
+} SHC_SIM_BOARD_CONFIG;
+
+/**
+ * @brief Statistic of the simulated control-board
+ *
+ */
+typedef struct SHC_SIM_BOARD_STATISTIC_STRUCT {
+
+    /**
+     * @brief number of received frames
+     *
+     */
+    u32 frames;
+
+    /**
+     * @brief number of frames that were not answered
+     *
+     */
+    u32 dropped;
+
+} SHC_SIM_BOARD_STATISTIC;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Opens the unix-socket and starts the thread
+ * that accepts the connections of the shcClient.
+ *
+ * @param p_config configuration, must be valid until shc_sim_board_stop()
+ * @return 1 on success, otherwise 0
+ */
+u8 shc_sim_board_start(const SHC_SIM_BOARD_CONFIG* p_config);
+
+/**
+ * @brief Closes all connections and removes the unix-socket
+ *
+ */
+void shc_sim_board_stop(void);
+
+/**
+ * @brief Get the actual statistic of the simulated control-board
+ *
+ * @param p_statistic the statistic is copied into this structure
+ */
+void shc_sim_board_get_statistic(SHC_SIM_BOARD_STATISTIC* p_statistic);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_shc_sim_board_
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,642 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_sim_broker.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Implementation of the minimal MQTT-broker of shcLoadTest
+ *
+ * @see     shc_sim_broker.h
+ */
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/eventfd.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+// --------------------------------------------------------------------------------
+
+#include "shc_sim_broker.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Maximum number of connected clients
+ *
+ */
+#ifndef SHC_SIM_BROKER_MAX_CLIENTS
+#define SHC_SIM_BROKER_MAX_CLIENTS                  16
+#endif
+
+/**
+ * @brief Maximum number of subscriptions of a single client
+ *
+ */
+#ifndef SHC_SIM_BROKER_MAX_SUBSCRIPTIONS
+#define SHC_SIM_BROKER_MAX_SUBSCRIPTIONS            4
+#endif
+
+/**
+ * @brief Maximum length of a topic-filter
+ *
+ */
+#ifndef SHC_SIM_BROKER_TOPIC_MAX_LENGTH
+#define SHC_SIM_BROKER_TOPIC_MAX_LENGTH             128
+#endif
+
+/**
+ * @brief Maximum size of a single MQTT-packet
+ *
+ */
+#ifndef SHC_SIM_BROKER_PACKET_MAX_LENGTH
+#define SHC_SIM_BROKER_PACKET_MAX_LENGTH            4096
+#endif
+
+// --------------------------------------------------------------------------------
+
+#define SHC_SIM_BROKER_CONNECT                      0x10
+#define SHC_SIM_BROKER_CONNACK                      0x20
+#define SHC_SIM_BROKER_PUBLISH                      0x30
+#define SHC_SIM_BROKER_PUBACK                       0x40
+#define SHC_SIM_BROKER_PUBREC                       0x50
+#define SHC_SIM_BROKER_PUBREL                       0x60
+#define SHC_SIM_BROKER_PUBCOMP                      0x70
+#define SHC_SIM_BROKER_SUBSCRIBE                    0x80
+#define SHC_SIM_BROKER_SUBACK                       0x90
+#define SHC_SIM_BROKER_PINGREQ                      0xC0
+#define SHC_SIM_BROKER_PINGRESP                     0xD0
+#define SHC_SIM_BROKER_DISCONNECT                   0xE0
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief A connected client
+ *
+ */
+typedef struct SHC_SIM_BROKER_CLIENT_STRUCT {
+
+    /**
+     * @brief file-descriptor of the connection, -1 if not used
+     *
+     */
+    int handle;
+
+    char subscription_list[SHC_SIM_BROKER_MAX_SUBSCRIPTIONS][SHC_SIM_BROKER_TOPIC_MAX_LENGTH];
+    u8 subscription_count;
+
+    /**
+     * @brief received bytes that are not processed yet
+     *
+     */
+    u8 rx_buffer[SHC_SIM_BROKER_PACKET_MAX_LENGTH];
+    u16 rx_length;
+
+} SHC_SIM_BROKER_CLIENT;
+
+// --------------------------------------------------------------------------------
+
+static SHC_SIM_BROKER_CLIENT client_list[SHC_SIM_BROKER_MAX_CLIENTS];
+
+static int socket_handle = -1;
+
+/**
+ * @brief Wakes up the broker-thread to stop it
+ *
+ */
+static int stop_handle = -1;
+
+static pthread_t broker_thread;
+static u8 broker_thread_running = 0;
+
+static pthread_mutex_t broker_mutex = PTHREAD_MUTEX_INITIALIZER;
+static SHC_SIM_BROKER_STATISTIC broker_statistic;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Closes the connection of the given client
+ *
+ * @param p_client the client
+ */
+static void shc_sim_broker_client_close(SHC_SIM_BROKER_CLIENT* p_client) {
+
+    if (p_client->handle >= 0) {
+        close(p_client->handle);
+    }
+
+    p_client->handle = -1;
+    p_client->subscription_count = 0;
+    p_client->rx_length = 0;
+}
+
+/**
+ * @brief Writes a complete packet to the client.
+ * The client is closed if the packet cannot be written.
+ *
+ * @param p_client the client
+ * @param p_packet the packet
+ * @param length number of bytes of p_packet
+ */
+static void shc_sim_broker_client_write(SHC_SIM_BROKER_CLIENT* p_client, const u8* p_packet, u32 length) {
+
+    u32 written = 0;
+
+    while (written < length) {
+
+        ssize_t count = send(p_client->handle, p_packet + written, length - written, MSG_NOSIGNAL);
+        if (count <= 0) {
+            shc_sim_broker_client_close(p_client);
+            return;
+        }
+
+        written += (u32)count;
+    }
+}
+
+/**
+ * @brief Checks if the topic matches the topic-filter
+ *
+ * @param p_filter zero-terminated topic-filter, may contain + and #
+ * @param p_topic the topic, must not be zero-terminated
+ * @param topic_length number of characters of p_topic
+ * @return 1 if the topic matches, otherwise 0
+ */
+static u8 shc_sim_broker_topic_matches(const char* p_filter, const char* p_topic, u16 topic_length) {
+
+    u16 position = 0;
+
+    while (*p_filter != '\0') {
+
+        if (*p_filter == '#') {
+            return 1;
+        }
+
+        if (*p_filter == '+') {
+
+            while (position < topic_length && p_topic[position] != '/') {
+                position += 1;
+            }
+
+            p_filter += 1;
+            continue;
+        }
+
+        if (position == topic_length || *p_filter != p_topic[position]) {
+            // "a/#" also matches "a"
+            return position == topic_length && p_filter[0] == '/' && p_filter[1] == '#' && p_filter[2] == '\0';
+        }
+
+        p_filter += 1;
+        position += 1;
+    }
+
+    return position == topic_length;
+}
+
+/**
+ * @brief Forwards a message to all matching subscribers with QoS 0
+ *
+ * @param p_topic the topic, must not be zero-terminated
+ * @param topic_length number of characters of p_topic
+ * @param p_payload the payload
+ * @param payload_length number of bytes of p_payload
+ */
+static void shc_sim_broker_forward(const char* p_topic, u16 topic_length, const u8* p_payload, u32 payload_length) {
+
+    u8 packet[SHC_SIM_BROKER_PACKET_MAX_LENGTH + 8];
+    u32 remaining_length = 2 + topic_length + payload_length;
+    u32 length = 0;
+
+    packet[length++] = SHC_SIM_BROKER_PUBLISH;
+
+    do {
+        u8 digit = remaining_length % 128;
+        remaining_length /= 128;
+        packet[length++] = remaining_length > 0 ? (digit | 0x80) : digit;
+    } while (remaining_length > 0);
+
+    packet[length++] = (u8)(topic_length >> 8);
+    packet[length++] = (u8)(topic_length);
+
+    memcpy(packet + length, p_topic, topic_length);
+    length += topic_length;
+
+    memcpy(packet + length, p_payload, payload_length);
+    length += payload_length;
+
+    u32 forwarded = 0;
+
+    u8 i = 0;
+    for ( ; i < SHC_SIM_BROKER_MAX_CLIENTS ; i++) {
+
+        SHC_SIM_BROKER_CLIENT* p_client = &client_list[i];
+
+        u8 j = 0;
+        for ( ; p_client->handle >= 0 && j < p_client->subscription_count ; j++) {
+
+            if (shc_sim_broker_topic_matches(p_client->subscription_list[j], p_topic, topic_length)) {
+                shc_sim_broker_client_write(p_client, packet, length);
+                forwarded += 1;
+                break;
+            }
+        }
+    }
+
+    pthread_mutex_lock(&broker_mutex);
+    broker_statistic.received += 1;
+    broker_statistic.forwarded += forwarded;
+    pthread_mutex_unlock(&broker_mutex);
+}
+
+/**
+ * @brief Processes a SUBSCRIBE-packet and answers with SUBACK
+ *
+ * @param p_client the client
+ * @param p_data variable header and payload of the packet
+ * @param length number of bytes of p_data
+ */
+static void shc_sim_broker_subscribe(SHC_SIM_BROKER_CLIENT* p_client, const u8* p_data, u32 length) {
+
+    u8 suback[4 + SHC_SIM_BROKER_MAX_SUBSCRIPTIONS * 4];
+    u32 suback_length = 4;
+    u32 position = 2;
+
+    suback[0] = SHC_SIM_BROKER_SUBACK;
+    suback[2] = p_data[0];
+    suback[3] = p_data[1];
+
+    while (position + 3 <= length && suback_length < sizeof(suback)) {
+
+        u16 filter_length = (u16)((p_data[position] << 8) | p_data[position + 1]);
+        position += 2;
+
+        if (position + filter_length + 1 > length) {
+            break;
+        }
+
+        if (p_client->subscription_count < SHC_SIM_BROKER_MAX_SUBSCRIPTIONS && filter_length < SHC_SIM_BROKER_TOPIC_MAX_LENGTH) {
+
+            char* p_filter = p_client->subscription_list[p_client->subscription_count++];
+
+            memcpy(p_filter, p_data + position, filter_length);
+            p_filter[filter_length] = '\0';
+
+            // all messages are forwarded with QoS 0
+            suback[suback_length++] = 0x00;
+
+        } else {
+            suback[suback_length++] = 0x80;
+        }
+
+        position += filter_length + 1;
+    }
+
+    suback[1] = (u8)(suback_length - 2);
+    shc_sim_broker_client_write(p_client, suback, suback_length);
+}
+
+/**
+ * @brief Processes a PUBLISH-packet, acknowledges it and
+ * forwards it to the subscribers
+ *
+ * @param p_client the client
+ * @param header first byte of the fixed header
+ * @param p_data variable header and payload of the packet
+ * @param length number of bytes of p_data
+ */
+static void shc_sim_broker_publish(SHC_SIM_BROKER_CLIENT* p_client, u8 header, const u8* p_data, u32 length) {
+
+    u8 qos = (header >> 1) & 0x03;
+
+    if (length < 2) {
+        return;
+    }
+
+    u16 topic_length = (u16)((p_data[0] << 8) | p_data[1]);
+    u32 position = 2 + topic_length;
+
+    if (qos != 0) {
+        position += 2;
+    }
+
+    if (position > length) {
+        return;
+    }
+
+    if (qos != 0) {
+        u8 ack[4] = { qos == 1 ? SHC_SIM_BROKER_PUBACK : SHC_SIM_BROKER_PUBREC, 2, p_data[2 + topic_length], p_data[3 + topic_length] };
+        shc_sim_broker_client_write(p_client, ack, sizeof(ack));
+    }
+
+    shc_sim_broker_forward((const char*)p_data + 2, topic_length, p_data + position, length - position);
+}
+
+/**
+ * @brief Processes a single packet of a client
+ *
+ * @param p_client the client
+ * @param header first byte of the fixed header
+ * @param p_data variable header and payload of the packet
+ * @param length number of bytes of p_data
+ */
+static void shc_sim_broker_process_packet(SHC_SIM_BROKER_CLIENT* p_client, u8 header, const u8* p_data, u32 length) {
+
+    switch (header & 0xF0) {
+
+        case SHC_SIM_BROKER_CONNECT: {
+            u8 connack[4] = { SHC_SIM_BROKER_CONNACK, 2, 0x00, 0x00 };
+            shc_sim_broker_client_write(p_client, connack, sizeof(connack));
+            break;
+        }
+
+        case SHC_SIM_BROKER_PUBLISH:
+            shc_sim_broker_publish(p_client, header, p_data, length);
+            break;
+
+        case SHC_SIM_BROKER_PUBREL: {
+            if (length >= 2) {
+                u8 pubcomp[4] = { SHC_SIM_BROKER_PUBCOMP, 2, p_data[0], p_data[1] };
+                shc_sim_broker_client_write(p_client, pubcomp, sizeof(pubcomp));
+            }
+            break;
+        }
+
+        case SHC_SIM_BROKER_SUBSCRIBE:
+            if (length >= 2) {
+                shc_sim_broker_subscribe(p_client, p_data, length);
+            }
+            break;
+
+        case SHC_SIM_BROKER_PINGREQ: {
+            u8 pingresp[2] = { SHC_SIM_BROKER_PINGRESP, 0 };
+            shc_sim_broker_client_write(p_client, pingresp, sizeof(pingresp));
+            break;
+        }
+
+        case SHC_SIM_BROKER_DISCONNECT:
+            shc_sim_broker_client_close(p_client);
+            break;
+
+        default:
+            // PUBACK, UNSUBSCRIBE, ... are ignored
+            break;
+    }
+}
+
+/**
+ * @brief Reads from the client and processes all complete packets
+ *
+ * @param p_client the client
+ */
+static void shc_sim_broker_client_receive(SHC_SIM_BROKER_CLIENT* p_client) {
+
+    ssize_t count = recv(p_client->handle, p_client->rx_buffer + p_client->rx_length, sizeof(p_client->rx_buffer) - p_client->rx_length, 0);
+
+    if (count <= 0) {
+        shc_sim_broker_client_close(p_client);
+        return;
+    }
+
+    p_client->rx_length += (u16)count;
+
+    while (p_client->handle >= 0 && p_client->rx_length >= 2) {
+
+        u32 remaining_length = 0;
+        u32 multiplier = 1;
+        u32 position = 1;
+
+        while (position < p_client->rx_length && position <= 4) {
+
+            u8 digit = p_client->rx_buffer[position++];
+            remaining_length += (digit & 0x7F) * multiplier;
+            multiplier *= 128;
+
+            if ((digit & 0x80) == 0) {
+                break;
+            }
+        }
+
+        if ((p_client->rx_buffer[position - 1] & 0x80) != 0) {
+
+            if (position > 4) {
+                // malformed remaining-length
+                shc_sim_broker_client_close(p_client);
+            }
+
+            return;
+        }
+
+        if (position + remaining_length > sizeof(p_client->rx_buffer)) {
+            shc_sim_broker_client_close(p_client);
+            return;
+        }
+
+        if (position + remaining_length > p_client->rx_length) {
+            return;
+        }
+
+        shc_sim_broker_process_packet(p_client, p_client->rx_buffer[0], p_client->rx_buffer + position, remaining_length);
+
+        if (p_client->handle < 0) {
+            return;
+        }
+
+        p_client->rx_length -= (u16)(position + remaining_length);
+        memmove(p_client->rx_buffer, p_client->rx_buffer + position + remaining_length, p_client->rx_length);
+    }
+}
+
+/**
+ * @brief Accepts a new connection
+ *
+ */
+static void shc_sim_broker_accept(void) {
+
+    int client_handle = accept(socket_handle, NULL, NULL);
+    if (client_handle < 0) {
+        return;
+    }
+
+    int no_delay = 1;
+    setsockopt(client_handle, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+
+    u8 i = 0;
+    for ( ; i < SHC_SIM_BROKER_MAX_CLIENTS ; i++) {
+
+        if (client_list[i].handle < 0) {
+            client_list[i].handle = client_handle;
+            client_list[i].subscription_count = 0;
+            client_list[i].rx_length = 0;
+            return;
+        }
+    }
+
+    printf("shcLoadTest: too many MQTT-clients\n");
+    close(client_handle);
+}
+
+/**
+ * @brief Serves all clients until the broker is stopped
+ *
+ * @param p_argument not used
+ * @return always NULL
+ */
+static void* shc_sim_broker_thread(void* p_argument) {
+
+    (void) p_argument;
+
+    struct pollfd poll_list[SHC_SIM_BROKER_MAX_CLIENTS + 2];
+    SHC_SIM_BROKER_CLIENT* client_ref[SHC_SIM_BROKER_MAX_CLIENTS + 2];
+
+    while (1) {
+
+        u8 count = 0;
+
+        poll_list[count].fd = stop_handle;
+        poll_list[count].events = POLLIN;
+        client_ref[count++] = NULL;
+
+        poll_list[count].fd = socket_handle;
+        poll_list[count].events = POLLIN;
+        client_ref[count++] = NULL;
+
+        u8 i = 0;
+        for ( ; i < SHC_SIM_BROKER_MAX_CLIENTS ; i++) {
+
+            if (client_list[i].handle >= 0) {
+                poll_list[count].fd = client_list[i].handle;
+                poll_list[count].events = POLLIN;
+                client_ref[count++] = &client_list[i];
+            }
+        }
+
+        if (poll(poll_list, count, -1) < 0) {
+            continue;
+        }
+
+        if (poll_list[0].revents != 0) {
+            break;
+        }
+
+        if (poll_list[1].revents != 0) {
+            shc_sim_broker_accept();
+        }
+
+        for (i = 2 ; i < count ; i++) {
+
+            if (poll_list[i].revents != 0 && client_ref[i]->handle == poll_list[i].fd) {
+                shc_sim_broker_client_receive(client_ref[i]);
+            }
+        }
+    }
+
+    return NULL;
+}
+
+// --------------------------------------------------------------------------------
+
+u8 shc_sim_broker_start(u16 port) {
+
+    memset(&broker_statistic, 0x00, sizeof(broker_statistic));
+
+    u8 i = 0;
+    for ( ; i < SHC_SIM_BROKER_MAX_CLIENTS ; i++) {
+        client_list[i].handle = -1;
+        client_list[i].subscription_count = 0;
+        client_list[i].rx_length = 0;
+    }
+
+    struct sockaddr_in address;
+    memset(&address, 0x00, sizeof(address));
+
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    socket_handle = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (socket_handle < 0) {
+        return 0;
+    }
+
+    int reuse = 1;
+    setsockopt(socket_handle, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    if (bind(socket_handle, (struct sockaddr*)&address, sizeof(address)) != 0 || listen(socket_handle, 8) != 0) {
+        close(socket_handle);
+        socket_handle = -1;
+        return 0;
+    }
+
+    stop_handle = eventfd(0, EFD_CLOEXEC);
+
+    if (stop_handle < 0 || pthread_create(&broker_thread, NULL, shc_sim_broker_thread, NULL) != 0) {
+        close(socket_handle);
+        socket_handle = -1;
+        return 0;
+    }
+
+    broker_thread_running = 1;
+    return 1;
+}
+
+void shc_sim_broker_stop(void) {
+
+    if (broker_thread_running) {
+
+        u64 value = 1;
+        if (write(stop_handle, &value, sizeof(value)) == sizeof(value)) {
+            pthread_join(broker_thread, NULL);
+        }
+
+        broker_thread_running = 0;
+    }
+
+    u8 i = 0;
+    for ( ; i < SHC_SIM_BROKER_MAX_CLIENTS ; i++) {
+        shc_sim_broker_client_close(&client_list[i]);
+    }
+
+    if (socket_handle >= 0) {
+        close(socket_handle);
+        socket_handle = -1;
+    }
+
+    if (stop_handle >= 0) {
+        close(stop_handle);
+        stop_handle = -1;
+    }
+}
+
+void shc_sim_broker_get_statistic(SHC_SIM_BROKER_STATISTIC* p_statistic) {
+
+    pthread_mutex_lock(&broker_mutex);
+    memcpy(p_statistic, &broker_statistic, sizeof(SHC_SIM_BROKER_STATISTIC));
+    pthread_mutex_unlock(&broker_mutex);
+}
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,92 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    shc_sim_broker.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Minimal MQTT-broker of shcLoadTest.
+ *
+ *          Supports the part of MQTT 3.1.1 that is used by the
+ *          shcClient and the load-generator: CONNECT, SUBSCRIBE
+ *          (with + and # wildcards), PUBLISH with QoS 0, 1 and 2,
+ *          PINGREQ and DISCONNECT. There is no session-state,
+ *          no retained message and no authentication.
+ *
+ *          Messages are forwarded to all matching subscribers with
+ *          QoS 0, including the sender if it has subscribed the topic.
+ *
+ *          The broker runs in its own thread and listens on
+ *          127.0.0.1:<port> only.
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_shc_sim_broker_
+#define _H_shc_sim_broker_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Statistic of the broker
+ *
+ */
+typedef struct SHC_SIM_BROKER_STATISTIC_STRUCT {
+
+    /**
+     * @brief number of received PUBLISH-packets
+     *
+     */
+    u32 received;
+
+    /**
+     * @brief number of PUBLISH-packets forwarded to subscribers
+     *
+     */
+    u32 forwarded;
+
+} SHC_SIM_BROKER_STATISTIC;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Opens the TCP-socket and starts the thread of the broker
+ *
+ * @param port TCP-port on 127.0.0.1
+ * @return 1 on success, otherwise 0
+ */
+u8 shc_sim_broker_start(u16 port);
+
+/**
+ * @brief Stops the thread of the broker and closes all connections
+ *
+ */
+void shc_sim_broker_stop(void);
+
+/**
+ * @brief Get the actual statistic of the broker
+ *
+ * @param p_statistic the statistic is copied into this structure
+ */
+void shc_sim_broker_get_statistic(SHC_SIM_BROKER_STATISTIC* p_statistic);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_shc_sim_broker_
+
+// --------------------------------------------------------------------------------
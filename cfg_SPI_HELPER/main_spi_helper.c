@@ -40,6 +40,10 @@
 // --------------------------------------------------------------------------------
 
 #include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
 
 // --------------------------------------------------------------------------------
 
@@ -54,6 +58,27 @@
 
 // --------------------------------------------------------------------------------
 
+/**
+ * @brief Path of the command-socket of a running shcClient
+ * 
+ */
+#ifndef SHC_COMMAND_SOCKET_DEFAULT_PATH
+#define SHC_COMMAND_SOCKET_DEFAULT_PATH         "/tmp/shc_client_command.sock"
+#endif
+
+/**
+ * @brief Maximum length of a request / response of the command-socket
+ * 
+ */
+#define SHC_COMMAND_SOCKET_LINE_MAX_LENGTH      256
+
+// --------------------------------------------------------------------------------
+
+/*!
+ *
+ */
+static u8 main_shc_client_request(int argc, char* argv[]);
+
 /*!
  *
  */
@@ -111,6 +136,11 @@ static u8 exit_program = 0;
  */
 int main(int argc, char* argv[]) {
 
+    if (main_shc_client_request(argc, argv)) {
+        // command was processed by a running shcClient
+        return 0;
+    }
+
     ATOMIC_OPERATION
     (
         initialization();
@@ -165,6 +195,92 @@ int main(int argc, char* argv[]) {
 
 // --------------------------------------------------------------------------------
 
+/**
+ * @brief Sends the command given by -cmd to a running shcClient
+ * via its command-socket and prints the response.
+ * The control-board is not accessed by this program in this case.
+ * 
+ * @param argc number of command-line arguments
+ * @param argv command-line arguments
+ * @return 1 if the command was processed by the shcClient,
+ * 0 if there is no command or no shcClient is running
+ */
+static u8 main_shc_client_request(int argc, char* argv[]) {
+
+    const char* p_command = NULL;
+
+    int i = 1;
+    for ( ; i < argc - 1 ; i++) {
+        if (strcmp(argv[i], "-cmd") == 0) {
+            p_command = argv[i + 1];
+        }
+    }
+
+    if (p_command == NULL || strlen(p_command) > SHC_COMMAND_SOCKET_LINE_MAX_LENGTH - 6) {
+        return 0;
+    }
+
+    struct sockaddr_un address;
+    memset(&address, 0x00, sizeof(address));
+
+    address.sun_family = AF_UNIX;
+    snprintf(address.sun_path, sizeof(address.sun_path), "%s", SHC_COMMAND_SOCKET_DEFAULT_PATH);
+
+    int handle = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (handle < 0) {
+        return 0;
+    }
+
+    if (connect(handle, (struct sockaddr*)&address, sizeof(address)) != 0) {
+        // shcClient is not running
+        close(handle);
+        return 0;
+    }
+
+    char line[SHC_COMMAND_SOCKET_LINE_MAX_LENGTH];
+    int length = snprintf(line, sizeof(line), "com:%s\n", p_command);
+
+    if (send(handle, line, (size_t)length, MSG_NOSIGNAL) != (ssize_t)length) {
+        close(handle);
+        return 0;
+    }
+
+    length = 0;
+
+    while (length < (int)sizeof(line) - 1) {
+
+        ssize_t count = recv(handle, line + length, sizeof(line) - 1 - (size_t)length, 0);
+        if (count <= 0) {
+            break;
+        }
+
+        length += (int)count;
+
+        if (memchr(line, '\n', (size_t)length) != NULL) {
+            break;
+        }
+    }
+
+    close(handle);
+
+    line[length] = '\0';
+    line[strcspn(line, "\r\n")] = '\0';
+
+    printf("Command:\n%s\n", p_command);
+
+    if (strncmp(line, "OK", 2) == 0) {
+        printf("Response:\n%s\n", line[2] == ' ' ? line + 3 : "");
+    } else if (strcmp(line, "TIMEOUT") == 0) {
+        printf("TIMEOUT !\n");
+    } else {
+        printf("shcClient: %s\n", length != 0 ? line : "no response");
+    }
+
+    return 1;
+}
+
+// --------------------------------------------------------------------------------
+
 /**
  * @brief 
  * 
@@ -273,6 +389,8 @@ static void main_CLI_HELP_REQUESTED_SLOT_CALLBACK(const void* p_argument) {
     console_write_line("Options:");
     console_write_line("-dev <device>                        : SPI-device to use for communication");
     console_write_line("-cmd <command>                       : command to send in hexadecimal form (e.g. 0101)");
+    console_new_line();
+    console_write_line("If the shcClient is running, the command is sent via its command-socket.");
 
     exit_program = 1;
 }
@@ -21,6 +21,24 @@
 
 //-------------------------------------------------------------------------
 
+// -filter needs the members of TRACE_OBJECT of tracer/trace_object.h of the
+// framework-revision given by framework_revision. To enable it, define
+// TRACER_FILTER_ENABLED together with all accessors, bound to the members of
+// that revision; the trace-types can optionally be given by name.
+//
+// #define TRACER_FILTER_ENABLED
+// #define TRACER_FILTER_OBJECT_FILE_NAME(p_object)         ((const char*)(p_object)-><file-name>)
+// #define TRACER_FILTER_OBJECT_LINE_NUMBER(p_object)       ((u32)(p_object)-><line-number>)
+// #define TRACER_FILTER_OBJECT_TYPE(p_object)              ((u8)(p_object)-><trace-type>)
+// #define TRACER_FILTER_OBJECT_PAYLOAD(p_object)           ((const u8*)(p_object)-><payload>)
+// #define TRACER_FILTER_OBJECT_PAYLOAD_LENGTH(p_object)    ((u16)(p_object)-><payload-length>)
+//
+// #define TRACER_FILTER_TYPE_PASS                          <trace-type of a pass>
+// #define TRACER_FILTER_TYPE_OPERAND                       <trace-type of an operand>
+// #define TRACER_FILTER_TYPE_ARRAY                         <trace-type of an array>
+
+//-------------------------------------------------------------------------
+
 #include "../src/config_default.h"
 
 #endif /* _config_H_ */
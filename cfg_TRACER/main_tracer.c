@@ -37,6 +37,11 @@
 // --------------------------------------------------------------------------------
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <signal.h>
+#include <unistd.h>
 
 // --------------------------------------------------------------------------------
 
@@ -44,7 +49,6 @@
 
 #include "common/signal_slot_interface.h"
 #include "common/common_types.h"
-#include "common/qeue_interface.h"
 #include "common/common_tools_string.h"
 
 #include "mcu_task_management/mcu_task_controller.h"
@@ -67,18 +71,51 @@
 
 // --------------------------------------------------------------------------------
 
+#include "tracer_spsc_ring.h"
+#include "tracer_capture.h"
+#include "tracer_replay.h"
+#include "tracer_filter.h"
+
+// --------------------------------------------------------------------------------
+
 #ifndef TRACER_DEFAULT_COM_DRIVER_DEVICE
 #define TRACER_DEFAULT_COM_DRIVER_DEVICE            "/dev/serial0"
 #endif
 
 // --------------------------------------------------------------------------------
 
+/**
+ * @brief Depth of the qeues if -depth is not given
+ *
+ */
 #ifndef TRACER_RAW_TRACE_OBJECT_QEUE_SIZE
-#define TRACER_RAW_TRACE_OBJECT_QEUE_SIZE           100
+#define TRACER_RAW_TRACE_OBJECT_QEUE_SIZE           TRACER_SPSC_RING_DEFAULT_DEPTH
 #endif
 
 #ifndef TRACER_PARSED_TRACE_OBJECT_QEUE_SIZE
-#define TRACER_PARSED_TRACE_OBJECT_QEUE_SIZE        100
+#define TRACER_PARSED_TRACE_OBJECT_QEUE_SIZE        TRACER_SPSC_RING_DEFAULT_DEPTH
+#endif
+
+/**
+ * @brief Interval of the qeue-statistic if -stats is given
+ *
+ */
+#ifndef TRACER_STATISTIC_INTERVAL_MS
+#define TRACER_STATISTIC_INTERVAL_MS                5000
+#endif
+
+/**
+ * @brief -filter reads the properties of a parsed trace-object through the
+ * accessors TRACER_FILTER_OBJECT_*, which are bound to TRACE_OBJECT of
+ * tracer/trace_object.h by config.h
+ *
+ */
+#ifdef TRACER_FILTER_ENABLED
+#if !defined(TRACER_FILTER_OBJECT_FILE_NAME) || !defined(TRACER_FILTER_OBJECT_LINE_NUMBER) || \
+    !defined(TRACER_FILTER_OBJECT_TYPE) || !defined(TRACER_FILTER_OBJECT_PAYLOAD) || \
+    !defined(TRACER_FILTER_OBJECT_PAYLOAD_LENGTH)
+#error "TRACER_FILTER_ENABLED needs the accessors TRACER_FILTER_OBJECT_* - see config.h"
+#endif
 #endif
 
 // --------------------------------------------------------------------------------
@@ -128,8 +165,49 @@ SIGNAL_SLOT_INTERFACE_CREATE_SLOT(CLI_ARGUMENT_DEVICE_SIGNAL, MAIN_CLI_ARGUMENT_
 
 // --------------------------------------------------------------------------------
 
-QEUE_INTERFACE_BUILD_QEUE(RAW_TRACE_OBJECT_QEUE, TRACE_OBJECT_RAW, sizeof(TRACE_OBJECT_RAW), TRACER_RAW_TRACE_OBJECT_QEUE_SIZE)
-QEUE_INTERFACE_BUILD_QEUE(TRACE_OBJECT_QEUE, TRACE_OBJECT, sizeof(TRACE_OBJECT), TRACER_PARSED_TRACE_OBJECT_QEUE_SIZE)
+/**
+ * @brief Depth of both qeues, given by -depth
+ *
+ */
+static u32 raw_qeue_depth = TRACER_RAW_TRACE_OBJECT_QEUE_SIZE;
+static u32 parsed_qeue_depth = TRACER_PARSED_TRACE_OBJECT_QEUE_SIZE;
+
+TRACER_SPSC_RING_BUILD_QEUE(RAW_TRACE_OBJECT_QEUE, TRACE_OBJECT_RAW, raw_qeue_depth)
+
+#ifdef TRACER_FILTER_ENABLED
+
+/**
+ * @brief Applies the filters given by -filter to a parsed trace-object.
+ * Called by the parse-thread on enqeue, a rejected object is never
+ * written into the qeue of the print-thread.
+ *
+ * @param p_object the parsed trace-object
+ * @return 1 if the object is printed, 0 if it is discarded
+ */
+static u8 main_trace_object_filter(const TRACE_OBJECT* p_object) {
+
+    if (tracer_filter_is_active() == 0) {
+        return 1;
+    }
+
+    TRACER_FILTER_OBJECT filter_object;
+
+    filter_object.p_file_name = TRACER_FILTER_OBJECT_FILE_NAME(p_object);
+    filter_object.line_number = TRACER_FILTER_OBJECT_LINE_NUMBER(p_object);
+    filter_object.type = TRACER_FILTER_OBJECT_TYPE(p_object);
+    filter_object.p_payload = TRACER_FILTER_OBJECT_PAYLOAD(p_object);
+    filter_object.payload_length = TRACER_FILTER_OBJECT_PAYLOAD_LENGTH(p_object);
+
+    return tracer_filter_match(&filter_object);
+}
+
+TRACER_SPSC_RING_BUILD_FILTERED_QEUE(TRACE_OBJECT_QEUE, TRACE_OBJECT, parsed_qeue_depth, main_trace_object_filter)
+
+#else
+
+TRACER_SPSC_RING_BUILD_QEUE(TRACE_OBJECT_QEUE, TRACE_OBJECT, parsed_qeue_depth)
+
+#endif
 
 // --------------------------------------------------------------------------------
 
@@ -138,6 +216,34 @@ QEUE_INTERFACE_BUILD_QEUE(TRACE_OBJECT_QEUE, TRACE_OBJECT, sizeof(TRACE_OBJECT),
  */
 static u8 exit_program = 0;
 
+/**
+ * @brief -stats was given, the qeue-statistic is printed periodically
+ *
+ */
+static u8 print_statistic = 0;
+
+/**
+ * @brief Capture-file given by -capture, NULL if trace-data is parsed live
+ *
+ */
+static const char* p_capture_file_path = NULL;
+
+/**
+ * @brief Capture-file given by -replay and the time-range
+ * given by -from and -to in microseconds since the start of the capture
+ *
+ */
+static const char* p_replay_file_path = NULL;
+static u64 replay_from_us = 0;
+static u64 replay_to_us = TRACER_REPLAY_TIME_END;
+
+/**
+ * @brief Set by SIGINT and SIGTERM, the main-loop ends
+ * and the capture-file is completed
+ *
+ */
+static volatile sig_atomic_t exit_requested = 0;
+
 /**
  * @brief holds the configuration of the communication driver
  * that is used to read trace data. By default a serial communicaiton
@@ -148,6 +254,296 @@ static TRX_DRIVER_CONFIGURATION driver_cfg;
 
 // --------------------------------------------------------------------------------
 
+/**
+ * @brief Get the actual value of the monotonic clock in milliseconds
+ *
+ * @return monotonic time in milliseconds
+ */
+static u64 main_time_ms(void) {
+
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (u64)now.tv_sec * 1000ULL + (u64)now.tv_nsec / 1000000ULL;
+}
+
+/**
+ * @brief Prints the statistic of a qeue on stderr
+ *
+ * @param p_name name of the qeue
+ * @param p_ring the ring of the qeue
+ */
+static void main_print_qeue_statistic(const char* p_name, TRACER_SPSC_RING* p_ring) {
+
+    TRACER_SPSC_RING_STATISTIC statistic;
+    tracer_spsc_ring_get_statistic(p_ring, &statistic);
+
+    fprintf(stderr, "%s - written:%u depth:%u/%u high-water:%u dropped:%u stalled:%u\n",
+        p_name, statistic.written, statistic.depth, statistic.capacity,
+        statistic.high_water, statistic.dropped, statistic.stalled
+    );
+}
+
+/**
+ * @brief Prints the statistic of the filter on stderr
+ *
+ */
+static void main_print_filter_statistic(void) {
+
+    TRACER_FILTER_STATISTIC statistic;
+    tracer_filter_get_statistic(&statistic);
+
+    fprintf(stderr, "filter - checked:%u rejected:%u\n", statistic.checked, statistic.rejected);
+}
+
+/**
+ * @brief Prints the statistic of the actual capture on stderr
+ *
+ */
+static void main_print_capture_statistic(void) {
+
+    TRACER_CAPTURE_STATISTIC statistic;
+    tracer_capture_get_statistic(&statistic);
+
+    fprintf(stderr, "capture - bytes:%llu records:%u chunks:%u stalled:%u write-errors:%u\n",
+        (unsigned long long)statistic.bytes, statistic.records, statistic.chunks,
+        statistic.stalled, statistic.write_errors
+    );
+}
+
+/**
+ * @brief Prints the statistic of the replay on stderr
+ *
+ */
+static void main_print_replay_statistic(void) {
+
+    TRACER_REPLAY_STATISTIC statistic;
+    tracer_replay_get_statistic(&statistic);
+
+    fprintf(stderr, "replay - bytes:%llu chunks:%u%s segments:%u failed:%u time:%ums\n",
+        (unsigned long long)statistic.bytes, statistic.chunks,
+        statistic.index_rebuilt ? " (index rebuilt)" : "",
+        statistic.segments, statistic.failed, statistic.duration_ms
+    );
+}
+
+/**
+ * @brief Requests the end of the main-loop
+ *
+ * @param signal_number not used
+ */
+static void main_exit_signal_handler(int signal_number) {
+    (void) signal_number;
+    exit_requested = 1;
+}
+
+/**
+ * @brief Removes the arguments that are handled by the tracer itself,
+ * all other arguments are given to the command-line-interface of the framework.
+ *
+ * @param argc number of arguments
+ * @param argv the arguments, modified in place
+ * @return number of remaining arguments
+ */
+static int main_filter_arguments(int argc, char* argv[]) {
+
+    int count = 0;
+    u8 output_file_given = 0;
+
+    int i = 0;
+    for ( ; i < argc ; i++) {
+
+        if (i != 0 && strcmp(argv[i], "-stats") == 0) {
+            print_statistic = 1;
+            continue;
+        }
+
+        if (i != 0 && strcmp(argv[i], "-capture") == 0) {
+
+            if (i + 1 >= argc) {
+                main_CLI_INVALID_PARAMETER_SLOT_CALLBACK("-capture");
+                return 0;
+            }
+
+            p_capture_file_path = argv[i + 1];
+
+            i += 1;
+            continue;
+        }
+
+        if (i != 0 && strcmp(argv[i], "-filter") == 0) {
+
+            #ifndef TRACER_FILTER_ENABLED
+            {
+                console_write_line("-filter is not supported by this build - see TRACER_FILTER_ENABLED of config.h");
+                exit_program = 1;
+                return 0;
+            }
+            #endif
+
+            if (i + 1 >= argc || tracer_filter_add(argv[i + 1]) == 0) {
+                main_CLI_INVALID_PARAMETER_SLOT_CALLBACK("-filter");
+                return 0;
+            }
+
+            i += 1;
+            continue;
+        }
+
+        if (i != 0 && strcmp(argv[i], "-file") == 0) {
+            // handled by the framework, remembered to check it against -replay
+            output_file_given = 1;
+        }
+
+        if (i != 0 && strcmp(argv[i], "-replay") == 0) {
+
+            if (i + 1 >= argc) {
+                main_CLI_INVALID_PARAMETER_SLOT_CALLBACK("-replay");
+                return 0;
+            }
+
+            p_replay_file_path = argv[i + 1];
+
+            i += 1;
+            continue;
+        }
+
+        if (i != 0 && (strcmp(argv[i], "-from") == 0 || strcmp(argv[i], "-to") == 0)) {
+
+            char* p_end = NULL;
+            double seconds = -1.0;
+
+            if (i + 1 < argc) {
+                seconds = strtod(argv[i + 1], &p_end);
+            }
+
+            if (p_end == NULL || *p_end != '\0' || seconds < 0.0) {
+                main_CLI_INVALID_PARAMETER_SLOT_CALLBACK(argv[i]);
+                return 0;
+            }
+
+            if (argv[i][1] == 'f') {
+                replay_from_us = (u64)(seconds * 1000000.0);
+            } else {
+                replay_to_us = (u64)(seconds * 1000000.0);
+            }
+
+            i += 1;
+            continue;
+        }
+
+        if (i != 0 && strcmp(argv[i], "-depth") == 0) {
+
+            char* p_end = NULL;
+            unsigned long depth = 0;
+
+            if (i + 1 < argc) {
+                depth = strtoul(argv[i + 1], &p_end, 10);
+            }
+
+            if (p_end == NULL || *p_end != '\0' || depth == 0 || depth > TRACER_SPSC_RING_MAX_DEPTH) {
+                main_CLI_INVALID_PARAMETER_SLOT_CALLBACK("-depth");
+                return 0;
+            }
+
+            raw_qeue_depth = (u32)depth;
+            parsed_qeue_depth = (u32)depth;
+
+            i += 1;
+            continue;
+        }
+
+        argv[count++] = argv[i];
+    }
+
+    if (count < argc) {
+        argv[count] = NULL;
+    }
+
+    if (p_replay_file_path != NULL && output_file_given) {
+        // every worker would write into the same file
+        console_write_line("-file can not be used together with -replay, the output of -replay is written to stdout");
+        exit_program = 1;
+        return 0;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Decodes a segment of the replay inside of a worker-process.
+ * The communication-driver is replaced by the replay, the pipeline
+ * runs until the segment was read and all trace-objects are printed.
+ *
+ * @param segment not used, selected by tracer_replay
+ * @return 1 on success, 0 if the replay was aborted
+ */
+static u8 main_replay_worker(u32 segment) {
+
+    (void) segment;
+
+    static TRX_DRIVER_INTERFACE replay_driver;
+
+    replay_driver = *i_system.driver.usart0;
+    replay_driver.bytes_available = tracer_replay_bytes_available;
+    replay_driver.get_N_bytes = tracer_replay_get_N_bytes;
+
+    thread_read_trace_object_set_com_driver(&replay_driver);
+
+    READ_TRACE_OBJECT_THREAD_start();
+    PARSE_TRACE_OBJECT_THREAD_start();
+    PRINT_TRACE_OBJECT_THREAD_start();
+
+    for (;;) {
+
+        if (exit_requested) {
+            return 0;
+        }
+
+        mcu_task_controller_schedule();
+        mcu_task_controller_background_run();
+        watchdog();
+
+        // checked in the order of the pipeline, a stage is done
+        // only after the stage in front of it has finished
+        if (tracer_replay_is_finished() &&
+            tracer_spsc_ring_is_drained(RAW_TRACE_OBJECT_QEUE_get_ring()) &&
+            tracer_spsc_ring_is_drained(TRACE_OBJECT_QEUE_get_ring())) {
+
+            return 1;
+        }
+    }
+}
+
+/**
+ * @brief Decodes the capture-file given by -replay on all cores
+ *
+ * @return exit-code of the program
+ */
+static int main_replay(void) {
+
+    if (tracer_replay_open(p_replay_file_path, replay_from_us, replay_to_us) == 0) {
+        console_write_string("Opening capture-file has FAILED: ", p_replay_file_path);
+        return 1;
+    }
+
+    long worker_count = sysconf(_SC_NPROCESSORS_ONLN);
+    if (worker_count < 1) {
+        worker_count = 1;
+    }
+
+    u8 success = tracer_replay_run((u32)worker_count, main_replay_worker);
+
+    if (print_statistic || success == 0) {
+        main_print_replay_statistic();
+    }
+
+    tracer_replay_close();
+    tracer_filter_deinit();
+
+    return success ? 0 : 1;
+}
+
 /**
  * @brief 
  * 
@@ -197,7 +593,12 @@ int main(int argc, char* argv[]) {
         common_tools_string_copy_string(driver_cfg.device.name, TRACER_DEFAULT_COM_DRIVER_DEVICE, DRIVER_CFG_DEVICE_NAME_MAX_LENGTH);
     }
 
-    command_line_interface(argc, argv);
+    argc = main_filter_arguments(argc, argv);
+
+    // -capture and -replay may be the only argument, the framework reports this as no argument
+    if (exit_program == 0 && (argc > 1 || (p_capture_file_path == NULL && p_replay_file_path == NULL))) {
+        command_line_interface(argc, argv);
+    }
 
     if (exit_program) {
         DEBUG_PASS("main() - PROGRAM EXIT REQUESTED !!! ---");
@@ -207,29 +608,89 @@ int main(int argc, char* argv[]) {
     RAW_TRACE_OBJECT_QEUE_init();
     TRACE_OBJECT_QEUE_init();
 
+    struct sigaction exit_action;
+    memset(&exit_action, 0x00, sizeof(exit_action));
+    exit_action.sa_handler = main_exit_signal_handler;
+
+    sigaction(SIGINT, &exit_action, NULL);
+    sigaction(SIGTERM, &exit_action, NULL);
+
+    if (p_replay_file_path != NULL) {
+        // the trace-data is read from the capture-file, the device is not used
+        return main_replay();
+    }
 
     i_system.driver.usart0->initialize();
     i_system.driver.usart0->configure(&driver_cfg);
     i_system.driver.usart0->start_rx(TRX_DRIVER_INTERFACE_UNLIMITED_RX_LENGTH);
 
-    thread_read_trace_object_set_com_driver(i_system.driver.usart0);
+    if (p_capture_file_path != NULL) {
 
-    READ_TRACE_OBJECT_THREAD_start();
-    PARSE_TRACE_OBJECT_THREAD_start();
-    PRINT_TRACE_OBJECT_THREAD_start();
+        // raw bytes only, nothing is parsed during a capture
+        if (tracer_capture_start(p_capture_file_path, i_system.driver.usart0) == 0) {
+            console_write_string("Creating capture-file has FAILED: ", p_capture_file_path);
+            return 1;
+        }
+
+    } else {
+
+        thread_read_trace_object_set_com_driver(i_system.driver.usart0);
+
+        READ_TRACE_OBJECT_THREAD_start();
+        PARSE_TRACE_OBJECT_THREAD_start();
+        PRINT_TRACE_OBJECT_THREAD_start();
+    }
+
+    u64 statistic_time_ms = main_time_ms();
 
     for (;;) {
 
-        if (exit_program) {
+        if (exit_program || exit_requested) {
             break;
         }
+
+        if (p_capture_file_path != NULL) {
+
+            tracer_capture_task();
+
+            if (tracer_capture_has_failed()) {
+                console_write_string("Writing capture-file has FAILED: ", p_capture_file_path);
+                break;
+            }
+        }
         
         mcu_task_controller_schedule();
         mcu_task_controller_background_run();
         watchdog();
+
+        if (print_statistic && main_time_ms() - statistic_time_ms >= TRACER_STATISTIC_INTERVAL_MS) {
+
+            if (p_capture_file_path != NULL) {
+                main_print_capture_statistic();
+            } else {
+                main_print_qeue_statistic("raw-qeue", RAW_TRACE_OBJECT_QEUE_get_ring());
+                main_print_qeue_statistic("parsed-qeue", TRACE_OBJECT_QEUE_get_ring());
+
+                if (tracer_filter_is_active()) {
+                    main_print_filter_statistic();
+                }
+            }
+
+            statistic_time_ms = main_time_ms();
+        }
+    }
+
+    u8 success = 1;
+
+    if (p_capture_file_path != NULL) {
+        tracer_capture_stop();
+        main_print_capture_statistic();
+        success = tracer_capture_has_failed() ? 0 : 1;
     }
 
-    return 0;
+    tracer_filter_deinit();
+
+    return success ? 0 : 1;
 }
 
 // --------------------------------------------------------------------------------
@@ -275,6 +736,13 @@ static void main_CLI_HELP_REQUESTED_SLOT_CALLBACK(const void* p_argument) {
     console_write_line("-file <path>                       : traceoutput will be stored into this file");
     console_write_line("-console                           : traceoutput will be shown on console");
     console_write_line("-mqtt <topic>@<servicer_ip:port>   : traceoutput will be shown on console");
+    console_write_line("-capture <file>                    : stores the raw trace-data into this file, nothing is parsed");
+    console_write_line("-replay <file>                     : decodes a capture-file on all cores, output on stdout, no -file");
+    console_write_line("-from <s> / -to <s>                : time-range of -replay in seconds since start of the capture");
+    console_write_line("-filter <term>[,<term>]            : prints only matching trace-objects, may be given more than once");
+    console_write_line("   file=<pattern> line=<n>[-<m>] type=<n>[|<n>] text=<string> regex=<regex>, !<term> negates");
+    console_write_line("-depth <n>                         : number of trace-objects each qeue can hold");
+    console_write_line("-stats                             : prints the qeue-statistic periodically on stderr");
 
     exit_program = 1;
 }
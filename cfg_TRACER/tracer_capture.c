@@ -0,0 +1,552 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    tracer_capture.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Implementation of the raw capture of the trace-data
+ *
+ *          The main-loop is the producer of the chunk-ring, it reads
+ *          the received bytes directly into the actual chunk. The
+ *          writer-thread is the consumer, it writes a chunk directly
+ *          out of the ring and keeps the index of all written chunks.
+ *
+ * @see     tracer_capture.h
+ */
+
+#define TRACER_OFF
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "tracer.h"
+
+// --------------------------------------------------------------------------------
+
+#include "cpu.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <semaphore.h>
+
+// --------------------------------------------------------------------------------
+
+#include "tracer_spsc_ring.h"
+#include "tracer_capture.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Maximum number of bytes of the records of a chunk
+ *
+ */
+#define TRACER_CAPTURE_CHUNK_DATA_SIZE              (TRACER_CAPTURE_CHUNK_SIZE - sizeof(TRACER_CAPTURE_CHUNK_HEADER))
+
+// --------------------------------------------------------------------------------
+
+static TRX_DRIVER_INTERFACE* p_driver = NULL;
+
+/**
+ * @brief Chunks that are filled by the main-loop and written by the writer-thread
+ *
+ */
+static TRACER_SPSC_RING chunk_ring;
+
+/**
+ * @brief Chunk that is filled at the moment, NULL if no chunk is open
+ *
+ */
+static u8* p_chunk = NULL;
+static u32 chunk_sequence = 0;
+static u64 chunk_open_time_us = 0;
+
+/**
+ * @brief All chunks are occupied, set until a chunk is free again
+ *
+ */
+static u8 is_stalled = 0;
+
+/**
+ * @brief Start of the capture on the monotonic clock
+ *
+ */
+static u64 start_time_us = 0;
+
+/**
+ * @brief Capture-file and its size, used by the writer-thread only
+ *
+ */
+static int file_handle = -1;
+static u64 file_offset = 0;
+
+/**
+ * @brief Index of all written chunks, used by the writer-thread only
+ *
+ */
+static TRACER_CAPTURE_INDEX_ENTRY* p_index_table = NULL;
+static u32 index_count = 0;
+static u32 index_capacity = 0;
+
+static pthread_t writer_thread;
+static sem_t writer_semaphore;
+static u8 writer_running = 0;
+
+/**
+ * @brief Set by the writer-thread if a chunk could not be written
+ *
+ */
+static u8 capture_failed = 0;
+
+/**
+ * @brief bytes, records and stalled are written by the main-loop,
+ * chunks and write_errors by the writer-thread
+ *
+ */
+static TRACER_CAPTURE_STATISTIC statistic;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Get the actual value of the monotonic clock in microseconds
+ *
+ * @return monotonic time in microseconds
+ */
+static u64 tracer_capture_time_us(void) {
+
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (u64)now.tv_sec * 1000000ULL + (u64)now.tv_nsec / 1000ULL;
+}
+
+/**
+ * @brief Writes a block of data completely into the capture-file
+ *
+ * @param p_data the data to write
+ * @param length number of bytes of p_data
+ * @return 1 on success, otherwise 0
+ */
+static u8 tracer_capture_write(const void* p_data, size_t length) {
+
+    const u8* p_position = (const u8*)p_data;
+
+    while (length != 0) {
+
+        ssize_t written = write(file_handle, p_position, length);
+
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+
+        if (written <= 0) {
+            return 0;
+        }
+
+        p_position += written;
+        length -= (size_t)written;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Cuts off everything behind the last complete chunk,
+ * e.g. a chunk that was written partly
+ *
+ * @return 1 on success, otherwise 0
+ */
+static u8 tracer_capture_truncate(void) {
+
+    if (ftruncate(file_handle, (off_t)file_offset) != 0) {
+        return 0;
+    }
+
+    return lseek(file_handle, (off_t)file_offset, SEEK_SET) == (off_t)file_offset ? 1 : 0;
+}
+
+/**
+ * @brief Writes a chunk completely into the capture-file. A failed
+ * attempt is cut off the capture-file before the chunk is written again.
+ *
+ * @param p_chunk_data the chunk including its header
+ * @param length number of bytes of the chunk
+ * @return 1 on success, 0 if the chunk could not be written
+ */
+static u8 tracer_capture_write_chunk(const u8* p_chunk_data, size_t length) {
+
+    u8 retry = 0;
+
+    for (;;) {
+
+        if (tracer_capture_write(p_chunk_data, length)) {
+            return 1;
+        }
+
+        DEBUG_PASS("tracer_capture_write_chunk() - write() has FAILED !!! ---");
+
+        if (tracer_capture_truncate() == 0 || retry == TRACER_CAPTURE_WRITE_RETRY_COUNT) {
+            return 0;
+        }
+
+        retry += 1;
+        usleep(TRACER_CAPTURE_WRITE_RETRY_DELAY_MS * 1000);
+    }
+}
+
+/**
+ * @brief Adds a written chunk to the index
+ *
+ * @param p_header header of the written chunk
+ * @param offset position of the chunk inside of the capture-file
+ */
+static void tracer_capture_index_add(const TRACER_CAPTURE_CHUNK_HEADER* p_header, u64 offset) {
+
+    if (index_count == index_capacity) {
+
+        u32 capacity = index_capacity != 0 ? index_capacity * 2 : 1024;
+
+        TRACER_CAPTURE_INDEX_ENTRY* p_table = realloc(p_index_table, sizeof(TRACER_CAPTURE_INDEX_ENTRY) * capacity);
+        if (p_table == NULL) {
+            DEBUG_PASS("tracer_capture_index_add() - realloc() has FAILED !!! ---");
+            return;
+        }
+
+        p_index_table = p_table;
+        index_capacity = capacity;
+    }
+
+    TRACER_CAPTURE_INDEX_ENTRY* p_entry = &p_index_table[index_count++];
+
+    p_entry->offset = offset;
+    p_entry->base_time_us = p_header->base_time_us;
+    p_entry->last_time_us = p_header->last_time_us;
+}
+
+/**
+ * @brief Writes all closed chunks into the capture-file
+ *
+ */
+static void tracer_capture_drain(void) {
+
+    u8* p_written_chunk = NULL;
+
+    while ((p_written_chunk = tracer_spsc_ring_read_acquire(&chunk_ring)) != NULL) {
+
+        const TRACER_CAPTURE_CHUNK_HEADER* p_header = (const TRACER_CAPTURE_CHUNK_HEADER*)p_written_chunk;
+        size_t length = sizeof(TRACER_CAPTURE_CHUNK_HEADER) + p_header->length;
+
+        // after a failed chunk the capture-file ends with the last complete chunk
+        if (__atomic_load_n(&capture_failed, __ATOMIC_ACQUIRE) == 0 && tracer_capture_write_chunk(p_written_chunk, length)) {
+
+            tracer_capture_index_add(p_header, file_offset);
+            file_offset += length;
+
+            __atomic_add_fetch(&statistic.chunks, 1, __ATOMIC_RELAXED);
+
+        } else {
+            __atomic_add_fetch(&statistic.write_errors, 1, __ATOMIC_RELAXED);
+            __atomic_store_n(&capture_failed, 1, __ATOMIC_RELEASE);
+        }
+
+        tracer_spsc_ring_read_release(&chunk_ring);
+    }
+}
+
+/**
+ * @brief Writes every chunk as soon as it was closed
+ *
+ * @param p_argument not used
+ * @return always NULL
+ */
+static void* tracer_capture_writer_thread(void* p_argument) {
+
+    (void) p_argument;
+
+    while (__atomic_load_n(&writer_running, __ATOMIC_ACQUIRE)) {
+        sem_wait(&writer_semaphore);
+        tracer_capture_drain();
+    }
+
+    tracer_capture_drain();
+
+    return NULL;
+}
+
+/**
+ * @brief Hands the actual chunk over to the writer-thread
+ *
+ */
+static void tracer_capture_close_chunk(void) {
+
+    if (p_chunk == NULL) {
+        return;
+    }
+
+    tracer_spsc_ring_write_commit(&chunk_ring);
+    p_chunk = NULL;
+
+    sem_post(&writer_semaphore);
+}
+
+/**
+ * @brief Opens a new chunk if no chunk is open
+ *
+ * @param now_us actual time since start of the capture
+ * @return the header of the open chunk or NULL if no chunk is free
+ */
+static TRACER_CAPTURE_CHUNK_HEADER* tracer_capture_open_chunk(u64 now_us) {
+
+    if (p_chunk != NULL) {
+        return (TRACER_CAPTURE_CHUNK_HEADER*)p_chunk;
+    }
+
+    p_chunk = tracer_spsc_ring_write_acquire(&chunk_ring);
+    if (p_chunk == NULL) {
+
+        // the main-loop polls until a chunk is free, this is a single stall
+        if (is_stalled == 0) {
+            is_stalled = 1;
+            statistic.stalled += 1;
+        }
+
+        return NULL;
+    }
+
+    is_stalled = 0;
+
+    TRACER_CAPTURE_CHUNK_HEADER* p_header = (TRACER_CAPTURE_CHUNK_HEADER*)p_chunk;
+
+    p_header->magic = TRACER_CAPTURE_CHUNK_MAGIC;
+    p_header->sequence = chunk_sequence++;
+    p_header->base_time_us = now_us;
+    p_header->last_time_us = now_us;
+    p_header->length = 0;
+    p_header->record_count = 0;
+
+    chunk_open_time_us = now_us;
+
+    return p_header;
+}
+
+// --------------------------------------------------------------------------------
+
+u8 tracer_capture_start(const char* p_file_path, TRX_DRIVER_INTERFACE* p_com_driver) {
+
+    DEBUG_TRACE_STR(p_file_path, "tracer_capture_start()");
+
+    memset(&statistic, 0x00, sizeof(statistic));
+
+    p_chunk = NULL;
+    chunk_sequence = 0;
+    index_count = 0;
+    is_stalled = 0;
+    capture_failed = 0;
+
+    if (tracer_spsc_ring_init(&chunk_ring, TRACER_CAPTURE_CHUNK_SIZE, TRACER_CAPTURE_CHUNK_COUNT) == 0) {
+        DEBUG_PASS("tracer_capture_start() - tracer_spsc_ring_init() has FAILED !!! ---");
+        return 0;
+    }
+
+    file_handle = open(p_file_path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (file_handle < 0) {
+        DEBUG_PASS("tracer_capture_start() - open capture-file has FAILED !!! ---");
+        tracer_spsc_ring_deinit(&chunk_ring);
+        return 0;
+    }
+
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+
+    TRACER_CAPTURE_FILE_HEADER file_header;
+    memset(&file_header, 0x00, sizeof(file_header));
+    memcpy(file_header.magic, TRACER_CAPTURE_FILE_MAGIC, TRACER_CAPTURE_MAGIC_LENGTH);
+
+    file_header.chunk_size = TRACER_CAPTURE_CHUNK_SIZE;
+    file_header.start_time_ns = (u64)now.tv_sec * 1000000000ULL + (u64)now.tv_nsec;
+
+    start_time_us = tracer_capture_time_us();
+
+    if (tracer_capture_write(&file_header, sizeof(file_header)) == 0) {
+        DEBUG_PASS("tracer_capture_start() - write file-header has FAILED !!! ---");
+        close(file_handle);
+        file_handle = -1;
+        tracer_spsc_ring_deinit(&chunk_ring);
+        return 0;
+    }
+
+    file_offset = sizeof(file_header);
+
+    if (sem_init(&writer_semaphore, 0, 0) != 0) {
+        DEBUG_PASS("tracer_capture_start() - sem_init() has FAILED !!! ---");
+        close(file_handle);
+        file_handle = -1;
+        tracer_spsc_ring_deinit(&chunk_ring);
+        return 0;
+    }
+
+    writer_running = 1;
+
+    if (pthread_create(&writer_thread, NULL, tracer_capture_writer_thread, NULL) != 0) {
+        DEBUG_PASS("tracer_capture_start() - pthread_create() has FAILED !!! ---");
+        writer_running = 0;
+        sem_destroy(&writer_semaphore);
+        close(file_handle);
+        file_handle = -1;
+        tracer_spsc_ring_deinit(&chunk_ring);
+        return 0;
+    }
+
+    p_driver = p_com_driver;
+
+    return 1;
+}
+
+void tracer_capture_task(void) {
+
+    if (p_driver == NULL || tracer_capture_has_failed()) {
+        return;
+    }
+
+    for (;;) {
+
+        u64 now_us = tracer_capture_time_us() - start_time_us;
+
+        if (p_chunk != NULL && now_us - chunk_open_time_us >= (u64)TRACER_CAPTURE_CHUNK_INTERVAL_MS * 1000ULL) {
+            tracer_capture_close_chunk();
+        }
+
+        u16 available = p_driver->bytes_available();
+        if (available == 0) {
+            return;
+        }
+
+        TRACER_CAPTURE_CHUNK_HEADER* p_header = tracer_capture_open_chunk(now_us);
+        if (p_header == NULL) {
+            // the bytes stay inside of the driver until a chunk is free
+            return;
+        }
+
+        u32 free_space = TRACER_CAPTURE_CHUNK_DATA_SIZE - p_header->length;
+        if (free_space <= TRACER_CAPTURE_RECORD_HEADER_SIZE) {
+            tracer_capture_close_chunk();
+            continue;
+        }
+
+        u32 length = free_space - TRACER_CAPTURE_RECORD_HEADER_SIZE;
+
+        if (length > available) {
+            length = available;
+        }
+
+        if (length > TRACER_CAPTURE_RECORD_MAX_LENGTH) {
+            length = TRACER_CAPTURE_RECORD_MAX_LENGTH;
+        }
+
+        u8* p_record = p_chunk + sizeof(TRACER_CAPTURE_CHUNK_HEADER) + p_header->length;
+
+        u16 record_length = p_driver->get_N_bytes((u16)length, p_record + TRACER_CAPTURE_RECORD_HEADER_SIZE);
+        if (record_length == 0) {
+            return;
+        }
+
+        u32 time_offset_us = (u32)(now_us - p_header->base_time_us);
+
+        memcpy(p_record, &time_offset_us, sizeof(time_offset_us));
+        memcpy(p_record + sizeof(time_offset_us), &record_length, sizeof(record_length));
+
+        p_header->length += TRACER_CAPTURE_RECORD_HEADER_SIZE + record_length;
+        p_header->record_count += 1;
+        p_header->last_time_us = now_us;
+
+        statistic.bytes += record_length;
+        statistic.records += 1;
+    }
+}
+
+void tracer_capture_stop(void) {
+
+    DEBUG_PASS("tracer_capture_stop()");
+
+    if (p_driver == NULL) {
+        return;
+    }
+
+    p_driver = NULL;
+
+    if (p_chunk != NULL && ((TRACER_CAPTURE_CHUNK_HEADER*)p_chunk)->length != 0) {
+        tracer_capture_close_chunk();
+    }
+
+    __atomic_store_n(&writer_running, 0, __ATOMIC_RELEASE);
+    sem_post(&writer_semaphore);
+
+    pthread_join(writer_thread, NULL);
+    sem_destroy(&writer_semaphore);
+
+    TRACER_CAPTURE_FILE_TRAILER trailer;
+    memset(&trailer, 0x00, sizeof(trailer));
+    memcpy(trailer.magic, TRACER_CAPTURE_INDEX_MAGIC, TRACER_CAPTURE_MAGIC_LENGTH);
+
+    trailer.index_offset = file_offset;
+    trailer.chunk_count = index_count;
+
+    if (tracer_capture_write(p_index_table, sizeof(TRACER_CAPTURE_INDEX_ENTRY) * index_count) == 0 ||
+        tracer_capture_write(&trailer, sizeof(trailer)) == 0) {
+
+        // without index the chunks are found by their magic on replay
+        DEBUG_PASS("tracer_capture_stop() - write index has FAILED !!! ---");
+        tracer_capture_truncate();
+        __atomic_store_n(&capture_failed, 1, __ATOMIC_RELEASE);
+    }
+
+    close(file_handle);
+    file_handle = -1;
+
+    free(p_index_table);
+    p_index_table = NULL;
+    index_capacity = 0;
+
+    p_chunk = NULL;
+    tracer_spsc_ring_deinit(&chunk_ring);
+}
+
+u8 tracer_capture_has_failed(void) {
+    return __atomic_load_n(&capture_failed, __ATOMIC_ACQUIRE);
+}
+
+void tracer_capture_get_statistic(TRACER_CAPTURE_STATISTIC* p_statistic) {
+
+    if (p_statistic == NULL) {
+        return;
+    }
+
+    p_statistic->bytes = statistic.bytes;
+    p_statistic->records = statistic.records;
+    p_statistic->stalled = statistic.stalled;
+    p_statistic->chunks = __atomic_load_n(&statistic.chunks, __ATOMIC_RELAXED);
+    p_statistic->write_errors = __atomic_load_n(&statistic.write_errors, __ATOMIC_RELAXED);
+}
+
+// --------------------------------------------------------------------------------
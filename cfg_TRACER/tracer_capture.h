@@ -0,0 +1,302 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    tracer_capture.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Raw capture of the trace-data into a binary file.
+ *
+ *          The bytes received from the communication-driver are stored
+ *          unparsed, together with the time they were received. Bytes
+ *          are collected into chunks of TRACER_CAPTURE_CHUNK_SIZE bytes.
+ *          A chunk is closed if it is full or older than
+ *          TRACER_CAPTURE_CHUNK_INTERVAL_MS and is handed over to a
+ *          writer-thread via a single-producer / single-consumer ring.
+ *          The writer appends every chunk with a single write(), so a
+ *          slow disk never blocks the reception of trace-data.
+ *
+ *          Layout of a capture-file, all numbers in host byte-order:
+ *
+ *              TRACER_CAPTURE_FILE_HEADER
+ *              chunk 0:    TRACER_CAPTURE_CHUNK_HEADER
+ *                          records: u32 time-offset to base_time_us in us,
+ *                                   u16 number of bytes, bytes
+ *              chunk 1:    ...
+ *              index:      TRACER_CAPTURE_INDEX_ENTRY of every chunk
+ *              TRACER_CAPTURE_FILE_TRAILER
+ *
+ *          Index and trailer are written by tracer_capture_stop(). If the
+ *          capture was aborted, the chunks can still be found by their
+ *          magic and length.
+ *
+ *          A chunk that can not be written is retried after the partly
+ *          written data was cut off the capture-file. If the last retry
+ *          fails the capture is marked as failed: no further chunk is
+ *          written, so the capture-file ends with the last complete chunk,
+ *          see tracer_capture_has_failed().
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_tracer_capture_
+#define _H_tracer_capture_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "driver/trx_driver_interface.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Size of a single chunk including its header in bytes
+ *
+ */
+#ifndef TRACER_CAPTURE_CHUNK_SIZE
+#define TRACER_CAPTURE_CHUNK_SIZE                   65536
+#endif
+
+/**
+ * @brief Number of chunks that can wait for the writer-thread
+ *
+ */
+#ifndef TRACER_CAPTURE_CHUNK_COUNT
+#define TRACER_CAPTURE_CHUNK_COUNT                  16
+#endif
+
+/**
+ * @brief Maximum age of a chunk before it is written,
+ * this is the maximum of data that is lost on a crash
+ *
+ */
+#ifndef TRACER_CAPTURE_CHUNK_INTERVAL_MS
+#define TRACER_CAPTURE_CHUNK_INTERVAL_MS            1000
+#endif
+
+/**
+ * @brief Maximum number of bytes of a single record
+ *
+ */
+#ifndef TRACER_CAPTURE_RECORD_MAX_LENGTH
+#define TRACER_CAPTURE_RECORD_MAX_LENGTH            1024
+#endif
+
+/**
+ * @brief Number of retries of a chunk that could not be written
+ *
+ */
+#ifndef TRACER_CAPTURE_WRITE_RETRY_COUNT
+#define TRACER_CAPTURE_WRITE_RETRY_COUNT            3
+#endif
+
+/**
+ * @brief Pause before a chunk is written again
+ *
+ */
+#ifndef TRACER_CAPTURE_WRITE_RETRY_DELAY_MS
+#define TRACER_CAPTURE_WRITE_RETRY_DELAY_MS         100
+#endif
+
+// --------------------------------------------------------------------------------
+
+#define TRACER_CAPTURE_FILE_MAGIC                   "SHCTCAP1"
+#define TRACER_CAPTURE_INDEX_MAGIC                  "SHCTCIX1"
+#define TRACER_CAPTURE_MAGIC_LENGTH                 8
+
+/**
+ * @brief Magic of a chunk, "CHNK"
+ *
+ */
+#define TRACER_CAPTURE_CHUNK_MAGIC                  0x4B4E4843
+
+/**
+ * @brief Size of the header of a record: time-offset and length
+ *
+ */
+#define TRACER_CAPTURE_RECORD_HEADER_SIZE           6
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief First bytes of a capture-file
+ *
+ */
+typedef struct TRACER_CAPTURE_FILE_HEADER_STRUCT {
+
+    char magic[TRACER_CAPTURE_MAGIC_LENGTH];
+
+    /**
+     * @brief TRACER_CAPTURE_CHUNK_SIZE of the capture
+     *
+     */
+    u32 chunk_size;
+    u32 reserved;
+
+    /**
+     * @brief Start of the capture, nanoseconds since 1970
+     *
+     */
+    u64 start_time_ns;
+
+} TRACER_CAPTURE_FILE_HEADER;
+
+/**
+ * @brief Header of a chunk, followed by length bytes of records
+ *
+ */
+typedef struct TRACER_CAPTURE_CHUNK_HEADER_STRUCT {
+
+    u32 magic;
+
+    /**
+     * @brief Number of the chunk, starting with 0
+     *
+     */
+    u32 sequence;
+
+    /**
+     * @brief Time of the first and the last record in
+     * microseconds since the start of the capture
+     *
+     */
+    u64 base_time_us;
+    u64 last_time_us;
+
+    /**
+     * @brief Number of bytes and number of records of the chunk
+     *
+     */
+    u32 length;
+    u32 record_count;
+
+} TRACER_CAPTURE_CHUNK_HEADER;
+
+/**
+ * @brief Position and time-range of a chunk
+ *
+ */
+typedef struct TRACER_CAPTURE_INDEX_ENTRY_STRUCT {
+
+    u64 offset;
+    u64 base_time_us;
+    u64 last_time_us;
+
+} TRACER_CAPTURE_INDEX_ENTRY;
+
+/**
+ * @brief Last bytes of a completed capture-file
+ *
+ */
+typedef struct TRACER_CAPTURE_FILE_TRAILER_STRUCT {
+
+    char magic[TRACER_CAPTURE_MAGIC_LENGTH];
+
+    /**
+     * @brief Position of the first index-entry
+     *
+     */
+    u64 index_offset;
+
+    u32 chunk_count;
+    u32 reserved;
+
+} TRACER_CAPTURE_FILE_TRAILER;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Statistic of the actual capture
+ *
+ */
+typedef struct TRACER_CAPTURE_STATISTIC_STRUCT {
+
+    /**
+     * @brief Number of received bytes and records
+     *
+     */
+    u64 bytes;
+    u32 records;
+
+    /**
+     * @brief Number of chunks that were written
+     *
+     */
+    u32 chunks;
+
+    /**
+     * @brief Number of times all chunks have become occupied,
+     * the received bytes stay inside of the driver meanwhile
+     *
+     */
+    u32 stalled;
+
+    /**
+     * @brief Number of chunks that could not be written,
+     * even after the retries
+     *
+     */
+    u32 write_errors;
+
+} TRACER_CAPTURE_STATISTIC;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Creates the capture-file and starts the writer-thread
+ *
+ * @param p_file_path path of the capture-file, an existing file is replaced
+ * @param p_com_driver driver the trace-data is read from
+ * @return 1 on success, otherwise 0
+ */
+u8 tracer_capture_start(const char* p_file_path, TRX_DRIVER_INTERFACE* p_com_driver);
+
+/**
+ * @brief Reads all available bytes of the communication-driver
+ * into the actual chunk. Must be called from the main-loop.
+ *
+ */
+void tracer_capture_task(void);
+
+/**
+ * @brief Writes all chunks, the index and the trailer
+ * and closes the capture-file
+ *
+ */
+void tracer_capture_stop(void);
+
+/**
+ * @brief Checks if a chunk could not be written into the capture-file.
+ * The capture should be stopped, the received data is not read anymore.
+ *
+ * @return 1 if the capture has failed, otherwise 0
+ */
+u8 tracer_capture_has_failed(void);
+
+/**
+ * @brief Get the statistic of the actual capture.
+ * Must be called from the main-loop.
+ *
+ * @param p_statistic the statistic is copied into this structure
+ */
+void tracer_capture_get_statistic(TRACER_CAPTURE_STATISTIC* p_statistic);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_tracer_capture_
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,601 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    tracer_filter.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Implementation of the filter of the parsed trace-objects
+ *
+ * @see     tracer_filter.h
+ */
+
+#define TRACER_OFF
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "tracer.h"
+
+// --------------------------------------------------------------------------------
+
+#include "cpu.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdlib.h>
+#include <string.h>
+#include <fnmatch.h>
+#include <regex.h>
+
+// --------------------------------------------------------------------------------
+
+#include "tracer_filter.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Maximum length of the file-name that is cached by a file-term
+ *
+ */
+#ifndef TRACER_FILTER_FILE_NAME_MAX_LENGTH
+#define TRACER_FILTER_FILE_NAME_MAX_LENGTH          512
+#endif
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Name and value of a trace-type
+ *
+ */
+typedef struct TRACER_FILTER_TYPE_NAME_STRUCT {
+
+    const char* p_name;
+    u32 type;
+
+} TRACER_FILTER_TYPE_NAME;
+
+/**
+ * @brief The trace-types that can be given by name, see tracer_filter.h
+ *
+ */
+static const TRACER_FILTER_TYPE_NAME type_name_table[] = {
+
+#ifdef TRACER_FILTER_TYPE_PASS
+    { "pass", TRACER_FILTER_TYPE_PASS },
+#endif
+
+#ifdef TRACER_FILTER_TYPE_OPERAND
+    { "operand", TRACER_FILTER_TYPE_OPERAND },
+#endif
+
+#ifdef TRACER_FILTER_TYPE_ARRAY
+    { "array", TRACER_FILTER_TYPE_ARRAY },
+#endif
+
+    { NULL, 0 }
+};
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Kind of a term, sorted from cheap to expensive
+ *
+ */
+typedef enum {
+
+    TRACER_FILTER_TERM_TYPE = 0,
+    TRACER_FILTER_TERM_LINE,
+    TRACER_FILTER_TERM_FILE,
+    TRACER_FILTER_TERM_TEXT,
+    TRACER_FILTER_TERM_REGEX
+
+} TRACER_FILTER_TERM_KIND;
+
+/**
+ * @brief A compiled term of a filter-expression
+ *
+ */
+typedef struct TRACER_FILTER_TERM_STRUCT {
+
+    TRACER_FILTER_TERM_KIND kind;
+    u8 negated;
+
+    /**
+     * @brief line: first and last line-number
+     *
+     */
+    u32 line_first;
+    u32 line_last;
+
+    /**
+     * @brief type: one bit for every accepted trace-type
+     *
+     */
+    u32 type_mask;
+
+    /**
+     * @brief file: shell-pattern, text: string to search for
+     *
+     */
+    char value[TRACER_FILTER_VALUE_MAX_LENGTH];
+    u16 value_length;
+
+    /**
+     * @brief regex: the compiled regular expression
+     *
+     */
+    regex_t regex;
+
+    /**
+     * @brief file: result of the last source-file
+     *
+     */
+    char cached_file_name[TRACER_FILTER_FILE_NAME_MAX_LENGTH];
+    u8 cached_result;
+
+} TRACER_FILTER_TERM;
+
+/**
+ * @brief A compiled filter-expression
+ *
+ */
+typedef struct TRACER_FILTER_EXPRESSION_STRUCT {
+
+    TRACER_FILTER_TERM term_list[TRACER_FILTER_MAX_TERMS];
+    u8 term_count;
+
+} TRACER_FILTER_EXPRESSION;
+
+// --------------------------------------------------------------------------------
+
+static TRACER_FILTER_EXPRESSION expression_list[TRACER_FILTER_MAX_EXPRESSIONS];
+static u8 expression_count = 0;
+
+static TRACER_FILTER_STATISTIC statistic;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Parses a decimal number
+ *
+ * @param p_string start of the number
+ * @param pp_end first character behind the number
+ * @param p_number the number is stored here
+ * @return 1 on success, 0 if p_string does not start with a number
+ */
+static u8 tracer_filter_parse_number(const char* p_string, const char** pp_end, u32* p_number) {
+
+    char* p_end = NULL;
+    unsigned long number = strtoul(p_string, &p_end, 10);
+
+    if (p_end == p_string || number > 0xFFFFFFFFUL) {
+        return 0;
+    }
+
+    *pp_end = p_end;
+    *p_number = (u32)number;
+
+    return 1;
+}
+
+/**
+ * @brief Compiles the value of a line-term: <n> or <n>-<m>
+ *
+ */
+static u8 tracer_filter_compile_line(TRACER_FILTER_TERM* p_term, const char* p_value) {
+
+    const char* p_end = NULL;
+
+    if (tracer_filter_parse_number(p_value, &p_end, &p_term->line_first) == 0) {
+        return 0;
+    }
+
+    p_term->line_last = p_term->line_first;
+
+    if (*p_end == '-') {
+
+        if (tracer_filter_parse_number(p_end + 1, &p_end, &p_term->line_last) == 0) {
+            return 0;
+        }
+    }
+
+    return *p_end == '\0' && p_term->line_first <= p_term->line_last;
+}
+
+/**
+ * @brief Searches a trace-type by its name
+ *
+ * @param p_name the name, not zero-terminated
+ * @param length number of characters of the name
+ * @param p_type the value of the trace-type
+ * @return 1 if the name is known, otherwise 0
+ */
+static u8 tracer_filter_find_type(const char* p_name, size_t length, u32* p_type) {
+
+    const TRACER_FILTER_TYPE_NAME* p_entry = type_name_table;
+
+    for ( ; p_entry->p_name != NULL ; p_entry++) {
+
+        if (strlen(p_entry->p_name) == length && strncmp(p_entry->p_name, p_name, length) == 0) {
+            *p_type = p_entry->type;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Compiles the value of a type-term: list of names or numbers separated by '|'
+ *
+ */
+static u8 tracer_filter_compile_type(TRACER_FILTER_TERM* p_term, const char* p_value) {
+
+    p_term->type_mask = 0;
+
+    while (*p_value != '\0') {
+
+        size_t length = strcspn(p_value, "|");
+        u32 type = 0;
+
+        if (tracer_filter_find_type(p_value, length, &type) == 0) {
+
+            const char* p_end = NULL;
+
+            if (tracer_filter_parse_number(p_value, &p_end, &type) == 0 || p_end != p_value + length) {
+                return 0;
+            }
+        }
+
+        if (type > 31) {
+            return 0;
+        }
+
+        p_term->type_mask |= 1UL << type;
+
+        p_value += length;
+
+        if (*p_value == '|') {
+            p_value += 1;
+        }
+    }
+
+    return p_term->type_mask != 0;
+}
+
+/**
+ * @brief Compiles a single term, e.g. "!file=*lcd*"
+ *
+ * @param p_term the compiled term
+ * @param p_string the term, the ',' inside of values are already unescaped
+ * @return 1 on success, otherwise 0
+ */
+static u8 tracer_filter_compile_term(TRACER_FILTER_TERM* p_term, const char* p_string) {
+
+    memset(p_term, 0x00, sizeof(TRACER_FILTER_TERM));
+
+    if (*p_string == '!') {
+        p_term->negated = 1;
+        p_string += 1;
+    }
+
+    const char* p_value = strchr(p_string, '=');
+    if (p_value == NULL) {
+        return 0;
+    }
+
+    size_t name_length = (size_t)(p_value - p_string);
+    p_value += 1;
+
+    size_t value_length = strlen(p_value);
+    if (value_length == 0 || value_length >= TRACER_FILTER_VALUE_MAX_LENGTH) {
+        return 0;
+    }
+
+    memcpy(p_term->value, p_value, value_length + 1);
+    p_term->value_length = (u16)value_length;
+
+    if (name_length == 4 && strncmp(p_string, "file", 4) == 0) {
+        p_term->kind = TRACER_FILTER_TERM_FILE;
+        return 1;
+    }
+
+    if (name_length == 4 && strncmp(p_string, "line", 4) == 0) {
+        p_term->kind = TRACER_FILTER_TERM_LINE;
+        return tracer_filter_compile_line(p_term, p_value);
+    }
+
+    if (name_length == 4 && strncmp(p_string, "type", 4) == 0) {
+        p_term->kind = TRACER_FILTER_TERM_TYPE;
+        return tracer_filter_compile_type(p_term, p_value);
+    }
+
+    if (name_length == 4 && strncmp(p_string, "text", 4) == 0) {
+        p_term->kind = TRACER_FILTER_TERM_TEXT;
+        return 1;
+    }
+
+    if (name_length == 5 && strncmp(p_string, "regex", 5) == 0) {
+        p_term->kind = TRACER_FILTER_TERM_REGEX;
+        return regcomp(&p_term->regex, p_value, REG_EXTENDED | REG_NOSUB) == 0;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Releases the resources of all terms of an expression
+ *
+ */
+static void tracer_filter_release_expression(TRACER_FILTER_EXPRESSION* p_expression) {
+
+    u8 i = 0;
+    for ( ; i < p_expression->term_count ; i++) {
+
+        if (p_expression->term_list[i].kind == TRACER_FILTER_TERM_REGEX) {
+            regfree(&p_expression->term_list[i].regex);
+        }
+    }
+
+    p_expression->term_count = 0;
+}
+
+/**
+ * @brief Checks a source-file against a file-term,
+ * the result of the last source-file is reused
+ *
+ */
+static u8 tracer_filter_match_file(TRACER_FILTER_TERM* p_term, const char* p_file_name) {
+
+    if (strcmp(p_term->cached_file_name, p_file_name) == 0) {
+        return p_term->cached_result;
+    }
+
+    p_term->cached_result = fnmatch(p_term->value, p_file_name, 0) == 0 ? 1 : 0;
+
+    if (strlen(p_file_name) < sizeof(p_term->cached_file_name)) {
+        strcpy(p_term->cached_file_name, p_file_name);
+    } else {
+        p_term->cached_file_name[0] = '\0';
+    }
+
+    return p_term->cached_result;
+}
+
+/**
+ * @brief Checks the payload against a text-term
+ *
+ */
+static u8 tracer_filter_match_text(const TRACER_FILTER_TERM* p_term, const TRACER_FILTER_OBJECT* p_object) {
+
+    if (p_object->p_payload == NULL || p_object->payload_length < p_term->value_length) {
+        return 0;
+    }
+
+    const u8* p_position = p_object->p_payload;
+    const u8* p_last = p_object->p_payload + p_object->payload_length - p_term->value_length;
+
+    // memmem() is a GNU extension, the first character is searched by memchr()
+    while (p_position <= p_last) {
+
+        p_position = memchr(p_position, p_term->value[0], (size_t)(p_last - p_position) + 1);
+        if (p_position == NULL) {
+            return 0;
+        }
+
+        if (memcmp(p_position, p_term->value, p_term->value_length) == 0) {
+            return 1;
+        }
+
+        p_position += 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Checks the payload against a regex-term
+ *
+ * @param p_payload zero-terminated copy of the payload
+ */
+static u8 tracer_filter_match_regex(const TRACER_FILTER_TERM* p_term, const char* p_payload) {
+    return regexec(&p_term->regex, p_payload, 0, NULL, 0) == 0;
+}
+
+/**
+ * @brief Checks a trace-object against all terms of an expression
+ *
+ * @param p_expression the expression to check
+ * @param p_object the trace-object
+ * @param p_payload_string zero-terminated copy of the payload, created on first use
+ * @return 1 if all terms match, otherwise 0
+ */
+static u8 tracer_filter_match_expression(TRACER_FILTER_EXPRESSION* p_expression, const TRACER_FILTER_OBJECT* p_object, char* p_payload_string) {
+
+    u8 i = 0;
+    for ( ; i < p_expression->term_count ; i++) {
+
+        TRACER_FILTER_TERM* p_term = &p_expression->term_list[i];
+        u8 result = 0;
+
+        switch (p_term->kind) {
+
+            case TRACER_FILTER_TERM_TYPE:
+                result = p_object->type < 32 && (p_term->type_mask & (1UL << p_object->type)) != 0;
+                break;
+
+            case TRACER_FILTER_TERM_LINE:
+                result = p_object->line_number >= p_term->line_first && p_object->line_number <= p_term->line_last;
+                break;
+
+            case TRACER_FILTER_TERM_FILE:
+                result = p_object->p_file_name != NULL && tracer_filter_match_file(p_term, p_object->p_file_name);
+                break;
+
+            case TRACER_FILTER_TERM_TEXT:
+                result = tracer_filter_match_text(p_term, p_object);
+                break;
+
+            case TRACER_FILTER_TERM_REGEX:
+
+                if (p_payload_string[0] == '\0' && p_object->p_payload != NULL) {
+
+                    u16 length = p_object->payload_length;
+                    if (length >= TRACER_FILTER_PAYLOAD_MAX_LENGTH) {
+                        length = TRACER_FILTER_PAYLOAD_MAX_LENGTH - 1;
+                    }
+
+                    memcpy(p_payload_string, p_object->p_payload, length);
+                    p_payload_string[length] = '\0';
+                }
+
+                result = tracer_filter_match_regex(p_term, p_payload_string);
+                break;
+        }
+
+        if (result == p_term->negated) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+// --------------------------------------------------------------------------------
+
+u8 tracer_filter_add(const char* p_expression) {
+
+    DEBUG_TRACE_STR(p_expression, "tracer_filter_add()");
+
+    if (p_expression == NULL || expression_count >= TRACER_FILTER_MAX_EXPRESSIONS) {
+        return 0;
+    }
+
+    TRACER_FILTER_EXPRESSION* p_compiled = &expression_list[expression_count];
+    p_compiled->term_count = 0;
+
+    char term[TRACER_FILTER_VALUE_MAX_LENGTH + 8];
+    u16 term_length = 0;
+
+    const char* p_position = p_expression;
+
+    for (;;) {
+
+        if (*p_position == '\\' && p_position[1] == ',') {
+            p_position += 1;
+
+        } else if (*p_position == ',' || *p_position == '\0') {
+
+            term[term_length] = '\0';
+
+            if (p_compiled->term_count >= TRACER_FILTER_MAX_TERMS ||
+                tracer_filter_compile_term(&p_compiled->term_list[p_compiled->term_count], term) == 0) {
+
+                DEBUG_TRACE_STR(term, "tracer_filter_add() - invalid term");
+                tracer_filter_release_expression(p_compiled);
+                return 0;
+            }
+
+            p_compiled->term_count += 1;
+            term_length = 0;
+
+            if (*p_position == '\0') {
+                break;
+            }
+
+            p_position += 1;
+            continue;
+        }
+
+        if (term_length >= sizeof(term) - 1) {
+            tracer_filter_release_expression(p_compiled);
+            return 0;
+        }
+
+        term[term_length++] = *p_position++;
+    }
+
+    // cheap terms first, the sort is stable to keep the order of the user
+    u8 i = 1;
+    for ( ; i < p_compiled->term_count ; i++) {
+
+        TRACER_FILTER_TERM compiled_term = p_compiled->term_list[i];
+        u8 j = i;
+
+        while (j > 0 && p_compiled->term_list[j - 1].kind > compiled_term.kind) {
+            p_compiled->term_list[j] = p_compiled->term_list[j - 1];
+            j -= 1;
+        }
+
+        p_compiled->term_list[j] = compiled_term;
+    }
+
+    expression_count += 1;
+
+    return 1;
+}
+
+u8 tracer_filter_is_active(void) {
+    return expression_count != 0;
+}
+
+u8 tracer_filter_match(const TRACER_FILTER_OBJECT* p_object) {
+
+    if (expression_count == 0) {
+        return 1;
+    }
+
+    __atomic_add_fetch(&statistic.checked, 1, __ATOMIC_RELAXED);
+
+    char payload_string[TRACER_FILTER_PAYLOAD_MAX_LENGTH];
+    payload_string[0] = '\0';
+
+    u8 i = 0;
+    for ( ; i < expression_count ; i++) {
+
+        if (tracer_filter_match_expression(&expression_list[i], p_object, payload_string)) {
+            return 1;
+        }
+    }
+
+    __atomic_add_fetch(&statistic.rejected, 1, __ATOMIC_RELAXED);
+
+    return 0;
+}
+
+void tracer_filter_deinit(void) {
+
+    u8 i = 0;
+    for ( ; i < expression_count ; i++) {
+        tracer_filter_release_expression(&expression_list[i]);
+    }
+
+    expression_count = 0;
+}
+
+void tracer_filter_get_statistic(TRACER_FILTER_STATISTIC* p_statistic) {
+
+    if (p_statistic == NULL) {
+        return;
+    }
+
+    p_statistic->checked = __atomic_load_n(&statistic.checked, __ATOMIC_RELAXED);
+    p_statistic->rejected = __atomic_load_n(&statistic.rejected, __ATOMIC_RELAXED);
+}
+
+// --------------------------------------------------------------------------------
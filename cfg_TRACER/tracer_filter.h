@@ -0,0 +1,182 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    tracer_filter.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Filter of the parsed trace-objects.
+ *
+ *          A filter-expression is a list of terms separated by ',',
+ *          all terms must match (and). An object passes the filter if
+ *          at least one expression matches (or). A term that starts
+ *          with '!' is negated. A ',' inside of a value is given as "\,".
+ *
+ *              file=<pattern>          source-file, shell-pattern (fnmatch)
+ *              line=<n>[-<m>]          line-number or range of line-numbers
+ *              type=<type>[|<type>]    a number or pass, operand, array
+ *              text=<string>           payload includes the string
+ *              regex=<expression>      payload matches the extended regex
+ *
+ *          e.g. "file=*lcd*,line=100-200,!text=idle"
+ *
+ *          Every expression is compiled once by tracer_filter_add():
+ *          numbers are parsed, regular expressions are compiled and the
+ *          terms are sorted from cheap to expensive, so an expression is
+ *          rejected by the cheapest term first. The result of the last
+ *          source-file is cached by every file-term.
+ *
+ *          tracer_filter_match() is called by the parse-thread only.
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_tracer_filter_
+#define _H_tracer_filter_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Maximum number of filter-expressions
+ *
+ */
+#ifndef TRACER_FILTER_MAX_EXPRESSIONS
+#define TRACER_FILTER_MAX_EXPRESSIONS               16
+#endif
+
+/**
+ * @brief Maximum number of terms of a single filter-expression
+ *
+ */
+#ifndef TRACER_FILTER_MAX_TERMS
+#define TRACER_FILTER_MAX_TERMS                     8
+#endif
+
+/**
+ * @brief Maximum length of the value of a term
+ *
+ */
+#ifndef TRACER_FILTER_VALUE_MAX_LENGTH
+#define TRACER_FILTER_VALUE_MAX_LENGTH              128
+#endif
+
+/**
+ * @brief Maximum number of bytes of the payload a regex is applied to
+ *
+ */
+#ifndef TRACER_FILTER_PAYLOAD_MAX_LENGTH
+#define TRACER_FILTER_PAYLOAD_MAX_LENGTH            256
+#endif
+
+/*
+ * The trace-types can be given by name if their values are defined by
+ * config.h, the values are taken from tracer/trace_object.h of the
+ * framework: TRACER_FILTER_TYPE_PASS, TRACER_FILTER_TYPE_OPERAND and
+ * TRACER_FILTER_TYPE_ARRAY. A name without value is rejected,
+ * numbers are always accepted.
+ */
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief The properties of a trace-object the filter is applied to
+ *
+ */
+typedef struct TRACER_FILTER_OBJECT_STRUCT {
+
+    /**
+     * @brief Zero-terminated path of the source-file
+     *
+     */
+    const char* p_file_name;
+    u32 line_number;
+
+    /**
+     * @brief Trace-type, 0 ... 31
+     *
+     */
+    u8 type;
+
+    /**
+     * @brief Payload of the trace-object, not zero-terminated
+     *
+     */
+    const u8* p_payload;
+    u16 payload_length;
+
+} TRACER_FILTER_OBJECT;
+
+/**
+ * @brief Statistic of the filter
+ *
+ */
+typedef struct TRACER_FILTER_STATISTIC_STRUCT {
+
+    /**
+     * @brief Number of checked and of rejected trace-objects
+     *
+     */
+    u32 checked;
+    u32 rejected;
+
+} TRACER_FILTER_STATISTIC;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Compiles a filter-expression and adds it to the filter.
+ * Must be called before the parse-thread is started.
+ *
+ * @param p_expression the filter-expression, e.g. "file=*lcd*,line=100-200"
+ * @return 1 on success, 0 if the expression is invalid
+ */
+u8 tracer_filter_add(const char* p_expression);
+
+/**
+ * @brief Checks if at least one filter-expression was added
+ *
+ * @return 1 if the filter is active, otherwise 0
+ */
+u8 tracer_filter_is_active(void);
+
+/**
+ * @brief Applies the filter to a trace-object
+ *
+ * @param p_object properties of the trace-object
+ * @return 1 if the object passes the filter, 0 if it is rejected
+ */
+u8 tracer_filter_match(const TRACER_FILTER_OBJECT* p_object);
+
+/**
+ * @brief Releases all filter-expressions
+ *
+ */
+void tracer_filter_deinit(void);
+
+/**
+ * @brief Get the statistic of the filter, can be called from any thread
+ *
+ * @param p_statistic the statistic is copied into this structure
+ */
+void tracer_filter_get_statistic(TRACER_FILTER_STATISTIC* p_statistic);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_tracer_filter_
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,932 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    tracer_replay.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Implementation of the offline decoding of a capture-file
+ *
+ *          Headers and records inside of the capture-file are not
+ *          aligned, they are always copied before they are used.
+ *
+ * @see     tracer_replay.h
+ */
+
+#define TRACER_OFF
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "tracer.h"
+
+// --------------------------------------------------------------------------------
+
+#include "cpu.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+// --------------------------------------------------------------------------------
+
+#include "tracer_capture.h"
+#include "tracer_replay.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Directory of the temporary output-files of the workers
+ *
+ */
+#ifndef TRACER_REPLAY_TEMP_PATH
+#define TRACER_REPLAY_TEMP_PATH                     "/tmp"
+#endif
+
+/**
+ * @brief Size of the buffer used to copy the output of the workers
+ *
+ */
+#ifndef TRACER_REPLAY_COPY_BUFFER_SIZE
+#define TRACER_REPLAY_COPY_BUFFER_SIZE              65536
+#endif
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief A chunk of the mapped capture-file
+ *
+ */
+typedef struct TRACER_REPLAY_CHUNK_STRUCT {
+
+    const u8* p_records;
+    u32 length;
+
+    u64 base_time_us;
+    u64 last_time_us;
+
+} TRACER_REPLAY_CHUNK;
+
+/**
+ * @brief Position of a record: number of the chunk and offset
+ * of the record-header inside of the records of the chunk.
+ * The end of the capture is { chunk_count, 0 }.
+ *
+ */
+typedef struct TRACER_REPLAY_POSITION_STRUCT {
+
+    u32 chunk;
+    u32 offset;
+
+} TRACER_REPLAY_POSITION;
+
+// --------------------------------------------------------------------------------
+
+static u8* p_map = NULL;
+static size_t map_size = 0;
+
+static TRACER_REPLAY_CHUNK* p_chunk_table = NULL;
+static u32 chunk_count = 0;
+
+/**
+ * @brief Segment i starts at segment_table[i] and ends
+ * in front of segment_table[i + 1]
+ *
+ */
+static TRACER_REPLAY_POSITION segment_table[TRACER_REPLAY_MAX_WORKERS + 1];
+static u32 segment_count = 0;
+
+/**
+ * @brief Selected time-range
+ *
+ */
+static TRACER_REPLAY_POSITION range_begin;
+static TRACER_REPLAY_POSITION range_end;
+
+/**
+ * @brief Read-position of the worker inside of its segment
+ *
+ */
+static TRACER_REPLAY_POSITION read_position;
+static TRACER_REPLAY_POSITION read_end;
+static const u8* p_read_data = NULL;
+static u16 read_remaining = 0;
+
+/**
+ * @brief Number of calls of tracer_replay_bytes_available() at the end
+ * of the segment, written by the read-thread only
+ *
+ */
+static u8 read_end_polls = 0;
+
+/**
+ * @brief Set by the read-thread if it has handed over the last
+ * trace-object of the segment, read by tracer_replay_is_finished()
+ *
+ */
+static u8 read_finished = 0;
+
+static TRACER_REPLAY_STATISTIC statistic;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Get the actual value of the monotonic clock in milliseconds
+ *
+ * @return monotonic time in milliseconds
+ */
+static u64 tracer_replay_time_ms(void) {
+
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (u64)now.tv_sec * 1000ULL + (u64)now.tv_nsec / 1000000ULL;
+}
+
+/**
+ * @brief Compares two positions
+ *
+ * @return < 0 if a is in front of b, 0 if both are equal, > 0 otherwise
+ */
+static int tracer_replay_position_compare(const TRACER_REPLAY_POSITION* p_a, const TRACER_REPLAY_POSITION* p_b) {
+
+    if (p_a->chunk != p_b->chunk) {
+        return p_a->chunk < p_b->chunk ? -1 : 1;
+    }
+
+    if (p_a->offset != p_b->offset) {
+        return p_a->offset < p_b->offset ? -1 : 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Moves a position behind the end of a chunk
+ * to the start of the next chunk that is not empty
+ *
+ */
+static void tracer_replay_position_normalize(TRACER_REPLAY_POSITION* p_position) {
+
+    while (p_position->chunk < chunk_count && p_position->offset >= p_chunk_table[p_position->chunk].length) {
+        p_position->chunk += 1;
+        p_position->offset = 0;
+    }
+
+    if (p_position->chunk >= chunk_count) {
+        p_position->chunk = chunk_count;
+        p_position->offset = 0;
+    }
+}
+
+/**
+ * @brief Reads the record at the given position and moves
+ * the position to the next record.
+ *
+ * @param p_position position of the record, normalized
+ * @param pp_data start of the bytes of the record
+ * @param p_length number of bytes of the record
+ * @param p_time_us time the record was received
+ * @return 1 if a record was read, 0 at the end of the capture
+ */
+static u8 tracer_replay_next_record(TRACER_REPLAY_POSITION* p_position, const u8** pp_data, u16* p_length, u64* p_time_us) {
+
+    while (p_position->chunk < chunk_count) {
+
+        const TRACER_REPLAY_CHUNK* p_chunk = &p_chunk_table[p_position->chunk];
+
+        if (p_position->offset + TRACER_CAPTURE_RECORD_HEADER_SIZE > p_chunk->length) {
+            // end of the chunk or a broken record
+            p_position->offset = p_chunk->length;
+            tracer_replay_position_normalize(p_position);
+            continue;
+        }
+
+        const u8* p_record = p_chunk->p_records + p_position->offset;
+
+        u32 time_offset_us = 0;
+        u16 length = 0;
+
+        memcpy(&time_offset_us, p_record, sizeof(time_offset_us));
+        memcpy(&length, p_record + sizeof(time_offset_us), sizeof(length));
+
+        if (p_position->offset + TRACER_CAPTURE_RECORD_HEADER_SIZE + length > p_chunk->length) {
+            p_position->offset = p_chunk->length;
+            tracer_replay_position_normalize(p_position);
+            continue;
+        }
+
+        *pp_data = p_record + TRACER_CAPTURE_RECORD_HEADER_SIZE;
+        *p_length = length;
+        *p_time_us = p_chunk->base_time_us + time_offset_us;
+
+        p_position->offset += TRACER_CAPTURE_RECORD_HEADER_SIZE + length;
+        tracer_replay_position_normalize(p_position);
+
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Searches the first record at or behind the start of a chunk that
+ * was received at or after a given time and after the line was idle for
+ * at least TRACER_REPLAY_SPLIT_GAP_US.
+ *
+ * @param chunk number of the chunk to start with
+ * @param min_time_us the record must not be received before this time
+ * @return position of the record or the end of the capture
+ */
+static TRACER_REPLAY_POSITION tracer_replay_find_split(u32 chunk, u64 min_time_us) {
+
+    TRACER_REPLAY_POSITION position = { chunk, 0 };
+    tracer_replay_position_normalize(&position);
+
+    // the first record of the capture can always be used
+    u8 has_previous = position.chunk != 0;
+    u64 previous_time_us = has_previous ? p_chunk_table[position.chunk - 1].last_time_us : 0;
+
+    for (;;) {
+
+        TRACER_REPLAY_POSITION record_position = position;
+
+        const u8* p_data = NULL;
+        u16 length = 0;
+        u64 time_us = 0;
+
+        if (tracer_replay_next_record(&position, &p_data, &length, &time_us) == 0) {
+            return position;
+        }
+
+        if (time_us >= min_time_us && (has_previous == 0 || time_us - previous_time_us >= TRACER_REPLAY_SPLIT_GAP_US)) {
+            return record_position;
+        }
+
+        has_previous = 1;
+        previous_time_us = time_us;
+    }
+}
+
+/**
+ * @brief Searches the last record that was received at or before a given
+ * time and after the line was idle for at least TRACER_REPLAY_SPLIT_GAP_US.
+ * The time-range is extended to the start of the trace-object that was
+ * received at the given time.
+ *
+ * @param chunk first chunk that includes records at or after time_us
+ * @param time_us start of the time-range
+ * @return position of the record or the start of the capture
+ */
+static TRACER_REPLAY_POSITION tracer_replay_find_begin(u32 chunk, u64 time_us) {
+
+    if (chunk >= chunk_count) {
+        TRACER_REPLAY_POSITION end = { chunk_count, 0 };
+        return end;
+    }
+
+    for (;;) {
+
+        TRACER_REPLAY_POSITION position = { chunk, 0 };
+        TRACER_REPLAY_POSITION found = { chunk_count, 0 };
+
+        u8 has_previous = chunk != 0;
+        u64 previous_time_us = has_previous ? p_chunk_table[chunk - 1].last_time_us : 0;
+
+        // only the records of this chunk, the chunks in front are searched next
+        while (position.chunk == chunk) {
+
+            TRACER_REPLAY_POSITION record_position = position;
+
+            const u8* p_data = NULL;
+            u16 length = 0;
+            u64 record_time_us = 0;
+
+            if (tracer_replay_next_record(&position, &p_data, &length, &record_time_us) == 0 || record_time_us > time_us) {
+                break;
+            }
+
+            if (has_previous == 0 || record_time_us - previous_time_us >= TRACER_REPLAY_SPLIT_GAP_US) {
+                found = record_position;
+            }
+
+            has_previous = 1;
+            previous_time_us = record_time_us;
+        }
+
+        if (found.chunk != chunk_count) {
+            return found;
+        }
+
+        if (chunk == 0) {
+            TRACER_REPLAY_POSITION start = { 0, 0 };
+            tracer_replay_position_normalize(&start);
+            return start;
+        }
+
+        chunk -= 1;
+    }
+}
+
+/**
+ * @brief Get the first chunk that includes records at or after a given time
+ *
+ * @param time_us time to search for
+ * @return number of the chunk or chunk_count
+ */
+static u32 tracer_replay_find_chunk(u64 time_us) {
+
+    u32 low = 0;
+    u32 high = chunk_count;
+
+    while (low < high) {
+
+        u32 middle = low + (high - low) / 2;
+
+        if (p_chunk_table[middle].last_time_us < time_us) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+/**
+ * @brief Reads the header of a chunk of the capture-file
+ *
+ * @param offset position of the chunk-header inside of the capture-file
+ * @param p_header the header is copied into this structure
+ * @return 1 if the chunk is complete, otherwise 0
+ */
+static u8 tracer_replay_read_chunk_header(u64 offset, TRACER_CAPTURE_CHUNK_HEADER* p_header) {
+
+    if (offset + sizeof(TRACER_CAPTURE_CHUNK_HEADER) > map_size) {
+        return 0;
+    }
+
+    memcpy(p_header, p_map + offset, sizeof(TRACER_CAPTURE_CHUNK_HEADER));
+
+    if (p_header->magic != TRACER_CAPTURE_CHUNK_MAGIC) {
+        return 0;
+    }
+
+    return offset + sizeof(TRACER_CAPTURE_CHUNK_HEADER) + p_header->length <= map_size ? 1 : 0;
+}
+
+/**
+ * @brief Adds a chunk to the chunk-table
+ *
+ * @param offset position of the chunk-header inside of the capture-file
+ * @return 1 if the chunk is complete, otherwise 0
+ */
+static u8 tracer_replay_add_chunk(u64 offset) {
+
+    TRACER_CAPTURE_CHUNK_HEADER header;
+
+    if (tracer_replay_read_chunk_header(offset, &header) == 0) {
+        return 0;
+    }
+
+    TRACER_REPLAY_CHUNK* p_chunk = &p_chunk_table[chunk_count++];
+
+    p_chunk->p_records = p_map + offset + sizeof(TRACER_CAPTURE_CHUNK_HEADER);
+    p_chunk->length = header.length;
+    p_chunk->base_time_us = header.base_time_us;
+    p_chunk->last_time_us = header.last_time_us;
+
+    return 1;
+}
+
+/**
+ * @brief Builds the chunk-table from the index of the capture-file
+ *
+ * @return 1 if the index is complete, 0 if the capture has no valid index
+ */
+static u8 tracer_replay_load_index(void) {
+
+    if (map_size < sizeof(TRACER_CAPTURE_FILE_HEADER) + sizeof(TRACER_CAPTURE_FILE_TRAILER)) {
+        return 0;
+    }
+
+    TRACER_CAPTURE_FILE_TRAILER trailer;
+    memcpy(&trailer, p_map + map_size - sizeof(trailer), sizeof(trailer));
+
+    if (memcmp(trailer.magic, TRACER_CAPTURE_INDEX_MAGIC, TRACER_CAPTURE_MAGIC_LENGTH) != 0) {
+        DEBUG_PASS("tracer_replay_load_index() - capture has no index");
+        return 0;
+    }
+
+    u64 index_size = (u64)trailer.chunk_count * sizeof(TRACER_CAPTURE_INDEX_ENTRY);
+
+    if (trailer.index_offset + index_size + sizeof(trailer) != map_size) {
+        DEBUG_PASS("tracer_replay_load_index() - index is corrupted");
+        return 0;
+    }
+
+    p_chunk_table = malloc(sizeof(TRACER_REPLAY_CHUNK) * (trailer.chunk_count + 1));
+    if (p_chunk_table == NULL) {
+        return 0;
+    }
+
+    chunk_count = 0;
+
+    u32 i = 0;
+    for ( ; i < trailer.chunk_count ; i++) {
+
+        TRACER_CAPTURE_INDEX_ENTRY entry;
+        memcpy(&entry, p_map + trailer.index_offset + i * sizeof(entry), sizeof(entry));
+
+        if (tracer_replay_add_chunk(entry.offset) == 0) {
+            DEBUG_TRACE_long(i, "tracer_replay_load_index() - invalid chunk");
+            free(p_chunk_table);
+            p_chunk_table = NULL;
+            chunk_count = 0;
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Builds the chunk-table by walking from chunk to chunk,
+ * used if the capture was aborted before the index was written
+ *
+ * @return 1 on success, otherwise 0
+ */
+static u8 tracer_replay_rebuild_index(void) {
+
+    TRACER_CAPTURE_CHUNK_HEADER header;
+
+    u32 count = 0;
+    u64 offset = sizeof(TRACER_CAPTURE_FILE_HEADER);
+
+    // the chunks are counted first, the table is allocated once
+    while (tracer_replay_read_chunk_header(offset, &header)) {
+        offset += sizeof(TRACER_CAPTURE_CHUNK_HEADER) + header.length;
+        count += 1;
+    }
+
+    p_chunk_table = malloc(sizeof(TRACER_REPLAY_CHUNK) * (count + 1));
+    if (p_chunk_table == NULL) {
+        return 0;
+    }
+
+    chunk_count = 0;
+    offset = sizeof(TRACER_CAPTURE_FILE_HEADER);
+
+    while (chunk_count < count && tracer_replay_add_chunk(offset)) {
+        offset += sizeof(TRACER_CAPTURE_CHUNK_HEADER) + p_chunk_table[chunk_count - 1].length;
+    }
+
+    DEBUG_TRACE_long(chunk_count, "tracer_replay_rebuild_index() - chunks found");
+
+    return 1;
+}
+
+/**
+ * @brief Splits the selected time-range into segments
+ *
+ * @param max_segments maximum number of segments
+ */
+static void tracer_replay_split(u32 max_segments) {
+
+    segment_count = 0;
+
+    if (tracer_replay_position_compare(&range_begin, &range_end) >= 0) {
+        return;
+    }
+
+    u32 first_chunk = range_begin.chunk;
+    u32 span = range_end.chunk - first_chunk + (range_end.offset != 0 ? 1 : 0);
+
+    segment_table[segment_count++] = range_begin;
+
+    u32 i = 1;
+    for ( ; i < max_segments ; i++) {
+
+        u32 chunk = first_chunk + (u32)(((u64)span * i) / max_segments);
+        if (chunk <= segment_table[segment_count - 1].chunk) {
+            continue;
+        }
+
+        TRACER_REPLAY_POSITION position = tracer_replay_find_split(chunk, 0);
+
+        if (tracer_replay_position_compare(&position, &range_end) >= 0) {
+            break;
+        }
+
+        if (tracer_replay_position_compare(&position, &segment_table[segment_count - 1]) <= 0) {
+            continue;
+        }
+
+        segment_table[segment_count++] = position;
+    }
+
+    segment_table[segment_count] = range_end;
+}
+
+/**
+ * @brief Writes a block of data completely into a file
+ *
+ * @param handle file to write into
+ * @param p_data the data to write
+ * @param length number of bytes of p_data
+ * @return 1 on success, otherwise 0
+ */
+static u8 tracer_replay_write(int handle, const void* p_data, size_t length) {
+
+    const u8* p_position = (const u8*)p_data;
+
+    while (length != 0) {
+
+        ssize_t written = write(handle, p_position, length);
+
+        if (written < 0) {
+
+            if (errno == EINTR) {
+                continue;
+            }
+
+            return 0;
+        }
+
+        p_position += written;
+        length -= (size_t)written;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Copies the output of a worker to stdout
+ *
+ * @param handle temporary output-file of the worker
+ * @return 1 on success, otherwise 0
+ */
+static u8 tracer_replay_copy_output(int handle) {
+
+    static u8 buffer[TRACER_REPLAY_COPY_BUFFER_SIZE];
+
+    if (lseek(handle, 0, SEEK_SET) < 0) {
+        return 0;
+    }
+
+    for (;;) {
+
+        ssize_t length = read(handle, buffer, sizeof(buffer));
+
+        if (length < 0) {
+
+            if (errno == EINTR) {
+                continue;
+            }
+
+            return 0;
+        }
+
+        if (length == 0) {
+            return 1;
+        }
+
+        if (tracer_replay_write(STDOUT_FILENO, buffer, (size_t)length) == 0) {
+            return 0;
+        }
+    }
+}
+
+/**
+ * @brief Creates an anonymous temporary file
+ *
+ * @return handle of the file or -1
+ */
+static int tracer_replay_create_temp_file(void) {
+
+    char path[] = TRACER_REPLAY_TEMP_PATH "/shcTracer_replay_XXXXXX";
+
+    int handle = mkstemp(path);
+    if (handle < 0) {
+        return -1;
+    }
+
+    unlink(path);
+
+    return handle;
+}
+
+/**
+ * @brief Selects the segment that is read by the replay-driver
+ *
+ * @param segment number of the segment
+ */
+static void tracer_replay_select_segment(u32 segment) {
+
+    read_position = segment_table[segment];
+    read_end = segment_table[segment + 1];
+
+    p_read_data = NULL;
+    read_remaining = 0;
+
+    read_end_polls = 0;
+    __atomic_store_n(&read_finished, 0, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Moves to the next record of the segment if the actual one was read
+ *
+ * @return number of bytes left of the actual record, 0 at the end of the segment
+ */
+static u16 tracer_replay_next_bytes(void) {
+
+    while (read_remaining == 0) {
+
+        if (tracer_replay_position_compare(&read_position, &read_end) >= 0) {
+            return 0;
+        }
+
+        u64 time_us = 0;
+
+        if (tracer_replay_next_record(&read_position, &p_read_data, &read_remaining, &time_us) == 0) {
+            read_position = read_end;
+            return 0;
+        }
+    }
+
+    return read_remaining;
+}
+
+// --------------------------------------------------------------------------------
+
+u8 tracer_replay_open(const char* p_file_path, u64 from_us, u64 to_us) {
+
+    DEBUG_TRACE_STR(p_file_path, "tracer_replay_open()");
+
+    memset(&statistic, 0x00, sizeof(statistic));
+
+    int handle = open(p_file_path, O_RDONLY | O_CLOEXEC);
+    if (handle < 0) {
+        DEBUG_PASS("tracer_replay_open() - open() has FAILED !!! ---");
+        return 0;
+    }
+
+    struct stat file_stat;
+
+    if (fstat(handle, &file_stat) != 0 || (size_t)file_stat.st_size < sizeof(TRACER_CAPTURE_FILE_HEADER)) {
+        DEBUG_PASS("tracer_replay_open() - capture-file is too small");
+        close(handle);
+        return 0;
+    }
+
+    map_size = (size_t)file_stat.st_size;
+    p_map = mmap(NULL, map_size, PROT_READ, MAP_PRIVATE, handle, 0);
+
+    close(handle);
+
+    if (p_map == MAP_FAILED) {
+        DEBUG_PASS("tracer_replay_open() - mmap() has FAILED !!! ---");
+        p_map = NULL;
+        return 0;
+    }
+
+    // all chunks are read once from the start to the end
+    madvise(p_map, map_size, MADV_SEQUENTIAL);
+
+    TRACER_CAPTURE_FILE_HEADER file_header;
+    memcpy(&file_header, p_map, sizeof(file_header));
+
+    if (memcmp(file_header.magic, TRACER_CAPTURE_FILE_MAGIC, TRACER_CAPTURE_MAGIC_LENGTH) != 0) {
+        DEBUG_PASS("tracer_replay_open() - no capture-file");
+        tracer_replay_close();
+        return 0;
+    }
+
+    if (tracer_replay_load_index() == 0) {
+
+        if (tracer_replay_rebuild_index() == 0) {
+            tracer_replay_close();
+            return 0;
+        }
+
+        statistic.index_rebuilt = 1;
+    }
+
+    statistic.chunks = chunk_count;
+
+    range_begin = tracer_replay_find_begin(tracer_replay_find_chunk(from_us), from_us);
+
+    if (to_us == TRACER_REPLAY_TIME_END) {
+        range_end.chunk = chunk_count;
+        range_end.offset = 0;
+    } else {
+        range_end = tracer_replay_find_split(tracer_replay_find_chunk(to_us), to_us);
+    }
+
+    TRACER_REPLAY_POSITION position = range_begin;
+
+    while (tracer_replay_position_compare(&position, &range_end) < 0) {
+
+        const u8* p_data = NULL;
+        u16 length = 0;
+        u64 time_us = 0;
+
+        if (tracer_replay_next_record(&position, &p_data, &length, &time_us) == 0) {
+            break;
+        }
+
+        statistic.bytes += length;
+    }
+
+    return 1;
+}
+
+u8 tracer_replay_run(u32 worker_count, TRACER_REPLAY_WORKER_CALLBACK p_worker) {
+
+    if (p_map == NULL || p_worker == NULL) {
+        return 0;
+    }
+
+    if (worker_count == 0) {
+        worker_count = 1;
+    }
+
+    if (worker_count > TRACER_REPLAY_MAX_WORKERS) {
+        worker_count = TRACER_REPLAY_MAX_WORKERS;
+    }
+
+    u64 start_time_ms = tracer_replay_time_ms();
+
+    tracer_replay_split(worker_count);
+
+    statistic.segments = segment_count;
+    statistic.failed = 0;
+
+    int output_table[TRACER_REPLAY_MAX_WORKERS];
+    pid_t pid_table[TRACER_REPLAY_MAX_WORKERS];
+
+    // buffered output would be written by every worker again
+    fflush(stdout);
+    fflush(stderr);
+
+    u32 i = 0;
+    for ( ; i < segment_count ; i++) {
+
+        pid_table[i] = -1;
+
+        output_table[i] = tracer_replay_create_temp_file();
+        if (output_table[i] < 0) {
+            DEBUG_PASS("tracer_replay_run() - create temp-file has FAILED !!! ---");
+            statistic.failed += 1;
+            continue;
+        }
+
+        pid_table[i] = fork();
+
+        if (pid_table[i] == 0) {
+
+            dup2(output_table[i], STDOUT_FILENO);
+
+            tracer_replay_select_segment(i);
+            u8 result = p_worker(i);
+
+            fflush(stdout);
+            _exit(result ? 0 : 1);
+        }
+
+        if (pid_table[i] < 0) {
+            DEBUG_PASS("tracer_replay_run() - fork() has FAILED !!! ---");
+            statistic.failed += 1;
+        }
+    }
+
+    for (i = 0 ; i < segment_count ; i++) {
+
+        if (pid_table[i] <= 0) {
+            continue;
+        }
+
+        int status = 0;
+
+        while (waitpid(pid_table[i], &status, 0) < 0 && errno == EINTR) {
+            continue;
+        }
+
+        if (WIFEXITED(status) == 0 || WEXITSTATUS(status) != 0) {
+            DEBUG_TRACE_long(i, "tracer_replay_run() - worker has FAILED !!! ---");
+            statistic.failed += 1;
+        }
+    }
+
+    // the segments follow each other in time, the output stays in order
+    for (i = 0 ; i < segment_count ; i++) {
+
+        if (output_table[i] < 0) {
+            continue;
+        }
+
+        if (pid_table[i] > 0 && tracer_replay_copy_output(output_table[i]) == 0) {
+            DEBUG_PASS("tracer_replay_run() - copy output has FAILED !!! ---");
+            statistic.failed += 1;
+        }
+
+        close(output_table[i]);
+    }
+
+    statistic.duration_ms = (u32)(tracer_replay_time_ms() - start_time_ms);
+
+    return statistic.failed == 0;
+}
+
+void tracer_replay_close(void) {
+
+    DEBUG_PASS("tracer_replay_close()");
+
+    free(p_chunk_table);
+    p_chunk_table = NULL;
+    chunk_count = 0;
+    segment_count = 0;
+
+    if (p_map != NULL) {
+        munmap(p_map, map_size);
+        p_map = NULL;
+        map_size = 0;
+    }
+}
+
+u16 tracer_replay_bytes_available(void) {
+
+    u16 length = tracer_replay_next_bytes();
+
+    if (length == 0 && read_end_polls < 2) {
+
+        // the first call may still belong to the last trace-object,
+        // the read-thread asks again after it has handed the object over
+        read_end_polls += 1;
+
+        if (read_end_polls == 2) {
+            __atomic_store_n(&read_finished, 1, __ATOMIC_RELEASE);
+        }
+    }
+
+    return length;
+}
+
+u16 tracer_replay_get_N_bytes(u16 num_bytes, u8* p_buffer_to) {
+
+    u16 count = 0;
+
+    while (count < num_bytes && tracer_replay_next_bytes() != 0) {
+
+        u16 length = num_bytes - count;
+        if (length > read_remaining) {
+            length = read_remaining;
+        }
+
+        memcpy(p_buffer_to + count, p_read_data, length);
+
+        p_read_data += length;
+        read_remaining -= length;
+        count += length;
+    }
+
+    return count;
+}
+
+u8 tracer_replay_is_finished(void) {
+    return __atomic_load_n(&read_finished, __ATOMIC_ACQUIRE);
+}
+
+void tracer_replay_get_statistic(TRACER_REPLAY_STATISTIC* p_statistic) {
+
+    if (p_statistic == NULL) {
+        return;
+    }
+
+    memcpy(p_statistic, &statistic, sizeof(TRACER_REPLAY_STATISTIC));
+}
+
+// --------------------------------------------------------------------------------
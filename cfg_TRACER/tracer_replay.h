@@ -0,0 +1,211 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    tracer_replay.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Offline decoding of a capture-file of tracer_capture.
+ *
+ *          The capture-file is memory-mapped and split into segments,
+ *          one segment per worker. Every worker is a child-process that
+ *          runs the complete read-, parse- and print-pipeline on its
+ *          segment, as fast as it can: the bytes of the segment are
+ *          delivered by tracer_replay_bytes_available() and
+ *          tracer_replay_get_N_bytes(), which replace the functions of
+ *          the communication-driver. The output of every worker is
+ *          written into its own temporary file and the files are copied
+ *          to stdout in the order of the segments. The segments follow
+ *          each other in time, so the result is in timestamp order.
+ *
+ *          A segment starts at a chunk-boundary, moved forward to the
+ *          first record that was received after the line was idle for
+ *          at least TRACER_REPLAY_SPLIT_GAP_US. The MCU sends a
+ *          trace-object without pauses, so a segment never starts inside
+ *          of a trace-object. The time-range given to tracer_replay_open()
+ *          is extended the same way: its start is moved back and its end
+ *          is moved forward to the next idle-time of the line.
+ *
+ *          The split-positions are only moved forward, so a capture in
+ *          which the line is busy without pauses of TRACER_REPLAY_SPLIT_GAP_US
+ *          results in fewer segments than workers. In the worst case the
+ *          whole time-range is decoded by a single worker. The output is
+ *          correct anyway, only the replay takes longer; the number of
+ *          segments is part of the statistic.
+ *
+ *          A worker has decoded its segment if every stage of the pipeline
+ *          has come back to its empty input after the last trace-object:
+ *          the read-thread, see tracer_replay_is_finished(), and the
+ *          consumers of both qeues, see tracer_spsc_ring_is_drained().
+ *
+ *          If the capture has no index (capture was aborted), the index
+ *          is rebuilt by walking from chunk to chunk.
+ *
+ *          Usage:
+ *
+ *              tracer_replay_open("trace.cap", from_us, to_us);
+ *              tracer_replay_run(worker_count, main_replay_worker);
+ *              tracer_replay_close();
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_tracer_replay_
+#define _H_tracer_replay_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Minimum idle-time of the line in front of the first record
+ * of a segment in microseconds
+ *
+ */
+#ifndef TRACER_REPLAY_SPLIT_GAP_US
+#define TRACER_REPLAY_SPLIT_GAP_US                  2000
+#endif
+
+/**
+ * @brief Maximum number of segments and worker-processes
+ *
+ */
+#ifndef TRACER_REPLAY_MAX_WORKERS
+#define TRACER_REPLAY_MAX_WORKERS                   64
+#endif
+
+/**
+ * @brief No end of the time-range
+ *
+ */
+#define TRACER_REPLAY_TIME_END                      0xFFFFFFFFFFFFFFFFULL
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Runs the pipeline on the selected segment inside of a
+ * worker-process and returns if all bytes of the segment are decoded.
+ * The decoded trace-objects must be printed on stdout.
+ *
+ * @param segment number of the segment of this worker
+ * @return 1 on success, otherwise 0
+ */
+typedef u8 (*TRACER_REPLAY_WORKER_CALLBACK)(u32 segment);
+
+/**
+ * @brief Statistic of the replay
+ *
+ */
+typedef struct TRACER_REPLAY_STATISTIC_STRUCT {
+
+    /**
+     * @brief Number of chunks of the capture-file and
+     * whether the index had to be rebuilt
+     *
+     */
+    u32 chunks;
+    u8 index_rebuilt;
+
+    /**
+     * @brief Number of segments and number of failed workers
+     *
+     */
+    u32 segments;
+    u32 failed;
+
+    /**
+     * @brief Number of bytes of the time-range
+     *
+     */
+    u64 bytes;
+
+    /**
+     * @brief Duration of the replay in milliseconds
+     *
+     */
+    u32 duration_ms;
+
+} TRACER_REPLAY_STATISTIC;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Maps the capture-file and selects the time-range to decode
+ *
+ * @param p_file_path path of the capture-file
+ * @param from_us start of the time-range in microseconds since the start of the capture
+ * @param to_us end of the time-range or TRACER_REPLAY_TIME_END
+ * @return 1 on success, 0 if the file is no valid capture-file
+ */
+u8 tracer_replay_open(const char* p_file_path, u64 from_us, u64 to_us);
+
+/**
+ * @brief Splits the time-range into segments and decodes every
+ * segment inside of its own worker-process. The output of all
+ * workers is written to stdout in the order of the segments.
+ *
+ * @param worker_count number of worker-processes, e.g. number of cores
+ * @param p_worker function that runs the pipeline inside of a worker
+ * @return 1 if all workers have succeeded, otherwise 0
+ */
+u8 tracer_replay_run(u32 worker_count, TRACER_REPLAY_WORKER_CALLBACK p_worker);
+
+/**
+ * @brief Unmaps the capture-file
+ *
+ */
+void tracer_replay_close(void);
+
+/**
+ * @brief Number of bytes of the actual record of the segment,
+ * replaces bytes_available() of the communication-driver.
+ * Must be called by the read-thread only.
+ *
+ * @return number of bytes that can be read at once, 0 at the end of the segment
+ */
+u16 tracer_replay_bytes_available(void);
+
+/**
+ * @brief Copies the next bytes of the segment,
+ * replaces get_N_bytes() of the communication-driver.
+ *
+ * @param num_bytes maximum number of bytes to copy
+ * @param p_buffer_to the bytes are copied into this buffer
+ * @return number of copied bytes
+ */
+u16 tracer_replay_get_N_bytes(u16 num_bytes, u8* p_buffer_to);
+
+/**
+ * @brief Checks if the read-thread has handed over the last trace-object
+ * of the segment: it has asked for more bytes again after the end of the
+ * segment was reported. Can be called from any thread.
+ *
+ * @return 1 if the segment is finished, otherwise 0
+ */
+u8 tracer_replay_is_finished(void);
+
+/**
+ * @brief Get the statistic of the replay
+ *
+ * @param p_statistic the statistic is copied into this structure
+ */
+void tracer_replay_get_statistic(TRACER_REPLAY_STATISTIC* p_statistic);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_tracer_replay_
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,281 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    tracer_spsc_ring.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Implementation of the single-producer / single-consumer ring
+ *
+ *          Positions are free-running counters, the slot of a position
+ *          is (position & mask). The producer publishes a slot with a
+ *          release-store of write_position, the consumer gives it back
+ *          with a release-store of read_position.
+ *
+ * @see     tracer_spsc_ring.h
+ */
+
+#define TRACER_OFF
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "tracer.h"
+
+// --------------------------------------------------------------------------------
+
+#include "cpu.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdlib.h>
+#include <string.h>
+
+// --------------------------------------------------------------------------------
+
+#include "tracer_spsc_ring.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Updates the high-water mark after an object was committed.
+ * The cached read-position is only refreshed if the depth
+ * it results in is a new high-water mark.
+ *
+ * @param p_ring the ring that was written
+ * @param write_position the new write-position
+ */
+static void tracer_spsc_ring_update_high_water(TRACER_SPSC_RING* p_ring, u32 write_position) {
+
+    if (write_position - p_ring->read_position_cache <= p_ring->high_water) {
+        return;
+    }
+
+    p_ring->read_position_cache = __atomic_load_n(&p_ring->read_position, __ATOMIC_ACQUIRE);
+
+    u32 depth = write_position - p_ring->read_position_cache;
+    if (depth > p_ring->high_water) {
+        __atomic_store_n(&p_ring->high_water, depth, __ATOMIC_RELAXED);
+    }
+}
+
+// --------------------------------------------------------------------------------
+
+u8 tracer_spsc_ring_init(TRACER_SPSC_RING* p_ring, u32 object_size, u32 depth) {
+
+    DEBUG_TRACE_long(depth, "tracer_spsc_ring_init() - depth:");
+
+    if (depth < 2) {
+        depth = 2;
+    }
+
+    if (depth > TRACER_SPSC_RING_MAX_DEPTH) {
+        depth = TRACER_SPSC_RING_MAX_DEPTH;
+    }
+
+    u32 capacity = 2;
+    while (capacity < depth) {
+        capacity <<= 1;
+    }
+
+    u32 slot_size = (object_size + TRACER_SPSC_RING_CACHE_LINE_SIZE - 1) & ~(u32)(TRACER_SPSC_RING_CACHE_LINE_SIZE - 1);
+
+    memset(p_ring, 0x00, sizeof(TRACER_SPSC_RING));
+
+    void* p_slot_memory = NULL;
+    if (posix_memalign(&p_slot_memory, TRACER_SPSC_RING_CACHE_LINE_SIZE, (size_t)slot_size * capacity) != 0) {
+        return 0;
+    }
+
+    p_ring->p_rejected_object = malloc(object_size);
+    if (p_ring->p_rejected_object == NULL) {
+        free(p_slot_memory);
+        return 0;
+    }
+
+    p_ring->p_slot_memory = (u8*)p_slot_memory;
+
+    p_ring->object_size = object_size;
+    p_ring->slot_size = slot_size;
+    p_ring->capacity = capacity;
+    p_ring->mask = capacity - 1;
+
+    return 1;
+}
+
+void tracer_spsc_ring_deinit(TRACER_SPSC_RING* p_ring) {
+
+    free(p_ring->p_slot_memory);
+    free(p_ring->p_rejected_object);
+
+    p_ring->p_slot_memory = NULL;
+    p_ring->p_rejected_object = NULL;
+    p_ring->capacity = 0;
+}
+
+void* tracer_spsc_ring_write_acquire(TRACER_SPSC_RING* p_ring) {
+
+    if (p_ring->p_slot_memory == NULL) {
+        return NULL;
+    }
+
+    u32 position = p_ring->write_position;
+
+    if (position - p_ring->read_position_cache >= p_ring->capacity) {
+
+        p_ring->read_position_cache = __atomic_load_n(&p_ring->read_position, __ATOMIC_ACQUIRE);
+
+        if (position - p_ring->read_position_cache >= p_ring->capacity) {
+
+            if (p_ring->is_stalled == 0) {
+                p_ring->is_stalled = 1;
+                __atomic_store_n(&p_ring->stalled, p_ring->stalled + 1, __ATOMIC_RELAXED);
+            }
+
+            return NULL;
+        }
+    }
+
+    p_ring->is_stalled = 0;
+
+    return p_ring->p_slot_memory + (size_t)(position & p_ring->mask) * p_ring->slot_size;
+}
+
+void tracer_spsc_ring_write_commit(TRACER_SPSC_RING* p_ring) {
+
+    u32 position = p_ring->write_position + 1;
+
+    __atomic_store_n(&p_ring->write_position, position, __ATOMIC_RELEASE);
+    __atomic_store_n(&p_ring->written, p_ring->written + 1, __ATOMIC_RELAXED);
+
+    tracer_spsc_ring_update_high_water(p_ring, position);
+}
+
+void tracer_spsc_ring_drop(TRACER_SPSC_RING* p_ring) {
+    __atomic_store_n(&p_ring->dropped, p_ring->dropped + 1, __ATOMIC_RELAXED);
+}
+
+u8 tracer_spsc_ring_write(TRACER_SPSC_RING* p_ring, const void* p_object) {
+
+    if (p_ring->p_slot_memory == NULL) {
+        return 0;
+    }
+
+    u8 is_retry = 0;
+
+    if (p_ring->rejected_pending) {
+
+        p_ring->rejected_pending = 0;
+        is_retry = memcmp(p_ring->p_rejected_object, p_object, p_ring->object_size) == 0 ? 1 : 0;
+
+        if (is_retry == 0) {
+            // the producer has given up the object that did not fit
+            tracer_spsc_ring_drop(p_ring);
+        }
+    }
+
+    void* p_slot = tracer_spsc_ring_write_acquire(p_ring);
+
+    if (p_slot == NULL) {
+
+        if (is_retry == 0) {
+            memcpy(p_ring->p_rejected_object, p_object, p_ring->object_size);
+        }
+
+        p_ring->rejected_pending = 1;
+        return 0;
+    }
+
+    memcpy(p_slot, p_object, p_ring->object_size);
+    tracer_spsc_ring_write_commit(p_ring);
+
+    return 1;
+}
+
+void* tracer_spsc_ring_read_acquire(TRACER_SPSC_RING* p_ring) {
+
+    if (p_ring->p_slot_memory == NULL) {
+        return NULL;
+    }
+
+    u32 position = p_ring->read_position;
+
+    if (position == p_ring->write_position_cache) {
+
+        p_ring->write_position_cache = __atomic_load_n(&p_ring->write_position, __ATOMIC_ACQUIRE);
+
+        if (position == p_ring->write_position_cache) {
+
+            if (p_ring->drained_position != position) {
+                __atomic_store_n(&p_ring->drained_position, position, __ATOMIC_RELEASE);
+            }
+
+            return NULL;
+        }
+    }
+
+    return p_ring->p_slot_memory + (size_t)(position & p_ring->mask) * p_ring->slot_size;
+}
+
+void tracer_spsc_ring_read_release(TRACER_SPSC_RING* p_ring) {
+    __atomic_store_n(&p_ring->read_position, p_ring->read_position + 1, __ATOMIC_RELEASE);
+}
+
+u8 tracer_spsc_ring_read(TRACER_SPSC_RING* p_ring, void* p_object) {
+
+    void* p_slot = tracer_spsc_ring_read_acquire(p_ring);
+
+    if (p_slot == NULL) {
+        return 0;
+    }
+
+    memcpy(p_object, p_slot, p_ring->object_size);
+    tracer_spsc_ring_read_release(p_ring);
+
+    return 1;
+}
+
+u8 tracer_spsc_ring_is_drained(TRACER_SPSC_RING* p_ring) {
+
+    u32 write_position = __atomic_load_n(&p_ring->write_position, __ATOMIC_ACQUIRE);
+
+    return __atomic_load_n(&p_ring->drained_position, __ATOMIC_ACQUIRE) == write_position ? 1 : 0;
+}
+
+u32 tracer_spsc_ring_depth(TRACER_SPSC_RING* p_ring) {
+
+    u32 read_position = __atomic_load_n(&p_ring->read_position, __ATOMIC_ACQUIRE);
+    u32 write_position = __atomic_load_n(&p_ring->write_position, __ATOMIC_ACQUIRE);
+
+    return write_position - read_position;
+}
+
+void tracer_spsc_ring_get_statistic(TRACER_SPSC_RING* p_ring, TRACER_SPSC_RING_STATISTIC* p_statistic) {
+
+    if (p_statistic == NULL) {
+        return;
+    }
+
+    p_statistic->written = __atomic_load_n(&p_ring->written, __ATOMIC_RELAXED);
+    p_statistic->high_water = __atomic_load_n(&p_ring->high_water, __ATOMIC_RELAXED);
+    p_statistic->dropped = __atomic_load_n(&p_ring->dropped, __ATOMIC_RELAXED);
+    p_statistic->stalled = __atomic_load_n(&p_ring->stalled, __ATOMIC_RELAXED);
+    p_statistic->depth = tracer_spsc_ring_depth(p_ring);
+    p_statistic->capacity = p_ring->capacity;
+}
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,385 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    tracer_spsc_ring.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Lock-free single-producer / single-consumer ring-buffer
+ *          that connects the threads of the tracer.
+ *
+ *          Every ring has exactly one producer-thread and one
+ *          consumer-thread. The producer and the consumer own their
+ *          position on their own cache-line and only read the position
+ *          of the other side if their cached copy says the ring is
+ *          full or empty. Slots are cache-line-aligned and are handed
+ *          out in place:
+ *
+ *              TRACE_OBJECT* p_object = tracer_spsc_ring_write_acquire(&ring);
+ *              if (p_object != NULL) {
+ *                  ... fill p_object ...
+ *                  tracer_spsc_ring_write_commit(&ring);
+ *              }
+ *
+ *              TRACE_OBJECT* p_object = tracer_spsc_ring_read_acquire(&ring);
+ *              if (p_object != NULL) {
+ *                  ... use p_object ...
+ *                  tracer_spsc_ring_read_release(&ring);
+ *              }
+ *
+ *          The depth of a ring is given at run-time and is rounded up
+ *          to the next power of two.
+ *
+ *          TRACER_SPSC_RING_BUILD_QEUE() builds the interface of
+ *          QEUE_INTERFACE_BUILD_QEUE() of the framework on top of a ring,
+ *          so the trace-object threads of the framework can be used
+ *          without changes. The threads of the framework own the object
+ *          they hand over, so enqeue() and deqeue() copy the object once
+ *          into and once out of its slot (instead of a copy and a mutex
+ *          per qeue-access). Producers and consumers of this tree use
+ *          the in-place interface <name>_write_acquire() / _write_commit()
+ *          and <name>_read_acquire() / _read_release() without any copy.
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_tracer_spsc_ring_
+#define _H_tracer_spsc_ring_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Size of a cache-line of the target in bytes
+ *
+ */
+#ifndef TRACER_SPSC_RING_CACHE_LINE_SIZE
+#define TRACER_SPSC_RING_CACHE_LINE_SIZE            64
+#endif
+
+/**
+ * @brief Depth of a ring if no depth is given on the command-line
+ *
+ */
+#ifndef TRACER_SPSC_RING_DEFAULT_DEPTH
+#define TRACER_SPSC_RING_DEFAULT_DEPTH              1024
+#endif
+
+/**
+ * @brief Maximum depth of a single ring
+ *
+ */
+#ifndef TRACER_SPSC_RING_MAX_DEPTH
+#define TRACER_SPSC_RING_MAX_DEPTH                  65536
+#endif
+
+#define TRACER_SPSC_RING_ALIGNED                    __attribute__((aligned(TRACER_SPSC_RING_CACHE_LINE_SIZE)))
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Statistic of a ring since tracer_spsc_ring_init()
+ *
+ */
+typedef struct TRACER_SPSC_RING_STATISTIC_STRUCT {
+
+    /**
+     * @brief Number of objects that have been written into the ring
+     *
+     */
+    u32 written;
+
+    /**
+     * @brief Maximum number of objects inside of the ring
+     *
+     */
+    u32 high_water;
+
+    /**
+     * @brief Number of objects that were lost because the ring was full.
+     * An object that is given to tracer_spsc_ring_write() again and again
+     * until it fits is not lost and is not counted.
+     *
+     */
+    u32 dropped;
+
+    /**
+     * @brief Number of times the ring has become full, a producer that
+     * keeps on retrying while the ring stays full is counted once
+     *
+     */
+    u32 stalled;
+
+    /**
+     * @brief Actual number of objects inside of the ring
+     *
+     */
+    u32 depth;
+
+    /**
+     * @brief Number of slots of the ring
+     *
+     */
+    u32 capacity;
+
+} TRACER_SPSC_RING_STATISTIC;
+
+/**
+ * @brief A single ring-buffer. Producer- and consumer-part
+ * are placed on their own cache-lines.
+ *
+ */
+typedef struct TRACER_SPSC_RING_STRUCT {
+
+    /**
+     * @brief Written by the producer only
+     *
+     */
+    u32 write_position TRACER_SPSC_RING_ALIGNED;
+    u32 read_position_cache;
+    u32 written;
+    u32 high_water;
+    u32 dropped;
+    u32 stalled;
+    u8 is_stalled;
+    u8 rejected_pending;
+
+    /**
+     * @brief Written by the consumer only
+     *
+     */
+    u32 read_position TRACER_SPSC_RING_ALIGNED;
+    u32 write_position_cache;
+    u32 drained_position;
+
+    /**
+     * @brief Constant after tracer_spsc_ring_init()
+     *
+     */
+    u8* p_slot_memory TRACER_SPSC_RING_ALIGNED;
+    u8* p_rejected_object;
+    u32 object_size;
+    u32 slot_size;
+    u32 capacity;
+    u32 mask;
+
+} TRACER_SPSC_RING;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Allocates the slots of the ring and clears its statistic
+ *
+ * @param p_ring the ring to initialize
+ * @param object_size size of a single object in bytes
+ * @param depth requested number of slots, is rounded up to a power of two
+ * @return 1 on success, 0 if the slots could not be allocated
+ */
+u8 tracer_spsc_ring_init(TRACER_SPSC_RING* p_ring, u32 object_size, u32 depth);
+
+/**
+ * @brief Releases the slots of the ring
+ *
+ * @param p_ring the ring to release
+ */
+void tracer_spsc_ring_deinit(TRACER_SPSC_RING* p_ring);
+
+/**
+ * @brief Get the next free slot. Producer only.
+ *
+ * @param p_ring the ring to write into
+ * @return the free slot or NULL if the ring is full
+ */
+void* tracer_spsc_ring_write_acquire(TRACER_SPSC_RING* p_ring);
+
+/**
+ * @brief Hands the slot of tracer_spsc_ring_write_acquire()
+ * over to the consumer. Producer only.
+ *
+ * @param p_ring the ring that was written
+ */
+void tracer_spsc_ring_write_commit(TRACER_SPSC_RING* p_ring);
+
+/**
+ * @brief Counts an object that the producer has discarded
+ * because the ring was full. Producer only.
+ *
+ * @param p_ring the ring that was full
+ */
+void tracer_spsc_ring_drop(TRACER_SPSC_RING* p_ring);
+
+/**
+ * @brief Copies an object into the next free slot. Producer only.
+ * If the ring is full a copy of the object is kept. It is counted as
+ * dropped as soon as the producer continues with another object,
+ * a producer that retries the same object loses nothing.
+ *
+ * @param p_ring the ring to write into
+ * @param p_object the object to copy, object_size bytes
+ * @return 1 if the object was written, 0 if the ring is full
+ */
+u8 tracer_spsc_ring_write(TRACER_SPSC_RING* p_ring, const void* p_object);
+
+/**
+ * @brief Get the oldest object of the ring. Consumer only.
+ *
+ * @param p_ring the ring to read from
+ * @return the oldest object or NULL if the ring is empty
+ */
+void* tracer_spsc_ring_read_acquire(TRACER_SPSC_RING* p_ring);
+
+/**
+ * @brief Gives the slot of tracer_spsc_ring_read_acquire()
+ * back to the producer. Consumer only.
+ *
+ * @param p_ring the ring that was read
+ */
+void tracer_spsc_ring_read_release(TRACER_SPSC_RING* p_ring);
+
+/**
+ * @brief Copies the oldest object out of the ring. Consumer only.
+ *
+ * @param p_ring the ring to read from
+ * @param p_object the object is copied into this buffer, object_size bytes
+ * @return 1 if an object was read, 0 if the ring is empty
+ */
+u8 tracer_spsc_ring_read(TRACER_SPSC_RING* p_ring, void* p_object);
+
+/**
+ * @brief Checks if the consumer has come back to the ring after the last
+ * object that was written and has found it empty. The consumer takes the
+ * next object after it has finished the previous one, so every written
+ * object has been processed completely. Can be called from any thread.
+ *
+ * @param p_ring the ring to check
+ * @return 1 if all written objects have been processed, otherwise 0
+ */
+u8 tracer_spsc_ring_is_drained(TRACER_SPSC_RING* p_ring);
+
+/**
+ * @brief Get the actual number of objects inside of the ring
+ *
+ * @param p_ring the ring to check
+ * @return number of objects
+ */
+u32 tracer_spsc_ring_depth(TRACER_SPSC_RING* p_ring);
+
+/**
+ * @brief Get the statistic of the ring, can be called from any thread
+ *
+ * @param p_ring the ring to check
+ * @param p_statistic the statistic is copied into this structure
+ */
+void tracer_spsc_ring_get_statistic(TRACER_SPSC_RING* p_ring, TRACER_SPSC_RING_STATISTIC* p_statistic);
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Filter of TRACER_SPSC_RING_BUILD_QEUE(), every object is enqeued
+ *
+ */
+#define TRACER_SPSC_RING_ACCEPT_ALL(p_object)       1
+
+/**
+ * @brief Builds the qeue-interface of the framework
+ * (init, enqeue, deqeue, is_empty, is_full, mutex_get, mutex_release)
+ * on top of a single-producer / single-consumer ring.
+ * The ring needs no mutex, mutex_get() always succeeds.
+ * Additionally the in-place interface write_acquire, write_commit,
+ * read_acquire and read_release is built for the given object-type.
+ *
+ * @param name name of the qeue, e.g. RAW_TRACE_OBJECT_QEUE
+ * @param object_type type of the objects of the qeue
+ * @param depth number of slots, evaluated on <name>_init()
+ */
+#define TRACER_SPSC_RING_BUILD_QEUE(name, object_type, depth)                          \
+    TRACER_SPSC_RING_BUILD_FILTERED_QEUE(name, object_type, depth, TRACER_SPSC_RING_ACCEPT_ALL)
+
+/**
+ * @brief Same as TRACER_SPSC_RING_BUILD_QEUE() but <name>_enqeue() calls
+ * filter(const object_type*) first. An object that is rejected by the
+ * filter is discarded inside of the producer-thread and never written
+ * into the ring, <name>_enqeue() returns 1 anyway. The filter is not
+ * applied by <name>_write_acquire().
+ *
+ * @param name name of the qeue, e.g. TRACE_OBJECT_QEUE
+ * @param object_type type of the objects of the qeue
+ * @param depth number of slots, evaluated on <name>_init()
+ * @param filter returns 1 if the object is enqeued, 0 if it is discarded
+ */
+#define TRACER_SPSC_RING_BUILD_FILTERED_QEUE(name, object_type, depth, filter)         \
+                                                                                        \
+    static TRACER_SPSC_RING _##name##_ring;                                             \
+                                                                                        \
+    TRACER_SPSC_RING* name##_get_ring(void) {                                           \
+        return &_##name##_ring;                                                         \
+    }                                                                                   \
+                                                                                        \
+    void name##_init(void) {                                                            \
+        if (tracer_spsc_ring_init(&_##name##_ring, sizeof(object_type), depth) == 0) {  \
+            DEBUG_PASS(#name "_init() - tracer_spsc_ring_init() has FAILED !!! ---");   \
+        }                                                                               \
+    }                                                                                   \
+                                                                                        \
+    u8 name##_enqeue(const void* p_object_from) {                                       \
+        if (filter((const object_type*)p_object_from) == 0) {                           \
+            return 1;                                                                   \
+        }                                                                               \
+        return tracer_spsc_ring_write(&_##name##_ring, p_object_from);                  \
+    }                                                                                   \
+                                                                                        \
+    u8 name##_deqeue(void* p_object_to) {                                               \
+        return tracer_spsc_ring_read(&_##name##_ring, p_object_to);                     \
+    }                                                                                   \
+                                                                                        \
+    object_type* name##_write_acquire(void) {                                           \
+        return (object_type*)tracer_spsc_ring_write_acquire(&_##name##_ring);           \
+    }                                                                                   \
+                                                                                        \
+    void name##_write_commit(void) {                                                    \
+        tracer_spsc_ring_write_commit(&_##name##_ring);                                 \
+    }                                                                                   \
+                                                                                        \
+    object_type* name##_read_acquire(void) {                                            \
+        return (object_type*)tracer_spsc_ring_read_acquire(&_##name##_ring);            \
+    }                                                                                   \
+                                                                                        \
+    void name##_read_release(void) {                                                    \
+        tracer_spsc_ring_read_release(&_##name##_ring);                                 \
+    }                                                                                   \
+                                                                                        \
+    u8 name##_is_empty(void) {                                                          \
+        return tracer_spsc_ring_depth(&_##name##_ring) == 0 ? 1 : 0;                    \
+    }                                                                                   \
+                                                                                        \
+    u8 name##_is_full(void) {                                                           \
+        return tracer_spsc_ring_depth(&_##name##_ring)                                  \
+            >= _##name##_ring.capacity ? 1 : 0;                                         \
+    }                                                                                   \
+                                                                                        \
+    u8 name##_mutex_get(void) {                                                         \
+        return 1;                                                                       \
+    }                                                                                   \
+                                                                                        \
+    void name##_mutex_release(void) {                                                   \
+    }
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_tracer_spsc_ring_
+
+// --------------------------------------------------------------------------------
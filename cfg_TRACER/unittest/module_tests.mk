@@ -0,0 +1,57 @@
+#-----------------------------------------------------------------------------
+#       Module-tests of the shcTracer
+#-----------------------------------------------------------------------------
+# The modules are built without the framework, against the dummy-headers
+# of ./stub. stub/config.h is included first, it uses the include-guard
+# of ../config.h, so the configuration of the framework is never read.
+# The complete tracer is built by ./makefile together with the framework.
+#
+#   make -f module_tests.mk             builds and runs all module-tests
+#   make -f module_tests.mk clean
+#-----------------------------------------------------------------------------
+
+CC          ?= gcc
+BUILD_DIR   ?= module_tests_build
+
+CFLAGS      = -std=gnu99 -Wall -Wextra -O2 -g -pthread
+CFLAGS      += -include stub/config.h
+CFLAGS      += -Istub -I. -I..
+LDLIBS      = -pthread -lrt
+
+#-----------------------------------------------------------------------------
+
+UNITTESTS   =
+UNITTESTS   += tracer_spsc_ring
+UNITTESTS   += tracer_capture
+UNITTESTS   += tracer_replay
+UNITTESTS   += tracer_filter
+
+unittest_tracer_spsc_ring_SRCS      = ../tracer_spsc_ring.c
+
+unittest_tracer_capture_SRCS        = ../tracer_capture.c
+unittest_tracer_capture_SRCS        += ../tracer_spsc_ring.c
+
+unittest_tracer_replay_SRCS         = ../tracer_replay.c
+
+unittest_tracer_filter_SRCS         = ../tracer_filter.c
+unittest_tracer_filter_SRCS         += ../tracer_spsc_ring.c
+
+#-----------------------------------------------------------------------------
+
+UNITTEST_PROGRAMS = $(addprefix $(BUILD_DIR)/unittest_,$(UNITTESTS))
+
+all: $(UNITTEST_PROGRAMS)
+	@for program in $(UNITTEST_PROGRAMS) ; do \
+		echo "--- $$program" ; \
+		$$program || exit 1 ; \
+	done
+
+.SECONDEXPANSION:
+$(BUILD_DIR)/unittest_%: unittest_%.c $$(unittest_%_SRCS) unittest.h $$(wildcard ../*.h) $$(wildcard stub/*.h stub/*/*.h)
+	@mkdir -p $(BUILD_DIR)
+	$(CC) $(CFLAGS) -o $@ unittest_$*.c $(unittest_$*_SRCS) $(LDLIBS)
+
+clean:
+	rm -rf $(BUILD_DIR)
+
+.PHONY: all clean
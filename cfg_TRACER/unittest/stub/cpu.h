@@ -0,0 +1,10 @@
+#ifndef   _CPU_H_
+#define   _CPU_H_
+
+//-------------------------------------------------------------------------
+
+// This is a dummy-file only to enable the module-tests without the framework
+
+//-------------------------------------------------------------------------
+
+#endif // _CPU_H_
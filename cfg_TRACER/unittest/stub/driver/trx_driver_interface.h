@@ -0,0 +1,25 @@
+#ifndef   _TRX_DRIVER_INTERFACE_H_
+#define   _TRX_DRIVER_INTERFACE_H_
+
+//-------------------------------------------------------------------------
+
+// This is a dummy-file only to enable the module-tests without the framework.
+// Only the members that are used by tracer_capture and tracer_replay exist.
+
+//-------------------------------------------------------------------------
+
+#define TRX_DRIVER_INTERFACE_UNLIMITED_RX_LENGTH    0xFFFF
+
+//-------------------------------------------------------------------------
+
+typedef u16 (*TRX_DRIVER_INTERFACE_BYTES_AVAILABLE_CALLBACK)    (void);
+typedef u16 (*TRX_DRIVER_INTERFACE_GET_N_BYTES_CALLBACK)        (u16 num_bytes, u8* p_buffer_to);
+
+typedef struct TRX_DRIVER_INTERFACE_STRUCT {
+    TRX_DRIVER_INTERFACE_BYTES_AVAILABLE_CALLBACK bytes_available;
+    TRX_DRIVER_INTERFACE_GET_N_BYTES_CALLBACK get_N_bytes;
+} TRX_DRIVER_INTERFACE;
+
+//-------------------------------------------------------------------------
+
+#endif // _TRX_DRIVER_INTERFACE_H_
@@ -0,0 +1,445 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    unittest_tracer_capture.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Module-test of the raw capture of the trace-data.
+ *          The communication-driver is replaced by a generator of
+ *          numbered bytes, every capture-file is parsed completely.
+ *
+ * @see     tracer_capture.h
+ */
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <sys/resource.h>
+
+// --------------------------------------------------------------------------------
+
+#include "unittest.h"
+#include "tracer_capture.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Number of bytes the generator offers per call of bytes_available()
+ *
+ */
+#define UNITTEST_BYTES_PER_CALL                     700
+
+/**
+ * @brief Time the reader of the FIFO waits before it starts reading
+ *
+ */
+#define UNITTEST_READER_DELAY_US                    300000
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Result of parsing a capture-file
+ *
+ */
+typedef struct UNITTEST_CAPTURE_STRUCT {
+    u8 is_valid;
+    u8 has_index;
+    u32 chunk_count;
+    u64 bytes;
+} UNITTEST_CAPTURE;
+
+// --------------------------------------------------------------------------------
+
+static u64 produced = 0;
+static u64 total = 0;
+
+static char file_path[64];
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Value of the byte at the given position of the trace-data
+ *
+ */
+static u8 unittest_byte(u64 position) {
+    return (u8)(position % 251);
+}
+
+static u16 unittest_bytes_available(void) {
+    return produced < total ? UNITTEST_BYTES_PER_CALL : 0;
+}
+
+static u16 unittest_get_N_bytes(u16 num_bytes, u8* p_buffer_to) {
+
+    if (total - produced < num_bytes) {
+        num_bytes = (u16)(total - produced);
+    }
+
+    u16 i = 0;
+    for ( ; i < num_bytes ; i++) {
+        p_buffer_to[i] = unittest_byte(produced + i);
+    }
+
+    produced += num_bytes;
+
+    return num_bytes;
+}
+
+static TRX_DRIVER_INTERFACE unittest_driver = {
+    unittest_bytes_available,
+    unittest_get_N_bytes
+};
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Parses a capture-file: header, the chunks in sequence and index and
+ * trailer if available. Every byte of every record is compared with the
+ * generator, there must not be anything behind the last chunk or the trailer.
+ *
+ */
+static UNITTEST_CAPTURE unittest_parse(const u8* p_data, size_t size) {
+
+    UNITTEST_CAPTURE capture;
+    memset(&capture, 0x00, sizeof(capture));
+
+    TRACER_CAPTURE_FILE_HEADER header;
+
+    if (size < sizeof(header)) {
+        return capture;
+    }
+
+    memcpy(&header, p_data, sizeof(header));
+
+    if (memcmp(header.magic, TRACER_CAPTURE_FILE_MAGIC, TRACER_CAPTURE_MAGIC_LENGTH) != 0) {
+        return capture;
+    }
+
+    size_t position = sizeof(header);
+
+    while (position + sizeof(TRACER_CAPTURE_CHUNK_HEADER) <= size) {
+
+        TRACER_CAPTURE_CHUNK_HEADER chunk;
+        memcpy(&chunk, p_data + position, sizeof(chunk));
+
+        if (chunk.magic != TRACER_CAPTURE_CHUNK_MAGIC) {
+            break;
+        }
+
+        if (chunk.sequence != capture.chunk_count || position + sizeof(chunk) + chunk.length > size) {
+            return capture;
+        }
+
+        const u8* p_record = p_data + position + sizeof(chunk);
+        const u8* p_end = p_record + chunk.length;
+
+        while (p_record < p_end) {
+
+            u16 length = 0;
+            memcpy(&length, p_record + sizeof(u32), sizeof(length));
+
+            u16 i = 0;
+            for ( ; i < length ; i++) {
+                if (p_record[TRACER_CAPTURE_RECORD_HEADER_SIZE + i] != unittest_byte(capture.bytes + i)) {
+                    return capture;
+                }
+            }
+
+            capture.bytes += length;
+            p_record += TRACER_CAPTURE_RECORD_HEADER_SIZE + length;
+        }
+
+        capture.chunk_count += 1;
+        position += sizeof(chunk) + chunk.length;
+    }
+
+    if (position == size) {
+        capture.is_valid = 1;
+        return capture;
+    }
+
+    TRACER_CAPTURE_FILE_TRAILER trailer;
+
+    if (size - position != sizeof(TRACER_CAPTURE_INDEX_ENTRY) * capture.chunk_count + sizeof(trailer)) {
+        return capture;
+    }
+
+    memcpy(&trailer, p_data + size - sizeof(trailer), sizeof(trailer));
+
+    if (memcmp(trailer.magic, TRACER_CAPTURE_INDEX_MAGIC, TRACER_CAPTURE_MAGIC_LENGTH) != 0
+     || trailer.index_offset != position || trailer.chunk_count != capture.chunk_count) {
+        return capture;
+    }
+
+    u32 i = 0;
+    for ( ; i < capture.chunk_count ; i++) {
+
+        TRACER_CAPTURE_INDEX_ENTRY entry;
+        memcpy(&entry, p_data + position + i * sizeof(entry), sizeof(entry));
+
+        TRACER_CAPTURE_CHUNK_HEADER chunk;
+        memcpy(&chunk, p_data + entry.offset, sizeof(chunk));
+
+        if (chunk.sequence != i || chunk.base_time_us != entry.base_time_us) {
+            return capture;
+        }
+    }
+
+    capture.has_index = 1;
+    capture.is_valid = 1;
+
+    return capture;
+}
+
+static UNITTEST_CAPTURE unittest_parse_file(void) {
+
+    UNITTEST_CAPTURE capture;
+    memset(&capture, 0x00, sizeof(capture));
+
+    FILE* p_file = fopen(file_path, "rb");
+    if (p_file == NULL) {
+        return capture;
+    }
+
+    fseek(p_file, 0, SEEK_END);
+    size_t size = (size_t)ftell(p_file);
+    fseek(p_file, 0, SEEK_SET);
+
+    u8* p_data = malloc(size + 1);
+
+    if (p_data != NULL && fread(p_data, 1, size, p_file) == size) {
+        capture = unittest_parse(p_data, size);
+    }
+
+    free(p_data);
+    fclose(p_file);
+
+    return capture;
+}
+
+static void unittest_setup(u64 num_bytes) {
+
+    produced = 0;
+    total = num_bytes;
+
+    snprintf(file_path, sizeof(file_path), "/tmp/unittest_tracer_capture_%d.cap", (int)getpid());
+    unlink(file_path);
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Every received byte is found in the capture-file,
+ * the index references every chunk
+ *
+ */
+static void unittest_capture_and_index(void) {
+
+    unittest_setup(4000000);
+
+    u8 started = tracer_capture_start(file_path, &unittest_driver);
+
+    while (started && produced < total) {
+        tracer_capture_task();
+    }
+
+    tracer_capture_stop();
+
+    TRACER_CAPTURE_STATISTIC statistic;
+    tracer_capture_get_statistic(&statistic);
+
+    UNITTEST_CAPTURE capture = unittest_parse_file();
+    unlink(file_path);
+
+    UT_ASSERT(started);
+    UT_ASSERT(tracer_capture_has_failed() == 0);
+    UT_ASSERT(capture.is_valid);
+    UT_ASSERT(capture.has_index);
+    UT_ASSERT_EQUAL(4000000, capture.bytes);
+    UT_ASSERT_EQUAL(4000000, statistic.bytes);
+    UT_ASSERT_EQUAL(statistic.chunks, capture.chunk_count);
+    UT_ASSERT(capture.chunk_count >= 4000000 / TRACER_CAPTURE_CHUNK_SIZE);
+    UT_ASSERT_EQUAL(0, statistic.write_errors);
+}
+
+// --------------------------------------------------------------------------------
+
+static u8* p_fifo_data = NULL;
+static size_t fifo_size = 0;
+
+/**
+ * @brief Reads the capture-file out of a FIFO, the reading starts late
+ * so the writer-thread is blocked and all chunks become occupied
+ *
+ */
+static void* unittest_fifo_reader_thread(void* p_argument) {
+
+    (void) p_argument;
+
+    int handle = open(file_path, O_RDONLY);
+    if (handle < 0) {
+        return NULL;
+    }
+
+    usleep(UNITTEST_READER_DELAY_US);
+
+    size_t capacity = 1024 * 1024;
+    p_fifo_data = malloc(capacity);
+
+    for (;;) {
+
+        if (fifo_size == capacity) {
+            capacity *= 2;
+            p_fifo_data = realloc(p_fifo_data, capacity);
+        }
+
+        ssize_t length = read(handle, p_fifo_data + fifo_size, capacity - fifo_size);
+        if (length <= 0) {
+            break;
+        }
+
+        fifo_size += (size_t)length;
+    }
+
+    close(handle);
+
+    return NULL;
+}
+
+/**
+ * @brief While all chunks are occupied the main-loop keeps on polling,
+ * this is counted as a single stall and not once per poll
+ *
+ */
+static void unittest_stall_is_counted_once(void) {
+
+    unittest_setup((u64)TRACER_CAPTURE_CHUNK_SIZE * (TRACER_CAPTURE_CHUNK_COUNT + 8));
+
+    p_fifo_data = NULL;
+    fifo_size = 0;
+
+    UT_ASSERT(mkfifo(file_path, 0600) == 0);
+
+    pthread_t reader;
+    pthread_create(&reader, NULL, unittest_fifo_reader_thread, NULL);
+
+    // open() blocks until the reader has opened the FIFO
+    u8 started = tracer_capture_start(file_path, &unittest_driver);
+    u32 polls = 0;
+
+    while (started && produced < total) {
+        tracer_capture_task();
+        polls += 1;
+    }
+
+    tracer_capture_stop();
+    pthread_join(reader, NULL);
+
+    TRACER_CAPTURE_STATISTIC statistic;
+    tracer_capture_get_statistic(&statistic);
+
+    UNITTEST_CAPTURE capture = unittest_parse(p_fifo_data, fifo_size);
+
+    free(p_fifo_data);
+    unlink(file_path);
+
+    UT_ASSERT(started);
+    UT_ASSERT(capture.is_valid);
+    UT_ASSERT_EQUAL(total, capture.bytes);
+    UT_ASSERT(polls > 1000);
+    UT_ASSERT(statistic.stalled >= 1);
+    UT_ASSERT(statistic.stalled <= statistic.chunks);
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief A chunk that can not be written is cut off the capture-file,
+ * the capture is marked as failed and the capture-file ends with the
+ * last complete chunk, followed by index and trailer
+ *
+ */
+static void unittest_write_error(void) {
+
+    unittest_setup((u64)TRACER_CAPTURE_CHUNK_SIZE * 20);
+
+    // the third chunk exceeds the maximum file-size, write() fails with EFBIG
+    struct rlimit original_limit;
+    getrlimit(RLIMIT_FSIZE, &original_limit);
+
+    struct rlimit limit = original_limit;
+    limit.rlim_cur = sizeof(TRACER_CAPTURE_FILE_HEADER) + 2 * TRACER_CAPTURE_CHUNK_SIZE + 1000;
+
+    signal(SIGXFSZ, SIG_IGN);
+    setrlimit(RLIMIT_FSIZE, &limit);
+
+    u8 started = tracer_capture_start(file_path, &unittest_driver);
+
+    while (started && produced < total && tracer_capture_has_failed() == 0) {
+        tracer_capture_task();
+    }
+
+    // the writer-thread needs some time for the retries
+    u32 wait_ms = 0;
+    while (started && tracer_capture_has_failed() == 0 && wait_ms < 5000) {
+        tracer_capture_task();
+        usleep(1000);
+        wait_ms += 1;
+    }
+
+    tracer_capture_stop();
+
+    setrlimit(RLIMIT_FSIZE, &original_limit);
+
+    TRACER_CAPTURE_STATISTIC statistic;
+    tracer_capture_get_statistic(&statistic);
+
+    UNITTEST_CAPTURE capture = unittest_parse_file();
+    unlink(file_path);
+
+    UT_ASSERT(started);
+    UT_ASSERT(tracer_capture_has_failed());
+    UT_ASSERT(statistic.write_errors >= 1);
+    UT_ASSERT_EQUAL(2, statistic.chunks);
+    UT_ASSERT(capture.is_valid);
+    UT_ASSERT(capture.has_index);
+    UT_ASSERT_EQUAL(2, capture.chunk_count);
+}
+
+// --------------------------------------------------------------------------------
+
+int main(void) {
+
+    alarm(60);
+
+    UT_RUN(unittest_capture_and_index);
+    UT_RUN(unittest_stall_is_counted_once);
+    UT_RUN(unittest_write_error);
+
+    return UT_RESULT();
+}
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,265 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    unittest_tracer_filter.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Module-test of the filter of the parsed trace-objects.
+ *          TRACE_OBJECT of the framework is replaced by a stand-in,
+ *          the accessors are bound to it like in config.h.
+ *
+ * @see     tracer_filter.h
+ */
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "tracer.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+// --------------------------------------------------------------------------------
+
+#include "unittest.h"
+#include "tracer_spsc_ring.h"
+#include "tracer_filter.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Stand-in of TRACE_OBJECT of tracer/trace_object.h
+ *
+ */
+typedef struct UNITTEST_TRACE_OBJECT_STRUCT {
+
+    u8 type;
+    char file_name[64];
+    u32 line_number;
+    u8 data[64];
+    u16 data_length;
+
+} UNITTEST_TRACE_OBJECT;
+
+#define TRACER_FILTER_OBJECT_FILE_NAME(p_object)        ((const char*)(p_object)->file_name)
+#define TRACER_FILTER_OBJECT_LINE_NUMBER(p_object)      ((u32)(p_object)->line_number)
+#define TRACER_FILTER_OBJECT_TYPE(p_object)             ((u8)(p_object)->type)
+#define TRACER_FILTER_OBJECT_PAYLOAD(p_object)          ((const u8*)(p_object)->data)
+#define TRACER_FILTER_OBJECT_PAYLOAD_LENGTH(p_object)   ((u16)(p_object)->data_length)
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Same as main_trace_object_filter() of main_tracer.c
+ *
+ */
+static u8 unittest_filter(const UNITTEST_TRACE_OBJECT* p_object) {
+
+    if (tracer_filter_is_active() == 0) {
+        return 1;
+    }
+
+    TRACER_FILTER_OBJECT filter_object;
+
+    filter_object.p_file_name = TRACER_FILTER_OBJECT_FILE_NAME(p_object);
+    filter_object.line_number = TRACER_FILTER_OBJECT_LINE_NUMBER(p_object);
+    filter_object.type = TRACER_FILTER_OBJECT_TYPE(p_object);
+    filter_object.p_payload = TRACER_FILTER_OBJECT_PAYLOAD(p_object);
+    filter_object.payload_length = TRACER_FILTER_OBJECT_PAYLOAD_LENGTH(p_object);
+
+    return tracer_filter_match(&filter_object);
+}
+
+static u32 qeue_depth = 16;
+
+TRACER_SPSC_RING_BUILD_FILTERED_QEUE(UNITTEST_QEUE, UNITTEST_TRACE_OBJECT, qeue_depth, unittest_filter)
+
+// --------------------------------------------------------------------------------
+
+static UNITTEST_TRACE_OBJECT unittest_object(u8 type, const char* p_file_name, u32 line_number, const char* p_payload) {
+
+    UNITTEST_TRACE_OBJECT object;
+    memset(&object, 0x00, sizeof(object));
+
+    object.type = type;
+    snprintf(object.file_name, sizeof(object.file_name), "%s", p_file_name);
+    object.line_number = line_number;
+    object.data_length = (u16)strlen(p_payload);
+    memcpy(object.data, p_payload, object.data_length);
+
+    return object;
+}
+
+/**
+ * @brief The two expressions used by the tests
+ *
+ */
+static u8 unittest_add_expressions(void) {
+
+    return tracer_filter_add("regex=temp[0-9]+\\,x,file=*lcd*,line=100-200")
+        && tracer_filter_add("type=3|7,!text=idle");
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Invalid expressions are not added, trace-type names
+ * are rejected if their values are not given by config.h
+ *
+ */
+static void unittest_invalid_expressions(void) {
+
+    static const char* invalid_list[] = {
+        "bogus",
+        "file=",
+        "line=5-2",
+        "line=x",
+        "regex=(",
+        "type=foo",
+        "type=32",
+        "size=1",
+        "type=pass"
+    };
+
+    u8 i = 0;
+    for ( ; i < sizeof(invalid_list) / sizeof(invalid_list[0]) ; i++) {
+
+        if (tracer_filter_add(invalid_list[i])) {
+            printf("    accepted: %s\n", invalid_list[i]);
+            UT_ASSERT(0);
+        }
+    }
+
+    UT_ASSERT_EQUAL(0, tracer_filter_is_active());
+}
+
+/**
+ * @brief All terms of an expression must match,
+ * one of the expressions must match
+ *
+ */
+static void unittest_terms_and_expressions(void) {
+
+    UT_ASSERT(unittest_add_expressions());
+
+    UNITTEST_TRACE_OBJECT lcd_match = unittest_object(1, "src/ui/lcd.c", 150, "temp42,x");
+    UNITTEST_TRACE_OBJECT lcd_no_text = unittest_object(1, "src/ui/lcd.c", 150, "temp42");
+    UNITTEST_TRACE_OBJECT other_file = unittest_object(1, "src/uart.c", 150, "temp42,x");
+    UNITTEST_TRACE_OBJECT lcd_other_line = unittest_object(1, "src/ui/lcd.c", 201, "temp42,x");
+    UNITTEST_TRACE_OBJECT type_busy = unittest_object(3, "x.c", 1, "busy");
+    UNITTEST_TRACE_OBJECT type_idle = unittest_object(3, "x.c", 1, "is idle");
+    UNITTEST_TRACE_OBJECT type_empty = unittest_object(7, "x.c", 1, "");
+    UNITTEST_TRACE_OBJECT other_type = unittest_object(2, "x.c", 1, "busy");
+
+    u8 result_list[] = {
+        unittest_filter(&lcd_match),
+        unittest_filter(&lcd_no_text),
+        unittest_filter(&other_file),
+        unittest_filter(&lcd_other_line),
+        unittest_filter(&type_busy),
+        unittest_filter(&type_idle),
+        unittest_filter(&type_empty),
+        unittest_filter(&other_type),
+        // the result of the file-term is cached now
+        unittest_filter(&lcd_match)
+    };
+
+    tracer_filter_deinit();
+
+    UT_ASSERT_EQUAL(1, result_list[0]);
+    UT_ASSERT_EQUAL(0, result_list[1]);
+    UT_ASSERT_EQUAL(0, result_list[2]);
+    UT_ASSERT_EQUAL(0, result_list[3]);
+    UT_ASSERT_EQUAL(1, result_list[4]);
+    UT_ASSERT_EQUAL(0, result_list[5]);
+    UT_ASSERT_EQUAL(1, result_list[6]);
+    UT_ASSERT_EQUAL(0, result_list[7]);
+    UT_ASSERT_EQUAL(1, result_list[8]);
+}
+
+/**
+ * @brief A rejected trace-object is never written into the qeue
+ *
+ */
+static void unittest_filtered_qeue(void) {
+
+    UT_ASSERT(unittest_add_expressions());
+
+    UNITTEST_TRACE_OBJECT lcd_match = unittest_object(1, "src/ui/lcd.c", 150, "temp42,x");
+    UNITTEST_TRACE_OBJECT lcd_no_text = unittest_object(1, "src/ui/lcd.c", 150, "temp42");
+    UNITTEST_TRACE_OBJECT type_idle = unittest_object(3, "x.c", 1, "is idle");
+
+    UNITTEST_QEUE_init();
+
+    u8 accepted = UNITTEST_QEUE_enqeue(&lcd_match) && UNITTEST_QEUE_enqeue(&lcd_no_text) && UNITTEST_QEUE_enqeue(&type_idle);
+
+    UNITTEST_TRACE_OBJECT object;
+    u8 has_object = UNITTEST_QEUE_deqeue(&object);
+    u8 is_empty = UNITTEST_QEUE_is_empty();
+
+    TRACER_SPSC_RING_STATISTIC statistic;
+    tracer_spsc_ring_get_statistic(UNITTEST_QEUE_get_ring(), &statistic);
+    tracer_spsc_ring_deinit(UNITTEST_QEUE_get_ring());
+
+    TRACER_FILTER_STATISTIC filter_statistic;
+    tracer_filter_get_statistic(&filter_statistic);
+
+    tracer_filter_deinit();
+
+    UT_ASSERT(accepted);
+    UT_ASSERT(has_object);
+    UT_ASSERT_EQUAL(150, object.line_number);
+    UT_ASSERT_EQUAL(8, object.data_length);
+    UT_ASSERT(is_empty);
+    UT_ASSERT_EQUAL(1, statistic.written);
+    UT_ASSERT(filter_statistic.rejected >= 2);
+}
+
+/**
+ * @brief Without filter-expressions every trace-object passes
+ *
+ */
+static void unittest_inactive_filter(void) {
+
+    UT_ASSERT(unittest_add_expressions());
+    tracer_filter_deinit();
+
+    UNITTEST_TRACE_OBJECT other_type = unittest_object(2, "x.c", 1, "busy");
+
+    UT_ASSERT_EQUAL(0, tracer_filter_is_active());
+    UT_ASSERT_EQUAL(1, unittest_filter(&other_type));
+}
+
+// --------------------------------------------------------------------------------
+
+int main(void) {
+
+    alarm(60);
+
+    UT_RUN(unittest_invalid_expressions);
+    UT_RUN(unittest_terms_and_expressions);
+    UT_RUN(unittest_filtered_qeue);
+    UT_RUN(unittest_inactive_filter);
+
+    return UT_RESULT();
+}
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,431 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    unittest_tracer_replay.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Module-test of the offline decoding of a capture-file.
+ *          The capture-files are generated by the test: groups of records
+ *          that stand for a trace-object, separated by idle-times of the
+ *          line. The workers copy the bytes of their segment to stdout.
+ *
+ * @see     tracer_replay.h
+ */
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// --------------------------------------------------------------------------------
+
+#include "unittest.h"
+#include "tracer_capture.h"
+#include "tracer_replay.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Number of trace-objects and records per trace-object
+ *
+ */
+#define UNITTEST_GROUP_COUNT                        400
+#define UNITTEST_RECORDS_PER_GROUP                  3
+#define UNITTEST_RECORD_COUNT                       (UNITTEST_GROUP_COUNT * UNITTEST_RECORDS_PER_GROUP)
+
+/**
+ * @brief Time between two trace-objects and between two records
+ *
+ */
+#define UNITTEST_GROUP_TIME_US                      5000
+#define UNITTEST_RECORD_TIME_US                     100
+
+/**
+ * @brief Maximum number of bytes of the records of a chunk
+ *
+ */
+#define UNITTEST_CHUNK_LENGTH                       2048
+
+#define UNITTEST_WORKER_COUNT                       4
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Position of every record inside of the trace-data and its time
+ *
+ */
+static u64 record_position[UNITTEST_RECORD_COUNT + 1];
+static u64 record_time_us[UNITTEST_RECORD_COUNT];
+
+static char file_path[64];
+
+// --------------------------------------------------------------------------------
+
+static u8 unittest_byte(u64 position) {
+    return (u8)(position % 251);
+}
+
+static u16 unittest_record_length(u32 record) {
+    return (u16)((record * 13) % 150 + 1);
+}
+
+/**
+ * @brief Writes a capture-file of UNITTEST_RECORD_COUNT records
+ *
+ * @param is_dense the line is never idle, all records follow each other
+ * @param with_index index and trailer are written, otherwise a broken chunk-header
+ * @return 1 on success, otherwise 0
+ */
+static u8 unittest_write_capture(u8 is_dense, u8 with_index) {
+
+    snprintf(file_path, sizeof(file_path), "/tmp/unittest_tracer_replay_%d.cap", (int)getpid());
+
+    FILE* p_file = fopen(file_path, "wb");
+    if (p_file == NULL) {
+        return 0;
+    }
+
+    TRACER_CAPTURE_FILE_HEADER file_header;
+    memset(&file_header, 0x00, sizeof(file_header));
+    memcpy(file_header.magic, TRACER_CAPTURE_FILE_MAGIC, TRACER_CAPTURE_MAGIC_LENGTH);
+    file_header.chunk_size = UNITTEST_CHUNK_LENGTH;
+
+    fwrite(&file_header, sizeof(file_header), 1, p_file);
+
+    static TRACER_CAPTURE_INDEX_ENTRY index_table[UNITTEST_RECORD_COUNT];
+    static u8 records[UNITTEST_CHUNK_LENGTH];
+
+    u32 chunk_count = 0;
+    u64 position = 0;
+    u32 record = 0;
+
+    for (record = 0 ; record < UNITTEST_RECORD_COUNT ; record++) {
+
+        record_position[record] = position;
+        position += unittest_record_length(record);
+
+        if (is_dense) {
+            record_time_us[record] = (u64)record * UNITTEST_RECORD_TIME_US;
+        } else {
+            record_time_us[record] = (u64)(record / UNITTEST_RECORDS_PER_GROUP) * UNITTEST_GROUP_TIME_US
+                                   + (u64)(record % UNITTEST_RECORDS_PER_GROUP) * UNITTEST_RECORD_TIME_US;
+        }
+    }
+
+    record_position[UNITTEST_RECORD_COUNT] = position;
+
+    record = 0;
+
+    while (record < UNITTEST_RECORD_COUNT) {
+
+        TRACER_CAPTURE_CHUNK_HEADER chunk;
+        memset(&chunk, 0x00, sizeof(chunk));
+
+        chunk.magic = TRACER_CAPTURE_CHUNK_MAGIC;
+        chunk.sequence = chunk_count;
+        chunk.base_time_us = record_time_us[record];
+
+        while (record < UNITTEST_RECORD_COUNT) {
+
+            u16 length = unittest_record_length(record);
+
+            if (chunk.length + TRACER_CAPTURE_RECORD_HEADER_SIZE + length > UNITTEST_CHUNK_LENGTH) {
+                break;
+            }
+
+            u32 time_offset_us = (u32)(record_time_us[record] - chunk.base_time_us);
+            u8* p_record = records + chunk.length;
+
+            memcpy(p_record, &time_offset_us, sizeof(time_offset_us));
+            memcpy(p_record + sizeof(time_offset_us), &length, sizeof(length));
+
+            u16 i = 0;
+            for ( ; i < length ; i++) {
+                p_record[TRACER_CAPTURE_RECORD_HEADER_SIZE + i] = unittest_byte(record_position[record] + i);
+            }
+
+            chunk.length += TRACER_CAPTURE_RECORD_HEADER_SIZE + length;
+            chunk.last_time_us = record_time_us[record];
+            chunk.record_count += 1;
+            record += 1;
+        }
+
+        index_table[chunk_count].offset = (u64)ftell(p_file);
+        index_table[chunk_count].base_time_us = chunk.base_time_us;
+        index_table[chunk_count].last_time_us = chunk.last_time_us;
+
+        fwrite(&chunk, sizeof(chunk), 1, p_file);
+        fwrite(records, chunk.length, 1, p_file);
+
+        chunk_count += 1;
+    }
+
+    if (with_index) {
+
+        TRACER_CAPTURE_FILE_TRAILER trailer;
+        memset(&trailer, 0x00, sizeof(trailer));
+        memcpy(trailer.magic, TRACER_CAPTURE_INDEX_MAGIC, TRACER_CAPTURE_MAGIC_LENGTH);
+        trailer.index_offset = (u64)ftell(p_file);
+        trailer.chunk_count = chunk_count;
+
+        fwrite(index_table, sizeof(TRACER_CAPTURE_INDEX_ENTRY), chunk_count, p_file);
+        fwrite(&trailer, sizeof(trailer), 1, p_file);
+
+    } else {
+
+        // the capture was aborted while a chunk was written
+        u32 magic = TRACER_CAPTURE_CHUNK_MAGIC;
+        fwrite(&magic, sizeof(magic), 1, p_file);
+    }
+
+    fclose(p_file);
+
+    return 1;
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Replaces the pipeline: copies the bytes of the segment to stdout.
+ * The segment is finished after the second call at its end only.
+ *
+ */
+static u8 unittest_worker(u32 segment) {
+
+    (void) segment;
+
+    u8 buffer[97];
+
+    while (tracer_replay_bytes_available() != 0) {
+
+        u16 length = tracer_replay_get_N_bytes(sizeof(buffer), buffer);
+        fwrite(buffer, 1, length, stdout);
+    }
+
+    if (tracer_replay_is_finished()) {
+        return 0;
+    }
+
+    tracer_replay_bytes_available();
+
+    return tracer_replay_is_finished();
+}
+
+/**
+ * @brief Runs the replay, the output on stdout is redirected into a temporary file
+ *
+ * @param p_output the output of all workers, must be freed
+ * @param p_length number of bytes of the output
+ * @return result of tracer_replay_run()
+ */
+static u8 unittest_run(u8** pp_output, size_t* p_length) {
+
+    char path[] = "/tmp/unittest_tracer_replay_XXXXXX";
+
+    int handle = mkstemp(path);
+    unlink(path);
+
+    fflush(stdout);
+
+    int stdout_handle = dup(STDOUT_FILENO);
+    dup2(handle, STDOUT_FILENO);
+
+    u8 result = tracer_replay_run(UNITTEST_WORKER_COUNT, unittest_worker);
+
+    fflush(stdout);
+    dup2(stdout_handle, STDOUT_FILENO);
+    close(stdout_handle);
+
+    *p_length = (size_t)lseek(handle, 0, SEEK_END);
+    *pp_output = malloc(*p_length + 1);
+
+    if (pread(handle, *pp_output, *p_length, 0) != (ssize_t)*p_length) {
+        result = 0;
+    }
+
+    close(handle);
+
+    return result;
+}
+
+/**
+ * @brief Checks if the output are the bytes of the given records
+ *
+ */
+static u8 unittest_output_is(const u8* p_output, size_t length, u32 first_record, u32 end_record) {
+
+    u64 first = record_position[first_record];
+
+    if (length != record_position[end_record] - first) {
+        return 0;
+    }
+
+    size_t i = 0;
+    for ( ; i < length ; i++) {
+        if (p_output[i] != unittest_byte(first + i)) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief The capture is split into one segment per worker,
+ * the output is complete and in order
+ *
+ */
+static void unittest_replay_with_index(void) {
+
+    UT_ASSERT(unittest_write_capture(0, 1));
+    UT_ASSERT(tracer_replay_open(file_path, 0, TRACER_REPLAY_TIME_END));
+
+    u8* p_output = NULL;
+    size_t length = 0;
+
+    u8 result = unittest_run(&p_output, &length);
+
+    TRACER_REPLAY_STATISTIC statistic;
+    tracer_replay_get_statistic(&statistic);
+
+    tracer_replay_close();
+    unlink(file_path);
+
+    u8 is_complete = unittest_output_is(p_output, length, 0, UNITTEST_RECORD_COUNT);
+    free(p_output);
+
+    UT_ASSERT(result);
+    UT_ASSERT(is_complete);
+    UT_ASSERT_EQUAL(0, statistic.index_rebuilt);
+    UT_ASSERT_EQUAL(UNITTEST_WORKER_COUNT, statistic.segments);
+    UT_ASSERT_EQUAL(0, statistic.failed);
+    UT_ASSERT_EQUAL(record_position[UNITTEST_RECORD_COUNT], statistic.bytes);
+}
+
+/**
+ * @brief An aborted capture without index is replayed completely,
+ * the broken chunk at its end is ignored
+ *
+ */
+static void unittest_replay_rebuilt_index(void) {
+
+    UT_ASSERT(unittest_write_capture(0, 0));
+    UT_ASSERT(tracer_replay_open(file_path, 0, TRACER_REPLAY_TIME_END));
+
+    u8* p_output = NULL;
+    size_t length = 0;
+
+    u8 result = unittest_run(&p_output, &length);
+
+    TRACER_REPLAY_STATISTIC statistic;
+    tracer_replay_get_statistic(&statistic);
+
+    tracer_replay_close();
+    unlink(file_path);
+
+    u8 is_complete = unittest_output_is(p_output, length, 0, UNITTEST_RECORD_COUNT);
+    free(p_output);
+
+    UT_ASSERT(result);
+    UT_ASSERT(is_complete);
+    UT_ASSERT_EQUAL(1, statistic.index_rebuilt);
+    UT_ASSERT(statistic.chunks > UNITTEST_WORKER_COUNT);
+}
+
+/**
+ * @brief The time-range is extended to complete trace-objects
+ *
+ */
+static void unittest_replay_time_range(void) {
+
+    u32 first_group = 100;
+    u32 last_group = 200;
+
+    UT_ASSERT(unittest_write_capture(0, 1));
+
+    // both times point to the second record of a trace-object
+    u64 from_us = record_time_us[first_group * UNITTEST_RECORDS_PER_GROUP + 1];
+    u64 to_us = record_time_us[last_group * UNITTEST_RECORDS_PER_GROUP + 1];
+
+    UT_ASSERT(tracer_replay_open(file_path, from_us, to_us));
+
+    u8* p_output = NULL;
+    size_t length = 0;
+
+    u8 result = unittest_run(&p_output, &length);
+
+    tracer_replay_close();
+    unlink(file_path);
+
+    u8 is_complete = unittest_output_is(p_output, length,
+        first_group * UNITTEST_RECORDS_PER_GROUP, (last_group + 1) * UNITTEST_RECORDS_PER_GROUP);
+    free(p_output);
+
+    UT_ASSERT(result);
+    UT_ASSERT(is_complete);
+}
+
+/**
+ * @brief A line without idle-times can not be split,
+ * it is decoded completely by a single worker
+ *
+ */
+static void unittest_replay_dense_capture(void) {
+
+    UT_ASSERT(unittest_write_capture(1, 1));
+    UT_ASSERT(tracer_replay_open(file_path, 0, TRACER_REPLAY_TIME_END));
+
+    u8* p_output = NULL;
+    size_t length = 0;
+
+    u8 result = unittest_run(&p_output, &length);
+
+    TRACER_REPLAY_STATISTIC statistic;
+    tracer_replay_get_statistic(&statistic);
+
+    tracer_replay_close();
+    unlink(file_path);
+
+    u8 is_complete = unittest_output_is(p_output, length, 0, UNITTEST_RECORD_COUNT);
+    free(p_output);
+
+    UT_ASSERT(result);
+    UT_ASSERT(is_complete);
+    UT_ASSERT_EQUAL(1, statistic.segments);
+}
+
+// --------------------------------------------------------------------------------
+
+int main(void) {
+
+    alarm(60);
+
+    UT_RUN(unittest_replay_with_index);
+    UT_RUN(unittest_replay_rebuilt_index);
+    UT_RUN(unittest_replay_time_range);
+    UT_RUN(unittest_replay_dense_capture);
+
+    return UT_RESULT();
+}
+
+// --------------------------------------------------------------------------------
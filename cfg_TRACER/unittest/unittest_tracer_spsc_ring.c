@@ -0,0 +1,431 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    unittest_tracer_spsc_ring.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Module-test of the single-producer / single-consumer ring
+ *          and of the qeue-interface that is built on top of it
+ *
+ * @see     tracer_spsc_ring.h
+ */
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "tracer.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sched.h>
+
+// --------------------------------------------------------------------------------
+
+#include "unittest.h"
+#include "tracer_spsc_ring.h"
+
+// --------------------------------------------------------------------------------
+
+#define UNITTEST_NUM_OBJECTS                        1000000
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Object of the rings of the test, larger than a cache-line
+ *
+ */
+typedef struct UNITTEST_OBJECT_STRUCT {
+    u32 number;
+    u8 payload[92];
+} UNITTEST_OBJECT;
+
+// --------------------------------------------------------------------------------
+
+static u32 qeue_depth = 4;
+
+/**
+ * @brief Filter of FILTERED_QEUE, only even numbers are enqeued
+ *
+ */
+static u8 unittest_is_even(const UNITTEST_OBJECT* p_object) {
+    return (p_object->number & 1) == 0 ? 1 : 0;
+}
+
+TRACER_SPSC_RING_BUILD_QEUE(UNITTEST_QEUE, UNITTEST_OBJECT, qeue_depth)
+TRACER_SPSC_RING_BUILD_FILTERED_QEUE(FILTERED_QEUE, UNITTEST_OBJECT, qeue_depth, unittest_is_even)
+
+// --------------------------------------------------------------------------------
+
+static UNITTEST_OBJECT unittest_object(u32 number) {
+
+    UNITTEST_OBJECT object;
+
+    memset(&object, (int)(number & 0xFF), sizeof(object));
+    object.number = number;
+
+    return object;
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief The depth is rounded up to a power of two, objects are read
+ * in the order they were written, also across the end of the slots
+ *
+ */
+static void unittest_order_and_capacity(void) {
+
+    TRACER_SPSC_RING ring;
+    UT_ASSERT(tracer_spsc_ring_init(&ring, sizeof(UNITTEST_OBJECT), 5));
+
+    u32 capacity = ring.capacity;
+    u8 in_order = 1;
+    u32 number = 0;
+
+    u32 round = 0;
+    for ( ; round < 5 ; round++) {
+
+        u32 i = 0;
+        for ( ; i < 6 ; i++) {
+            UNITTEST_OBJECT object = unittest_object(round * 6 + i);
+            tracer_spsc_ring_write(&ring, &object);
+        }
+
+        UNITTEST_OBJECT object;
+        while (tracer_spsc_ring_read(&ring, &object)) {
+
+            UNITTEST_OBJECT expected = unittest_object(number++);
+            if (memcmp(&object, &expected, sizeof(object)) != 0) {
+                in_order = 0;
+            }
+        }
+    }
+
+    TRACER_SPSC_RING_STATISTIC statistic;
+    tracer_spsc_ring_get_statistic(&ring, &statistic);
+    tracer_spsc_ring_deinit(&ring);
+
+    UT_ASSERT_EQUAL(8, capacity);
+    UT_ASSERT(in_order);
+    UT_ASSERT_EQUAL(30, number);
+    UT_ASSERT_EQUAL(30, statistic.written);
+    UT_ASSERT_EQUAL(6, statistic.high_water);
+    UT_ASSERT_EQUAL(0, statistic.dropped);
+    UT_ASSERT_EQUAL(0, statistic.depth);
+}
+
+/**
+ * @brief A producer that retries the same object until it fits
+ * loses nothing, the full ring is counted as a single stall
+ *
+ */
+static void unittest_retry_is_no_drop(void) {
+
+    TRACER_SPSC_RING ring;
+    UT_ASSERT(tracer_spsc_ring_init(&ring, sizeof(UNITTEST_OBJECT), 2));
+
+    UNITTEST_OBJECT object = unittest_object(0);
+    tracer_spsc_ring_write(&ring, &object);
+    object = unittest_object(1);
+    tracer_spsc_ring_write(&ring, &object);
+
+    object = unittest_object(2);
+
+    u32 failed = 0;
+    u32 i = 0;
+    for ( ; i < 100 ; i++) {
+        failed += tracer_spsc_ring_write(&ring, &object) == 0 ? 1 : 0;
+    }
+
+    UNITTEST_OBJECT read_object;
+    tracer_spsc_ring_read(&ring, &read_object);
+
+    u8 written = tracer_spsc_ring_write(&ring, &object);
+
+    TRACER_SPSC_RING_STATISTIC statistic;
+    tracer_spsc_ring_get_statistic(&ring, &statistic);
+    tracer_spsc_ring_deinit(&ring);
+
+    UT_ASSERT_EQUAL(100, failed);
+    UT_ASSERT(written);
+    UT_ASSERT_EQUAL(3, statistic.written);
+    UT_ASSERT_EQUAL(0, statistic.dropped);
+    UT_ASSERT_EQUAL(1, statistic.stalled);
+}
+
+/**
+ * @brief Every object the producer gives up is counted once,
+ * independent of how often it was retried
+ *
+ */
+static void unittest_drop_per_object(void) {
+
+    TRACER_SPSC_RING ring;
+    UT_ASSERT(tracer_spsc_ring_init(&ring, sizeof(UNITTEST_OBJECT), 2));
+
+    u32 number = 0;
+    for ( ; number < 2 ; number++) {
+        UNITTEST_OBJECT object = unittest_object(number);
+        tracer_spsc_ring_write(&ring, &object);
+    }
+
+    // 3 objects are given up, each of them is tried 10 times
+    for ( ; number < 5 ; number++) {
+
+        UNITTEST_OBJECT object = unittest_object(number);
+
+        u32 i = 0;
+        for ( ; i < 10 ; i++) {
+            tracer_spsc_ring_write(&ring, &object);
+        }
+    }
+
+    UNITTEST_OBJECT read_object;
+    tracer_spsc_ring_read(&ring, &read_object);
+
+    // the producer continues with the next object after a free slot
+    UNITTEST_OBJECT object = unittest_object(number);
+    u8 written = tracer_spsc_ring_write(&ring, &object);
+
+    // the ring becomes full again: a second stall
+    object = unittest_object(number + 1);
+    tracer_spsc_ring_write(&ring, &object);
+
+    TRACER_SPSC_RING_STATISTIC statistic;
+    tracer_spsc_ring_get_statistic(&ring, &statistic);
+    tracer_spsc_ring_deinit(&ring);
+
+    UT_ASSERT(written);
+    UT_ASSERT_EQUAL(3, statistic.written);
+    UT_ASSERT_EQUAL(3, statistic.dropped);
+    UT_ASSERT_EQUAL(2, statistic.stalled);
+}
+
+/**
+ * @brief The in-place interface of the qeue hands out the slots
+ * themselves, enqeue() and deqeue() copy
+ *
+ */
+static void unittest_qeue_interface(void) {
+
+    UNITTEST_QEUE_init();
+
+    u8 was_empty = UNITTEST_QEUE_is_empty();
+
+    UNITTEST_OBJECT* p_slot = UNITTEST_QEUE_write_acquire();
+    UT_ASSERT(p_slot != NULL);
+    *p_slot = unittest_object(1);
+    UNITTEST_QEUE_write_commit();
+
+    u32 i = 2;
+    for ( ; i <= 4 ; i++) {
+        UNITTEST_OBJECT object = unittest_object(i);
+        UNITTEST_QEUE_enqeue(&object);
+    }
+
+    u8 is_full = UNITTEST_QEUE_is_full();
+    u8 no_slot = UNITTEST_QEUE_write_acquire() == NULL;
+
+    UNITTEST_OBJECT object;
+    u8 dequeued = UNITTEST_QEUE_deqeue(&object);
+    u32 first_number = object.number;
+
+    UNITTEST_OBJECT* p_read_slot = UNITTEST_QEUE_read_acquire();
+    u8 is_in_place = p_read_slot != NULL && (u8*)p_read_slot >= UNITTEST_QEUE_get_ring()->p_slot_memory;
+    u32 second_number = p_read_slot != NULL ? p_read_slot->number : 0;
+    UNITTEST_QEUE_read_release();
+
+    u8 mutex = UNITTEST_QEUE_mutex_get();
+    UNITTEST_QEUE_mutex_release();
+
+    tracer_spsc_ring_deinit(UNITTEST_QEUE_get_ring());
+
+    UT_ASSERT(was_empty);
+    UT_ASSERT(is_full);
+    UT_ASSERT(no_slot);
+    UT_ASSERT(dequeued);
+    UT_ASSERT_EQUAL(1, first_number);
+    UT_ASSERT(is_in_place);
+    UT_ASSERT_EQUAL(2, second_number);
+    UT_ASSERT(mutex);
+}
+
+/**
+ * @brief An object that is rejected by the filter is never written,
+ * enqeue() reports success anyway
+ *
+ */
+static void unittest_filtered_qeue(void) {
+
+    FILTERED_QEUE_init();
+
+    u8 accepted = 1;
+
+    u32 i = 0;
+    for ( ; i < 8 ; i++) {
+        UNITTEST_OBJECT object = unittest_object(i);
+        accepted &= FILTERED_QEUE_enqeue(&object);
+    }
+
+    u32 count = 0;
+    u8 only_even = 1;
+
+    UNITTEST_OBJECT object;
+    while (FILTERED_QEUE_deqeue(&object)) {
+        count += 1;
+        only_even &= unittest_is_even(&object);
+    }
+
+    TRACER_SPSC_RING_STATISTIC statistic;
+    tracer_spsc_ring_get_statistic(FILTERED_QEUE_get_ring(), &statistic);
+    tracer_spsc_ring_deinit(FILTERED_QEUE_get_ring());
+
+    UT_ASSERT(accepted);
+    UT_ASSERT_EQUAL(4, count);
+    UT_ASSERT(only_even);
+    UT_ASSERT_EQUAL(4, statistic.written);
+    UT_ASSERT_EQUAL(0, statistic.dropped);
+}
+
+/**
+ * @brief The ring is drained only after the consumer
+ * has come back to it after the last object
+ *
+ */
+static void unittest_drained_handshake(void) {
+
+    TRACER_SPSC_RING ring;
+    UT_ASSERT(tracer_spsc_ring_init(&ring, sizeof(UNITTEST_OBJECT), 4));
+
+    u8 drained_on_start = tracer_spsc_ring_is_drained(&ring);
+
+    UNITTEST_OBJECT object = unittest_object(0);
+    tracer_spsc_ring_write(&ring, &object);
+    tracer_spsc_ring_write(&ring, &object);
+
+    u8 drained_after_write = tracer_spsc_ring_is_drained(&ring);
+
+    tracer_spsc_ring_read(&ring, &object);
+    tracer_spsc_ring_read(&ring, &object);
+
+    // the last object may still be processed
+    u8 drained_after_last_read = tracer_spsc_ring_is_drained(&ring);
+
+    u8 has_read_empty = tracer_spsc_ring_read(&ring, &object);
+    u8 drained_after_empty_read = tracer_spsc_ring_is_drained(&ring);
+
+    tracer_spsc_ring_write(&ring, &object);
+    u8 drained_after_next_write = tracer_spsc_ring_is_drained(&ring);
+
+    tracer_spsc_ring_deinit(&ring);
+
+    UT_ASSERT_EQUAL(1, drained_on_start);
+    UT_ASSERT_EQUAL(0, drained_after_write);
+    UT_ASSERT_EQUAL(0, drained_after_last_read);
+    UT_ASSERT_EQUAL(0, has_read_empty);
+    UT_ASSERT_EQUAL(1, drained_after_empty_read);
+    UT_ASSERT_EQUAL(0, drained_after_next_write);
+}
+
+// --------------------------------------------------------------------------------
+
+static TRACER_SPSC_RING thread_ring;
+static u32 consumed = 0;
+static u8 consumed_in_order = 1;
+
+static void* unittest_consumer_thread(void* p_argument) {
+
+    (void) p_argument;
+
+    while (consumed < UNITTEST_NUM_OBJECTS) {
+
+        const UNITTEST_OBJECT* p_object = tracer_spsc_ring_read_acquire(&thread_ring);
+
+        if (p_object == NULL) {
+            sched_yield();
+            continue;
+        }
+
+        if (p_object->number != consumed || p_object->payload[91] != (u8)(consumed & 0xFF)) {
+            consumed_in_order = 0;
+        }
+
+        tracer_spsc_ring_read_release(&thread_ring);
+        consumed += 1;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief A retrying producer and a consumer on their own threads,
+ * every object arrives once and in order, nothing is counted as dropped
+ *
+ */
+static void unittest_producer_consumer_threads(void) {
+
+    UT_ASSERT(tracer_spsc_ring_init(&thread_ring, sizeof(UNITTEST_OBJECT), 64));
+
+    pthread_t consumer;
+    pthread_create(&consumer, NULL, unittest_consumer_thread, NULL);
+
+    u32 number = 0;
+    for ( ; number < UNITTEST_NUM_OBJECTS ; number++) {
+
+        UNITTEST_OBJECT object = unittest_object(number);
+
+        while (tracer_spsc_ring_write(&thread_ring, &object) == 0) {
+            sched_yield();
+        }
+    }
+
+    pthread_join(consumer, NULL);
+
+    TRACER_SPSC_RING_STATISTIC statistic;
+    tracer_spsc_ring_get_statistic(&thread_ring, &statistic);
+    tracer_spsc_ring_deinit(&thread_ring);
+
+    UT_ASSERT_EQUAL(UNITTEST_NUM_OBJECTS, consumed);
+    UT_ASSERT(consumed_in_order);
+    UT_ASSERT_EQUAL(UNITTEST_NUM_OBJECTS, statistic.written);
+    UT_ASSERT_EQUAL(0, statistic.dropped);
+    UT_ASSERT(statistic.high_water <= statistic.capacity);
+}
+
+// --------------------------------------------------------------------------------
+
+int main(void) {
+
+    alarm(60);
+
+    UT_RUN(unittest_order_and_capacity);
+    UT_RUN(unittest_retry_is_no_drop);
+    UT_RUN(unittest_drop_per_object);
+    UT_RUN(unittest_qeue_interface);
+    UT_RUN(unittest_filtered_qeue);
+    UT_RUN(unittest_drained_handshake);
+    UT_RUN(unittest_producer_consumer_threads);
+
+    return UT_RESULT();
+}
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,333 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    cmd_handler_batch.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Command-handler of the batch-frame CMD_BATCH.
+ *
+ *          A batch carries several commands of the host and returns
+ *          all of their responses within a single transaction.
+ *
+ *          Command (after the command-id):
+ *
+ *              [count]
+ *              [length_1][cmd_1][arg_1 ...] ... [length_n][cmd_n][arg_n ...]
+ *
+ *          Response:
+ *
+ *              [CMD_BATCH][status][count]
+ *              [length_1][cmd_1][status_1][data_1 ...] ...
+ *
+ *          Every command is processed by the handler of the batch-table.
+ *          The batch-table consists of the local command-handler table
+ *          and config_BATCH_COMMAND_HANDLER_TABLE_FUNC_CALLBACK.
+ *          [cmd][status][data] of a response is written by the handler
+ *          itself, like outside of a batch. A command without handler
+ *          is answered with [cmd][0xFF].
+ *
+ *          [count] of the response is the number of responses. It is
+ *          less than the number of commands if the batch is truncated.
+ *
+ * @see     cfg_SHC_CLIENT/shc_rpi_batch.h
+ */
+
+#define TRACER_OFF
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "tracer.h"
+
+// --------------------------------------------------------------------------------
+
+#include "cpu.h"
+
+// --------------------------------------------------------------------------------
+
+#include <string.h>
+
+// --------------------------------------------------------------------------------
+
+#include "command_management/command_handler_interface.h"
+#include "command_management/protocol_interface.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Maximum number of bytes of a single command or response inside of a batch
+ *
+ */
+#ifndef CMD_HANDLER_BATCH_MAX_ENTRY_LENGTH
+#define CMD_HANDLER_BATCH_MAX_ENTRY_LENGTH          32
+#endif
+
+/**
+ * @brief Maximum number of bytes of all responses of a batch
+ * without the header [CMD_BATCH][status][count]
+ *
+ */
+#ifndef CMD_HANDLER_BATCH_MAX_RESPONSE_LENGTH
+#define CMD_HANDLER_BATCH_MAX_RESPONSE_LENGTH       96
+#endif
+
+/**
+ * @brief Handlers of the framework that can be used inside of a batch
+ *
+ */
+#ifndef config_BATCH_COMMAND_HANDLER_TABLE_FUNC_PROTO
+#define config_BATCH_COMMAND_HANDLER_TABLE_FUNC_PROTO
+#endif
+
+#ifndef config_BATCH_COMMAND_HANDLER_TABLE_FUNC_CALLBACK
+#define config_BATCH_COMMAND_HANDLER_TABLE_FUNC_CALLBACK
+#endif
+
+// --------------------------------------------------------------------------------
+
+#define CMD_HANDLER_BATCH_STATUS_OK                 0x00
+#define CMD_HANDLER_BATCH_STATUS_INVALID_FRAME      0x01
+#define CMD_HANDLER_BATCH_STATUS_UNKNOWN_COMMAND    0xFF
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Entry of the batch-table
+ *
+ */
+typedef struct CMD_HANDLER_BATCH_TABLE_ENTRY_STRUCT {
+    u8 command_id;
+    u8 (*handle) (const COMMAND_BUFFER_INTERFACE* i_cmd_buffer, const ANSWER_BUFFER_INTERFACE* i_answ_buffer);
+} CMD_HANDLER_BATCH_TABLE_ENTRY;
+
+// --------------------------------------------------------------------------------
+
+config_LOCAL_COMMAND_HANDLER_TABLE_FUNC_PROTO
+config_BATCH_COMMAND_HANDLER_TABLE_FUNC_PROTO
+
+static const CMD_HANDLER_BATCH_TABLE_ENTRY batch_handler_table[] = {
+    config_LOCAL_COMMAND_HANDLER_TABLE_FUNC_CALLBACK
+    config_BATCH_COMMAND_HANDLER_TABLE_FUNC_CALLBACK
+    {0, NULL}
+};
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Arguments of the actual command of the batch
+ *
+ */
+static u8 batch_command[CMD_HANDLER_BATCH_MAX_ENTRY_LENGTH];
+static u8 batch_command_length = 0;
+static u8 batch_command_position = 0;
+
+/**
+ * @brief Answer of the actual command of the batch
+ *
+ */
+static u8 batch_answer[CMD_HANDLER_BATCH_MAX_ENTRY_LENGTH];
+static u8 batch_answer_length = 0;
+
+/**
+ * @brief All responses of the batch, [count] is only known
+ * after the last command has been processed
+ *
+ */
+static u8 batch_response[CMD_HANDLER_BATCH_MAX_RESPONSE_LENGTH];
+static u8 batch_response_length = 0;
+
+// --------------------------------------------------------------------------------
+
+static void cmd_handler_batch_start_read(void) {
+    batch_command_position = 0;
+}
+
+static void cmd_handler_batch_stop_read(void) {
+
+}
+
+static u16 cmd_handler_batch_bytes_available(void) {
+    return batch_command_length - batch_command_position;
+}
+
+static u8 cmd_handler_batch_get_byte(void) {
+
+    if (batch_command_position == batch_command_length) {
+        return 0;
+    }
+
+    return batch_command[batch_command_position++];
+}
+
+static u16 cmd_handler_batch_get_N_bytes(u16 num_bytes, u8* p_buffer_to) {
+
+    u16 available = cmd_handler_batch_bytes_available();
+    if (num_bytes > available) {
+        num_bytes = available;
+    }
+
+    memcpy(p_buffer_to, batch_command + batch_command_position, num_bytes);
+    batch_command_position += num_bytes;
+
+    return num_bytes;
+}
+
+static void cmd_handler_batch_start_write(void) {
+    batch_answer_length = 0;
+}
+
+static void cmd_handler_batch_stop_write(void) {
+
+}
+
+static void cmd_handler_batch_add_byte(u8 byte) {
+
+    if (batch_answer_length < sizeof(batch_answer)) {
+        batch_answer[batch_answer_length++] = byte;
+    }
+}
+
+static void cmd_handler_batch_add_N_bytes(u16 num_bytes, const u8* p_buffer_from) {
+
+    u16 i = 0;
+    for ( ; i < num_bytes ; i++) {
+        cmd_handler_batch_add_byte(p_buffer_from[i]);
+    }
+}
+
+/**
+ * @brief Command-buffer of a single command of the batch
+ *
+ */
+static const COMMAND_BUFFER_INTERFACE batch_command_buffer = {
+    .start_read = &cmd_handler_batch_start_read,
+    .stop_read = &cmd_handler_batch_stop_read,
+    .bytes_available = &cmd_handler_batch_bytes_available,
+    .get_byte = &cmd_handler_batch_get_byte,
+    .get_N_bytes = &cmd_handler_batch_get_N_bytes
+};
+
+/**
+ * @brief Answer-buffer of a single command of the batch
+ *
+ */
+static const ANSWER_BUFFER_INTERFACE batch_answer_buffer = {
+    .start_write = &cmd_handler_batch_start_write,
+    .stop_write = &cmd_handler_batch_stop_write,
+    .add_byte = &cmd_handler_batch_add_byte,
+    .add_N_bytes = &cmd_handler_batch_add_N_bytes
+};
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Processes a single command of the batch.
+ * The arguments of the command are inside of batch_command,
+ * the response [cmd][status][data] is inside of batch_answer.
+ *
+ * @param command_id id of the command
+ */
+static void cmd_handler_batch_process(u8 command_id) {
+
+    const CMD_HANDLER_BATCH_TABLE_ENTRY* p_entry = &batch_handler_table[0];
+    u8 status = CMD_HANDLER_BATCH_STATUS_UNKNOWN_COMMAND;
+
+    batch_command_position = 0;
+    batch_answer_length = 0;
+
+    if (command_id == CMD_BATCH) {
+        DEBUG_PASS("cmd_handler_batch_process() - Nested batch not supported");
+        p_entry = NULL;
+    }
+
+    for ( ; p_entry != NULL && p_entry->handle != NULL ; p_entry++) {
+
+        if (p_entry->command_id == command_id) {
+            status = p_entry->handle(&batch_command_buffer, &batch_answer_buffer);
+            break;
+        }
+    }
+
+    if (p_entry != NULL && p_entry->handle == NULL) {
+        DEBUG_TRACE_byte(command_id, "cmd_handler_batch_process() - Unknown command");
+    }
+
+    if (batch_answer_length < 2) {
+        // the handler has not written a response
+        batch_answer[0] = command_id;
+        batch_answer[1] = status;
+        batch_answer_length = 2;
+    }
+}
+
+// --------------------------------------------------------------------------------
+
+u8 cmd_handler_batch(const COMMAND_BUFFER_INTERFACE* i_cmd_buffer, const ANSWER_BUFFER_INTERFACE* i_answ_buffer) {
+
+    DEBUG_PASS("cmd_handler_batch()");
+
+    u8 status = CMD_HANDLER_BATCH_STATUS_OK;
+    u8 count = 0;
+
+    batch_response_length = 0;
+
+    if (i_cmd_buffer->bytes_available() == 0) {
+        status = CMD_HANDLER_BATCH_STATUS_INVALID_FRAME;
+    } else {
+        count = i_cmd_buffer->get_byte();
+    }
+
+    u8 i = 0;
+    for ( ; i < count ; i++) {
+
+        u8 length = i_cmd_buffer->get_byte();
+
+        if (length == 0 || length > sizeof(batch_command) + 1 || i_cmd_buffer->bytes_available() < length) {
+
+            // every following command would be misaligned
+            DEBUG_TRACE_byte(length, "cmd_handler_batch() - Invalid command-length");
+            break;
+        }
+
+        u8 command_id = i_cmd_buffer->get_byte();
+        batch_command_length = (u8)i_cmd_buffer->get_N_bytes(length - 1, batch_command);
+
+        cmd_handler_batch_process(command_id);
+
+        if ((u16)(batch_response_length + 1 + batch_answer_length) > sizeof(batch_response)) {
+            // the host requests the missing responses one by one
+            DEBUG_TRACE_byte(i, "cmd_handler_batch() - Response too long, responses:");
+            break;
+        }
+
+        batch_response[batch_response_length++] = batch_answer_length;
+        memcpy(batch_response + batch_response_length, batch_answer, batch_answer_length);
+        batch_response_length += batch_answer_length;
+    }
+
+    i_answ_buffer->start_write();
+    i_answ_buffer->add_byte(CMD_BATCH);
+    i_answ_buffer->add_byte(status);
+    i_answ_buffer->add_byte(i);
+    i_answ_buffer->add_N_bytes(batch_response_length, batch_response);
+    i_answ_buffer->stop_write();
+
+    return status;
+}
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,412 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    cmd_handler_sequence.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Command-handler of the windowed host-protocol CMD_SEQUENCE.
+ *
+ *          The host tags every command with a sequence-number. The
+ *          command is executed while it is submitted and its response
+ *          is stored inside of the completion-queue. All stored responses
+ *          are returned together with the acknowledge of the next
+ *          command or on a poll of the host, so the host can keep
+ *          several commands in flight. The handlers are not executed
+ *          in the background, a slow command still delays the
+ *          acknowledge of its own submit.
+ *
+ *          Submit (after the command-id):
+ *
+ *              [sequence][length_cmd][cmd][arg ...]
+ *
+ *          Poll (after the command-id):
+ *
+ *              nothing
+ *
+ *          Response:
+ *
+ *              [CMD_SEQUENCE][status][count]
+ *              [sequence_1][length_1][cmd_1][status_1][data_1 ...] ...
+ *
+ *          [cmd][status][data] of a response is written by the handler
+ *          itself, like outside of a sequence. The sequence-table is the
+ *          batch-table without CMD_BATCH and CMD_SEQUENCE. A command
+ *          without handler is completed with [cmd][0xFF], the host
+ *          sends it again as single command.
+ *
+ *          A command is rejected with CMD_HANDLER_SEQUENCE_STATUS_QUEUE_FULL
+ *          if there is no free entry inside of the completion-queue.
+ *          Completions that do not fit into the response are returned
+ *          with the next transaction.
+ *
+ * @see     cfg_SHC_CLIENT/shc_rpi_window.h
+ */
+
+#define TRACER_OFF
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include "tracer.h"
+
+// --------------------------------------------------------------------------------
+
+#include "cpu.h"
+
+// --------------------------------------------------------------------------------
+
+#include <string.h>
+
+// --------------------------------------------------------------------------------
+
+#include "command_management/command_handler_interface.h"
+#include "command_management/protocol_interface.h"
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Maximum number of responses waiting for the host
+ *
+ */
+#ifndef CMD_HANDLER_SEQUENCE_QUEUE_SIZE
+#define CMD_HANDLER_SEQUENCE_QUEUE_SIZE             8
+#endif
+
+/**
+ * @brief Maximum number of bytes of a single command or response.
+ * A response of a batch must fit into a single entry.
+ *
+ */
+#ifndef CMD_HANDLER_SEQUENCE_MAX_ENTRY_LENGTH
+#define CMD_HANDLER_SEQUENCE_MAX_ENTRY_LENGTH       64
+#endif
+
+/**
+ * @brief Maximum number of bytes of the response of a transaction
+ *
+ */
+#ifndef CMD_HANDLER_SEQUENCE_MAX_RESPONSE_LENGTH
+#define CMD_HANDLER_SEQUENCE_MAX_RESPONSE_LENGTH    96
+#endif
+
+/**
+ * @brief Handlers of the framework that can be used inside of a sequence
+ *
+ */
+#ifndef config_BATCH_COMMAND_HANDLER_TABLE_FUNC_PROTO
+#define config_BATCH_COMMAND_HANDLER_TABLE_FUNC_PROTO
+#endif
+
+#ifndef config_BATCH_COMMAND_HANDLER_TABLE_FUNC_CALLBACK
+#define config_BATCH_COMMAND_HANDLER_TABLE_FUNC_CALLBACK
+#endif
+
+// --------------------------------------------------------------------------------
+
+#define CMD_HANDLER_SEQUENCE_STATUS_OK              0x00
+#define CMD_HANDLER_SEQUENCE_STATUS_INVALID_FRAME   0x01
+#define CMD_HANDLER_SEQUENCE_STATUS_QUEUE_FULL      0x02
+#define CMD_HANDLER_SEQUENCE_STATUS_UNKNOWN_COMMAND 0xFF
+
+/**
+ * @brief [sequence][length] of every completion inside of the response
+ *
+ */
+#define CMD_HANDLER_SEQUENCE_COMPLETION_HEADER      2
+
+/**
+ * @brief [CMD_SEQUENCE][status][count]
+ *
+ */
+#define CMD_HANDLER_SEQUENCE_RESPONSE_HEADER        3
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Entry of the sequence-table
+ *
+ */
+typedef struct CMD_HANDLER_SEQUENCE_TABLE_ENTRY_STRUCT {
+    u8 command_id;
+    u8 (*handle) (const COMMAND_BUFFER_INTERFACE* i_cmd_buffer, const ANSWER_BUFFER_INTERFACE* i_answ_buffer);
+} CMD_HANDLER_SEQUENCE_TABLE_ENTRY;
+
+/**
+ * @brief A response waiting for the host, data is [cmd][status][answer ...]
+ *
+ */
+typedef struct CMD_HANDLER_SEQUENCE_COMPLETION_STRUCT {
+    u8 sequence;
+    u8 length;
+    u8 data[CMD_HANDLER_SEQUENCE_MAX_ENTRY_LENGTH];
+} CMD_HANDLER_SEQUENCE_COMPLETION;
+
+// --------------------------------------------------------------------------------
+
+config_LOCAL_COMMAND_HANDLER_TABLE_FUNC_PROTO
+config_BATCH_COMMAND_HANDLER_TABLE_FUNC_PROTO
+
+static const CMD_HANDLER_SEQUENCE_TABLE_ENTRY sequence_handler_table[] = {
+    config_LOCAL_COMMAND_HANDLER_TABLE_FUNC_CALLBACK
+    config_BATCH_COMMAND_HANDLER_TABLE_FUNC_CALLBACK
+    {0, NULL}
+};
+
+// --------------------------------------------------------------------------------
+
+static CMD_HANDLER_SEQUENCE_COMPLETION completion_queue[CMD_HANDLER_SEQUENCE_QUEUE_SIZE];
+static u8 completion_read_index = 0;
+static u8 completion_count = 0;
+
+/**
+ * @brief Arguments of the actual command
+ *
+ */
+static u8 sequence_command[CMD_HANDLER_SEQUENCE_MAX_ENTRY_LENGTH];
+static u8 sequence_command_length = 0;
+static u8 sequence_command_position = 0;
+
+/**
+ * @brief The completion of the actual command,
+ * the handler writes [cmd][status][answer ...] into it
+ *
+ */
+static CMD_HANDLER_SEQUENCE_COMPLETION* p_sequence_completion = NULL;
+
+// --------------------------------------------------------------------------------
+
+static void cmd_handler_sequence_start_read(void) {
+    sequence_command_position = 0;
+}
+
+static void cmd_handler_sequence_stop_read(void) {
+
+}
+
+static u16 cmd_handler_sequence_bytes_available(void) {
+    return sequence_command_length - sequence_command_position;
+}
+
+static u8 cmd_handler_sequence_get_byte(void) {
+
+    if (sequence_command_position == sequence_command_length) {
+        return 0;
+    }
+
+    return sequence_command[sequence_command_position++];
+}
+
+static u16 cmd_handler_sequence_get_N_bytes(u16 num_bytes, u8* p_buffer_to) {
+
+    u16 available = cmd_handler_sequence_bytes_available();
+    if (num_bytes > available) {
+        num_bytes = available;
+    }
+
+    memcpy(p_buffer_to, sequence_command + sequence_command_position, num_bytes);
+    sequence_command_position += num_bytes;
+
+    return num_bytes;
+}
+
+static void cmd_handler_sequence_start_write(void) {
+    p_sequence_completion->length = 0;
+}
+
+static void cmd_handler_sequence_stop_write(void) {
+
+}
+
+static void cmd_handler_sequence_add_byte(u8 byte) {
+
+    if (p_sequence_completion->length < sizeof(p_sequence_completion->data)) {
+        p_sequence_completion->data[p_sequence_completion->length++] = byte;
+    }
+}
+
+static void cmd_handler_sequence_add_N_bytes(u16 num_bytes, const u8* p_buffer_from) {
+
+    u16 i = 0;
+    for ( ; i < num_bytes ; i++) {
+        cmd_handler_sequence_add_byte(p_buffer_from[i]);
+    }
+}
+
+/**
+ * @brief Command-buffer of a single command of a sequence
+ *
+ */
+static const COMMAND_BUFFER_INTERFACE sequence_command_buffer = {
+    .start_read = &cmd_handler_sequence_start_read,
+    .stop_read = &cmd_handler_sequence_stop_read,
+    .bytes_available = &cmd_handler_sequence_bytes_available,
+    .get_byte = &cmd_handler_sequence_get_byte,
+    .get_N_bytes = &cmd_handler_sequence_get_N_bytes
+};
+
+/**
+ * @brief Answer-buffer of a single command of a sequence
+ *
+ */
+static const ANSWER_BUFFER_INTERFACE sequence_answer_buffer = {
+    .start_write = &cmd_handler_sequence_start_write,
+    .stop_write = &cmd_handler_sequence_stop_write,
+    .add_byte = &cmd_handler_sequence_add_byte,
+    .add_N_bytes = &cmd_handler_sequence_add_N_bytes
+};
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Processes the actual command and stores its response
+ * inside of the given completion.
+ *
+ * @param p_completion the completion of the command
+ * @param command_id id of the command
+ */
+static void cmd_handler_sequence_process(CMD_HANDLER_SEQUENCE_COMPLETION* p_completion, u8 command_id) {
+
+    const CMD_HANDLER_SEQUENCE_TABLE_ENTRY* p_entry = &sequence_handler_table[0];
+    u8 status = CMD_HANDLER_SEQUENCE_STATUS_UNKNOWN_COMMAND;
+
+    sequence_command_position = 0;
+    p_sequence_completion = p_completion;
+    p_completion->length = 0;
+
+    if (command_id == CMD_SEQUENCE || command_id == CMD_BATCH) {
+        // a nested frame would carry a second header inside of the completion
+        DEBUG_TRACE_byte(command_id, "cmd_handler_sequence_process() - Nested frame not supported");
+        p_entry = NULL;
+    }
+
+    for ( ; p_entry != NULL && p_entry->handle != NULL ; p_entry++) {
+
+        if (p_entry->command_id == command_id) {
+            status = p_entry->handle(&sequence_command_buffer, &sequence_answer_buffer);
+            break;
+        }
+    }
+
+    if (p_entry != NULL && p_entry->handle == NULL) {
+        DEBUG_TRACE_byte(command_id, "cmd_handler_sequence_process() - Unknown command");
+    }
+
+    if (p_completion->length < 2) {
+        // the handler has not written a response
+        p_completion->data[0] = command_id;
+        p_completion->data[1] = status;
+        p_completion->length = 2;
+    }
+}
+
+/**
+ * @brief Executes the submitted command and adds its response
+ * to the completion-queue.
+ *
+ * @param i_cmd_buffer the submit-frame behind the command-id
+ * @return status of the submit
+ */
+static u8 cmd_handler_sequence_submit(const COMMAND_BUFFER_INTERFACE* i_cmd_buffer) {
+
+    if (i_cmd_buffer->bytes_available() < 3) {
+        DEBUG_PASS("cmd_handler_sequence_submit() - Invalid frame");
+        return CMD_HANDLER_SEQUENCE_STATUS_INVALID_FRAME;
+    }
+
+    u8 sequence = i_cmd_buffer->get_byte();
+    u8 length = i_cmd_buffer->get_byte();
+
+    if (length == 0 || length > sizeof(sequence_command) + 1 || i_cmd_buffer->bytes_available() < length) {
+        DEBUG_TRACE_byte(length, "cmd_handler_sequence_submit() - Invalid command-length");
+        return CMD_HANDLER_SEQUENCE_STATUS_INVALID_FRAME;
+    }
+
+    if (completion_count == CMD_HANDLER_SEQUENCE_QUEUE_SIZE) {
+        DEBUG_TRACE_byte(sequence, "cmd_handler_sequence_submit() - Queue full");
+        return CMD_HANDLER_SEQUENCE_STATUS_QUEUE_FULL;
+    }
+
+    CMD_HANDLER_SEQUENCE_COMPLETION* p_completion = &completion_queue[
+        (completion_read_index + completion_count) % CMD_HANDLER_SEQUENCE_QUEUE_SIZE
+    ];
+
+    u8 command_id = i_cmd_buffer->get_byte();
+    sequence_command_length = (u8)i_cmd_buffer->get_N_bytes(length - 1, sequence_command);
+
+    p_completion->sequence = sequence;
+    cmd_handler_sequence_process(p_completion, command_id);
+
+    completion_count += 1;
+
+    return CMD_HANDLER_SEQUENCE_STATUS_OK;
+}
+
+// --------------------------------------------------------------------------------
+
+u8 cmd_handler_sequence(const COMMAND_BUFFER_INTERFACE* i_cmd_buffer, const ANSWER_BUFFER_INTERFACE* i_answ_buffer) {
+
+    DEBUG_PASS("cmd_handler_sequence()");
+
+    u8 status = CMD_HANDLER_SEQUENCE_STATUS_OK;
+
+    if (i_cmd_buffer->bytes_available() != 0) {
+        status = cmd_handler_sequence_submit(i_cmd_buffer);
+    }
+
+    u16 response_length = CMD_HANDLER_SEQUENCE_RESPONSE_HEADER;
+    u8 count = 0;
+
+    while (count < completion_count) {
+
+        const CMD_HANDLER_SEQUENCE_COMPLETION* p_completion = &completion_queue[
+            (completion_read_index + count) % CMD_HANDLER_SEQUENCE_QUEUE_SIZE
+        ];
+
+        if (response_length + CMD_HANDLER_SEQUENCE_COMPLETION_HEADER + p_completion->length > CMD_HANDLER_SEQUENCE_MAX_RESPONSE_LENGTH) {
+            break;
+        }
+
+        response_length += CMD_HANDLER_SEQUENCE_COMPLETION_HEADER + p_completion->length;
+        count += 1;
+    }
+
+    i_answ_buffer->start_write();
+    i_answ_buffer->add_byte(CMD_SEQUENCE);
+    i_answ_buffer->add_byte(status);
+    i_answ_buffer->add_byte(count);
+
+    u8 i = 0;
+    for ( ; i < count ; i++) {
+
+        const CMD_HANDLER_SEQUENCE_COMPLETION* p_completion = &completion_queue[completion_read_index];
+
+        i_answ_buffer->add_byte(p_completion->sequence);
+        i_answ_buffer->add_byte(p_completion->length);
+        i_answ_buffer->add_N_bytes(p_completion->length, p_completion->data);
+
+        completion_read_index = (completion_read_index + 1) % CMD_HANDLER_SEQUENCE_QUEUE_SIZE;
+        completion_count -= 1;
+    }
+
+    i_answ_buffer->stop_write();
+
+    // the status of the submit is part of the response
+    return CMD_HANDLER_SEQUENCE_STATUS_OK;
+}
+
+// --------------------------------------------------------------------------------
@@ -25,11 +25,50 @@
 
 //-------------------------------------------------------------------------
 
+#define CMD_BATCH                                       0x20
+#define CMD_SEQUENCE                                    0x21
+
 #define config_LOCAL_COMMAND_HANDLER_TABLE_FUNC_PROTO		\
-	u8 cmd_handler_version(const COMMAND_BUFFER_INTERFACE* i_cmd_buffer, const ANSWER_BUFFER_INTERFACE* i_answ_buffer);
+	u8 cmd_handler_version(const COMMAND_BUFFER_INTERFACE* i_cmd_buffer, const ANSWER_BUFFER_INTERFACE* i_answ_buffer);	\
+	u8 cmd_handler_batch(const COMMAND_BUFFER_INTERFACE* i_cmd_buffer, const ANSWER_BUFFER_INTERFACE* i_answ_buffer);	\
+	u8 cmd_handler_sequence(const COMMAND_BUFFER_INTERFACE* i_cmd_buffer, const ANSWER_BUFFER_INTERFACE* i_answ_buffer);
 
 #define config_LOCAL_COMMAND_HANDLER_TABLE_FUNC_CALLBACK	\
-	{CMD_VERSION, &cmd_handler_version},
+	{CMD_VERSION, &cmd_handler_version},			\
+	{CMD_BATCH, &cmd_handler_batch},			\
+	{CMD_SEQUENCE, &cmd_handler_sequence},
+
+//-------------------------------------------------------------------------
+
+#ifndef CMD_SET_OUTPUT
+#define CMD_SET_OUTPUT                                  0x04
+#endif
+
+#ifndef CMD_GET_OUTPUT
+#define CMD_GET_OUTPUT                                  0x05
+#endif
+
+#ifndef CMD_GET_TEMPERATURE
+#define CMD_GET_TEMPERATURE                             0x07
+#endif
+
+#ifndef CMD_GET_HUMIDITY
+#define CMD_GET_HUMIDITY                                0x08
+#endif
+
+// handlers of RPI_CMD_IO and RPI_CMD_SENSOR inside of CMD_BATCH and CMD_SEQUENCE,
+// routed commands are answered with 0xFF and sent again as single commands
+#define config_BATCH_COMMAND_HANDLER_TABLE_FUNC_PROTO		\
+	u8 rpi_cmd_handler_set_output(const COMMAND_BUFFER_INTERFACE* i_cmd_buffer, const ANSWER_BUFFER_INTERFACE* i_answ_buffer);	\
+	u8 rpi_cmd_handler_get_output(const COMMAND_BUFFER_INTERFACE* i_cmd_buffer, const ANSWER_BUFFER_INTERFACE* i_answ_buffer);	\
+	u8 rpi_cmd_handler_get_temperature(const COMMAND_BUFFER_INTERFACE* i_cmd_buffer, const ANSWER_BUFFER_INTERFACE* i_answ_buffer);	\
+	u8 rpi_cmd_handler_get_humidity(const COMMAND_BUFFER_INTERFACE* i_cmd_buffer, const ANSWER_BUFFER_INTERFACE* i_answ_buffer);
+
+#define config_BATCH_COMMAND_HANDLER_TABLE_FUNC_CALLBACK	\
+	{CMD_SET_OUTPUT, &rpi_cmd_handler_set_output},		\
+	{CMD_GET_OUTPUT, &rpi_cmd_handler_get_output},		\
+	{CMD_GET_TEMPERATURE, &rpi_cmd_handler_get_temperature},	\
+	{CMD_GET_HUMIDITY, &rpi_cmd_handler_get_humidity},
 
 //-------------------------------------------------------------------------
 
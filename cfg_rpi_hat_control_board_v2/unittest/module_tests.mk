@@ -0,0 +1,55 @@
+#-----------------------------------------------------------------------------
+#       Module-tests of the control-board
+#-----------------------------------------------------------------------------
+# The command-handlers are built without the framework, against the
+# dummy-headers of ./stub/include, but together with ../config.h.
+# "../src/config_default.h" of ../config.h is found as stub/src/config_default.h,
+# so the handler-tables of the tests are the tables of the control-board.
+# The framework-handlers of these tables are replaced by stub/unittest_stub.c
+#
+#   make -f module_tests.mk             builds and runs all module-tests
+#   make -f module_tests.mk clean
+#-----------------------------------------------------------------------------
+
+CC          ?= gcc
+BUILD_DIR   ?= module_tests_build
+
+CFLAGS      = -std=gnu99 -Wall -Wextra -O2 -g
+CFLAGS      += -Istub/include -I. -I..
+LDLIBS      =
+
+#-----------------------------------------------------------------------------
+
+STUB_SRCS   = stub/unittest_stub.c
+
+#-----------------------------------------------------------------------------
+
+UNITTESTS   =
+UNITTESTS   += cmd_handler_batch
+UNITTESTS   += cmd_handler_sequence
+
+unittest_cmd_handler_batch_SRCS     = ../cmd_handler_batch.c
+unittest_cmd_handler_batch_SRCS     += ../cmd_handler_sequence.c
+
+unittest_cmd_handler_sequence_SRCS  = ../cmd_handler_sequence.c
+unittest_cmd_handler_sequence_SRCS  += ../cmd_handler_batch.c
+
+#-----------------------------------------------------------------------------
+
+UNITTEST_PROGRAMS = $(addprefix $(BUILD_DIR)/unittest_,$(UNITTESTS))
+
+all: $(UNITTEST_PROGRAMS)
+	@for program in $(UNITTEST_PROGRAMS) ; do \
+		echo "--- $$program" ; \
+		$$program || exit 1 ; \
+	done
+
+.SECONDEXPANSION:
+$(BUILD_DIR)/unittest_%: unittest_%.c $$(unittest_%_SRCS) $(STUB_SRCS) unittest.h ../config.h
+	@mkdir -p $(BUILD_DIR)
+	$(CC) $(CFLAGS) -o $@ unittest_$*.c $(unittest_$*_SRCS) $(STUB_SRCS) $(LDLIBS)
+
+clean:
+	rm -rf $(BUILD_DIR)
+
+.PHONY: all clean
@@ -0,0 +1,27 @@
+#ifndef   _COMMAND_HANDLER_INTERFACE_H_
+#define   _COMMAND_HANDLER_INTERFACE_H_
+
+//-------------------------------------------------------------------------
+
+// This is a dummy-file only to enable the module-tests without the framework
+
+//-------------------------------------------------------------------------
+
+typedef struct COMMAND_BUFFER_INTERFACE_STRUCT {
+	void (*start_read) (void);
+	void (*stop_read) (void);
+	u16 (*bytes_available) (void);
+	u8 (*get_byte) (void);
+	u16 (*get_N_bytes) (u16 num_bytes, u8* p_buffer_to);
+} COMMAND_BUFFER_INTERFACE;
+
+typedef struct ANSWER_BUFFER_INTERFACE_STRUCT {
+	void (*start_write) (void);
+	void (*stop_write) (void);
+	void (*add_byte) (u8 byte);
+	void (*add_N_bytes) (u16 num_bytes, const u8* p_buffer_from);
+} ANSWER_BUFFER_INTERFACE;
+
+//-------------------------------------------------------------------------
+
+#endif // _COMMAND_HANDLER_INTERFACE_H_
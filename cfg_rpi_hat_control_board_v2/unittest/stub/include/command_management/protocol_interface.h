@@ -0,0 +1,14 @@
+#ifndef   _PROTOCOL_INTERFACE_H_
+#define   _PROTOCOL_INTERFACE_H_
+
+//-------------------------------------------------------------------------
+
+// This is a dummy-file only to enable the module-tests without the framework
+
+//-------------------------------------------------------------------------
+
+#define CMD_VERSION                                 0x01
+
+//-------------------------------------------------------------------------
+
+#endif // _PROTOCOL_INTERFACE_H_
@@ -0,0 +1,10 @@
+#ifndef   _BOARD_180920_H_
+#define   _BOARD_180920_H_
+
+//-------------------------------------------------------------------------
+
+// This is a dummy-file only to enable the module-tests without the framework
+
+//-------------------------------------------------------------------------
+
+#endif // _BOARD_180920_H_
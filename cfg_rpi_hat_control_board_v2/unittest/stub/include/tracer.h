@@ -0,0 +1,19 @@
+#ifndef   _TRACER_H_
+#define   _TRACER_H_
+
+//-------------------------------------------------------------------------
+
+// This is a dummy-file only to enable the module-tests without the framework
+
+//-------------------------------------------------------------------------
+
+#define DEBUG_PASS(str)                             do { } while (0)
+#define DEBUG_TRACE_STR(p_str, str)                 do { (void)(p_str); } while (0)
+#define DEBUG_TRACE_byte(byte, str)                 do { (void)(byte); } while (0)
+#define DEBUG_TRACE_word(word, str)                 do { (void)(word); } while (0)
+#define DEBUG_TRACE_long(integer, str)              do { (void)(integer); } while (0)
+#define DEBUG_TRACE_N(length, p_buffer, str)        do { (void)(length); (void)(p_buffer); } while (0)
+
+//-------------------------------------------------------------------------
+
+#endif // _TRACER_H_
@@ -0,0 +1,220 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    unittest_stub.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Stand-ins of the command-handlers of the framework that are
+ *          registered by config.h and the command- and answer-buffer
+ *          of the host-interface.
+ *
+ *          Every handler answers with [cmd][status][data ...]
+ *          like the handlers of the framework.
+ */
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include <string.h>
+
+// --------------------------------------------------------------------------------
+
+#include "command_management/command_handler_interface.h"
+#include "command_management/protocol_interface.h"
+
+// --------------------------------------------------------------------------------
+
+#include "unittest.h"
+
+// --------------------------------------------------------------------------------
+
+#define UNITTEST_STUB_NUM_OUTPUTS                   8
+
+// --------------------------------------------------------------------------------
+
+u8 unittest_output_state[UNITTEST_STUB_NUM_OUTPUTS];
+u8 unittest_temperature = 21;
+u8 unittest_humidity = 45;
+u32 unittest_num_handler_calls = 0;
+
+// --------------------------------------------------------------------------------
+
+static const u8* p_unittest_command = NULL;
+static u16 unittest_command_length = 0;
+static u16 unittest_command_position = 0;
+
+static u8* p_unittest_answer = NULL;
+static u16 unittest_answer_max_length = 0;
+static u16 unittest_answer_length = 0;
+
+static void unittest_start_read(void) {
+    unittest_command_position = 0;
+}
+
+static void unittest_stop_read(void) {
+
+}
+
+static u16 unittest_bytes_available(void) {
+    return unittest_command_length - unittest_command_position;
+}
+
+static u8 unittest_get_byte(void) {
+
+    if (unittest_command_position == unittest_command_length) {
+        return 0;
+    }
+
+    return p_unittest_command[unittest_command_position++];
+}
+
+static u16 unittest_get_N_bytes(u16 num_bytes, u8* p_buffer_to) {
+
+    if (num_bytes > unittest_bytes_available()) {
+        num_bytes = unittest_bytes_available();
+    }
+
+    memcpy(p_buffer_to, p_unittest_command + unittest_command_position, num_bytes);
+    unittest_command_position += num_bytes;
+
+    return num_bytes;
+}
+
+static void unittest_start_write(void) {
+    unittest_answer_length = 0;
+}
+
+static void unittest_stop_write(void) {
+
+}
+
+static void unittest_add_byte(u8 byte) {
+
+    if (unittest_answer_length < unittest_answer_max_length) {
+        p_unittest_answer[unittest_answer_length++] = byte;
+    }
+}
+
+static void unittest_add_N_bytes(u16 num_bytes, const u8* p_buffer_from) {
+
+    u16 i = 0;
+    for ( ; i < num_bytes ; i++) {
+        unittest_add_byte(p_buffer_from[i]);
+    }
+}
+
+static const COMMAND_BUFFER_INTERFACE unittest_command_buffer = {
+    .start_read = &unittest_start_read,
+    .stop_read = &unittest_stop_read,
+    .bytes_available = &unittest_bytes_available,
+    .get_byte = &unittest_get_byte,
+    .get_N_bytes = &unittest_get_N_bytes
+};
+
+static const ANSWER_BUFFER_INTERFACE unittest_answer_buffer = {
+    .start_write = &unittest_start_write,
+    .stop_write = &unittest_stop_write,
+    .add_byte = &unittest_add_byte,
+    .add_N_bytes = &unittest_add_N_bytes
+};
+
+// --------------------------------------------------------------------------------
+
+u16 unittest_run_handler(UNITTEST_COMMAND_HANDLER p_handler, const u8* p_command, u16 length, u8* p_answer, u16 max_length) {
+
+    p_unittest_command = p_command;
+    unittest_command_length = length;
+    unittest_command_position = 0;
+
+    p_unittest_answer = p_answer;
+    unittest_answer_max_length = max_length;
+    unittest_answer_length = 0;
+
+    p_handler(&unittest_command_buffer, &unittest_answer_buffer);
+
+    return unittest_answer_length;
+}
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Writes [cmd][status=0][data ...]
+ *
+ */
+static u8 unittest_answer(const ANSWER_BUFFER_INTERFACE* i_answ_buffer, u8 command_id, const u8* p_data, u16 length) {
+
+    unittest_num_handler_calls += 1;
+
+    i_answ_buffer->start_write();
+    i_answ_buffer->add_byte(command_id);
+    i_answ_buffer->add_byte(0);
+    i_answ_buffer->add_N_bytes(length, p_data);
+    i_answ_buffer->stop_write();
+
+    return 0;
+}
+
+u8 cmd_handler_version(const COMMAND_BUFFER_INTERFACE* i_cmd_buffer, const ANSWER_BUFFER_INTERFACE* i_answ_buffer) {
+
+    (void) i_cmd_buffer;
+
+    const u8 version[] = {5, 10};
+    return unittest_answer(i_answ_buffer, CMD_VERSION, version, sizeof(version));
+}
+
+/**
+ * @brief [output][state][duration:4]
+ *
+ */
+u8 rpi_cmd_handler_set_output(const COMMAND_BUFFER_INTERFACE* i_cmd_buffer, const ANSWER_BUFFER_INTERFACE* i_answ_buffer) {
+
+    u8 output = i_cmd_buffer->get_byte();
+    u8 state = i_cmd_buffer->get_byte();
+
+    if (output < UNITTEST_STUB_NUM_OUTPUTS) {
+        unittest_output_state[output] = state;
+    }
+
+    return unittest_answer(i_answ_buffer, CMD_SET_OUTPUT, NULL, 0);
+}
+
+/**
+ * @brief [output]
+ *
+ */
+u8 rpi_cmd_handler_get_output(const COMMAND_BUFFER_INTERFACE* i_cmd_buffer, const ANSWER_BUFFER_INTERFACE* i_answ_buffer) {
+
+    u8 output = i_cmd_buffer->get_byte();
+    u8 state = output < UNITTEST_STUB_NUM_OUTPUTS ? unittest_output_state[output] : 0;
+
+    return unittest_answer(i_answ_buffer, CMD_GET_OUTPUT, &state, 1);
+}
+
+u8 rpi_cmd_handler_get_temperature(const COMMAND_BUFFER_INTERFACE* i_cmd_buffer, const ANSWER_BUFFER_INTERFACE* i_answ_buffer) {
+
+    (void) i_cmd_buffer;
+    return unittest_answer(i_answ_buffer, CMD_GET_TEMPERATURE, &unittest_temperature, 1);
+}
+
+u8 rpi_cmd_handler_get_humidity(const COMMAND_BUFFER_INTERFACE* i_cmd_buffer, const ANSWER_BUFFER_INTERFACE* i_answ_buffer) {
+
+    (void) i_cmd_buffer;
+    return unittest_answer(i_answ_buffer, CMD_GET_HUMIDITY, &unittest_humidity, 1);
+}
+
+// --------------------------------------------------------------------------------
@@ -0,0 +1,147 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    unittest.h
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Minimal test-macros of the module-tests of the control-board.
+ *
+ *          Every unittest_<module>.c is a program of its own that runs
+ *          all of its test-cases and returns 0 if all of them passed.
+ *          The modules are built against the dummy-headers of ./stub,
+ *          see module_tests.mk.
+ *
+ *              static void unittest_xyz(void) {
+ *                  UT_ASSERT(shc_xyz() == 1);
+ *              }
+ *
+ *              int main(void) {
+ *                  UT_RUN(unittest_xyz);
+ *                  return UT_RESULT();
+ *              }
+ */
+
+// --------------------------------------------------------------------------------
+
+#ifndef _H_unittest_
+#define _H_unittest_
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+
+// --------------------------------------------------------------------------------
+
+#include "command_management/command_handler_interface.h"
+
+// --------------------------------------------------------------------------------
+
+static u32 unittest_num_tests __attribute__((unused)) = 0;
+static u32 unittest_num_failed __attribute__((unused)) = 0;
+static u8 unittest_actual_failed __attribute__((unused)) = 0;
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Aborts the actual test-case if the condition is false
+ *
+ */
+#define UT_ASSERT(condition)                                                            \
+    do {                                                                                \
+        if (!(condition)) {                                                             \
+            printf("    %s:%d: %s\n", __FILE__, __LINE__, #condition);                  \
+            unittest_actual_failed = 1;                                                 \
+            return;                                                                     \
+        }                                                                               \
+    } while (0)
+
+/**
+ * @brief Aborts the actual test-case if the two integers are not equal
+ *
+ */
+#define UT_ASSERT_EQUAL(expected, actual)                                               \
+    do {                                                                                \
+        long long ut_expected = (long long)(expected);                                  \
+        long long ut_actual = (long long)(actual);                                      \
+        if (ut_expected != ut_actual) {                                                 \
+            printf("    %s:%d: %s == %lld, expected %lld\n",                            \
+                __FILE__, __LINE__, #actual, ut_actual, ut_expected);                   \
+            unittest_actual_failed = 1;                                                 \
+            return;                                                                     \
+        }                                                                               \
+    } while (0)
+
+/**
+ * @brief Runs a single test-case
+ *
+ */
+#define UT_RUN(test_case)                                                               \
+    do {                                                                                \
+        unittest_actual_failed = 0;                                                     \
+        test_case();                                                                    \
+        unittest_num_tests += 1;                                                        \
+        if (unittest_actual_failed) {                                                   \
+            unittest_num_failed += 1;                                                   \
+        }                                                                               \
+        printf("%s - %s\n", unittest_actual_failed ? "FAILED" : "PASSED", #test_case);  \
+    } while (0)
+
+/**
+ * @brief Prints the summary, use as return-value of main()
+ *
+ */
+#define UT_RESULT()                                                                     \
+    (printf("%u of %u test-cases passed\n",                                             \
+        unittest_num_tests - unittest_num_failed, unittest_num_tests),                  \
+     unittest_num_failed == 0 ? 0 : 1)
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief Signature of a command-handler of the framework
+ *
+ */
+typedef u8 (*UNITTEST_COMMAND_HANDLER) (const COMMAND_BUFFER_INTERFACE* i_cmd_buffer, const ANSWER_BUFFER_INTERFACE* i_answ_buffer);
+
+/**
+ * @brief State of the stand-ins of the framework-handlers, see stub/unittest_stub.c
+ *
+ */
+extern u8 unittest_output_state[];
+extern u8 unittest_temperature;
+extern u8 unittest_humidity;
+extern u32 unittest_num_handler_calls;
+
+/**
+ * @brief Runs the given handler like the host-interface of the framework
+ *
+ * @param p_handler the command-handler
+ * @param p_command the command behind its command-id
+ * @param length number of bytes of p_command
+ * @param p_answer the answer of the handler is written into this buffer
+ * @param max_length size of p_answer
+ * @return number of bytes of the answer
+ */
+u16 unittest_run_handler(UNITTEST_COMMAND_HANDLER p_handler, const u8* p_command, u16 length, u8* p_answer, u16 max_length);
+
+// --------------------------------------------------------------------------------
+
+#endif // _H_unittest_
+
+// --------------------------------------------------------------------------------
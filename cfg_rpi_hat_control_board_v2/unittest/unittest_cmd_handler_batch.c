@@ -0,0 +1,217 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    unittest_cmd_handler_batch.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Module-test of the batch-frame CMD_BATCH with the
+ *          handler-table of config.h. The commands are the
+ *          reports of cfg_SHC_CLIENT/cfg/smart_home_report_file.txt
+ *
+ * @see     cmd_handler_batch.c
+ */
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include <string.h>
+#include <unistd.h>
+
+// --------------------------------------------------------------------------------
+
+#include "unittest.h"
+
+// --------------------------------------------------------------------------------
+
+u8 cmd_handler_batch(const COMMAND_BUFFER_INTERFACE* i_cmd_buffer, const ANSWER_BUFFER_INTERFACE* i_answ_buffer);
+
+// --------------------------------------------------------------------------------
+
+#define UNITTEST_STATUS_OK                          0x00
+#define UNITTEST_STATUS_INVALID_FRAME               0x01
+#define UNITTEST_STATUS_UNKNOWN_COMMAND             0xFF
+
+// --------------------------------------------------------------------------------
+
+static u8 answer[128];
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief rpt_light_01=com:020501 and rpt_temperature=com:0107,
+ * every response is [length][cmd][status][data]
+ *
+ */
+static void unittest_reports(void) {
+
+    const u8 command[] = {
+        2,
+        0x02, 0x05, 0x01,
+        0x01, 0x07
+    };
+
+    const u8 expected[] = {
+        CMD_BATCH, UNITTEST_STATUS_OK, 2,
+        0x03, 0x05, UNITTEST_STATUS_OK, 0x01,
+        0x03, 0x07, UNITTEST_STATUS_OK, 21
+    };
+
+    unittest_output_state[1] = 1;
+    unittest_temperature = 21;
+
+    u16 length = unittest_run_handler(&cmd_handler_batch, command, sizeof(command), answer, sizeof(answer));
+
+    UT_ASSERT_EQUAL(sizeof(expected), length);
+    UT_ASSERT(memcmp(expected, answer, sizeof(expected)) == 0);
+}
+
+/**
+ * @brief cmd_light_02_on=com:0704020100000000 followed by rpt_light_02
+ *
+ */
+static void unittest_command_and_report(void) {
+
+    const u8 command[] = {
+        2,
+        0x07, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x05, 0x02
+    };
+
+    const u8 expected[] = {
+        CMD_BATCH, UNITTEST_STATUS_OK, 2,
+        0x02, 0x04, UNITTEST_STATUS_OK,
+        0x03, 0x05, UNITTEST_STATUS_OK, 0x01
+    };
+
+    unittest_output_state[2] = 0;
+
+    u16 length = unittest_run_handler(&cmd_handler_batch, command, sizeof(command), answer, sizeof(answer));
+
+    UT_ASSERT_EQUAL(sizeof(expected), length);
+    UT_ASSERT(memcmp(expected, answer, sizeof(expected)) == 0);
+}
+
+/**
+ * @brief Commands without handler inside of a batch, e.g. a routed command
+ * or a nested batch, are answered with [cmd][0xFF]
+ *
+ */
+static void unittest_unknown_command(void) {
+
+    const u8 command[] = {
+        3,
+        0x02, 0x30, 0x01,
+        0x02, CMD_BATCH, 0x00,
+        0x01, 0x08
+    };
+
+    const u8 expected[] = {
+        CMD_BATCH, UNITTEST_STATUS_OK, 3,
+        0x02, 0x30, UNITTEST_STATUS_UNKNOWN_COMMAND,
+        0x02, CMD_BATCH, UNITTEST_STATUS_UNKNOWN_COMMAND,
+        0x03, 0x08, UNITTEST_STATUS_OK, 45
+    };
+
+    unittest_humidity = 45;
+
+    u16 length = unittest_run_handler(&cmd_handler_batch, command, sizeof(command), answer, sizeof(answer));
+
+    UT_ASSERT_EQUAL(sizeof(expected), length);
+    UT_ASSERT(memcmp(expected, answer, sizeof(expected)) == 0);
+}
+
+/**
+ * @brief [count] of the response is the number of responses
+ * if the batch is truncated by an invalid command-length
+ *
+ */
+static void unittest_invalid_length(void) {
+
+    const u8 command[] = {
+        3,
+        0x01, 0x07,
+        0x09, 0x05, 0x01
+    };
+
+    const u8 expected[] = {
+        CMD_BATCH, UNITTEST_STATUS_OK, 1,
+        0x03, 0x07, UNITTEST_STATUS_OK, 21
+    };
+
+    u16 length = unittest_run_handler(&cmd_handler_batch, command, sizeof(command), answer, sizeof(answer));
+
+    UT_ASSERT_EQUAL(sizeof(expected), length);
+    UT_ASSERT(memcmp(expected, answer, sizeof(expected)) == 0);
+}
+
+/**
+ * @brief A batch without [count]
+ *
+ */
+static void unittest_empty_frame(void) {
+
+    const u8 expected[] = {
+        CMD_BATCH, UNITTEST_STATUS_INVALID_FRAME, 0
+    };
+
+    u16 length = unittest_run_handler(&cmd_handler_batch, NULL, 0, answer, sizeof(answer));
+
+    UT_ASSERT_EQUAL(sizeof(expected), length);
+    UT_ASSERT(memcmp(expected, answer, sizeof(expected)) == 0);
+}
+
+/**
+ * @brief Responses that do not fit into the response of the batch
+ * are not part of [count]
+ *
+ */
+static void unittest_response_too_long(void) {
+
+    u8 command[1 + 40 * 2];
+    command[0] = 40;
+
+    u8 i = 0;
+    for ( ; i < 40 ; i++) {
+        command[1 + i * 2] = 0x01;
+        command[2 + i * 2] = 0x07;
+    }
+
+    u16 length = unittest_run_handler(&cmd_handler_batch, command, sizeof(command), answer, sizeof(answer));
+
+    // 96 bytes of responses of 4 bytes each
+    UT_ASSERT_EQUAL(24, answer[2]);
+    UT_ASSERT_EQUAL(3 + 24 * 4, length);
+}
+
+// --------------------------------------------------------------------------------
+
+int main(void) {
+
+    alarm(60);
+
+    UT_RUN(unittest_reports);
+    UT_RUN(unittest_command_and_report);
+    UT_RUN(unittest_unknown_command);
+    UT_RUN(unittest_invalid_length);
+    UT_RUN(unittest_empty_frame);
+    UT_RUN(unittest_response_too_long);
+
+    return UT_RESULT();
+}
+
+// --------------------------------------------------------------------------------
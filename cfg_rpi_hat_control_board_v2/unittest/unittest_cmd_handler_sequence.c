@@ -0,0 +1,186 @@
+/**
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * @file    unittest_cmd_handler_sequence.c
+ * @author  Sebastian Lesse
+ * @date    2026 / 10 / 16
+ * @brief   Module-test of the windowed host-protocol CMD_SEQUENCE with
+ *          the handler-table of config.h. The commands are the commands
+ *          and reports of cfg_SHC_CLIENT/cfg/
+ *
+ * @see     cmd_handler_sequence.c
+ */
+
+// --------------------------------------------------------------------------------
+
+#include "config.h"
+
+// --------------------------------------------------------------------------------
+
+#include <string.h>
+#include <unistd.h>
+
+// --------------------------------------------------------------------------------
+
+#include "unittest.h"
+
+// --------------------------------------------------------------------------------
+
+u8 cmd_handler_sequence(const COMMAND_BUFFER_INTERFACE* i_cmd_buffer, const ANSWER_BUFFER_INTERFACE* i_answ_buffer);
+
+// --------------------------------------------------------------------------------
+
+#define UNITTEST_STATUS_OK                          0x00
+#define UNITTEST_STATUS_INVALID_FRAME               0x01
+#define UNITTEST_STATUS_UNKNOWN_COMMAND             0xFF
+
+// --------------------------------------------------------------------------------
+
+static u8 answer[128];
+
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief cmd_light_01_on=com:0704010100000000 is completed
+ * with the acknowledge of its own submit
+ *
+ */
+static void unittest_command(void) {
+
+    const u8 command[] = {
+        0x11, 0x07, 0x04, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00
+    };
+
+    const u8 expected[] = {
+        CMD_SEQUENCE, UNITTEST_STATUS_OK, 1,
+        0x11, 0x02, 0x04, UNITTEST_STATUS_OK
+    };
+
+    unittest_output_state[1] = 0;
+
+    u16 length = unittest_run_handler(&cmd_handler_sequence, command, sizeof(command), answer, sizeof(answer));
+    u8 state = unittest_output_state[1];
+
+    UT_ASSERT_EQUAL(1, state);
+    UT_ASSERT_EQUAL(sizeof(expected), length);
+    UT_ASSERT(memcmp(expected, answer, sizeof(expected)) == 0);
+}
+
+/**
+ * @brief rpt_temperature=com:0107, followed by a poll without completions
+ *
+ */
+static void unittest_report_and_poll(void) {
+
+    const u8 command[] = {
+        0x12, 0x01, 0x07
+    };
+
+    const u8 expected[] = {
+        CMD_SEQUENCE, UNITTEST_STATUS_OK, 1,
+        0x12, 0x03, 0x07, UNITTEST_STATUS_OK, 21
+    };
+
+    const u8 expected_poll[] = {
+        CMD_SEQUENCE, UNITTEST_STATUS_OK, 0
+    };
+
+    unittest_temperature = 21;
+
+    u8 poll_answer[16];
+
+    u16 length = unittest_run_handler(&cmd_handler_sequence, command, sizeof(command), answer, sizeof(answer));
+    u16 poll_length = unittest_run_handler(&cmd_handler_sequence, NULL, 0, poll_answer, sizeof(poll_answer));
+
+    UT_ASSERT_EQUAL(sizeof(expected), length);
+    UT_ASSERT(memcmp(expected, answer, sizeof(expected)) == 0);
+    UT_ASSERT_EQUAL(sizeof(expected_poll), poll_length);
+    UT_ASSERT(memcmp(expected_poll, poll_answer, sizeof(expected_poll)) == 0);
+}
+
+/**
+ * @brief A batch or a command without handler, e.g. a routed command,
+ * is completed with [cmd][0xFF]
+ *
+ */
+static void unittest_not_supported(void) {
+
+    const u8 batch[] = {
+        0x13, 0x04, CMD_BATCH, 0x01, 0x01, 0x07
+    };
+
+    const u8 routed[] = {
+        0x14, 0x02, 0x30, 0x01
+    };
+
+    const u8 expected_batch[] = {
+        CMD_SEQUENCE, UNITTEST_STATUS_OK, 1,
+        0x13, 0x02, CMD_BATCH, UNITTEST_STATUS_UNKNOWN_COMMAND
+    };
+
+    const u8 expected_routed[] = {
+        CMD_SEQUENCE, UNITTEST_STATUS_OK, 1,
+        0x14, 0x02, 0x30, UNITTEST_STATUS_UNKNOWN_COMMAND
+    };
+
+    u8 routed_answer[16];
+
+    u32 num_handler_calls = unittest_num_handler_calls;
+
+    u16 length = unittest_run_handler(&cmd_handler_sequence, batch, sizeof(batch), answer, sizeof(answer));
+    u16 routed_length = unittest_run_handler(&cmd_handler_sequence, routed, sizeof(routed), routed_answer, sizeof(routed_answer));
+
+    UT_ASSERT_EQUAL(num_handler_calls, unittest_num_handler_calls);
+    UT_ASSERT_EQUAL(sizeof(expected_batch), length);
+    UT_ASSERT(memcmp(expected_batch, answer, sizeof(expected_batch)) == 0);
+    UT_ASSERT_EQUAL(sizeof(expected_routed), routed_length);
+    UT_ASSERT(memcmp(expected_routed, routed_answer, sizeof(expected_routed)) == 0);
+}
+
+/**
+ * @brief A submit with an invalid command-length is rejected
+ *
+ */
+static void unittest_invalid_frame(void) {
+
+    const u8 command[] = {
+        0x15, 0x05, 0x07
+    };
+
+    const u8 expected[] = {
+        CMD_SEQUENCE, UNITTEST_STATUS_INVALID_FRAME, 0
+    };
+
+    u16 length = unittest_run_handler(&cmd_handler_sequence, command, sizeof(command), answer, sizeof(answer));
+
+    UT_ASSERT_EQUAL(sizeof(expected), length);
+    UT_ASSERT(memcmp(expected, answer, sizeof(expected)) == 0);
+}
+
+// --------------------------------------------------------------------------------
+
+int main(void) {
+
+    alarm(60);
+
+    UT_RUN(unittest_command);
+    UT_RUN(unittest_report_and_poll);
+    UT_RUN(unittest_not_supported);
+    UT_RUN(unittest_invalid_frame);
+
+    return UT_RESULT();
+}
+
+// --------------------------------------------------------------------------------